@@ -0,0 +1,48 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsPixelData.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Encodes and decodes BC1, BC1a, BC2, BC3, BC4 and BC5 compressed pixel data without
+	 *			relying on external libraries.
+	 *
+	 *			Rows of 4x4 blocks are processed in parallel if the task scheduler is running.
+	 */
+	class BS_CORE_EXPORT BlockCompression
+	{
+	public:
+		/**
+		 * @brief	Compresses the provided pixels. Destination must be in one of the supported
+		 *			compressed formats and have the same size as the source.
+		 *
+		 * @param	src			Data to compress, in any uncompressed format that can be converted to R8G8B8A8.
+		 * @param	dst			Buffer to receive the compressed data.
+		 * @param	highQuality	If true, block endpoints are fitted along the principal axis of the block
+		 *						colors and iteratively refined, which greatly reduces error but is
+		 *						several times slower. Otherwise endpoints are taken from the bounding
+		 *						box of the block colors.
+		 */
+		static void compress(const PixelData& src, PixelData& dst, bool highQuality);
+
+		/**
+		 * @brief	Decompresses the provided compressed pixels. Source must be in one of the supported
+		 *			compressed formats and destination must have the same size.
+		 *
+		 * @param	src			Compressed data to decompress.
+		 * @param	dst			Buffer to receive the decompressed data, in any uncompressed format that
+		 *						R8G8B8A8 can be converted to.
+		 */
+		static void decompress(const PixelData& src, PixelData& dst);
+
+		/**
+		 * @brief	Checks can data in the provided compressed format be encoded and decoded.
+		 */
+		static bool isSupported(PixelFormat format);
+	};
+}
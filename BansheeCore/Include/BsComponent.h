@@ -41,6 +41,7 @@ namespace BansheeEngine
 
 	protected:
 		friend class SceneObject;
+		friend class CoreSceneManager;
 
 		Component(const HSceneObject& parent);
 		virtual ~Component();
@@ -55,6 +56,9 @@ namespace BansheeEngine
 	protected:
 		HSceneObject mParent;
 
+	private:
+		UINT32 mStorageIdx; /**< Index in the scene manager's list of components of the same type. */
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -64,6 +68,6 @@ namespace BansheeEngine
 		virtual RTTITypeBase* getRTTI() const;
 
 	protected:
-		Component() {} // Serialization only
+		Component() :mStorageIdx(0) {} // Serialization only
 	};
 }
\ No newline at end of file
@@ -0,0 +1,56 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Allocates memory for components of a single type from large blocks, so components
+	 *			of the same type end up next to each other in memory and can be iterated over
+	 *			without jumping all over the heap.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT ComponentPool
+	{
+	public:
+		/**
+		 * @brief	Constructs a new pool.
+		 *
+		 * @param	elementSize			Size of a single component in bytes.
+		 * @param	elementsPerBlock	Number of components to allocate memory for at once.
+		 */
+		ComponentPool(UINT32 elementSize, UINT32 elementsPerBlock = 256);
+		~ComponentPool();
+
+		/**
+		 * @brief	Allocates memory for a single component.
+		 */
+		void* allocate();
+
+		/**
+		 * @brief	Releases memory previously allocated with ::allocate.
+		 */
+		void free(void* data);
+
+		/**
+		 * @brief	Returns the pool used for components of the specified type and size.
+		 *
+		 * @note	Pools are created on first use and never destroyed, since components may be
+		 *			released by their last owner after the engine modules shut down.
+		 */
+		static ComponentPool& getPool(UINT32 typeId, UINT32 elementSize);
+
+	private:
+		static const UINT32 ALIGNMENT;
+
+		UINT32 mElementSize;
+		UINT32 mElementsPerBlock;
+		UINT32 mNumUsedInLastBlock;
+		Vector<UINT8*> mBlocks;
+		void* mFreeList;
+	};
+}
@@ -8,6 +8,7 @@
 #include "BsCoreThreadAccessor.h"
 #include "BsRenderWindow.h"
 #include "BsEvent.h"
+#include "BsPath.h"
 
 namespace BansheeEngine
 {
@@ -25,6 +26,8 @@ namespace BansheeEngine
 		RENDER_WINDOW_DESC primaryWindowDesc; /**< Describes the window to create during start-up. */
 
 		Vector<String> importers; /**< A list of importer plugins to load. */
+
+		Path importCacheFolder; /**< Folder in which to cache imported resources. Empty to disable the import cache. */
 	};
 
 	/**
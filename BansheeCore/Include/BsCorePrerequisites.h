@@ -106,6 +106,7 @@ namespace BansheeEngine
 	class BlendState;
 	class GpuParamBlock;
 	class GpuParamBlockBuffer;
+	class GpuParamBlockAllocator;
 	class GpuParams;
 	struct GpuParamDesc;
 	struct GpuParamDataDesc;
@@ -116,7 +117,9 @@ namespace BansheeEngine
 	class CoreObject;
 	class ImportOptions;
 	struct FontData;
+	class TextData;
 	class GameObject;
+	class GameObjectHandleBase;
 	class GpuResource;
 	class GpuResourceData;
 	struct RenderOperation;
@@ -145,12 +148,16 @@ namespace BansheeEngine
 	class Resource;
 	class Resources;
 	class ResourceManifest;
+	class ResourcePackage;
+	class Guid;
 	class Texture;
 	class Mesh;
 	class MeshBase;
 	class TransientMesh;
 	class MeshHeap;
 	class Font;
+	class GlyphCache;
+	class GlyphRasterizer;
 	class OSDropTarget;
 	// Scene
 	class SceneObject;
@@ -219,6 +226,8 @@ namespace BansheeEngine
 	typedef std::shared_ptr<ImportOptions> ImportOptionsPtr;
 	typedef std::shared_ptr<const ImportOptions> ConstImportOptionsPtr;
 	typedef std::shared_ptr<Font> FontPtr;
+	typedef std::shared_ptr<GlyphCache> GlyphCachePtr;
+	typedef std::shared_ptr<GlyphRasterizer> GlyphRasterizerPtr;
 	typedef std::shared_ptr<GpuResource> GpuResourcePtr;
 	typedef std::shared_ptr<VertexDataDesc> VertexDataDescPtr;
 	typedef CoreThreadAccessor<CommandQueueNoSync> CoreAccessor;
@@ -229,6 +238,7 @@ namespace BansheeEngine
 	typedef std::shared_ptr<TimerQuery> TimerQueryPtr;
 	typedef std::shared_ptr<OcclusionQuery> OcclusionQueryPtr;
 	typedef std::shared_ptr<ResourceManifest> ResourceManifestPtr;
+	typedef std::shared_ptr<ResourcePackage> ResourcePackagePtr;
 	typedef std::shared_ptr<VideoModeInfo> VideoModeInfoPtr;
 	typedef std::shared_ptr<DrawList> DrawListPtr;
 	typedef std::shared_ptr<RenderQueue> RenderQueuePtr;
@@ -299,7 +309,9 @@ namespace BansheeEngine
 		TID_ResourceManifest = 1067,
 		TID_ResourceManifestEntry = 1068,
 		TID_EmulatedParamBlock = 1069,
-		TID_TextureImportOptions = 1070
+		TID_TextureImportOptions = 1070,
+		TID_UUID = 1071,
+		TID_MeshImportOptions = 1072
 	};
 }
 
@@ -308,6 +320,7 @@ namespace BansheeEngine
 /************************************************************************/
 
 #include "BsResourceHandle.h"
+#include "BsLog.h"
 
 namespace BansheeEngine
 {
@@ -368,6 +381,7 @@ namespace BansheeEngine
 
 		static void onThreadEnded(const String& name)
 		{
+			Log::_endThread();
 			MemStack::endThread();
 		}
 	};
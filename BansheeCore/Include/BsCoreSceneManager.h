@@ -6,6 +6,8 @@
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
 #include "BsGameObject.h"
+#include "BsComponent.h"
+#include "BsTaskScheduler.h"
 
 namespace BansheeEngine
 {
@@ -14,6 +16,9 @@ namespace BansheeEngine
 	 * 			for finding objects. This is just the base class with basic query 
 	 *			functionality. You should override it with your own version that
 	 * 			implements a spatial data structure of your choice for faster queries.
+	 *
+	 *			Active components are kept in a separate list per type, which allows all components
+	 *			of a certain type to be iterated over without traversing the scene graph.
 	 */
 	class BS_CORE_EXPORT CoreSceneManager : public Module<CoreSceneManager>
 	{
@@ -33,6 +38,91 @@ namespace BansheeEngine
 		 */
 		virtual void _update();
 
+		/**
+		 * @brief	Calls the provided function for every active component of type T. Components of types
+		 *			derived from T are not included.
+		 *
+		 * @note	Components may be added or destroyed from within the function. Components added during
+		 *			iteration are visited as well, and destroyed components are skipped.
+		 */
+		template<class T, class Func>
+		void forEachComponent(Func func)
+		{
+			ComponentList* list = findComponentList(T::getRTTIStatic()->getRTTIId());
+			if(list == nullptr)
+				return;
+
+			mIterationDepth++;
+
+			// Components can be added during iteration, so the list size and storage may change
+			for(UINT32 i = 0; i < (UINT32)list->components.size(); i++)
+			{
+				Component* component = list->components[i];
+				if(component != nullptr)
+					func(*static_cast<T*>(component));
+			}
+
+			endIteration();
+		}
+
+		/**
+		 * @brief	Calls the provided function for every active component of type T, from multiple
+		 *			threads in parallel. Components of types derived from T are not included.
+		 *
+		 * @param	func		Function to call. Must be safe to call concurrently for different components,
+		 *						and must not add or destroy any components.
+		 * @param	batchSize	Number of components processed by a single task.
+		 */
+		template<class T, class Func>
+		void forEachComponentParallel(Func func, UINT32 batchSize = 1024)
+		{
+			ComponentList* list = findComponentList(T::getRTTIStatic()->getRTTIId());
+			if(list == nullptr)
+				return;
+
+			mIterationDepth++;
+
+			Component** components = list->components.data();
+			UINT32 numComponents = (UINT32)list->components.size();
+
+			Vector<TaskPtr> tasks;
+			for(UINT32 start = 0; start < numComponents; start += batchSize)
+			{
+				UINT32 end = std::min(start + batchSize, numComponents);
+
+				TaskPtr task = Task::create("ComponentIteration", [&func, components, start, end]()
+				{
+					for(UINT32 i = start; i < end; i++)
+					{
+						if(components[i] != nullptr)
+							func(*static_cast<T*>(components[i]));
+					}
+				});
+
+				TaskScheduler::instance().addTask(task);
+				tasks.push_back(task);
+			}
+
+			for(auto& task : tasks)
+				task->wait();
+
+			endIteration();
+		}
+
+		/**
+		 * @brief	Returns the number of active components of type T. Components of types derived from T 
+		 *			are not included.
+		 */
+		template<class T>
+		UINT32 getNumComponents() const
+		{
+			auto iterFind = mComponentListsPerType.find(T::getRTTIStatic()->getRTTIId());
+			if(iterFind == mComponentListsPerType.end())
+				return 0;
+
+			return (UINT32)iterFind->second->components.size() - iterFind->second->numRemoved;
+		}
+
 	protected:
 		friend class SceneObject;
 
@@ -48,16 +138,51 @@ namespace BansheeEngine
 
 		/**
 		 * @brief	SceneObjects call this when they have a component added to them.
+		 *
+		 * @note	Implementations must call the base method, which registers the component in its type list.
 		 */
 		virtual void notifyComponentAdded(const HComponent& component);
 
 		/**
 		 * @brief	SceneObjects call this when they have a component removed from them.
+		 *
+		 * @note	Implementations must call the base method, which unregisters the component from its type list.
 		 */
 		virtual void notifyComponentRemoved(const HComponent& component);
 
+	private:
+		/**
+		 * @brief	Active components of a single type.
+		 */
+		struct ComponentList
+		{
+			ComponentList()
+				:numRemoved(0)
+			{ }
+
+			Vector<Component*> components;
+			UINT32 numRemoved; /**< Number of null entries left by components removed during iteration. */
+		};
+
+		/**
+		 * @brief	Returns a list of components of the specified type, or null if no components of that type
+		 *			were ever added.
+		 */
+		ComponentList* findComponentList(UINT32 typeId) const;
+
+		/**
+		 * @brief	Finishes iteration started by incrementing the iteration depth. Once the outermost
+		 *			iteration ends, entries of components removed during iteration are cleaned up.
+		 */
+		void endIteration();
+
 	protected:
 		HSceneObject mRootNode;
+
+	private:
+		UnorderedMap<UINT32, ComponentList*> mComponentListsPerType;
+		Vector<ComponentList*> mComponentLists;
+		UINT32 mIterationDepth;
 	};
 
 	/**
@@ -95,6 +95,9 @@ namespace BansheeEngine
 		/** @copydoc RenderSystem::drawIndexed() */
 		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount);
 
+		/** @copydoc RenderSystem::drawIndexedInstanced() */
+		void drawIndexedInstanced(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount);
+
 		/**
 		 * @copydoc RenderSystem::writeSubresource()
 		 *
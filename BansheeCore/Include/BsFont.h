@@ -16,15 +16,64 @@ namespace BansheeEngine
 	 */
 	struct BS_CORE_EXPORT FontData : public IReflectable
 	{
+		FontData();
+		FontData(const FontData& other);
+		FontData& operator=(const FontData& other);
+
 		/**
 		 * @brief	Returns a character description for the character with the specified ID.
 		 */
 		const CHAR_DESC& getCharDesc(UINT32 charId) const;
 
+		/**
+		 * @brief	Returns the kerning amount to apply between two consecutive characters, in pixels.
+		 */
+		INT32 getKerning(UINT32 charId, UINT32 nextCharId) const;
+
+		/**
+		 * @brief	Returns the number of textures the characters are stored in.
+		 */
+		UINT32 getNumTexturePages() const;
+
+		/**
+		 * @brief	Returns the texture with the specified index, as referenced by CHAR_DESC::page.
+		 */
+		const HTexture& getTexturePage(UINT32 idx) const;
+
+		/**
+		 * @brief	Returns the cache that renders characters on demand, or null if all characters
+		 *			were rendered when the font was imported.
+		 */
+		const GlyphCachePtr& getGlyphCache() const { return mGlyphCache; }
+
+		/**
+		 * @brief	Sets the cache that renders characters on demand. Character lookups are routed
+		 *			to the cache instead of ::fontDesc and ::texturePages.
+		 *
+		 * @note	Internal method. Called by Font when initializing a dynamic font.
+		 */
+		void _setGlyphCache(const GlyphCachePtr& glyphCache);
+
+		/**
+		 * @brief	Rebuilds character and kerning lookup tables from data in ::fontDesc. Must be called
+		 *			whenever ::fontDesc changes.
+		 *
+		 * @note	Called automatically on copy and when deserializing.
+		 */
+		void buildLookupTables();
+
 		UINT32 size; /**< Font size for which the data is contained. */
 		FONT_DESC fontDesc; /**< Font description containing per-character and general font data. */
 		Vector<HTexture> texturePages; /**< Textures in which the characters are stored. */
 
+	private:
+		static const UINT32 MAX_DIRECT_LOOKUP_CHAR = 0xFFFF;
+
+		Vector<const CHAR_DESC*> mDirectCharLookup; /**< Characters in the Basic Multilingual Plane, indexed by character ID. */
+		UnorderedMap<UINT32, const CHAR_DESC*> mExtendedCharLookup; /**< Characters outside of the Basic Multilingual Plane. */
+		UnorderedMap<UINT64, INT32> mKerningLookup; /**< Kerning amounts keyed by character ID pair. */
+		GlyphCachePtr mGlyphCache;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -66,6 +115,17 @@ namespace BansheeEngine
 		 */
 		INT32 getClosestAvailableSize(UINT32 size) const;
 
+		/**
+		 * @brief	Checks does the font render its characters on demand at runtime, instead
+		 *			of using textures generated on import.
+		 */
+		bool isDynamic() const { return !mFontFileData.empty(); }
+
+		/**
+		 * @copydoc	Resource::getResourceDependencies
+		 */
+		void getResourceDependencies(Vector<HResource>& dependencies) const;
+
 		/************************************************************************/
 		/* 								STATICS		                     		*/
 		/************************************************************************/
@@ -82,14 +142,32 @@ namespace BansheeEngine
 		 */
 		static FontPtr _createPtr(const Vector<FontData>& fontInitData);
 
+		/**
+		 * @brief	Creates a new font that renders its characters on demand from the provided font file contents.
+		 *
+		 * @note	Internal method.
+		 *
+		 * @see		FontManager::createDynamic
+		 */
+		static FontPtr _createDynamicPtr(const Vector<UINT8>& fontFileData, const Vector<UINT32>& fontSizes, UINT32 dpi, bool antialiasing);
+
 	protected:
 		friend class FontManager;
 
 		Font();
 
 	private:
+		/**
+		 * @brief	Creates glyph caches for all sizes of a dynamic font.
+		 */
+		void createGlyphCaches();
+
 		Map<UINT32, FontData> mFontDataPerSize;
 
+		Vector<UINT8> mFontFileData; /**< Source font file, only present for dynamic fonts. */
+		UINT32 mDPI;
+		bool mAntialiasing;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
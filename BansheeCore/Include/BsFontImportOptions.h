@@ -43,6 +43,13 @@ namespace BansheeEngine
 		 */
 		void setAntialiasing(bool enabled) { mAntialiasing = enabled; }
 
+		/**
+		 * @brief	Set to true if you want characters to be rendered on demand at runtime, instead of
+		 *			being rendered into textures on import. Character index ranges are ignored for
+		 *			dynamic fonts since any character in the font can be rendered.
+		 */
+		void setDynamic(bool dynamic) { mDynamic = dynamic; }
+
 		/**
 		 * @brief	Gets the sizes that are to be imported.
 		 */
@@ -63,6 +70,11 @@ namespace BansheeEngine
 		 */
 		bool getAntialiasing() const { return mAntialiasing; }
 
+		/**
+		 * @brief	Query if characters will be rendered on demand at runtime.
+		 */
+		bool getDynamic() const { return mDynamic; }
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -76,5 +88,6 @@ namespace BansheeEngine
 		Vector<std::pair<UINT32, UINT32>> mCharIndexRanges;
 		UINT32 mDPI;
 		bool mAntialiasing;
+		bool mDynamic;
 	};
 }
\ No newline at end of file
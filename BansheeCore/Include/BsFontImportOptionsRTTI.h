@@ -24,6 +24,9 @@ namespace BansheeEngine
 		bool& getAntialiasing(FontImportOptions* obj) { return obj->mAntialiasing; }
 		void setAntialiasing(FontImportOptions* obj, bool& value) { obj->mAntialiasing = value; }
 
+		bool& getDynamic(FontImportOptions* obj) { return obj->mDynamic; }
+		void setDynamic(FontImportOptions* obj, bool& value) { obj->mDynamic = value; }
+
 	public:
 		FontImportOptionsRTTI()
 		{
@@ -31,6 +34,7 @@ namespace BansheeEngine
 			addPlainField("mCharIndexRanges", 1, &FontImportOptionsRTTI::getCharIndexRanges, &FontImportOptionsRTTI::setCharIndexRanges);
 			addPlainField("mDPI", 2, &FontImportOptionsRTTI::getDPI, &FontImportOptionsRTTI::setDPI);
 			addPlainField("mAntialiasing", 3, &FontImportOptionsRTTI::getAntialiasing, &FontImportOptionsRTTI::setAntialiasing);
+			addPlainField("mDynamic", 4, &FontImportOptionsRTTI::getDynamic, &FontImportOptionsRTTI::setDynamic);
 		}
 
 		virtual const String& getRTTIName()
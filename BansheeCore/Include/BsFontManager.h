@@ -14,16 +14,75 @@ namespace BansheeEngine
 	class BS_CORE_EXPORT FontManager : public Module<FontManager>
 	{
 	public:
+		/**
+		 * @brief	Creates a glyph rasterizer from font file contents, font size in points, dots
+		 *			per inch and antialiasing setting. Returns null if the data cannot be parsed.
+		 */
+		typedef std::function<GlyphRasterizerPtr(const UINT8*, UINT32, UINT32, UINT32, bool)> GlyphRasterizerFactory;
+
 		/**
 		 * @brief	Creates a new font from the provided populated font data structure.
 		 */
 		FontPtr create(const Vector<FontData>& fontData) const;
 
+		/**
+		 * @brief	Creates a new font that renders its glyphs on demand at runtime, from the
+		 *			provided font file contents.
+		 *
+		 * @param	fontFileData	Contents of the font file, in a format the registered glyph rasterizer factory supports.
+		 * @param	fontSizes		Sizes to create glyph caches for, in points.
+		 * @param	dpi				Dots per inch scale to use when rendering the glyphs.
+		 * @param	antialiasing	Should the glyphs be antialiased.
+		 */
+		FontPtr createDynamic(const Vector<UINT8>& fontFileData, const Vector<UINT32>& fontSizes, UINT32 dpi, bool antialiasing) const;
+
 		/**
 		 * @brief	Creates an empty font.
 		 *
 		 * @note	Internal method. Used by factory methods.
 		 */
 		FontPtr _createEmpty() const;
+
+		/**
+		 * @brief	Registers the factory used for creating glyph rasterizers for dynamic fonts.
+		 *
+		 * @note	Internal method. Called by font importer plugins.
+		 */
+		void _setGlyphRasterizerFactory(const GlyphRasterizerFactory& factory) { mGlyphRasterizerFactory = factory; }
+
+		/**
+		 * @brief	Creates a glyph rasterizer using the registered factory. Returns null if no factory
+		 *			is registered or it failed to create the rasterizer.
+		 *
+		 * @note	Internal method.
+		 */
+		GlyphRasterizerPtr _createGlyphRasterizer(const UINT8* fontFileData, UINT32 fontFileSize, UINT32 fontSize, UINT32 dpi, bool antialiasing) const;
+
+		/**
+		 * @brief	Registers a glyph cache so its pages get uploaded every frame.
+		 *
+		 * @note	Internal method. Called by GlyphCache.
+		 */
+		void _registerGlyphCache(GlyphCache* glyphCache);
+
+		/**
+		 * @brief	Unregisters a glyph cache registered with ::_registerGlyphCache.
+		 *
+		 * @note	Internal method. Called by GlyphCache.
+		 */
+		void _unregisterGlyphCache(GlyphCache* glyphCache);
+
+		/**
+		 * @brief	Uploads glyphs rendered since the last call to the GPU.
+		 *
+		 * @note	Internal method. Called once per frame by the application.
+		 */
+		void _update();
+
+	private:
+		GlyphRasterizerFactory mGlyphRasterizerFactory;
+
+		Set<GlyphCache*> mGlyphCaches;
+		BS_MUTEX(mMutex);
 	};
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "BsRTTIType.h"
 #include "BsFont.h"
 #include "BsFontManager.h"
+#include "BsManagedDataBlock.h"
 #include "BsTexture.h"
 
 namespace BansheeEngine
@@ -32,6 +33,7 @@ namespace BansheeEngine
 		void setFontDesc(FontData* obj, FONT_DESC& val)
 		{
 			obj->fontDesc = val;
+			obj->buildLookupTables();
 		}
 
 		HTexture& getTexture(FontData* obj, UINT32 idx)
@@ -118,10 +120,37 @@ namespace BansheeEngine
 			initData->fontDataPerSize.resize(size);
 		}
 
+		ManagedDataBlock getFontFileData(Font* obj)
+		{
+			return ManagedDataBlock(obj->mFontFileData.data(), (UINT32)obj->mFontFileData.size());
+		}
+
+		void setFontFileData(Font* obj, ManagedDataBlock value)
+		{
+			// Nothing to do here, the pointer we provided already belongs to the font
+			// so the data is already written
+		}
+
+		static UINT8* allocateFontFileData(Font* obj, UINT32 numBytes)
+		{
+			obj->mFontFileData.resize(numBytes);
+
+			return obj->mFontFileData.data();
+		}
+
+		UINT32& getDPI(Font* obj) { return obj->mDPI; }
+		void setDPI(Font* obj, UINT32& value) { obj->mDPI = value; }
+
+		bool& getAntialiasing(Font* obj) { return obj->mAntialiasing; }
+		void setAntialiasing(Font* obj, bool& value) { obj->mAntialiasing = value; }
+
 	public:
 		FontRTTI()
 		{
 			addReflectableArrayField("mFontDataPerSize", 0, &FontRTTI::getFontData, &FontRTTI::getNumFontData, &FontRTTI::setFontData, &FontRTTI::setNumFontData);
+			addDataBlockField("mFontFileData", 1, &FontRTTI::getFontFileData, &FontRTTI::setFontFileData, 0, &FontRTTI::allocateFontFileData);
+			addPlainField("mDPI", 2, &FontRTTI::getDPI, &FontRTTI::setDPI);
+			addPlainField("mAntialiasing", 3, &FontRTTI::getAntialiasing, &FontRTTI::setAntialiasing);
 		}
 
 		virtual const String& getRTTIName()
@@ -8,19 +8,6 @@
 
 namespace BansheeEngine
 {
-	/**
-	 * @brief	Contains instance data that is held by all GameObject handles.
-	 */
-	struct GameObjectInstanceData
-	{
-		GameObjectInstanceData()
-			:mInstanceId(0), object(nullptr)
-		{ }
-
-		std::shared_ptr<GameObject> object;
-		UINT64 mInstanceId;
-	};
-
 	/**
 	 * @brief	Type of object that can be referenced by a GameObject handle.
 	 *			Each object has an unique ID and is registered with the GameObjectManager.
@@ -34,7 +21,7 @@ namespace BansheeEngine
 		/**
 		 * @brief	Returns the unique instance ID of the GameObject.
 		 */
-		UINT64 getInstanceId() const { return mInstanceData->mInstanceId; }
+		UINT64 getInstanceId() const { return mInstanceId; }
 
 		/**
 		 * @brief	Gets the name of the object.
@@ -46,20 +33,32 @@ namespace BansheeEngine
 		 */
 		void setName(const String& name) { mName = name; }
 
+		/**
+		 * @brief	Returns a handle referencing this object.
+		 *
+		 * @note	Internal method. Allows handles to be retrieved in constant time for objects
+		 *			accessed directly, like during component iteration.
+		 */
+		GameObjectHandleBase _getHandle() const;
+
 	protected:
 		friend class GameObjectHandleBase;
 		friend class GameObjectManager;
 
 		/**
 		 * @brief	Initializes the GameObject after construction.
+		 *
+		 * @param	instanceId	Unique ID of the object.
+		 * @param	slotIdx		Index of the GameObjectManager slot the object is stored in.
 		 */
-		void initialize(const std::shared_ptr<GameObject>& object, UINT64 instanceId);
+		void initialize(UINT64 instanceId, UINT32 slotIdx);
 
 	protected:
 		String mName;
 
 	private:
-		std::shared_ptr<GameObjectInstanceData> mInstanceData;
+		UINT64 mInstanceId;
+		UINT32 mSlotIdx;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
@@ -8,31 +8,31 @@ namespace BansheeEngine
 	class GameObjectManager;
 
 	/**
-	 * @brief	Internal data shared between GameObject handles.
+	 * @brief	Entry in the GameObject slot map. Handles reference objects by slot index and are
+	 *			valid only as long as the slot generation matches the one stored in the handle.
+	 *
+	 * @note	Slots are owned by GameObjectManager.
 	 */
-	struct BS_CORE_EXPORT GameObjectHandleData
+	struct GameObjectSlot
 	{
-		GameObjectHandleData()
-			:mPtr(nullptr), mInstanceId(0)
+		GameObjectSlot()
+			:instanceId(0), generation(0), primary(0), nextFree(0)
 		{ }
 
-		GameObjectHandleData(const std::shared_ptr<GameObjectInstanceData>& ptr)
-		{
-			mPtr = ptr;
-			if(ptr != nullptr)
-				mInstanceId = ptr->object->getInstanceId();
-			else
-				mInstanceId = 0;
-		}
-
-		std::shared_ptr<GameObjectInstanceData> mPtr;
-		UINT64 mInstanceId;
+		std::shared_ptr<GameObject> object;
+		UINT64 instanceId;
+		UINT32 generation;
+		UINT32 primary; /**< Index of the slot the object was registered in. Differs only for slots created during deserialization. */
+		UINT32 nextFree;
 	};
 
 	/**
 	 * @brief	A handle that can point to various types of game objects.
 	 * 			It primarily keeps track if the object is still alive, so anything
 	 * 			still referencing it doesn't accidentally use it.
+	 *
+	 *			Handles are plain values referencing a slot in GameObjectManager's slot map, so copying them
+	 *			is cheap and checking if the object is alive requires no pointer chasing.
 	 * 			
 	 * @note	This class exists because references between game objects should be quite loose.
 	 * 			For example one game object should be able to reference another one without the other
@@ -43,17 +43,22 @@ namespace BansheeEngine
 	class BS_CORE_EXPORT GameObjectHandleBase : public IReflectable
 	{
 	public:
+		static const UINT32 INVALID_SLOT;
+
 		GameObjectHandleBase();
 
 		/**
 		 * @brief	Returns true if the object the handle is pointing to has been destroyed.
 		 */
-		bool isDestroyed() const { return mData->mPtr == nullptr || mData->mPtr->object == nullptr; }
+		bool isDestroyed() const 
+		{ 
+			return mSlotIdx >= sNumSlots || sSlots[mSlotIdx].generation != mGeneration || sSlots[mSlotIdx].object == nullptr; 
+		}
 
 		/**
 		 * @brief	Returns the instance ID of the object the handle is referencing.
 		 */
-		UINT64 getInstanceId() const { return mData->mInstanceId; }
+		UINT64 getInstanceId() const { return isDestroyed() ? mInstanceId : sSlots[mSlotIdx].instanceId; }
 
 		/**
 		 * @brief	Returns pointer to the referenced GameObject.
@@ -64,7 +69,7 @@ namespace BansheeEngine
 		{ 
 			throwIfDestroyed();
 
-			return mData->mPtr->object.get(); 
+			return sSlots[mSlotIdx].object.get(); 
 		}
 
 		/**
@@ -76,7 +81,7 @@ namespace BansheeEngine
 		{
 			throwIfDestroyed();
 
-			return mData->mPtr->object;
+			return sSlots[mSlotIdx].object;
 		}
 
 		/**
@@ -93,56 +98,48 @@ namespace BansheeEngine
 		 */
 		GameObject& operator*() const { return *get(); }
 
-		/**
-		 * @brief	Returns internal handle data.
-		 *
-		 * @note	Internal method.
-		 */
-		std::shared_ptr<GameObjectHandleData> _getHandleData() const { return mData; }
-
-		/**
-		 * @brief	Resolves a handle to a proper GameObject in case it was created uninitialized.
-		 *
-		 * @note	Internal method.
-		 */
-		void _resolve(const GameObjectHandleBase& object);
-
 	protected:
+		friend class GameObject;
 		friend class SceneObject;
 		friend class SceneObjectRTTI;
 		friend class GameObjectManager;
+		friend class GameObjectHandleRTTI;
 
 		GameObjectHandleBase(const std::shared_ptr<GameObject> ptr);
-		GameObjectHandleBase(const std::shared_ptr<GameObjectHandleData>& data);
+		GameObjectHandleBase(UINT32 slotIdx, UINT32 generation, UINT64 instanceId);
 		GameObjectHandleBase(std::nullptr_t ptr);
 
 		/**
 		 * @brief	Throws an exception if the referenced GameObject has been destroyed.
 		 */
-		inline void throwIfDestroyed() const;
+		void throwIfDestroyed() const
+		{
+			if(isDestroyed())
+				throwDestroyedException();
+		}
+
+		/**
+		 * @brief	Throws an exception signaling the referenced object was destroyed.
+		 */
+		static void throwDestroyedException();
 		
 		/**
 		 * @brief	Invalidates the handle signifiying the referenced object was destroyed.
+		 *			This releases the object, and invalidates all other handles referencing it.
 		 */
-		void destroy()
-		{
-			// We need to clear mData->mPtr before we clear mData->mPtr->object,
-			// as this handle could be stored within the "object" and destroyed when
-			// we set it to null 
-			std::shared_ptr<GameObjectInstanceData> instanceData = mData->mPtr;
-			mData->mPtr = nullptr;
-
-			if(instanceData != nullptr)
-				instanceData->object = nullptr;
-		}
+		void destroy();
+
+		UINT32 mSlotIdx;
+		UINT32 mGeneration;
+		UINT64 mInstanceId; /**< Serialized instance ID until the handle is resolved, cached instance ID afterwards. */
 
-		std::shared_ptr<GameObjectHandleData> mData;
+		static GameObjectSlot* sSlots;
+		static UINT32 sNumSlots;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
 	public:
-		friend class GameObjectHandleRTTI;
 		static RTTITypeBase* getRTTIStatic();
 		virtual RTTITypeBase* getRTTI() const;
 	};
@@ -162,35 +159,31 @@ namespace BansheeEngine
 		 */
 		GameObjectHandle()
 			:GameObjectHandleBase()
-		{	
-			mData = bs_shared_ptr<GameObjectHandleData, PoolAlloc>();
-		}
+		{ }
 
 		/**
 		 * @brief	Copy constructor from another handle of the same type.
 		 */
 		template <typename T1>
 		GameObjectHandle(const GameObjectHandle<T1>& ptr)
-			:GameObjectHandleBase()
-		{ 	
-			mData = ptr._getHandleData();
-		}
+			:GameObjectHandleBase(ptr)
+		{ }
 
 		/**
 		 * @brief	Copy constructor from another handle of the base type.
 		 */
 		GameObjectHandle(const GameObjectHandleBase& ptr)
-			:GameObjectHandleBase()
-		{ 	
-			mData = ptr._getHandleData();
-		}
+			:GameObjectHandleBase(ptr)
+		{ }
 
 		/**
 		 * @brief	Invalidates the handle.
 		 */
 		inline GameObjectHandle<T>& operator=(std::nullptr_t ptr)
 		{ 	
-			mData = bs_shared_ptr<GameObjectHandleData, PoolAlloc>();
+			mSlotIdx = INVALID_SLOT;
+			mGeneration = 0;
+			mInstanceId = 0;
 
 			return *this;
 		}
@@ -200,9 +193,7 @@ namespace BansheeEngine
 		 */
 		inline operator GameObjectHandleBase()
 		{
-			GameObjectHandleBase base(mData);
-
-			return base;
+			return GameObjectHandleBase(mSlotIdx, mGeneration, mInstanceId);
 		}
 
 		/**
@@ -214,7 +205,7 @@ namespace BansheeEngine
 		{ 
 			throwIfDestroyed();
 
-			return reinterpret_cast<T*>(mData->mPtr->object.get()); 
+			return reinterpret_cast<T*>(sSlots[mSlotIdx].object.get()); 
 		}
 
 		/**
@@ -226,7 +217,7 @@ namespace BansheeEngine
 		{
 			throwIfDestroyed();
 
-			return std::static_pointer_cast<T>(mData->mPtr->object);
+			return std::static_pointer_cast<T>(sSlots[mSlotIdx].object);
 		}
 
 		/**
@@ -257,7 +248,7 @@ namespace BansheeEngine
 		 */
 		operator int Bool_struct<T>::*() const
 		{
-			return (((mData->mPtr != nullptr) && (mData->mPtr->object != nullptr)) ? &Bool_struct<T>::_Member : 0);
+			return (!isDestroyed() ? &Bool_struct<T>::_Member : 0);
 		}
 
 	private:
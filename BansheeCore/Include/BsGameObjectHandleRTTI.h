@@ -13,8 +13,13 @@ namespace BansheeEngine
 	class BS_CORE_EXPORT GameObjectHandleRTTI : public RTTIType<GameObjectHandleBase, IReflectable, GameObjectHandleRTTI>
 	{
 	private:
-		UINT64& getInstanceId(GameObjectHandleBase* obj) { return obj->mData->mInstanceId; }
-		void setInstanceId(GameObjectHandleBase* obj, UINT64& value) { obj->mData->mInstanceId = value; } 
+		UINT64& getInstanceId(GameObjectHandleBase* obj) 
+		{ 
+			obj->mInstanceId = obj->getInstanceId();
+			return obj->mInstanceId; 
+		}
+
+		void setInstanceId(GameObjectHandleBase* obj, UINT64& value) { obj->mInstanceId = value; } 
 
 	public:
 		GameObjectHandleRTTI()
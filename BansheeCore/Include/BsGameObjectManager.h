@@ -13,6 +13,11 @@ namespace BansheeEngine
 	 * @brief	Tracks GameObject creation and destructions. Also resolves
 	 *			GameObject references from GameObject handles.
 	 *
+	 *			Objects are stored in a slot map. Each handle references an object by its slot index
+	 *			and the generation of the slot at the time the object was registered. Slots are reused
+	 *			once their object is destroyed, with an incremented generation which invalidates all
+	 *			existing handles to the slot.
+	 *
 	 * @note	Sim thread only.
 	 */
 	class BS_CORE_EXPORT GameObjectManager : public Module<GameObjectManager>
@@ -31,6 +36,13 @@ namespace BansheeEngine
 		 */
 		void unregisterObject(const GameObjectHandleBase& object);
 
+		/**
+		 * @brief	Releases the object in the specified slot, and invalidates all handles referencing it.
+		 *
+		 * @note	Internal method. Use GameObjectHandleBase::destroy.
+		 */
+		void destroyObject(UINT32 slotIdx);
+
 		/**
 		 * @brief	Attempts to find a GameObject handle based on the GameObject instance ID.
 		 *			Returns empty handle if ID cannot be found.
@@ -83,9 +95,10 @@ namespace BansheeEngine
 		void registerDeserializedId(UINT64 deserializedId, UINT64 actualId);
 
 		/**
-		 * @brief	Queues the specified handle and resolves it when deserialization ends.
+		 * @brief	Points the handle with a deserialized instance ID to the object it references. If the object
+		 *			wasn't deserialized yet the handle will be resolved when deserialization ends.
 		 */
-		void registerUnresolvedHandle(const GameObjectHandleBase& object);
+		void registerUnresolvedHandle(GameObjectHandleBase& object);
 
 		/**
 		 * @brief	Registers a callback that will be triggered when GameObject serialization ends.
@@ -93,13 +106,34 @@ namespace BansheeEngine
 		void registerOnDeserializationEndCallback(std::function<void()> callback);
 
 	private:
+		/**
+		 * @brief	Finds an empty slot, or creates a new one if there are none.
+		 */
+		UINT32 allocateSlot();
+
+		/**
+		 * @brief	Marks the slot as empty and invalidates all handles referencing it. 
+		 *
+		 * @note	Slot object is cleared, so make sure to keep a reference to it if it
+		 *			shouldn't be released yet.
+		 */
+		void freeSlot(UINT32 slotIdx);
+
+		/**
+		 * @brief	Updates the slot array referenced by handles. Must be called whenever slots are reallocated.
+		 */
+		void updateSlotPointers();
+
 		UINT64 mNextAvailableID; // 0 is not a valid ID
-		Map<UINT64, GameObjectHandleBase> mObjects;
+		Vector<GameObjectSlot> mSlots;
+		UINT32 mFirstFreeSlot;
+		UnorderedMap<UINT64, UINT32> mObjects; // Instance ID -> slot index
+		UnorderedMap<UINT32, Vector<UINT32>> mSecondarySlots; // Slots created during deserialization, per primary slot
 
 		GameObject* mActiveDeserializedObject;
 		bool mIsDeserializationActive;
 		Map<UINT64, UINT64> mIdMapping;
-		Vector<GameObjectHandleBase> mUnresolvedHandles;
+		UnorderedMap<UINT64, UINT32> mUnresolvedSlots; // Deserialized instance ID -> slot reserved for it
 		Vector<std::function<void()>> mEndCallbacks;
 	};
 }
\ No newline at end of file
@@ -17,7 +17,7 @@ namespace BansheeEngine
 		String& getName(GameObject* obj) { return obj->mName; }
 		void setName(GameObject* obj, String& name) { obj->mName = name; }
 
-		UINT64& getInstanceID(GameObject* obj) { return obj->mInstanceData->mInstanceId; }
+		UINT64& getInstanceID(GameObject* obj) { return obj->mInstanceId; }
 		void setInstanceID(GameObject* obj, UINT64& instanceId) 
 		{  
 			// The system will have already assigned the instance ID, but since other objects might be referencing
@@ -0,0 +1,173 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsFontDesc.h"
+#include "BsTexAtlasPacker.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Renders glyphs of a single font size on demand and stores them in single channel
+	 *			atlas textures. Glyphs are packed incrementally as they are requested using
+	 *			TexAtlasMaxRectsPacker, and modified pages are uploaded to the GPU once per frame.
+	 *
+	 *			Once all pages are full, least recently used glyphs that aren't referenced by any
+	 *			text are evicted to make room for new ones.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT GlyphCache
+	{
+		/**
+		 * @brief	A glyph rendered into one of the pages.
+		 */
+		struct Glyph
+		{
+			CHAR_DESC desc;
+			UINT32 x, y; /**< Position of the glyph slot in the page, in pixels. */
+			UINT32 slotWidth, slotHeight; /**< Size of the glyph slot, including padding. Zero if glyph has no slot. */
+			UINT32 numReferences;
+			UINT64 lastUsed;
+		};
+
+		/**
+		 * @brief	A single atlas texture and its system memory copy.
+		 */
+		struct Page
+		{
+			Page(UINT32 size)
+				:packer(size, size), isDirty(true)
+			{ }
+
+			HTexture texture;
+			PixelDataPtr pixels;
+			TexAtlasMaxRectsPacker packer;
+			bool isDirty;
+		};
+
+	public:
+		/**
+		 * @brief	Creates a new glyph cache.
+		 *
+		 * @param	rasterizer	Rasterizer used for rendering glyphs. Cache takes ownership of it.
+		 * @param	pageSize	Width and height of a single page, in pixels.
+		 * @param	maxPages	Maximum number of pages to create before glyphs start getting evicted.
+		 */
+		GlyphCache(const GlyphRasterizerPtr& rasterizer, UINT32 pageSize = 512, UINT32 maxPages = 4);
+		~GlyphCache();
+
+		/**
+		 * @brief	Returns glyph independent font information, as reported by the rasterizer.
+		 */
+		const FONT_DESC& getFontDesc() const { return mFontDesc; }
+
+		/**
+		 * @brief	Returns a character description for the character with the specified ID, rendering
+		 *			it if it's not in the cache already.
+		 *
+		 * @note	The returned description may be evicted by any later request. Use ::acquireCharDesc if
+		 *			it needs to stay valid.
+		 */
+		const CHAR_DESC& getCharDesc(UINT32 charId);
+
+		/**
+		 * @brief	Same as ::getCharDesc but also adds a reference to the character, ensuring it
+		 *			doesn't get evicted until it is released with ::releaseCharDescs.
+		 */
+		const CHAR_DESC& acquireCharDesc(UINT32 charId);
+
+		/**
+		 * @brief	Releases references to characters previously acquired with ::acquireCharDesc.
+		 *
+		 * @return	Number of glyphs evicted from the cache so far. Provide it to ::reacquireCharDescs
+		 *			to reference the same characters again.
+		 */
+		UINT64 releaseCharDescs(const CHAR_DESC** chars, UINT32 numChars);
+
+		/**
+		 * @brief	References characters released with ::releaseCharDescs again, without looking them up.
+		 *			Fails if any glyph was evicted since, in which case the descriptions may no longer be
+		 *			valid and must be requested again.
+		 *
+		 * @param	chars			Characters to reference.
+		 * @param	numChars		Number of characters in the array.
+		 * @param	evictionCount	Value returned by ::releaseCharDescs when the characters were released.
+		 */
+		bool reacquireCharDescs(const CHAR_DESC** chars, UINT32 numChars, UINT64 evictionCount);
+
+		/**
+		 * @brief	Returns the kerning amount to apply between two consecutive characters, in pixels.
+		 */
+		INT32 getKerning(UINT32 charId, UINT32 nextCharId);
+
+		/**
+		 * @brief	Returns the number of created atlas pages.
+		 */
+		UINT32 getNumPages() const;
+
+		/**
+		 * @brief	Returns the atlas texture with the specified index.
+		 */
+		const HTexture& getPage(UINT32 idx) const;
+
+		/**
+		 * @brief	Uploads all pages modified since the last call to the GPU.
+		 *
+		 * @note	Internal method. Called once per frame by FontManager.
+		 */
+		void _update();
+
+	private:
+		/**
+		 * @brief	Finds the glyph for the specified character, rendering it if needed.
+		 *			Returns null if the font doesn't contain the character.
+		 *
+		 * @note	Caller must hold the cache mutex.
+		 */
+		Glyph* findOrCreateGlyph(UINT32 charId);
+
+		/**
+		 * @brief	Finds room for and copies the glyph bitmap into one of the pages, evicting other
+		 *			glyphs or creating a new page if needed. Returns false if there is no room.
+		 *
+		 * @note	Caller must hold the cache mutex.
+		 */
+		bool insertGlyph(Glyph& glyph, const Vector<UINT8>& pixels);
+
+		/**
+		 * @brief	Attempts to allocate a slot of the specified size in one of the existing pages.
+		 */
+		bool allocateSlot(UINT32 width, UINT32 height, UINT32& page, UINT32& x, UINT32& y);
+
+		/**
+		 * @brief	Evicts the least recently used glyph that isn't referenced by anything.
+		 *			Returns false if there are no such glyphs.
+		 */
+		bool evictGlyph();
+
+		/**
+		 * @brief	Creates a new empty page.
+		 */
+		void createPage();
+
+		static const UINT32 GLYPH_PADDING;
+
+		GlyphRasterizerPtr mRasterizer;
+		FONT_DESC mFontDesc;
+		UINT32 mPageSize;
+		UINT32 mMaxPages;
+
+		UnorderedMap<UINT32, Glyph> mGlyphs;
+		UnorderedSet<UINT32> mMissingChars; /**< Characters the font doesn't contain. */
+		Glyph mMissingGlyph;
+		UnorderedMap<UINT64, INT32> mKerningCache;
+		Vector<Page*> mPages;
+		UINT64 mUseCounter;
+		UINT64 mNumEvictions;
+
+		BS_MUTEX(mMutex);
+	};
+}
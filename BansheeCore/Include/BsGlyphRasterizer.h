@@ -0,0 +1,52 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsFontDesc.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Renders individual glyphs of a single font face at a single size. Used by
+	 *			GlyphCache to render glyphs on demand at runtime.
+	 *
+	 * @note	Implementations are provided by font importer plugins. Not thread safe,
+	 *			GlyphCache serializes all calls.
+	 */
+	class BS_CORE_EXPORT GlyphRasterizer
+	{
+	public:
+		virtual ~GlyphRasterizer() {}
+
+		/**
+		 * @brief	Fills out glyph independent font information (baseline offset,
+		 *			line height and space width).
+		 */
+		virtual void getFontDesc(FONT_DESC& fontDesc) = 0;
+
+		/**
+		 * @brief	Renders a single glyph.
+		 *
+		 * @param	charId		Unicode key of the character to render.
+		 * @param	charDesc	Output character information. Everything but the texture page and
+		 *						coordinates is filled out.
+		 * @param	pixels		Output single channel glyph bitmap, charDesc.width * charDesc.height in size.
+		 *
+		 * @return	False if the font doesn't contain the character.
+		 */
+		virtual bool rasterizeGlyph(UINT32 charId, CHAR_DESC& charDesc, Vector<UINT8>& pixels) = 0;
+
+		/**
+		 * @brief	Renders the glyph used in place of characters the font doesn't contain.
+		 *			Outputs are the same as for ::rasterizeGlyph.
+		 */
+		virtual void rasterizeMissingGlyph(CHAR_DESC& charDesc, Vector<UINT8>& pixels) = 0;
+
+		/**
+		 * @brief	Returns the kerning amount to apply between two consecutive characters, in pixels.
+		 */
+		virtual INT32 getKerning(UINT32 charId, UINT32 nextCharId) = 0;
+	};
+}
@@ -0,0 +1,80 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Linear allocator that sub-allocates GPU parameter blocks from a single large
+	 *			GPU parameter block buffer. Allocations are valid for a single frame, and all
+	 *			data allocated during a frame is uploaded to the GPU with a single write.
+	 *
+	 *			Allocated blocks should be bound by setting the buffer and the returned offset
+	 *			on GpuParams. See GpuParams::setParamBlockOffset.
+	 *
+	 * @note	Requires a render system that supports RSC_PARAM_BLOCK_OFFSETS.
+	 *			Core thread only.
+	 */
+	class BS_CORE_EXPORT GpuParamBlockAllocator
+	{
+	public:
+		/**
+		 * @brief	Creates a new allocator with the initial buffer size in bytes. Buffer will
+		 *			grow as needed.
+		 */
+		GpuParamBlockAllocator(UINT32 initialSize = 64 * 1024);
+		~GpuParamBlockAllocator();
+
+		/**
+		 * @brief	Starts a new frame, releasing all allocations from the previous frame.
+		 *
+		 * @param	requiredSize	Number of bytes that will be allocated this frame. If larger than the
+		 *							current buffer, a new buffer is created, in which case buffers returned
+		 *							by ::getBuffer prior to this call must no longer be used.
+		 *
+		 * @note	Use ::getAllocationSize to determine the number of bytes needed by each allocation.
+		 */
+		void beginFrame(UINT32 requiredSize);
+
+		/**
+		 * @brief	Allocates space for a parameter block and copies the provided data into it.
+		 *			Data is not visible to the GPU until ::endFrame is called.
+		 *
+		 * @return	Offset of the parameter block in bytes, from the start of the buffer. Returns
+		 *			(UINT32)-1 if the buffer is full.
+		 */
+		UINT32 allocate(const UINT8* data, UINT32 size);
+
+		/**
+		 * @brief	Uploads all parameter blocks allocated since ::beginFrame to the GPU.
+		 */
+		void endFrame();
+
+		/**
+		 * @brief	Returns the number of bytes an allocation of the provided size will consume,
+		 *			including any alignment padding.
+		 */
+		UINT32 getAllocationSize(UINT32 size) const;
+
+		/**
+		 * @brief	Returns the buffer all parameter blocks are allocated from.
+		 */
+		const GpuParamBlockBufferPtr& getBuffer() const { return mBuffer; }
+
+	private:
+		/**
+		 * @brief	Creates a new buffer and CPU staging area of the specified size.
+		 */
+		void createBuffer(UINT32 size);
+
+		GpuParamBlockBufferPtr mBuffer;
+		UINT8* mStagingData;
+
+		UINT32 mSize;
+		UINT32 mAlignment;
+		UINT32 mFreePtr;
+	};
+}
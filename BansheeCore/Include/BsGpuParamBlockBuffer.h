@@ -40,6 +40,15 @@ namespace BansheeEngine
 		 */
 		virtual void writeData(const UINT8* data) = 0;
 
+		/**
+		 * @brief	Writes the specified data to a part of the buffer, discarding the rest of the buffer contents.
+		 *			Contents outside of the written range are undefined after this call.
+		 *
+		 * @note	Allows the driver to give the buffer new storage while the GPU is still using the previous contents,
+		 *			instead of waiting until the GPU is done with them.
+		 */
+		virtual void writeDataDiscard(const UINT8* data, UINT32 offset, UINT32 length) = 0;
+
 		/**
 		 * @brief	Copies data from the internal buffer to a pre-allocated array. 
 		 * 			Be aware this generally isn't a very fast operation as reading
@@ -103,6 +112,11 @@ namespace BansheeEngine
 		 */
 		void writeData(const UINT8* data);
 
+		/**
+		 * @copydoc	GpuParamBlockBuffer::writeDataDiscard
+		 */
+		void writeDataDiscard(const UINT8* data, UINT32 offset, UINT32 length);
+
 		/**
 		 * @copydoc GpuParamBlockBuffer::readData.
 		 */
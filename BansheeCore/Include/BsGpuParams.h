@@ -73,6 +73,20 @@ namespace BansheeEngine
 		 */
 		void setParamBlockBuffer(const String& name, const GpuParamBlockBufferPtr& paramBlockBuffer);
 
+		/**
+		 * @brief	Sets an offset in bytes into the parameter buffer bound at the specified slot. When the
+		 *			parameters are bound to the pipeline only the part of the buffer starting at the offset
+		 *			will be visible to the GPU program. This allows a single large buffer to hold parameters
+		 *			for many objects.
+		 *
+		 * @note	Offset is reset to zero whenever a new buffer is bound to the slot.
+		 *
+		 *			Offset must be a multiple of RenderSystemCapabilities::getParamBlockOffsetAlignment, and is
+		 *			only respected if the render system supports RSC_PARAM_BLOCK_OFFSETS. Parameter reads and
+		 *			writes through this object ignore the offset.
+		 */
+		void setParamBlockOffset(UINT32 slot, UINT32 offset);
+
 		/**
 		 * @brief	Returns a description of all stored parameters.
 		 */
@@ -229,6 +243,13 @@ namespace BansheeEngine
 		 */
 		GpuParamBlockBufferPtr getParamBlockBuffer(UINT32 slot) const;
 
+		/**
+		 * @brief	Gets an offset in bytes into the parameter block buffer bound at the specified slot.
+		 *
+		 * @see		setParamBlockOffset
+		 */
+		UINT32 getParamBlockOffset(UINT32 slot) const;
+
 		/**
 		 * @brief	Gets a texture bound to the specified slot.
 		 */
@@ -301,6 +322,7 @@ namespace BansheeEngine
 
 		GpuParamBlockPtr* mParamBlocks;
 		GpuParamBlockBufferPtr* mParamBlockBuffers;
+		UINT32* mParamBlockOffsets;
 		HTexture* mTextures;
 		HSamplerState* mSamplerStates;
 
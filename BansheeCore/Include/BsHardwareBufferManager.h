@@ -76,8 +76,13 @@ namespace BansheeEngine
 
 		/**
 		 * @brief	Creates a new vertex declaration from a list of vertex elements.
+		 *
+		 * @param	elements			Vertex elements in the declaration.
+		 * @param	instanceStepRates	Step rates of sources that contain per-instance data, keyed by source index.
+		 *								See VertexDeclaration::getInstanceStepRate.
 		 */
-		virtual VertexDeclarationPtr createVertexDeclaration(const VertexDeclaration::VertexElementList& elements);
+		virtual VertexDeclarationPtr createVertexDeclaration(const VertexDeclaration::VertexElementList& elements,
+			const VertexDeclaration::InstanceStepRateMap& instanceStepRates = VertexDeclaration::InstanceStepRateMap());
 
 	protected:
 		/**
@@ -104,7 +109,8 @@ namespace BansheeEngine
 		/**
 		 * @copydoc	createVertexDeclaration
 		 */
-		virtual VertexDeclarationPtr createVertexDeclarationImpl(const VertexDeclaration::VertexElementList& elements);
+		virtual VertexDeclarationPtr createVertexDeclarationImpl(const VertexDeclaration::VertexElementList& elements,
+			const VertexDeclaration::InstanceStepRateMap& instanceStepRates);
 	};
 }
 
@@ -5,6 +5,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
+#include "BsPath.h"
 
 namespace BansheeEngine
 {
@@ -39,6 +40,24 @@ namespace BansheeEngine
 			return static_resource_cast<T>(import(inputFilePath, importOptions));
 		}
 
+		/**
+		 * @brief	Imports multiple resources. Files whose importers are thread safe are imported in parallel
+		 *			on task scheduler worker threads, while others are imported on the calling thread in the
+		 *			meantime. Import cache is used the same as with import().
+		 *
+		 * @param	inputFilePaths	Pathnames of the input files.
+		 * @param	importOptions	(optional) Options for controlling the import of each file, in the same order as
+		 *							the files. Null or missing entries use the default import options.
+		 * @param	maxInFlight		(optional) Maximum number of files being imported in parallel. Limits the amount
+		 *							of memory used by intermediate import data. If zero, number of hardware threads is used.
+		 *
+		 * @return	Handles to the imported resources, in the same order as the input files. Handles of files that
+		 *			failed to import are null. Import errors are logged as warnings instead of thrown, so
+		 *			a single failed file doesn't discard the rest of the batch.
+		 */
+		Vector<HResource> importBatch(const Vector<Path>& inputFilePaths, 
+			const Vector<ConstImportOptionsPtr>& importOptions = Vector<ConstImportOptionsPtr>(), UINT32 maxInFlight = 0);
+
 		/**
 		 * @brief	Imports a resource and replaces the contents of the provided existing resource with new imported data.
 		 *
@@ -51,6 +70,22 @@ namespace BansheeEngine
 		 */
 		void reimport(HResource& existingResource, const Path& inputFilePath, ConstImportOptionsPtr importOptions = nullptr);
 
+		/**
+		 * @brief	Sets a folder in which imported resources are cached. When a file is imported
+		 *			again with the same contents, import options and importer version the cached
+		 *			resource is loaded instead of running the importer. Provide an empty path to
+		 *			disable the cache (default).
+		 *
+		 * @note	Resources referenced by imported resources (e.g. font texture pages) are cached
+		 *			as well and registered with Resources through an "ImportCache" manifest.
+		 */
+		void setCacheFolder(const Path& cacheFolder);
+
+		/**
+		 * @brief	Returns the folder imported resources are cached in. Empty if cache is disabled.
+		 */
+		const Path& getCacheFolder() const { return mCacheFolder; }
+
 		/**
 		 * @brief	Automatically detects the importer needed for the provided file and returns valid type of
 		 * 			import options for that importer.
@@ -94,8 +129,46 @@ namespace BansheeEngine
 		 */
 		void _registerAssetImporter(SpecificImporter* importer);
 	private:
-		Vector<SpecificImporter*> mAssetImporters;
+		/**
+		 * @brief	Imports a resource at the specified location, or loads it from the import
+		 *			cache if it was already imported. Returns null if the file cannot be imported.
+		 */
+		ResourcePtr importResource(const Path& inputFilePath, ConstImportOptionsPtr importOptions);
+
+		/**
+		 * @brief	Finds the importer for the file and validates the import options, replacing them with
+		 *			default options if none are provided. Returns null if the file cannot be imported.
+		 */
+		SpecificImporter* prepareImport(const Path& inputFilePath, ConstImportOptionsPtr& importOptions) const;
+
+		/**
+		 * @brief	Loads a resource from the import cache entry with the provided key. Returns null if the
+		 *			entry doesn't exist or is invalid.
+		 */
+		ResourcePtr loadFromCache(UINT64 key, const Path& inputFilePath) const;
+
+		/**
+		 * @brief	Calculates the key of an import cache entry from the contents of the input file,
+		 *			the import options and the importer version.
+		 */
+		UINT64 calculateCacheKey(const Path& inputFilePath, SpecificImporter* importer, const ConstImportOptionsPtr& importOptions) const;
+
+		/**
+		 * @brief	Returns the path to the file storing the import cache entry with the provided key.
+		 *			Dependencies of the entry are stored in files with a non-zero dependency index.
+		 */
+		Path getCachePath(UINT64 key, UINT32 dependencyIdx) const;
+
+		/**
+		 * @brief	Saves the imported resource and all of its dependencies to the import cache.
+		 */
+		void saveToCache(UINT64 key, const ResourcePtr& resource);
 
 		SpecificImporter* getImporterForFile(const Path& inputFilePath) const;
+
+		Vector<SpecificImporter*> mAssetImporters;
+
+		Path mCacheFolder;
+		ResourceManifestPtr mCacheManifest;
 	};
 }
\ No newline at end of file
@@ -58,6 +58,16 @@ namespace BansheeEngine
 		 */
 		const Bounds& getBounds() const { return mBounds; }
 
+		/**
+		 * @brief	Returns a description of the vertex elements stored in the mesh.
+		 */
+		const VertexDataDescPtr& getVertexDesc() const { return mVertexDesc; }
+
+		/**
+		 * @copydoc Resource::getGPUMemorySize
+		 */
+		virtual UINT32 getGPUMemorySize() const;
+
 		/**
 		 * @copydoc MeshBase::getVertexData
 		 */
@@ -80,7 +90,7 @@ namespace BansheeEngine
 		/**
 		 * @copydoc	MeshBase::_createProxy
 		 */
-		MeshProxyPtr _createProxy(UINT32 subMeshIdx);
+		MeshProxyPtr _createProxy(UINT32 subMeshIdx, UINT32 lodIdx = 0);
 
 	protected:
 		friend class MeshManager;
@@ -105,6 +115,8 @@ namespace BansheeEngine
 		VertexDataDescPtr mVertexDesc; // Immutable
 		MeshBufferType mBufferType; // Immutable
 		IndexBuffer::IndexType mIndexType; // Immutable
+		Vector3 mPositionOffset; // Immutable
+		float mPositionScale; // Immutable
 
 		MeshDataPtr mTempInitialMeshData; // Immutable
 
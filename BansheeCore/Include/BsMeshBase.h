@@ -70,9 +70,12 @@ namespace BansheeEngine
 		 * 			certain portion of this mesh. If no sub-meshes are specified manually
 		 *			a special sub-mesh containing all indices is returned.
 		 *
+		 * @param	subMeshIdx	Index of the sub-mesh.
+		 * @param	lodIdx		Level of detail to retrieve the sub-mesh for. Level 0 is the full detail mesh.
+		 *
 		 * @note	Thread safe.
 		 */
-		const SubMesh& getSubMesh(UINT32 subMeshIdx = 0) const;
+		const SubMesh& getSubMesh(UINT32 subMeshIdx = 0, UINT32 lodIdx = 0) const;
 
 		/**
 		 * @brief	Retrieves a total number of sub-meshes in this mesh.
@@ -81,6 +84,23 @@ namespace BansheeEngine
 		 */
 		UINT32 getNumSubMeshes() const;
 
+		/**
+		 * @brief	Returns the number of levels of detail in this mesh, including the full detail level. 
+		 *			Each level contains the same number of sub-meshes.
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT32 getNumLODs() const;
+
+		/**
+		 * @brief	Returns the screen size below which the specified level of detail should be used. Screen size
+		 *			is the radius of the mesh bounding sphere divided by the half-height of the viewport it is 
+		 *			rendered in. Full detail level always returns infinity.
+		 *
+		 * @note	Thread safe.
+		 */
+		float getLODScreenSize(UINT32 lodIdx) const;
+
 		/**
 		 * @brief	Returns maximum number of vertices the mesh may store.
 		 *
@@ -161,14 +181,14 @@ namespace BansheeEngine
 		void _markCoreClean(MeshDirtyFlag flag) { mCoreDirtyFlags &= ~(UINT32)flag; }
 
 		/**
-		 * @brief	Gets the currently active proxy of this material.
+		 * @brief	Gets the currently active proxy of the specified sub-mesh and level of detail.
 		 */
-		MeshProxyPtr _getActiveProxy(UINT32 i) const { return mActiveProxies[i]; }
+		MeshProxyPtr _getActiveProxy(UINT32 i, UINT32 lodIdx = 0) const { return mActiveProxies[lodIdx * (UINT32)mSubMeshes.size() + i]; }
 
 		/**
-		 * @brief	Sets an active proxy for this material.
+		 * @brief	Sets an active proxy for the specified sub-mesh and level of detail.
 		 */
-		void _setActiveProxy(UINT32 i, const MeshProxyPtr& proxy) { mActiveProxies[i] = proxy; }
+		void _setActiveProxy(UINT32 i, const MeshProxyPtr& proxy, UINT32 lodIdx = 0) { mActiveProxies[lodIdx * (UINT32)mSubMeshes.size() + i] = proxy; }
 
 		/**
 		 * @brief	Creates a new core proxy from the current mesh data. Core proxy contains a snapshot of 
@@ -178,7 +198,19 @@ namespace BansheeEngine
 		 *			You generally need to update the core thread with a new proxy whenever core 
 		 *			dirty flag is set.
 		 */
-		virtual MeshProxyPtr _createProxy(UINT32 subMeshIdx) = 0;
+		virtual MeshProxyPtr _createProxy(UINT32 subMeshIdx, UINT32 lodIdx = 0) = 0;
+
+		/**
+		 * @brief	Assigns levels of detail to the mesh. Indices of all levels must be contained in the mesh index buffer.
+		 *
+		 * @param	lodSubMeshes	Sub-meshes of all levels of detail except the full detail one. Each level must contain 
+		 *							as many sub-meshes as the full detail level, stored one level after another.
+		 * @param	lodScreenSizes	Screen size below which each level should be used, in decreasing order. 
+		 *							See getLODScreenSize.
+		 *
+		 * @note	Sim thread only. Must be called before the mesh is used for rendering.
+		 */
+		void _setLODs(const Vector<SubMesh>& lodSubMeshes, const Vector<float>& lodScreenSizes);
 
 	protected:
 		/**
@@ -188,6 +220,8 @@ namespace BansheeEngine
 
 	protected:
 		Vector<SubMesh> mSubMeshes; // Immutable
+		Vector<SubMesh> mLODSubMeshes; // Immutable
+		Vector<float> mLODScreenSizes; // Immutable
 		UINT32 mNumVertices; // Immutable
 		UINT32 mNumIndices; // Immutable
 		Vector<MeshProxyPtr> mActiveProxies;
@@ -20,6 +20,20 @@ namespace BansheeEngine
 		UINT32 getNumSubmeshes(MeshBase* obj) { return (UINT32)obj->mSubMeshes.size(); }
 		void setNumSubmeshes(MeshBase* obj, UINT32 numElements) { obj->mSubMeshes.resize(numElements); obj->mActiveProxies.resize(numElements); }
 
+		SubMesh& getLODSubMesh(MeshBase* obj, UINT32 arrayIdx) { return obj->mLODSubMeshes[arrayIdx]; }
+		void setLODSubMesh(MeshBase* obj, UINT32 arrayIdx, SubMesh& value) { obj->mLODSubMeshes[arrayIdx] = value; }
+		UINT32 getNumLODSubmeshes(MeshBase* obj) { return (UINT32)obj->mLODSubMeshes.size(); }
+		void setNumLODSubmeshes(MeshBase* obj, UINT32 numElements) { obj->mLODSubMeshes.resize(numElements); }
+
+		float& getLODScreenSize(MeshBase* obj, UINT32 arrayIdx) { return obj->mLODScreenSizes[arrayIdx]; }
+		void setLODScreenSize(MeshBase* obj, UINT32 arrayIdx, float& value) { obj->mLODScreenSizes[arrayIdx] = value; }
+		UINT32 getNumLODScreenSizes(MeshBase* obj) { return (UINT32)obj->mLODScreenSizes.size(); }
+		void setNumLODScreenSizes(MeshBase* obj, UINT32 numElements) 
+		{ 
+			obj->mLODScreenSizes.resize(numElements); 
+			obj->mActiveProxies.resize(obj->mSubMeshes.size() * (numElements + 1)); 
+		}
+
 		UINT32& getNumVertices(MeshBase* obj) { return obj->mNumVertices; }
 		void setNumVertices(MeshBase* obj, UINT32& value) { obj->mNumVertices = value; }
 
@@ -34,6 +48,11 @@ namespace BansheeEngine
 
 			addPlainArrayField("mSubMeshes", 2, &MeshBaseRTTI::getSubMesh, 
 				&MeshBaseRTTI::getNumSubmeshes, &MeshBaseRTTI::setSubMesh, &MeshBaseRTTI::setNumSubmeshes);
+
+			addPlainArrayField("mLODSubMeshes", 3, &MeshBaseRTTI::getLODSubMesh, 
+				&MeshBaseRTTI::getNumLODSubmeshes, &MeshBaseRTTI::setLODSubMesh, &MeshBaseRTTI::setNumLODSubmeshes);
+			addPlainArrayField("mLODScreenSizes", 4, &MeshBaseRTTI::getLODScreenSize, 
+				&MeshBaseRTTI::getNumLODScreenSizes, &MeshBaseRTTI::setLODScreenSize, &MeshBaseRTTI::setNumLODScreenSizes);
 		}
 
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
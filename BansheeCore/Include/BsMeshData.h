@@ -11,6 +11,8 @@
 #include "BsDrawOps.h"
 #include "BsSubMesh.h"
 #include "BsBounds.h"
+#include "BsVector3.h"
+#include "BsVector4.h"
 
 namespace BansheeEngine
 {
@@ -90,6 +92,48 @@ namespace BansheeEngine
 		UINT32 mNumElements;
 	};
 
+	/**
+	 * @brief	Iterator that allows you to read vertex elements of any type in MeshData,
+	 *			decoded into floating point values.
+	 *
+	 * @note	Normalized integer types are converted into [0, 1] or [-1, 1] range. Quantized
+	 *			positions are transformed back into mesh space and octahedral encoded directions
+	 *			are expanded into unit vectors (see MeshQuantizer). Components not present in the 
+	 *			element are set to zero.
+	 */
+	class BS_CORE_EXPORT VertexElemDecodeIter
+	{
+	public:
+		VertexElemDecodeIter(UINT8* data, UINT32 byteStride, UINT32 numElements, VertexElementType type, 
+			VertexElementSemantic semantic, const Vector3& positionOffset, float positionScale);
+
+		/**
+		 * @brief	Returns the decoded value at the iterators current position.
+		 */
+		Vector4 getValue() const;
+
+		/**
+		 * @brief	Moves the iterator to the next position. Returns true
+		 *			if there are more elements.
+		 */
+		bool moveNext();
+
+		/**
+		 * @brief	Returns the number of elements this iterator can iterate over.
+		 */
+		UINT32 getNumElements() const { return mNumElements; }
+
+	private:
+		UINT8* mData;
+		UINT8* mEnd;
+		UINT32 mByteStride;
+		UINT32 mNumElements;
+		VertexElementType mType;
+		VertexElementSemantic mSemantic;
+		Vector3 mPositionOffset;
+		float mPositionScale;
+	};
+
 	/**
 	 * @brief	Used for initializing, updating and reading mesh data from Meshes.
 	 */
@@ -146,6 +190,34 @@ namespace BansheeEngine
 		 */
 		VertexElemIter<UINT32> getDWORDDataIter(VertexElementSemantic semantic, UINT32 semanticIdx = 0, UINT32 streamIdx = 0);
 
+		/**
+		 * @brief	Returns an iterator you can use for reading vertex elements of any type, decoded into
+		 *			Vector4 values. Use this when reading elements that might be quantized.
+		 * 			
+		 * @note	If vertex data of this semantic/index/stream doesn't exist and exception will be thrown.
+		 */
+		VertexElemDecodeIter getDecodedDataIter(VertexElementSemantic semantic, UINT32 semanticIdx = 0, UINT32 streamIdx = 0) const;
+
+		/**
+		 * @brief	Sets parameters used for decoding quantized VET_USHORT4_NORM positions. Decoded position
+		 *			is calculated as "offset + value * scale".
+		 */
+		void setPositionDecode(const Vector3& offset, float scale) { mPositionOffset = offset; mPositionScale = scale; }
+
+		/**
+		 * @brief	Returns the offset used for decoding quantized positions.
+		 *
+		 * @see		setPositionDecode
+		 */
+		const Vector3& getPositionDecodeOffset() const { return mPositionOffset; }
+
+		/**
+		 * @brief	Returns the scale used for decoding quantized positions.
+		 *
+		 * @see		setPositionDecode
+		 */
+		float getPositionDecodeScale() const { return mPositionScale; }
+
 		/**
 		 * @brief	Returns the total number of vertices this object can hold.
 		 */
@@ -277,6 +349,8 @@ namespace BansheeEngine
 	private:
 		friend class Mesh;
 		friend class MeshHeap;
+		friend class MeshOptimizer;
+		friend class MeshSimplifier;
 
 		UINT32 mDescBuilding;
 
@@ -286,6 +360,9 @@ namespace BansheeEngine
 
 		VertexDataDescPtr mVertexData;
 
+		Vector3 mPositionOffset;
+		float mPositionScale;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -28,6 +28,12 @@ namespace BansheeEngine
 		UINT32& getNumIndices(MeshData* obj) { return obj->mNumIndices; }
 		void setNumIndices(MeshData* obj, UINT32& value) { obj->mNumIndices = value; }
 
+		Vector3& getPositionOffset(MeshData* obj) { return obj->mPositionOffset; }
+		void setPositionOffset(MeshData* obj, Vector3& value) { obj->mPositionOffset = value; }
+
+		float& getPositionScale(MeshData* obj) { return obj->mPositionScale; }
+		void setPositionScale(MeshData* obj, float& value) { obj->mPositionScale = value; }
+
 		ManagedDataBlock getData(MeshData* obj) 
 		{ 
 			ManagedDataBlock dataBlock((UINT8*)obj->getData(), obj->getInternalBufferSize());
@@ -57,6 +63,9 @@ namespace BansheeEngine
 			addPlainField("mNumIndices", 3, &MeshDataRTTI::getNumIndices, &MeshDataRTTI::setNumIndices);
 
 			addDataBlockField("data", 4, &MeshDataRTTI::getData, &MeshDataRTTI::setData, 0, &MeshDataRTTI::allocateData);
+
+			addPlainField("mPositionOffset", 5, &MeshDataRTTI::getPositionOffset, &MeshDataRTTI::setPositionOffset);
+			addPlainField("mPositionScale", 6, &MeshDataRTTI::getPositionScale, &MeshDataRTTI::setPositionScale);
 		}
 
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
@@ -24,6 +24,13 @@ namespace BansheeEngine
 	 *			Downside is that this class may allocate 2-3x (or more) memory than it is actually needed
 	 *			for your data.
 	 *			
+	 *			Heap may also be created in streaming mode (see MeshHeap::createStreaming) which is meant
+	 *			for geometry that is rebuilt every frame. In that mode the buffers are split into a ring
+	 *			of per-frame regions, each protected by a single GPU fence, and mesh data is written directly
+	 *			into the GPU buffer without keeping a CPU copy. Render systems don't allow a buffer to stay mapped
+	 *			while it is used for drawing, so instead of a persistent mapping each mesh maps only its own range
+	 *			without overwrite checks.
+	 *
 	 *			Sim thread except where noted otherwise.
 	 */
 	class BS_CORE_EXPORT MeshHeap : public CoreObject
@@ -69,6 +76,29 @@ namespace BansheeEngine
 			UINT32 queryId;
 		};
 
+		/**
+		 * @brief	Represents a piece of data allocated for a mesh in streaming mode. Offsets
+		 *			are relative to the start of the frame region the mesh was allocated in.
+		 */
+		struct StreamAllocatedData
+		{
+			UINT32 frameIdx;
+			UINT32 vertOffset;
+			UINT32 idxOffset;
+		};
+
+		/**
+		 * @brief	Represents a single frame region of a streaming heap ring buffer.
+		 */
+		struct StreamFrameData
+		{
+			UINT32 numUsedVertices;
+			UINT32 numUsedIndices;
+
+			bool usedOnGPU;
+			UINT32 eventQueryIdx;
+		};
+
 	public:
 		~MeshHeap();
 
@@ -98,6 +128,38 @@ namespace BansheeEngine
 		static MeshHeapPtr create(UINT32 numVertices, UINT32 numIndices, 
 			const VertexDataDescPtr& vertexDesc, IndexBuffer::IndexType indexType = IndexBuffer::IT_32BIT);
 
+		/**
+		 * @brief	Creates a new mesh heap in streaming mode. Streaming heap is meant for geometry that is
+		 *			regenerated every frame (e.g. GUI, debug drawing, overlays).
+		 *
+		 *			Meshes allocated from a streaming heap are only valid until the next call to ::beginFrame,
+		 *			after which their data may be overwritten. Heap memory is split into a ring of 
+		 *			"numFrames" regions and only a single GPU fence is used per region, instead of one per mesh.
+		 *
+		 * @param	numVertices	Initial number of vertices a single frame may store. This will grow automatically if needed.
+		 * @param	numIndices	Initial number of indices a single frame may store. This will grow automatically if needed.
+		 * @param	vertexDesc	Description of the stored vertices.
+		 * @param	indexType	Type of the stored indices.
+		 * @param	numFrames	Number of frames the GPU is allowed to lag behind before the CPU needs to wait or
+		 *						discard the buffer contents.
+		 */
+		static MeshHeapPtr createStreaming(UINT32 numVertices, UINT32 numIndices, 
+			const VertexDataDescPtr& vertexDesc, IndexBuffer::IndexType indexType = IndexBuffer::IT_32BIT, UINT32 numFrames = 3);
+
+		/**
+		 * @brief	Advances the streaming heap to the next frame region. Must be called once per frame,
+		 *			before any meshes for that frame are allocated. All meshes allocated during the
+		 *			previous frame are released.
+		 *
+		 * @note	Only valid for heaps created with ::createStreaming.
+		 */
+		void beginFrame();
+
+		/**
+		 * @brief	Checks was the heap created in streaming mode.
+		 */
+		bool isStreaming() const { return mIsStreaming; }
+
 	private:
 		friend class TransientMesh;
 
@@ -105,7 +167,7 @@ namespace BansheeEngine
 		 * @copydoc	create
 		 */
 		MeshHeap(UINT32 numVertices, UINT32 numIndices, 
-			const VertexDataDescPtr& vertexDesc, IndexBuffer::IndexType indexType = IndexBuffer::IT_32BIT);
+			const VertexDataDescPtr& vertexDesc, IndexBuffer::IndexType indexType, bool isStreaming, UINT32 numFrames);
 
 		/**
 		 * @copydoc CoreObject::initialize_internal()
@@ -135,6 +197,33 @@ namespace BansheeEngine
 		 */
 		void deallocInternal(TransientMeshPtr mesh);
 
+		/**
+		 * @brief	Allocates a new mesh in the current frame region of a streaming heap, expanding the
+		 *			heap if needed. Data is written directly into the GPU buffers.
+		 *
+		 * @param	meshId		Mesh for which we are allocating the data.
+		 * @param	meshData	Data to initialize the new mesh with.
+		 *
+		 * @note	Core thread.
+		 */
+		void allocStreamingInternal(TransientMeshPtr mesh, const MeshDataPtr& meshData);
+
+		/**
+		 * @brief	Fences the current frame region of a streaming heap and moves to the
+		 *			next one.
+		 *
+		 * @note	Core thread.
+		 */
+		void beginFrameInternal();
+
+		/**
+		 * @brief	Resizes the frame regions of a streaming heap so that each may contain the provided
+		 *			number of vertices and indices. Data written during the current frame is preserved.
+		 *
+		 * @note	Core thread.
+		 */
+		void growStreamingBuffers(UINT32 numVertices, UINT32 numIndices);
+
 		/**
 		 * @brief	Resizes the vertex buffers so they max contain the provided
 		 *			number of vertices.
@@ -200,6 +289,12 @@ namespace BansheeEngine
 		 */
 		static void queryTriggered(MeshHeapPtr thisPtr, UINT32 meshId, UINT32 queryId);
 
+		/**
+		 * @brief	Called by an GPU event query when GPU processes the query. Signals the
+		 *			streaming heap that the GPU is done with a frame region.
+		 */
+		static void frameQueryTriggered(MeshHeapPtr thisPtr, UINT32 frameIdx, UINT32 queryId);
+
 		/**
 		 * @brief	Attempts to reorganize the vertex and index buffer chunks in order to 
 		 *			in order to make free memory contigous.
@@ -241,6 +336,12 @@ namespace BansheeEngine
 
 		UINT32 mNextQueryId;
 
+		bool mIsStreaming; // Immutable
+		UINT32 mNumFrames; // Immutable
+		UINT32 mCurFrame; // Core thread
+		Vector<StreamFrameData> mStreamFrames; // Core thread
+		Map<UINT32, StreamAllocatedData> mStreamAllocData; // Core thread
+
 		static const float GrowPercent;
 	};
 }
\ No newline at end of file
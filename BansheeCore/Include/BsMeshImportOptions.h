@@ -0,0 +1,83 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsImportOptions.h"
+
+namespace BansheeEngine
+{
+	/**
+	* @brief	Contains import options you may use to control how is a mesh imported.
+	*/
+	class BS_CORE_EXPORT MeshImportOptions : public ImportOptions
+	{
+	public:
+		MeshImportOptions();
+
+		/**
+		 * @brief	Enables or disables reordering of mesh triangles and vertices for more efficient rendering.
+		 *			This changes the order in which triangles of a sub-mesh are drawn.
+		 *
+		 * @see		MeshOptimizer::optimize
+		 */
+		void setOptimizeMesh(bool optimize) { mOptimizeMesh = optimize; }
+
+		/**
+		 * @brief	Checks will the triangles and vertices of the imported mesh be reordered for more efficient rendering.
+		 */
+		bool getOptimizeMesh() const { return mOptimizeMesh; }
+
+		/**
+		 * @brief	Sets the maximum number of levels of detail to generate for the mesh, including the full detail 
+		 *			level. Each level has roughly half the triangles of the previous one. Default is 1 (no simplified levels).
+		 *
+		 * @see		MeshSimplifier::generateLODs
+		 */
+		void setNumLODs(UINT32 numLODs) { mNumLODs = numLODs; }
+
+		/**
+		 * @brief	Returns the maximum number of levels of detail to generate for the mesh, including the full detail level.
+		 */
+		UINT32 getNumLODs() const { return mNumLODs; }
+
+		/**
+		 * @brief	Enables or disables storing vertex positions as 16-bit normalized integers relative to the mesh bounds.
+		 *
+		 * @see		MeshQuantizer::quantize
+		 */
+		void setQuantizePositions(bool quantize) { mQuantizePositions = quantize; }
+
+		/**
+		 * @brief	Checks will vertex positions be stored as 16-bit normalized integers.
+		 */
+		bool getQuantizePositions() const { return mQuantizePositions; }
+
+		/**
+		 * @brief	Enables or disables storing texture coordinates as 16-bit floating point values.
+		 *
+		 * @see		MeshQuantizer::quantize
+		 */
+		void setQuantizeTexCoords(bool quantize) { mQuantizeTexCoords = quantize; }
+
+		/**
+		 * @brief	Checks will texture coordinates be stored as 16-bit floating point values.
+		 */
+		bool getQuantizeTexCoords() const { return mQuantizeTexCoords; }
+
+		/************************************************************************/
+		/* 								SERIALIZATION                      		*/
+		/************************************************************************/
+	public:
+		friend class MeshImportOptionsRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		virtual RTTITypeBase* getRTTI() const;
+
+	private:
+		bool mOptimizeMesh;
+		UINT32 mNumLODs;
+		bool mQuantizePositions;
+		bool mQuantizeTexCoords;
+	};
+}
@@ -0,0 +1,52 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsRTTIType.h"
+#include "BsMeshImportOptions.h"
+
+namespace BansheeEngine
+{
+	class BS_CORE_EXPORT MeshImportOptionsRTTI : public RTTIType<MeshImportOptions, IReflectable, MeshImportOptionsRTTI>
+	{
+	private:
+		bool& getOptimizeMesh(MeshImportOptions* obj) { return obj->mOptimizeMesh; }
+		void setOptimizeMesh(MeshImportOptions* obj, bool& value) { obj->mOptimizeMesh = value; }
+
+		UINT32& getNumLODs(MeshImportOptions* obj) { return obj->mNumLODs; }
+		void setNumLODs(MeshImportOptions* obj, UINT32& value) { obj->mNumLODs = value; }
+
+		bool& getQuantizePositions(MeshImportOptions* obj) { return obj->mQuantizePositions; }
+		void setQuantizePositions(MeshImportOptions* obj, bool& value) { obj->mQuantizePositions = value; }
+
+		bool& getQuantizeTexCoords(MeshImportOptions* obj) { return obj->mQuantizeTexCoords; }
+		void setQuantizeTexCoords(MeshImportOptions* obj, bool& value) { obj->mQuantizeTexCoords = value; }
+
+	public:
+		MeshImportOptionsRTTI()
+		{
+			addPlainField("mOptimizeMesh", 0, &MeshImportOptionsRTTI::getOptimizeMesh, &MeshImportOptionsRTTI::setOptimizeMesh);
+			addPlainField("mNumLODs", 1, &MeshImportOptionsRTTI::getNumLODs, &MeshImportOptionsRTTI::setNumLODs);
+			addPlainField("mQuantizePositions", 2, &MeshImportOptionsRTTI::getQuantizePositions, &MeshImportOptionsRTTI::setQuantizePositions);
+			addPlainField("mQuantizeTexCoords", 4, &MeshImportOptionsRTTI::getQuantizeTexCoords, &MeshImportOptionsRTTI::setQuantizeTexCoords);
+		}
+
+		virtual const String& getRTTIName()
+		{
+			static String name = "MeshImportOptions";
+			return name;
+		}
+
+		virtual UINT32 getRTTIId()
+		{
+			return TID_MeshImportOptions;
+		}
+
+		virtual std::shared_ptr<IReflectable> newRTTIObject()
+		{
+			return bs_shared_ptr<MeshImportOptions, PoolAlloc>();
+		}
+	};
+}
@@ -0,0 +1,53 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsSubMesh.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Reorders triangles and vertices of mesh data so it can be rendered more efficiently.
+	 */
+	class BS_CORE_EXPORT MeshOptimizer
+	{
+	public:
+		/**
+		 * @brief	Size of the FIFO vertex cache used for calculating statistics.
+		 */
+		static const UINT32 DEFAULT_CACHE_SIZE = 16;
+
+		/**
+		 * @brief	Optimizes the mesh data in place, in three steps:
+		 *			 - Triangles of each sub-mesh are reordered to improve post-transform vertex cache use
+		 *			   (Forsyth's linear-speed algorithm).
+		 *			 - Triangles of each sub-mesh are split into clusters with a similar cache efficiency, and 
+		 *			   clusters facing outwards from the sub-mesh center are moved to the front to reduce overdraw.
+		 *			 - Vertices are reordered in the order they are first referenced by the index buffer, 
+		 *			   improving vertex fetch locality.
+		 *
+		 * @param	meshData	Mesh data to optimize.
+		 * @param	subMeshes	Sub-meshes referencing the mesh data. Index ranges of the sub-meshes remain the same. 
+		 *						Only sub-meshes using triangle lists have their triangles reordered.
+		 *
+		 * @note	Overdraw reordering is skipped if the mesh data has no VET_FLOAT3 position element.
+		 */
+		static void optimize(MeshData& meshData, const Vector<SubMesh>& subMeshes);
+
+		/**
+		 * @brief	Calculates the average cache miss ratio (number of transformed vertices per triangle) of a 
+		 *			triangle list sub-mesh when rendered using a FIFO vertex cache of the specified size. Values 
+		 *			range from 3 (worst) to about 0.5 (best).
+		 */
+		static float calculateACMR(const MeshData& meshData, const SubMesh& subMesh, UINT32 cacheSize = DEFAULT_CACHE_SIZE);
+
+		/**
+		 * @brief	Calculates the average transform to vertex ratio (number of transformed vertices per unique
+		 *			vertex) of a triangle list sub-mesh when rendered using a FIFO vertex cache of the specified 
+		 *			size. Values range from 1 (best) upwards.
+		 */
+		static float calculateATVR(const MeshData& meshData, const SubMesh& subMesh, UINT32 cacheSize = DEFAULT_CACHE_SIZE);
+	};
+}
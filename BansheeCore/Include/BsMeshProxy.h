@@ -6,6 +6,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsSubMesh.h"
 #include "BsBounds.h"
+#include "BsMatrix4.h"
 
 namespace BansheeEngine
 {
@@ -14,9 +15,14 @@ namespace BansheeEngine
 	 */
 	struct BS_CORE_EXPORT MeshProxy
 	{
+		MeshProxy()
+			:submeshIdx(0), positionDecode(Matrix4::IDENTITY)
+		{ }
+
 		std::weak_ptr<MeshBase> mesh;
 		SubMesh subMesh;
 		Bounds bounds;
 		UINT32 submeshIdx;
+		Matrix4 positionDecode; /**< Transform from quantized vertex positions into mesh space. See MeshQuantizer. */
 	};
 }
\ No newline at end of file
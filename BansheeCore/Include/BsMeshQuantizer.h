@@ -0,0 +1,49 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsVector2.h"
+#include "BsVector3.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Converts vertex elements of mesh data into smaller, quantized vertex element types.
+	 */
+	class BS_CORE_EXPORT MeshQuantizer
+	{
+	public:
+		/**
+		 * @brief	Creates a copy of the mesh data with some of its vertex elements quantized.
+		 *
+		 * @param	meshData			Mesh data to quantize.
+		 * @param	quantizePositions	If true, VET_FLOAT3 positions are stored as VET_USHORT4_NORM, relative to the
+		 *								mesh bounds. Decoding parameters are stored in the mesh data, see
+		 *								MeshData::getPositionDecodeOffset and MeshData::getPositionDecodeScale.
+		 *								The fourth component is always 1.
+		 * @param	quantizeDirections	If true, VET_FLOAT3 normals, tangents and bitangents are stored as
+		 *								VET_SHORT2_NORM, using octahedral encoding. None of the built-in shaders
+		 *								decode these, so only enable this for meshes rendered with custom shaders
+		 *								that use the same mapping as decodeOctahedral.
+		 * @param	quantizeTexCoords	If true, VET_FLOAT2 texture coordinates are stored as VET_HALF2.
+		 *
+		 * @return	Quantized mesh data, with the same indices and number of vertices as the original. Elements
+		 *			that were not quantized are copied unchanged.
+		 */
+		static MeshDataPtr quantize(const MeshDataPtr& meshData, bool quantizePositions, bool quantizeDirections,
+			bool quantizeTexCoords);
+
+		/**
+		 * @brief	Maps a unit length direction onto an octahedron unfolded into a square, returning coordinates
+		 *			in [-1, 1] range.
+		 */
+		static Vector2 encodeOctahedral(const Vector3& direction);
+
+		/**
+		 * @brief	Converts coordinates returned by encodeOctahedral back into a unit length direction.
+		 */
+		static Vector3 decodeOctahedral(const Vector2& encoded);
+	};
+}
@@ -0,0 +1,64 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsSubMesh.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Reduces the number of triangles in mesh data using edge collapses ordered by a quadric error metric.
+	 *			Used for generating mesh levels of detail.
+	 */
+	class BS_CORE_EXPORT MeshSimplifier
+	{
+	public:
+		/**
+		 * @brief	Screen size (fraction of the viewport height covered by the mesh bounding sphere radius) at which
+		 *			a simplified level of detail with half the triangles of the full detail mesh starts being used.
+		 */
+		static const float LOD_SCREEN_SIZE;
+
+		/**
+		 * @brief	Simplifies indices of a single triangle list sub-mesh. Vertex data is not modified, instead the
+		 *			simplified triangles reference a subset of the original vertices.
+		 *
+		 *			Vertices on mesh borders and on attribute seams (vertices with the same position but different
+		 *			attributes, e.g. UV borders or hard edges) are only moved along the border or seam they belong to.
+		 *
+		 * @param	meshData			Mesh data containing a VET_FLOAT3 position element and the sub-mesh indices.
+		 * @param	subMesh				Triangle list sub-mesh to simplify.
+		 * @param	targetIndexCount	Number of indices the simplification should reduce the sub-mesh to.
+		 * @param	maxError			Maximum allowed error, as distance relative to the size of the mesh bounds.
+		 *								Simplification stops before reaching the target index count if no more
+		 *								triangles can be removed within the error.
+		 * @param	output				Simplified indices, appended at the end of the vector.
+		 *
+		 * @return	Number of indices appended to the output.
+		 */
+		static UINT32 simplify(const MeshData& meshData, const SubMesh& subMesh, UINT32 targetIndexCount,
+			float maxError, Vector<UINT32>& output);
+
+		/**
+		 * @brief	Generates levels of detail for the provided mesh data. Each level has roughly half the triangles
+		 *			of the previous one.
+		 *
+		 * @param	meshData		Mesh data containing a VET_FLOAT3 position element.
+		 * @param	subMeshes		Sub-meshes of the full detail mesh. Each sub-mesh is simplified separately, and 
+		 *							vertices shared between sub-meshes are never moved so sub-mesh boundaries stay intact.
+		 * @param	numLODs			Maximum number of levels of detail, including the full detail mesh. Less levels
+		 *							are generated if the mesh can't be simplified any further.
+		 * @param	lodSubMeshes	Sub-meshes of the generated levels of detail, excluding the full detail level.
+		 *							For each level there are as many entries as there are sub-meshes, in the same order.
+		 * @param	lodScreenSizes	Screen size below which each generated level of detail should be used. See
+		 *							MeshBase::getLODScreenSize.
+		 *
+		 * @return	New mesh data containing the original vertices, and indices of all levels of detail placed after
+		 *			the original indices. Returns the original mesh data if no levels of detail were generated.
+		 */
+		static MeshDataPtr generateLODs(const MeshDataPtr& meshData, const Vector<SubMesh>& subMeshes, UINT32 numLODs,
+			Vector<SubMesh>& lodSubMeshes, Vector<float>& lodScreenSizes);
+	};
+}
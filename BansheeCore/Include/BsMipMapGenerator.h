@@ -0,0 +1,34 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsPixelUtil.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Generates mip-map chains by repeatedly downsampling the source image with a separable filter.
+	 *
+	 *			Filtering is done in floating point, in linear space, and each level is filtered from the
+	 *			unquantized previous level. Rows of each level are split between multiple tasks if the task
+	 *			scheduler is running.
+	 */
+	class BS_CORE_EXPORT MipMapGenerator
+	{
+	public:
+		/**
+		 * @brief	Generates a full mip-map chain for the provided source data.
+		 *
+		 * @param	src			Data to generate the mip-maps from. Must not be compressed.
+		 * @param	options		Options controlling the filter, wrapping and post-processing of the generated levels.
+		 * @param	dstFormat	Format to write the generated levels in. Levels are written directly in this format
+		 *						without intermediate copies. If PF_UNKNOWN, format of the source data is used.
+		 *
+		 * @returns	A list of generated mip-map levels. First entry is the base level and others follow in
+		 *			order from largest to smallest.
+		 */
+		static Vector<PixelDataPtr> generate(const PixelData& src, const MipMapGenOptions& options, PixelFormat dstFormat = PF_UNKNOWN);
+	};
+}
@@ -0,0 +1,49 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsPixelData.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Specialized routine that converts a row of pixels between two specific formats.
+	 */
+	struct PixelConversionKernel
+	{
+		typedef void(*Func)(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle);
+
+		PixelConversionKernel()
+			:func(nullptr)
+		{
+			swizzle[0] = swizzle[1] = swizzle[2] = swizzle[3] = 0;
+		}
+
+		/**
+		 * @brief	Converts a number of consecutive pixels from source to destination.
+		 */
+		void convert(const UINT8* src, UINT8* dst, UINT32 numPixels) const { func(src, dst, numPixels, swizzle); }
+
+		Func func;
+		UINT8 swizzle[4]; /**< Source channel of each destination channel. Unused by kernels that don't reorder channels. */
+	};
+
+	/**
+	 * @brief	Registry of specialized routines for converting pixels between pairs of formats, used
+	 *			for speeding up the most common conversions that would otherwise go through
+	 *			floating point one pixel at a time.
+	 *
+	 *			Kernels use SSE2, SSSE3 or F16C instructions when the CPU supports them.
+	 */
+	class BS_CORE_EXPORT PixelConversion
+	{
+	public:
+		/**
+		 * @brief	Returns a kernel converting pixels from the source to the destination format,
+		 *			or null if there is no specialized kernel for the pair.
+		 */
+		static const PixelConversionKernel* findKernel(PixelFormat srcFormat, PixelFormat dstFormat);
+	};
+}
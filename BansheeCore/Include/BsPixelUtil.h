@@ -19,6 +19,18 @@ namespace BansheeEngine
 		Highest
 	};
 
+	/**
+	 * @brief	Available implementations of texture compression.
+	 *
+	 * @note	NVTT is always used unless the built-in compressor is explicitly requested through
+	 *			CompressionOptions::backend.
+	 */
+	enum class CompressionBackend
+	{
+		NVTT, /**< NVIDIA texture tools. Supports all options. */
+		Builtin /**< Built-in block compressor. Faster, but doesn't support alpha mode, sRGB, or normal map options for color formats. */
+	};
+
 	/**
 	 * @brief	Specifies what is alpha channel used for in the texture.
 	 */
@@ -46,7 +58,8 @@ namespace BansheeEngine
 	{
 		Box,
 		Triangle,
-		Kaiser
+		Kaiser,
+		Lanczos
 	};
 
 	/**
@@ -59,6 +72,7 @@ namespace BansheeEngine
 		bool isNormalMap = false;
 		bool isSRGB = false;
 		CompressionQuality quality = CompressionQuality::Normal;
+		CompressionBackend backend = CompressionBackend::NVTT;
 	};
 
 	/**
@@ -70,6 +84,9 @@ namespace BansheeEngine
 		MipMapWrapMode wrapMode = MipMapWrapMode::Mirror;
 		bool isNormalMap = false;
 		bool normalizeMipmaps = false;
+		bool isSRGB = false; /**< If true color channels are converted to linear space before filtering. Ignored for normal maps. */
+		bool preserveAlphaCoverage = false; /**< If true alpha of each level is scaled so the same portion of pixels passes the alpha cutoff as in the base level. */
+		float alphaCoverageCutoff = 0.5f; /**< Alpha test reference value used when preserving alpha coverage. */
 	};
 
 	/**
@@ -84,7 +101,11 @@ namespace BansheeEngine
 		enum Filter
 		{
 			FILTER_NEAREST,
-			FILTER_LINEAR
+			FILTER_LINEAR,
+			FILTER_BICUBIC, /**< Catmull-Rom cubic. Sharp, with slight ringing around edges. */
+			FILTER_MITCHELL, /**< Mitchell-Netravali cubic. Balance between sharpness and ringing. */
+			FILTER_LANCZOS3, /**< Three lobed Lanczos. Sharpest, but with the most ringing. */
+			FILTER_AREA /**< Average of all the source pixels covered by a destination pixel. Meant for downscaling. */
 		};
 
 		/**
@@ -235,11 +256,19 @@ namespace BansheeEngine
 		/**
 		 * @brief	Converts pixels from one format to another. Provided pixel data objects
 		 *			must have previously allocated buffers of adequate size and their sizes must match.
+		 *
+		 * @note	Data in BC1 to BC5 formats can be decompressed to any uncompressed format.
 		 */
         static void bulkPixelConversion(const PixelData& src, PixelData& dst);
 
 		/**
 		 * @brief	Compresses the provided data using the specified compression options. 
+		 *
+		 * @note	Built-in backend supports only BC1 to BC5 formats. Its "Fastest" quality uses bounding box
+		 *			endpoint selection, while all other qualities use a slower principal axis fit. It throws an
+		 *			exception if a non-default alpha mode or sRGB is requested, or if a normal map is to be 
+		 *			stored in BC1 to BC3 formats. Normal maps in BC4 and BC5 formats are supported since 
+		 *			their channels are encoded independently.
 		 */
 		static void compress(const PixelData& src, PixelData& dst, const CompressionOptions& options);
 
@@ -247,15 +276,22 @@ namespace BansheeEngine
 		 * @brief	Generates mip-maps from the provided source data using the specified compression options.
 		 *			Returned list includes the base level.
 		 *
+		 * @param	src			Data to generate the mip-maps from.
+		 * @param	options		Options controlling mip-map generation.
+		 * @param	dstFormat	Format of the returned mip-map data. If PF_UNKNOWN, format of the source data is used.
+		 *
 		 * @returns	A list of calculated mip-map data. First entry is the largest mip and other follow in
 		 *			order from largest to smallest.
 		 */
-		static Vector<PixelDataPtr> genMipmaps(const PixelData& src, const MipMapGenOptions& options);
+		static Vector<PixelDataPtr> genMipmaps(const PixelData& src, const MipMapGenOptions& options, PixelFormat dstFormat = PF_UNKNOWN);
 
 		/**
 		 * @brief	Scales pixel data in the source buffer and stores the scaled data in the destination buffer.
 		 *			Provided pixel data objects must have previously allocated buffers of adequate size. You may
 		 *			also provided a filtering method to use when scaling.
+		 *
+		 * @note	Filters other than nearest and linear are only supported for two dimensional data, and
+		 *			3D data falls back to the linear filter.
 		 */
 		static void scale(const PixelData& src, PixelData& dst, Filter filter = FILTER_LINEAR);
 
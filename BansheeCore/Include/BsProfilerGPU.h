@@ -39,6 +39,7 @@ namespace BansheeEngine
 
 		UINT32 numResourceWrites; /**< How many times were GPU resources written to. */
 		UINT32 numResourceReads; /**< How many times were GPU resources read from. */
+		UINT32 numBytesUploaded; /**< How many bytes of dynamic geometry were uploaded to the GPU. */
 
 		UINT32 numObjectsCreated; /**< How many GPU objects were created. */
 		UINT32 numObjectsDestroyed; /**< How many GPU objects were destroyed. */
@@ -28,13 +28,14 @@ namespace BansheeEngine
 	struct BS_CORE_EXPORT RenderStatsData
 	{
 		RenderStatsData()
-		: numDrawCalls(0), numRenderTargetChanges(0), numPresents(0), numClears(0),
+		: numDrawCalls(0), numInstances(0), numRenderTargetChanges(0), numPresents(0), numClears(0),
 		  numVertices(0), numPrimitives(0), numBlendStateChanges(0), numRasterizerStateChanges(0), 
 		  numDepthStencilStateChanges(0), numTextureBinds(0), numSamplerBinds(0), numVertexBufferBinds(0), 
-		  numIndexBufferBinds(0), numGpuParamBufferBinds(0), numGpuProgramBinds(0)
+		  numIndexBufferBinds(0), numGpuParamBufferBinds(0), numGpuProgramBinds(0), numBytesUploaded(0)
 		{ }
 
 		UINT64 numDrawCalls;
+		UINT64 numInstances;
 		UINT64 numRenderTargetChanges;
 		UINT64 numPresents;
 		UINT64 numClears;
@@ -56,6 +57,8 @@ namespace BansheeEngine
 		UINT64 numResourceWrites;
 		UINT64 numResourceReads;
 
+		UINT64 numBytesUploaded;
+
 		UINT64 numObjectsCreated; 
 		UINT64 numObjectsDestroyed;
 	};
@@ -72,6 +75,10 @@ namespace BansheeEngine
 		 *  render system API Draw methods called. */
 		void incNumDrawCalls() { mData.numDrawCalls++; }
 
+		/** Increments instance counter indicating how many object
+		 *  instances were drawn. Non-instanced draws count as one instance. */
+		void addNumInstances(UINT32 count) { mData.numInstances += count; }
+
 		/** Increments render target change counter indicating how many
 		 *  times did the active render target change. */
 		void incNumRenderTargetChanges() { mData.numRenderTargetChanges++; }
@@ -128,6 +135,10 @@ namespace BansheeEngine
 		 *  times was a GPU program bound to the pipeline. */
 		void incNumGpuProgramBinds() { mData.numGpuProgramBinds++; }
 
+		/** Increments uploaded bytes counter indicating how much dynamic
+		 *  geometry data was written to GPU buffers. */
+		void addNumBytesUploaded(UINT32 count) { mData.numBytesUploaded += count; }
+
 		/**
 		 * Increments created GPU resource counter. 
 		 *
@@ -160,6 +160,15 @@ namespace BansheeEngine
 		 */
 		virtual void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount) = 0;
 
+		/**
+		 * @brief	Draws multiple instances of an object based on currently bound GPU programs, vertex declaration, 
+		 *			vertex and index buffers. Vertex elements with a non-zero instance step rate are advanced per instance
+		 *			instead of per vertex.
+		 *
+		 * @note	Requires RSC_INSTANCING capability.
+		 */
+		virtual void drawIndexedInstanced(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount) = 0;
+
 		/**
 		 * @brief	Swap the front and back buffer of the specified render target.
 		 */
@@ -63,6 +63,8 @@ namespace BansheeEngine
 		RSC_HWRENDER_TO_VERTEX_BUFFER	= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 27), /**< Supports rendering to vertex buffers. */
 		RSC_TESSELLATION_PROGRAM		= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 28), /**< Supports hardware tessellation programs. */
 		RSC_COMPUTE_PROGRAM				= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 29), /**< Supports hardware compute programs. */
+		RSC_INSTANCING					= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 30), /**< Supports instanced draw calls and per-instance vertex data. */
+		RSC_PARAM_BLOCK_OFFSETS			= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 31), /**< Supports binding a part of a GPU param block buffer, starting at an offset. */
 
 		// ***** DirectX 9 specific caps *****
 		RSC_PERSTAGECONSTANT = BS_CAPS_VALUE(CAPS_CATEGORY_D3D9, 0), /**< Are per stage constants supported. */
@@ -240,6 +242,17 @@ namespace BansheeEngine
 			mNumMultiRenderTargets = num;
 		}
 
+		/**
+		 * @brief	Sets the alignment in bytes required for offsets of GPU param block buffers bound
+		 *			at an offset.
+		 *
+		 * @see		RSC_PARAM_BLOCK_OFFSETS
+		 */
+		void setParamBlockOffsetAlignment(UINT32 alignment)
+		{
+			mParamBlockOffsetAlignment = alignment;
+		}
+
 		/**
 		 * @brief	Returns the number of texture units supported per pipeline stage.
 		 */
@@ -309,6 +322,17 @@ namespace BansheeEngine
 			return mNumMultiRenderTargets;
 		}
 
+		/**
+		 * @brief	Returns the alignment in bytes required for offsets of GPU param block buffers
+		 *			bound at an offset.
+		 *
+		 * @see		RSC_PARAM_BLOCK_OFFSETS
+		 */
+		UINT32 getParamBlockOffsetAlignment() const
+		{
+			return mParamBlockOffsetAlignment;
+		}
+
 		/**
 		 * @brief	Sets a capability flag indicating this capability is supported.
 		 */
@@ -644,6 +668,8 @@ namespace BansheeEngine
 		UINT16 mFragmentProgramConstantBoolCount = 0;
 		// The number of simultaneous render targets supported
 		UINT16 mNumMultiRenderTargets = 0;
+		// Alignment of offsets param block buffers are bound at
+		UINT32 mParamBlockOffsetAlignment = 256;
 		// The maximum point size in pixels
 		float mMaxPointSize = 0.0f;
 		// The number of vertices a geometry program can emit in a single run
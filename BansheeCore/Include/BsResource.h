@@ -28,6 +28,24 @@ namespace BansheeEngine
 		 */
 		void setName(const String& name) { mName = name; }
 
+		/**
+		 * @brief	Returns the approximate number of bytes of system memory used by the resource.
+		 *			Used for residency tracking and monitoring.
+		 */
+		virtual UINT32 getCPUMemorySize() const { return 0; }
+
+		/**
+		 * @brief	Returns the approximate number of bytes of GPU memory used by the resource.
+		 *			Used for residency tracking and monitoring.
+		 */
+		virtual UINT32 getGPUMemorySize() const { return 0; }
+
+		/**
+		 * @brief	Returns all resources this resource references and that have to be available 
+		 *			whenever this resource is loaded (e.g. texture pages of a font).
+		 */
+		virtual void getResourceDependencies(Vector<HResource>& dependencies) const { }
+
 	protected:
 		friend class Resources;
 
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "BsIReflectable.h"
+#include "BsUUID.h"
 
 namespace BansheeEngine
 {
@@ -20,7 +21,7 @@ namespace BansheeEngine
 		{ }
 
 		std::shared_ptr<Resource> mPtr;
-		String mUUID;
+		Guid mUUID;
 		bool mIsCreated;	
 	};
 
@@ -48,7 +49,7 @@ namespace BansheeEngine
 		/**
 		 * @brief	Returns the UUID of the resource the handle is referring to.
 		 */
-		const String& getUUID() const { return mData != nullptr ? mData->mUUID : StringUtil::BLANK; }
+		const Guid& getUUID() const { return mData != nullptr ? mData->mUUID : Guid::EMPTY; }
 
 		/**
 		 * @brief	Gets the handle data. For internal use only.
@@ -64,11 +65,22 @@ namespace BansheeEngine
 		 *			multithreaded nature of resource loading.
 		 *			Internal method.
 		 */
-		void _setHandleData(std::shared_ptr<Resource> ptr, const String& uuid);
+		void _setHandleData(std::shared_ptr<Resource> ptr, const Guid& uuid);
+
+		/**
+		 * @brief	Makes this handle refer to the same resource as the provided handle.
+		 */
+		ResourceHandleBase& operator=(const ResourceHandleBase& other);
 
 	protected:
 		ResourceHandleBase();
 
+		/**
+		 * @brief	Releases the reference to the shared handle data, notifying the resource manager
+		 *			if this was the last handle to the resource outside of the manager.
+		 */
+		void releaseData();
+
 		std::shared_ptr<ResourceHandleData> mData;
 
 	private:
@@ -109,7 +121,7 @@ namespace BansheeEngine
 		 * @brief	Constructs an invalid handle with the specified UUID. You must call _setHandleData
 		 *			with the actual resource pointer to make the handle valid.
 		 */
-		ResourceHandle(const String& uuid)
+		ResourceHandle(const Guid& uuid)
 			:ResourceHandleBase()
 		{
 			mData = bs_shared_ptr<ResourceHandleData, PoolAlloc>();
@@ -154,7 +166,7 @@ namespace BansheeEngine
 		 */
 		ResourceHandle<T>& operator=(std::nullptr_t ptr)
 		{ 	
-			mData = nullptr;
+			releaseData();
 			return *this;
 		}
 
@@ -208,7 +220,7 @@ namespace BansheeEngine
 		 * @note	Handle will take ownership of the provided resource pointer, so make sure you don't
 		 *			delete it elsewhere.
 		 */
-		explicit ResourceHandle(T* ptr, const String& uuid)
+		explicit ResourceHandle(T* ptr, const Guid& uuid)
 			:ResourceHandleBase()
 		{
 			mData = bs_shared_ptr<ResourceHandleData, PoolAlloc>();
@@ -218,7 +230,7 @@ namespace BansheeEngine
 		/**
 		 * @brief	Constructs a new valid handle for the provided resource with the provided UUID.
 		 */
-		ResourceHandle(std::shared_ptr<T> ptr, const String& uuid)
+		ResourceHandle(std::shared_ptr<T> ptr, const Guid& uuid)
 			:ResourceHandleBase()
 		{
 			mData = bs_shared_ptr<ResourceHandleData, PoolAlloc>();
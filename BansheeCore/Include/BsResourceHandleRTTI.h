@@ -13,25 +13,40 @@ namespace BansheeEngine
 	class BS_CORE_EXPORT ResourceHandleRTTI : public RTTIType<ResourceHandleBase, IReflectable, ResourceHandleRTTI>
 	{
 	private:
-		String& getUUID(ResourceHandleBase* obj) 
+		Guid& getUUID(ResourceHandleBase* obj) 
 		{ 
-			static String Blank = "";
+			static Guid Blank;
 
 			return obj->mData != nullptr ? obj->mData->mUUID : Blank; 
 		}
 
-		void setUUID(ResourceHandleBase* obj, String& uuid) { obj->mData->mUUID = uuid; } 
+		void setUUID(ResourceHandleBase* obj, Guid& uuid) { obj->mData->mUUID = uuid; } 
+
+		// Handles used to be serialized with a string UUID. We never write it anymore but
+		// still read it so older data remains valid.
+		String& getLegacyUUID(ResourceHandleBase* obj) 
+		{ 
+			static String Blank = "";
+			return Blank; 
+		}
+
+		void setLegacyUUID(ResourceHandleBase* obj, String& uuid) 
+		{ 
+			if(!uuid.empty())
+				obj->mData->mUUID = Guid(uuid); 
+		} 
 	public:
 		ResourceHandleRTTI()
 		{
-			addPlainField("mUUID", 0, &ResourceHandleRTTI::getUUID, &ResourceHandleRTTI::setUUID);
+			addPlainField("mUUIDLegacy", 0, &ResourceHandleRTTI::getLegacyUUID, &ResourceHandleRTTI::setLegacyUUID);
+			addPlainField("mUUID", 1, &ResourceHandleRTTI::getUUID, &ResourceHandleRTTI::setUUID);
 		}
 
 		void onDeserializationEnded(IReflectable* obj)
 		{
 			ResourceHandleBase* resourceHandle = static_cast<ResourceHandleBase*>(obj);
 
-			if(resourceHandle->mData && resourceHandle->mData->mUUID != "")
+			if(resourceHandle->mData && !resourceHandle->mData->mUUID.empty())
 			{
 				// NOTE: This will cause Resources::load to be called recursively with resources that contain other
 				// resources. This might cause problems. Keep this note here as a warning until I prove otherwise.
@@ -6,6 +6,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsIReflectable.h"
 #include "BsPath.h"
+#include "BsUUID.h"
 
 namespace BansheeEngine
 {
@@ -34,35 +35,55 @@ namespace BansheeEngine
 		/**
 		 * @brief	Registers a new resource in the manifest.
 		 */
-		void registerResource(const String& uuid, const Path& filePath);
+		void registerResource(const Guid& uuid, const Path& filePath);
 
 		/**
 		 * @brief	Removes a resource from the manifest.
 		 */
-		void unregisterResource(const String& uuid);
+		void unregisterResource(const Guid& uuid);
 
 		/**
 		 * @brief	Attempts to find a resource with the provided UUID and outputs the path
 		 *			to the resource if found. Returns true if UUID was found, false otherwise.
 		 */
-		bool uuidToFilePath(const String& uuid, Path& filePath) const;
+		bool uuidToFilePath(const Guid& uuid, Path& filePath) const;
 
 		/**
 		 * @brief	Attempts to find a resource with the provided path and outputs the UUID
 		 *			to the resource if found. Returns true if path was found, false otherwise.
 		 */
-		bool filePathToUUID(const Path& filePath, String& outUUID) const;
+		bool filePathToUUID(const Path& filePath, Guid& outUUID) const;
 
 		/**
 		 * @brief	Checks if provided UUID exists in the manifest.
 		 */
-		bool uuidExists(const String& uuid) const;
+		bool uuidExists(const Guid& uuid) const;
 
 		/**
 		 * @brief	Checks if the provided path exists in the manifest.
 		 */
 		bool filePathExists(const Path& filePath) const;
 
+		/**
+		 * @brief	Sets a path to a resource package containing all resources in this manifest.
+		 *			When set, resources from this manifest are loaded from the package instead of
+		 *			from their individual files. Provide an empty path to load from individual files.
+		 *
+		 * @see		ResourcePackage
+		 */
+		void setPackagePath(const Path& packagePath) { mPackagePath = packagePath; }
+
+		/**
+		 * @brief	Returns the path to the resource package containing resources in this manifest.
+		 *			Empty if resources are loaded from individual files.
+		 */
+		const Path& getPackagePath() const { return mPackagePath; }
+
+		/**
+		 * @brief	Checks are resources in this manifest loaded from a resource package.
+		 */
+		bool isPackaged() const { return !mPackagePath.isEmpty(); }
+
 		/**
 		 * @brief	Saves the resource manifest to the specified location.
 		 *
@@ -90,8 +111,9 @@ namespace BansheeEngine
 
 	private:
 		String mName;
-		UnorderedMap<String, Path> mUUIDToFilePath;
-		UnorderedMap<Path, String> mFilePathToUUID;
+		UnorderedMap<Guid, Path> mUUIDToFilePath;
+		UnorderedMap<Path, Guid> mFilePathToUUID;
+		Path mPackagePath;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
@@ -103,6 +125,7 @@ namespace BansheeEngine
 		static ResourceManifestPtr createEmpty();
 
 	public:
+		friend class ResourcePackage;
 		friend class ResourceManifestRTTI;
 		static RTTITypeBase* getRTTIStatic();
 		virtual RTTITypeBase* getRTTI() const;
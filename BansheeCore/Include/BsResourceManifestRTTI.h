@@ -23,12 +23,12 @@ namespace BansheeEngine
 			obj->mName = val;
 		}
 
-		UnorderedMap<String, Path>& getUUIDMap(ResourceManifest* obj)
+		UnorderedMap<Guid, Path>& getUUIDMap(ResourceManifest* obj)
 		{ 
 			return obj->mUUIDToFilePath;
 		}
 
-		void setUUIDMap(ResourceManifest* obj, UnorderedMap<String, Path>& val)
+		void setUUIDMap(ResourceManifest* obj, UnorderedMap<Guid, Path>& val)
 		{ 
 			obj->mUUIDToFilePath = val; 
 
@@ -39,11 +39,42 @@ namespace BansheeEngine
 				obj->mFilePathToUUID[entry.second] = entry.first;
 			}
 		} 
+
+		// Manifests used to store string UUIDs. They are never written anymore, but are
+		// converted to binary UUIDs when older manifests are loaded.
+		UnorderedMap<String, Path>& getLegacyUUIDMap(ResourceManifest* obj)
+		{ 
+			static UnorderedMap<String, Path> Blank;
+			return Blank;
+		}
+
+		void setLegacyUUIDMap(ResourceManifest* obj, UnorderedMap<String, Path>& val)
+		{ 
+			for(auto& entry : val)
+			{
+				Guid uuid(entry.first);
+
+				obj->mUUIDToFilePath[uuid] = entry.second;
+				obj->mFilePathToUUID[entry.second] = uuid;
+			}
+		} 
+
+		Path& getPackagePath(ResourceManifest* obj)
+		{
+			return obj->mPackagePath;
+		}
+
+		void setPackagePath(ResourceManifest* obj, Path& val)
+		{
+			obj->mPackagePath = val;
+		}
 	public:
 		ResourceManifestRTTI()
 		{
 			addPlainField("mName", 0, &ResourceManifestRTTI::getName, &ResourceManifestRTTI::setName);
-			addPlainField("mUUIDToFilePath", 1, &ResourceManifestRTTI::getUUIDMap, &ResourceManifestRTTI::setUUIDMap);
+			addPlainField("mUUIDToFilePathLegacy", 1, &ResourceManifestRTTI::getLegacyUUIDMap, &ResourceManifestRTTI::setLegacyUUIDMap);
+			addPlainField("mUUIDToFilePath", 2, &ResourceManifestRTTI::getUUIDMap, &ResourceManifestRTTI::setUUIDMap);
+			addPlainField("mPackagePath", 3, &ResourceManifestRTTI::getPackagePath, &ResourceManifestRTTI::setPackagePath);
 		}
 
 		virtual const String& getRTTIName()
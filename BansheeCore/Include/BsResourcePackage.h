@@ -0,0 +1,103 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsUUID.h"
+#include "BsPath.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	A single archive file containing many serialized resources. Archive starts with
+	 *			a table of contents sorted by resource UUID, followed by resource data. Each
+	 *			resource is stored in the same format Resources::save writes to disk, optionally
+	 *			compressed.
+	 *
+	 *			Archive is memory mapped when opened, so loading a resource requires no file system
+	 *			calls and multiple resources may be loaded from different threads in parallel.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT ResourcePackage
+	{
+	public:
+		/**
+		 * @brief	Flags that control how a single entry is stored in the archive.
+		 */
+		enum EntryFlags
+		{
+			EF_Compressed = 0x01
+		};
+
+		/**
+		 * @brief	Table of contents entry for a single resource.
+		 */
+		struct Entry
+		{
+			Guid uuid;
+			UINT64 offset; /**< Offset of the resource data from the start of the archive, in bytes. */
+			UINT32 size; /**< Size of the resource data stored in the archive, in bytes. */
+			UINT32 uncompressedSize; /**< Size of the resource data after decompression, in bytes. */
+			UINT32 flags; /**< Combination of EntryFlags. */
+		};
+
+		ResourcePackage(const Path& path);
+
+		/**
+		 * @brief	Returns the path of the archive file.
+		 */
+		const Path& getPath() const { return mPath; }
+
+		/**
+		 * @brief	Returns the table of contents, sorted by UUID.
+		 */
+		const Vector<Entry>& getEntries() const { return mEntries; }
+
+		/**
+		 * @brief	Checks does the archive contain a resource with the provided UUID.
+		 */
+		bool contains(const Guid& uuid) const;
+
+		/**
+		 * @brief	Decompresses (if needed) and deserializes the resource with the provided UUID.
+		 *			Throws an exception if the resource is not in the archive.
+		 */
+		ResourcePtr load(const Guid& uuid) const;
+
+		/**
+		 * @brief	Opens and memory maps the archive at the specified location.
+		 */
+		static ResourcePackagePtr open(const Path& path);
+
+		/**
+		 * @brief	Builds an archive containing all resources registered in the provided manifest.
+		 *			Resources are read from the locations stored in the manifest.
+		 *
+		 * @param	manifest	Manifest whose resources to store in the archive. Its package path
+		 *						is set to the newly built archive, so saving the manifest afterwards
+		 *						makes Resources load from the archive instead of loose files.
+		 * @param	path		Full pathname of the archive file to create. Existing file is overwritten.
+		 * @param	compress	If true, entries are compressed unless compression wouldn't save
+		 *						a meaningful amount of space.
+		 */
+		static void build(const ResourceManifestPtr& manifest, const Path& path, bool compress = true);
+
+	private:
+		/**
+		 * @brief	Finds the table of contents entry for the provided UUID. Returns null if not found.
+		 */
+		const Entry* findEntry(const Guid& uuid) const;
+
+		static const UINT32 MAGIC;
+		static const UINT32 VERSION;
+		static const UINT32 HEADER_SIZE;
+		static const UINT32 TOC_ENTRY_SIZE;
+		static const UINT32 DATA_ALIGNMENT;
+
+		Path mPath;
+		MappedFilePtr mFile;
+		Vector<Entry> mEntries;
+	};
+}
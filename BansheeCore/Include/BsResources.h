@@ -8,6 +8,20 @@
 
 namespace BansheeEngine
 {
+	/**
+	 * @brief	Memory used by all resident resources of a single type.
+	 */
+	struct ResourceMemoryStats
+	{
+		ResourceMemoryStats()
+			:numResources(0), cpuBytes(0), gpuBytes(0)
+		{ }
+
+		UINT32 numResources; /**< Number of loaded resources of this type. */
+		UINT64 cpuBytes; /**< System memory used by resources of this type, in bytes. */
+		UINT64 gpuBytes; /**< GPU memory used by resources of this type, in bytes. */
+	};
+
 	/**
 	 * @brief	Manager for dealing with all engine resources. It allows you to save 
 	 *			new resources and load existing ones.
@@ -62,7 +76,7 @@ namespace BansheeEngine
 		 * @brief	Loads the resource with the given UUID. Returns an empty handle if resource can't be loaded.
 		 *			Resource is loaded synchronously.
 		 */
-		HResource loadFromUUID(const String& uuid);
+		HResource loadFromUUID(const Guid& uuid);
 
 		/**
 		 * @brief	Loads the resource with the given UUID asynchronously. Initially returned resource handle will be invalid
@@ -73,7 +87,7 @@ namespace BansheeEngine
 		 * @note	You can use returned invalid handle in engine systems as the engine will check for handle
 		 *			validity before using it.
 		 */
-		HResource loadFromUUIDAsync(const String& uuid);
+		HResource loadFromUUIDAsync(const Guid& uuid);
 
 		/**
 		 * @brief	Unloads the resource that is referenced by the handle. 
@@ -90,6 +104,33 @@ namespace BansheeEngine
 		 */
 		void unloadAllUnused();
 
+		/**
+		 * @brief	Sets the maximum number of bytes (CPU and GPU combined) resident resources are allowed
+		 *			to use. When the budget is exceeded resources that are no longer referenced are unloaded
+		 *			automatically, least recently used ones first. Set to zero to disable the budget.
+		 *
+		 * @note	Only resources that can be found in one of the registered manifests are unloaded, so
+		 *			that they can be reloaded transparently on next access.
+		 */
+		void setMemoryBudget(UINT64 numBytes);
+
+		/**
+		 * @brief	Returns the memory budget for resident resources, in bytes. Zero if disabled.
+		 *
+		 * @see		setMemoryBudget
+		 */
+		UINT64 getMemoryBudget() const;
+
+		/**
+		 * @brief	Returns the total number of bytes (CPU and GPU combined) used by all loaded resources.
+		 */
+		UINT64 getResidentBytes() const;
+
+		/**
+		 * @brief	Returns memory used by loaded resources, grouped by resource RTTI type id.
+		 */
+		Map<UINT32, ResourceMemoryStats> getResidentMemoryPerType() const;
+
 		/**
 		 * @brief	Saves the resource at the specified location.
 		 *
@@ -114,6 +155,23 @@ namespace BansheeEngine
 		 */
 		HResource _createResourceHandle(const ResourcePtr& obj);
 
+		/**
+		 * @brief	Updates residency information for all loaded resources and unloads unused resources
+		 *			if the memory budget is exceeded.
+		 *
+		 * @note	Internal method. Called once per frame. Cost is proportional to the number of resources
+		 *			released since the last call, plus the number of resources unloaded.
+		 */
+		void _update();
+
+		/**
+		 * @brief	Notifies the manager that the last handle to a resource, apart from the one held
+		 *			by the manager, is being released.
+		 *
+		 * @note	Internal method. Thread safe.
+		 */
+		void _notifyHandleReleased(const Guid& uuid);
+
 		/**
 		 * @brief	Allows you to set a resource manifest containing UUID <-> file path mapping that is
 		 * 			used when resolving resource references.
@@ -122,6 +180,9 @@ namespace BansheeEngine
 		 * 			find that resource even after application restart, then you must save the resource
 		 * 			manifest before closing the application and restore it upon startup.
 		 * 			Otherwise resources will be assigned brand new UUIDs and references will be broken.
+		 *
+		 *			If the manifest references a resource package, the package is opened and all resources
+		 *			in the manifest will be loaded from it.
 		 */
 		void registerResourceManifest(const ResourceManifestPtr& manifest);
 
@@ -140,20 +201,51 @@ namespace BansheeEngine
 		 * @brief	Attempts to retrieve file path from the provided UUID. Returns true
 		 *			if successful, false otherwise.
 		 */
-		bool getFilePathFromUUID(const String& uuid, Path& filePath) const;
+		bool getFilePathFromUUID(const Guid& uuid, Path& filePath) const;
 
 		/**
 		 * @brief	Attempts to retrieve UUID from the provided file path. Returns true
 		 *			if successful, false otherwise.
 		 */
-		bool getUUIDFromFilePath(const Path& path, String& uuid) const;
+		bool getUUIDFromFilePath(const Path& path, Guid& uuid) const;
 
 	private:
+		/**
+		 * @brief	Residency information about a single loaded resource.
+		 */
+		struct ResidencyData
+		{
+			UINT32 typeId;
+			UINT32 cpuBytes;
+			UINT32 gpuBytes;
+
+			bool isUnused;
+			List<Guid>::iterator unusedIter;
+		};
+
 		/**
 		 * @brief	Starts resource loading or returns an already loaded resource.
 		 */
 		HResource loadInternal(const Path& filePath, bool synchronous);
 
+		/**
+		 * @brief	Starts loading the resource with the specified UUID from the provided path, 
+		 *			or returns an already loaded resource.
+		 */
+		HResource loadInternal(const Guid& uuid, const Path& filePath, bool synchronous);
+
+		/**
+		 * @brief	Returns the resource with the specified UUID if it is loaded or currently
+		 *			being loaded. Returns an empty handle otherwise.
+		 */
+		HResource findLoaded(const Guid& uuid, bool synchronous);
+
+		/**
+		 * @brief	Returns the resource package the resource with the specified UUID should be loaded from,
+		 *			or null if it should be loaded from its own file.
+		 */
+		ResourcePackagePtr findPackage(const Guid& uuid) const;
+
 		/**
 		 * @brief	Performs actually reading and deserializing of the resource file. 
 		 *			Called from various worker threads.
@@ -162,18 +254,45 @@ namespace BansheeEngine
 
 		/**
 		 * @brief	Callback triggered when the task manager is ready to process the loading task.
+		 *
+		 * @param	filePath	Path to the resource file. Ignored if package is provided.
+		 * @param	package		Package to load the resource from. If null the resource is loaded from its file.
+		 * @param	resource	Handle to the resource being loaded.
+		 */
+		void loadCallback(const Path& filePath, const ResourcePackagePtr& package, HResource& resource);
+
+		/**
+		 * @brief	Starts tracking memory usage of a newly loaded resource.
+		 *
+		 * @note	Caller must hold the loaded resource mutex.
 		 */
-		void loadCallback(const Path& filePath, HResource& resource);
+		void addResidency(const Guid& uuid, const ResourcePtr& resource);
+
+		/**
+		 * @brief	Stops tracking memory usage of a resource that has been unloaded.
+		 *
+		 * @note	Caller must hold the loaded resource mutex.
+		 */
+		void removeResidency(const Guid& uuid);
 
 	private:
 		Vector<ResourceManifestPtr> mResourceManifests;
 		ResourceManifestPtr mDefaultResourceManifest;
+		UnorderedMap<String, ResourcePackagePtr> mResourcePackages; // Packages of packaged manifests, keyed by manifest name
 
 		BS_MUTEX(mInProgressResourcesMutex);
 		BS_MUTEX(mLoadedResourceMutex);
+		BS_MUTEX(mReleasedResourcesMutex);
+
+		Vector<Guid> mReleasedResources; // Resources whose last external handle was released since last update, in release order
+
+		UnorderedMap<Guid, HResource> mLoadedResources;
+		UnorderedMap<Guid, HResource> mInProgressResources; // Resources that are being asynchronously loaded
 
-		UnorderedMap<String, HResource> mLoadedResources;
-		UnorderedMap<String, HResource> mInProgressResources; // Resources that are being asynchronously loaded
+		UnorderedMap<Guid, ResidencyData> mResidency;
+		List<Guid> mUnusedResources; // Resources not referenced by anything, most recently released first
+		UINT64 mResidentBytes;
+		UINT64 mMemoryBudget;
 	};
 
 	/**
@@ -11,6 +11,7 @@
 #include "BsCoreSceneManager.h"
 #include "BsGameObjectManager.h"
 #include "BsGameObject.h"
+#include "BsComponentPool.h"
 
 namespace BansheeEngine
 {
@@ -338,9 +339,10 @@ namespace BansheeEngine
 			static_assert((std::is_base_of<BansheeEngine::Component, T>::value),
 				"Specified type is not a valid Component.");
 
-			std::shared_ptr<T> gameObject(new (bs_alloc<T, PoolAlloc>()) T(mThisHandle,
+			ComponentPool* pool = &getComponentPool<T>();
+			std::shared_ptr<T> gameObject(new (pool->allocate()) T(mThisHandle,
 				std::forward<Args>(args)...),
-				&bs_delete<PoolAlloc, T>, StdAlloc<PoolAlloc>());
+				[pool](T* component) { component->~T(); pool->free(component); }, StdAlloc<PoolAlloc>());
 
 			GameObjectHandle<T> newComponent =
 				GameObjectHandle<T>(GameObjectManager::instance().registerObject(gameObject));
@@ -431,12 +433,24 @@ namespace BansheeEngine
 		{
 			static_assert((std::is_base_of<BansheeEngine::Component, T>::value), "Specified type is not a valid Component.");
 
-			std::shared_ptr<T> gameObject(new (bs_alloc<T, PoolAlloc>()) T(), &bs_delete<PoolAlloc, T>, StdAlloc<PoolAlloc>());
+			ComponentPool* pool = &getComponentPool<T>();
+			std::shared_ptr<T> gameObject(new (pool->allocate()) T(), 
+				[pool](T* component) { component->~T(); pool->free(component); }, StdAlloc<PoolAlloc>());
 			GameObjectHandle<T>(GameObjectManager::instance().registerObject(gameObject));
 
 			return gameObject;
 		}
 
+		/**
+		 * @brief	Returns the pool that memory for components of type T is allocated from.
+		 */
+		template <typename T>
+		static ComponentPool& getComponentPool()
+		{
+			static ComponentPool& pool = ComponentPool::getPool(T::getRTTIStatic()->getRTTIId(), (UINT32)sizeof(T));
+			return pool;
+		}
+
 		/**
 		 * @brief	Adds the component to the internal component array.
 		 */
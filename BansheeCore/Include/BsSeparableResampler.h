@@ -0,0 +1,32 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsPixelUtil.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Performs pixel data resampling using a separable filter, first filtering every row and
+	 *			then every column using precomputed weights for each axis. When downscaling the filter
+	 *			is stretched to cover all source pixels, so there is no aliasing regardless of the ratio.
+	 *
+	 *			Pixel formats with one byte or one float per channel are resampled directly, other
+	 *			formats are converted to floating point first. Rows are split between multiple tasks
+	 *			if the task scheduler is running.
+	 */
+	class BS_CORE_EXPORT SeparableResampler
+	{
+	public:
+		/**
+		 * @brief	Resamples the source data into destination data. Only two dimensional data is supported.
+		 *
+		 * @param	source	Data to resample.
+		 * @param	dest	Buffer to receive the resampled data, in any format the source format can be converted to.
+		 * @param	filter	Filter to use, one of FILTER_BICUBIC, FILTER_MITCHELL, FILTER_LANCZOS3 or FILTER_AREA.
+		 */
+		static void scale(const PixelData& source, const PixelData& dest, PixelUtil::Filter filter);
+	};
+}
@@ -128,6 +128,16 @@ namespace BansheeEngine
 		 */
 		void setAllowSeparablePasses(bool enable);
 
+		/**
+		 * @brief	Enables or disables instancing. When enabled the renderer is free to draw multiple objects
+		 *			using the same mesh and material with a single draw call. Per-object data is then provided
+		 *			to the vertex program as per-instance vertex inputs, in a format determined by the active
+		 *			renderer, instead of through per-object parameters.
+		 *
+		 * @note	Only enable this for shaders whose vertex programs read the renderer's per-instance inputs.
+		 */
+		void setAllowInstancing(bool enable);
+
 		/**
 		 * @brief	Returns currently active queue sort type.
 		 *
@@ -149,6 +159,13 @@ namespace BansheeEngine
 		 */
 		bool getAllowSeparablePasses() const { return mSeparablePasses; }
 
+		/**
+		 * @brief	Returns if instancing is allowed.
+		 *
+		 * @see		setAllowInstancing
+		 */
+		bool getAllowInstancing() const { return mInstancing; }
+
 		/**
 		 * @brief	Registers a new data (int, Vector2, etc.) parameter you that you may then use 
 		 *			via Material by providing the parameter name. All parameters internally map to 
@@ -312,6 +329,7 @@ namespace BansheeEngine
 		QueueSortType mQueueSortType;
 		UINT32 mQueuePriority;
 		bool mSeparablePasses;
+		bool mInstancing;
 		Vector<TechniquePtr> mTechniques;
 		UINT32 mCoreDirtyFlags;
 
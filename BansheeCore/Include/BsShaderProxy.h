@@ -13,6 +13,7 @@ namespace BansheeEngine
 		QueueSortType queueSortType;
 		UINT32 queuePriority;
 		bool separablePasses;
+		bool instancing;
 
 		Map<String, SHADER_DATA_PARAM_DESC> dataParams;
 		Map<String, SHADER_OBJECT_PARAM_DESC> objectParams;
@@ -214,6 +214,9 @@ namespace BansheeEngine
 		bool& getAllowSeparablePasses(Shader* obj) { return obj->mSeparablePasses; }
 		void setAllowSeparablePasses(Shader* obj, bool& value) { obj->mSeparablePasses = value; }
 
+		bool& getAllowInstancing(Shader* obj) { return obj->mInstancing; }
+		void setAllowInstancing(Shader* obj, bool& value) { obj->mInstancing = value; }
+
 
 	public:
 		ShaderRTTI()
@@ -232,6 +235,7 @@ namespace BansheeEngine
 			addPlainField("mQueueSortType", 5, &ShaderRTTI::getQueueSortType, &ShaderRTTI::setQueueSortType);
 			addPlainField("mQueuePriority", 6, &ShaderRTTI::getQueuePriority, &ShaderRTTI::setQueuePriority);
 			addPlainField("mSeparablePasses", 7, &ShaderRTTI::getAllowSeparablePasses, &ShaderRTTI::setAllowSeparablePasses);
+			addPlainField("mInstancing", 8, &ShaderRTTI::getAllowInstancing, &ShaderRTTI::setAllowInstancing);
 		}
 
 		virtual const String& getRTTIName()
@@ -33,6 +33,18 @@ namespace BansheeEngine
 		 */
 		virtual bool isMagicNumberSupported(const UINT8* magicNumPtr, UINT32 numBytes) const = 0; 
 
+		/**
+		 * @brief	Returns the version of the importer. Must be increased whenever a change to the
+		 *			importer changes the imported data, so previously cached imports are discarded.
+		 */
+		virtual UINT32 getVersion() const { return 0; }
+
+		/**
+		 * @brief	Returns true if import() may be called from multiple threads at once. Such importers
+		 *			are run in parallel when importing multiple files using Importer::importBatch.
+		 */
+		virtual bool isThreadSafe() const { return false; }
+
 		/**
 		 * @brief	Imports the given file.
 		 *
@@ -36,10 +36,11 @@ namespace BansheeEngine
 			 *
 			 * @param	charIdx		Sequential index of the character in the original string.
 			 * @param	desc		Character description from the font.
+			 * @param	fontData	Font data the character belongs to, used for kerning lookup.
 			 *
 			 * @returns		How many pixels did the added character expand the word by.
 			 */
-			UINT32 addChar(UINT32 charIdx, const CHAR_DESC& desc);
+			UINT32 addChar(UINT32 charIdx, const CHAR_DESC& desc, const FontData& fontData);
 
 			/**
 			 * @brief	Adds a space to the word. Word must have previously have been declared as
@@ -269,6 +270,25 @@ namespace BansheeEngine
 		 */
 		BS_CORE_EXPORT UINT32 getHeight() const;
 
+		/**
+		 * @brief	Adds a reference to the glyphs of a dynamic font used by the text, preventing the glyph cache
+		 *			from evicting them. Text data holds one such reference after construction. Returns false if
+		 *			all references were released and the glyph cache evicted glyphs since, in which case the
+		 *			text data is no longer valid and must be created anew.
+		 *
+		 * @note	Internal method. Used for caching text that isn't currently in use. Not thread safe.
+		 */
+		BS_CORE_EXPORT bool _pinGlyphs();
+
+		/**
+		 * @brief	Releases a reference added by ::_pinGlyphs, or the one held since construction. Once all
+		 *			are released the glyph cache is allowed to evict the glyphs, and the text data must not be
+		 *			used until ::_pinGlyphs succeeds.
+		 *
+		 * @note	Internal method. Not thread safe.
+		 */
+		BS_CORE_EXPORT void _unpinGlyphs();
+
 	private:
 		friend class TextLine;
 
@@ -312,11 +332,17 @@ namespace BansheeEngine
 
 		HFont mFont;
 		const FontData* mFontData;
+		GlyphCachePtr mGlyphCache;
+		UINT32 mNumGlyphPins;
+		UINT64 mUnpinEvictionCount;
 
 		// Static buffers used to reduce runtime memory allocation
 	private:
 		static BS_THREADLOCAL bool BuffersInitialized;
 
+		static BS_THREADLOCAL const CHAR_DESC** CharBuffer;
+		static BS_THREADLOCAL UINT32 CharBufferSize;
+
 		static BS_THREADLOCAL TextWord* WordBuffer;
 		static BS_THREADLOCAL UINT32 WordBufferSize;
 		static BS_THREADLOCAL UINT32 NextFreeWord;
@@ -335,6 +361,11 @@ namespace BansheeEngine
 		 */
 		static void initAlloc();
 
+		/**
+		 * @brief	Ensures the character buffer can hold at least the specified number of characters.
+		 */
+		static void allocChars(UINT32 numChars);
+
 		/**
 		 * @brief	Allocates a new word and adds it to the buffer. Returns index of the word
 		 *			in the word buffer.
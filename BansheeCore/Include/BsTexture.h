@@ -140,6 +140,11 @@ namespace BansheeEngine
          */
         virtual UINT32 getNumFaces() const;
 
+		/**
+		 * @copydoc Resource::getGPUMemorySize
+		 */
+		virtual UINT32 getGPUMemorySize() const;
+
 		/**
 		 * @copydoc GpuResource::writeSubresource
 		 */
@@ -34,6 +34,23 @@ namespace BansheeEngine
 		 */
 		void setMaxMip(UINT32 maxMip) { mMaxMip = maxMip; }
 
+		/**
+		 * @brief	Sets whether the texture data is in gamma (sRGB) space. If true, color channels are
+		 *			converted to linear space before mipmaps are filtered.
+		 */
+		void setSRGB(bool srgb) { mSRGB = srgb; }
+
+		/**
+		 * @brief	Enables or disables scaling of mipmap alpha so each mip level has the same portion of
+		 *			pixels passing the alpha cutoff as the base level. Use this for alpha tested textures.
+		 */
+		void setPreserveAlphaCoverage(bool preserve) { mPreserveAlphaCoverage = preserve; }
+
+		/**
+		 * @brief	Sets the alpha test reference value used when preserving alpha coverage.
+		 */
+		void setAlphaCutoff(float cutoff) { mAlphaCutoff = cutoff; }
+
 		/**
 		 * @brief	Gets the pixel format that the imported texture will have.
 		 */
@@ -50,6 +67,21 @@ namespace BansheeEngine
 		 */
 		UINT32 getMaxMip() const { return mMaxMip; }
 
+		/**
+		 * @brief	Checks is the texture data in gamma (sRGB) space.
+		 */
+		bool getSRGB() const { return mSRGB; }
+
+		/**
+		 * @brief	Checks will mipmap alpha be scaled to preserve alpha test coverage.
+		 */
+		bool getPreserveAlphaCoverage() const { return mPreserveAlphaCoverage; }
+
+		/**
+		 * @brief	Gets the alpha test reference value used when preserving alpha coverage.
+		 */
+		float getAlphaCutoff() const { return mAlphaCutoff; }
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -62,5 +94,8 @@ namespace BansheeEngine
 		PixelFormat mFormat;
 		bool mGenerateMips;
 		UINT32 mMaxMip;
+		bool mSRGB;
+		bool mPreserveAlphaCoverage;
+		float mAlphaCutoff;
 	};
 }
\ No newline at end of file
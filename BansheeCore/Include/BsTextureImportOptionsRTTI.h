@@ -21,12 +21,24 @@ namespace BansheeEngine
 		UINT32& getMaxMip(TextureImportOptions* obj) { return obj->mMaxMip; }
 		void setMaxMip(TextureImportOptions* obj, UINT32& value) { obj->mMaxMip = value; }
 
+		bool& getSRGB(TextureImportOptions* obj) { return obj->mSRGB; }
+		void setSRGB(TextureImportOptions* obj, bool& value) { obj->mSRGB = value; }
+
+		bool& getPreserveAlphaCoverage(TextureImportOptions* obj) { return obj->mPreserveAlphaCoverage; }
+		void setPreserveAlphaCoverage(TextureImportOptions* obj, bool& value) { obj->mPreserveAlphaCoverage = value; }
+
+		float& getAlphaCutoff(TextureImportOptions* obj) { return obj->mAlphaCutoff; }
+		void setAlphaCutoff(TextureImportOptions* obj, float& value) { obj->mAlphaCutoff = value; }
+
 	public:
 		TextureImportOptionsRTTI()
 		{
 			addPlainField("mPixelFormat", 0, &TextureImportOptionsRTTI::getPixelFormat, &TextureImportOptionsRTTI::setPixelFormat);
 			addPlainField("mGenerateMips", 1, &TextureImportOptionsRTTI::getGenerateMips, &TextureImportOptionsRTTI::setGenerateMips);
 			addPlainField("mMaxMip", 2, &TextureImportOptionsRTTI::getMaxMip, &TextureImportOptionsRTTI::setMaxMip);
+			addPlainField("mSRGB", 3, &TextureImportOptionsRTTI::getSRGB, &TextureImportOptionsRTTI::setSRGB);
+			addPlainField("mPreserveAlphaCoverage", 4, &TextureImportOptionsRTTI::getPreserveAlphaCoverage, &TextureImportOptionsRTTI::setPreserveAlphaCoverage);
+			addPlainField("mAlphaCutoff", 5, &TextureImportOptionsRTTI::getAlphaCutoff, &TextureImportOptionsRTTI::setAlphaCutoff);
 		}
 
 		virtual const String& getRTTIName()
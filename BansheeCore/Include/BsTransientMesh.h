@@ -70,7 +70,7 @@ namespace BansheeEngine
 		/**
 		 * @copydoc	MeshBase::_createProxy
 		 */
-		MeshProxyPtr _createProxy(UINT32 subMeshIdx);
+		MeshProxyPtr _createProxy(UINT32 subMeshIdx, UINT32 lodIdx = 0);
 
 	protected:
 		friend class MeshHeap;
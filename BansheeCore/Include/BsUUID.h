@@ -5,11 +5,131 @@
 
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
+#include "BsCommonTypes.h"
 #include "BsSpinLock.h"
+#include "BsRTTIPrerequisites.h"
+#include "BsUtil.h"
 #include <random>
 
 namespace BansheeEngine
 {
+	/**
+	 * @brief	Represents a universally unique identifier, packed into 128 bits. Comparison and hashing
+	 *			operate directly on the binary data which makes it cheap to use as a map key.
+	 *
+	 * @note	Use ::toString and the string constructor only when interfacing with humans or legacy data.
+	 *
+	 * @note	Not named UUID because that name is taken by a typedef in the Windows headers.
+	 */
+	class BS_CORE_EXPORT Guid
+	{
+	public:
+		/**
+		 * @brief	Initializes an empty UUID.
+		 */
+		Guid()
+		{
+			mData[0] = 0;
+			mData[1] = 0;
+			mData[2] = 0;
+			mData[3] = 0;
+		}
+
+		/**
+		 * @brief	Initializes an UUID using its 128 bit binary representation.
+		 */
+		Guid(UINT32 data0, UINT32 data1, UINT32 data2, UINT32 data3)
+		{
+			mData[0] = data0;
+			mData[1] = data1;
+			mData[2] = data2;
+			mData[3] = data3;
+		}
+
+		/**
+		 * @brief	Initializes an UUID from its string representation ("xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx").
+		 *			Results in an empty UUID if the string cannot be parsed.
+		 */
+		explicit Guid(const String& uuid);
+
+		bool operator== (const Guid& rhs) const
+		{
+			return mData[0] == rhs.mData[0] && mData[1] == rhs.mData[1] && 
+				mData[2] == rhs.mData[2] && mData[3] == rhs.mData[3];
+		}
+
+		bool operator!= (const Guid& rhs) const
+		{
+			return !(*this == rhs);
+		}
+
+		bool operator< (const Guid& rhs) const
+		{
+			for (UINT32 i = 0; i < 4; i++)
+			{
+				if (mData[i] != rhs.mData[i])
+					return mData[i] < rhs.mData[i];
+			}
+
+			return false;
+		}
+
+		/**
+		 * @brief	Checks has the UUID been initialized to a valid value.
+		 */
+		bool empty() const
+		{
+			return mData[0] == 0 && mData[1] == 0 && mData[2] == 0 && mData[3] == 0;
+		}
+
+		/**
+		 * @brief	Converts the UUID to its string representation.
+		 */
+		String toString() const;
+
+		static Guid EMPTY;
+
+	private:
+		friend struct std::hash<Guid>;
+
+		UINT32 mData[4];
+	};
+
+	/**
+	 * @brief	RTTIPlainType specialization for UUID that allows it to be serialized as a value type.
+	 *
+	 * @see		RTTIPlainType
+	 */
+	template<> struct RTTIPlainType<Guid>
+	{	
+		enum { id = TID_UUID }; enum { hasDynamicSize = 0 };
+
+		/**
+		 * @copydoc		RTTIPlainType::toMemory
+		 */
+		static void toMemory(const Guid& data, char* memory)
+		{ 
+			memcpy(memory, &data, sizeof(Guid));
+		}
+
+		/**
+		 * @copydoc		RTTIPlainType::fromMemory
+		 */
+		static UINT32 fromMemory(Guid& data, char* memory)
+		{ 
+			memcpy(&data, memory, sizeof(Guid));
+			return sizeof(Guid);
+		}
+
+		/**
+		 * @copydoc		RTTIPlainType::getDynamicSize
+		 */
+		static UINT32 getDynamicSize(const Guid& data)	
+		{ 
+			return sizeof(Guid);
+		}	
+	}; 
+
 	/**
 	 * @brief	Utility class for generating universally unique identifiers.
 	 *
@@ -31,7 +151,7 @@ namespace BansheeEngine
 		/**
 		 * @brief	Generate a new random universally unique identifier.
 		 */
-		String generateRandom();
+		Guid generateRandom();
 
 	private:
 		std::mt19937 mRandomGenerator;
@@ -39,4 +159,22 @@ namespace BansheeEngine
 		SpinLock mSpinLock;
 		bool mHaveMacAddress;
 	};
-}
\ No newline at end of file
+}
+
+/**
+ * @brief	Hash value generator for UUID.
+ */
+template<>
+struct std::hash<BansheeEngine::Guid>
+{
+	size_t operator()(const BansheeEngine::Guid& value) const
+	{
+		size_t hash = 0;
+		BansheeEngine::hash_combine(hash, value.mData[0]);
+		BansheeEngine::hash_combine(hash, value.mData[1]);
+		BansheeEngine::hash_combine(hash, value.mData[2]);
+		BansheeEngine::hash_combine(hash, value.mData[3]);
+
+		return hash;
+	}
+};
\ No newline at end of file
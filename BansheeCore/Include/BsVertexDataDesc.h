@@ -76,6 +76,8 @@ namespace BansheeEngine
 	private:
 		friend class Mesh;
 		friend class MeshHeap;
+		friend class MeshOptimizer;
+		friend class MeshSimplifier;
 
 		/**
 		 * @brief	Returns the largest stream index of all the stored vertex elements.
@@ -45,7 +45,10 @@ namespace BansheeEngine
         VET_COLOR_ARGB = 10,
         VET_COLOR_ABGR = 11,
 		VET_UINT4 = 12,
-		VET_SINT4 = 13
+		VET_SINT4 = 13,
+		VET_USHORT4_NORM = 14, /**< Four unsigned 16-bit integers, normalized to [0, 1] range. */
+		VET_SHORT2_NORM = 15, /**< Two signed 16-bit integers, normalized to [-1, 1] range. */
+		VET_HALF2 = 16 /**< Two 16-bit floating point values. */
     };
 
 	/**
@@ -127,6 +130,7 @@ namespace BansheeEngine
     {
     public:
         typedef List<VertexElement> VertexElementList;
+		typedef Map<UINT16, UINT32> InstanceStepRateMap;
 
 	public:
         virtual ~VertexDeclaration();
@@ -165,13 +169,21 @@ namespace BansheeEngine
 		 */
 		virtual UINT32 getVertexSize(UINT16 source);
 
+		/**
+		 * @brief	Returns at what rate do elements using the provided source index advance during
+		 *			instanced rendering. Zero means the elements advance once per vertex, and any other 
+		 *			value means they advance once per that many instances.
+		 */
+		UINT32 getInstanceStepRate(UINT16 source) const;
+
     protected:
 		friend class HardwareBufferManager;
 
-		VertexDeclaration(const VertexElementList& elements);
+		VertexDeclaration(const VertexElementList& elements, const InstanceStepRateMap& instanceStepRates);
 
 	protected:
 		VertexElementList mElementList;
+		InstanceStepRateMap mInstanceStepRates; // Not serialized, only used by declarations created at runtime
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
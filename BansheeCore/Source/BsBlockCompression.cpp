@@ -0,0 +1,907 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsBlockCompression.h"
+#include "BsPixelUtil.h"
+#include "BsTaskScheduler.h"
+#include "BsMath.h"
+#include "BsException.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Number of rows of blocks processed by a single task.
+	 */
+	static const UINT32 BLOCK_ROWS_PER_TASK = 8;
+
+	/**
+	 * @brief	Four pixels by four pixels of R8G8B8A8 data, in row major order.
+	 */
+	typedef UINT8 BlockPixels[16][4];
+
+	/************************************************************************/
+	/* 								COLOR BLOCKS                     		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Quantizes a color with channels in [0, 255] range to 5:6:5 bits.
+	 */
+	static UINT16 packColor565(const float* color)
+	{
+		UINT32 r = (UINT32)Math::clamp(color[0] * (31.0f / 255.0f) + 0.5f, 0.0f, 31.0f);
+		UINT32 g = (UINT32)Math::clamp(color[1] * (63.0f / 255.0f) + 0.5f, 0.0f, 63.0f);
+		UINT32 b = (UINT32)Math::clamp(color[2] * (31.0f / 255.0f) + 0.5f, 0.0f, 31.0f);
+
+		return (UINT16)((r << 11) | (g << 5) | b);
+	}
+
+	/**
+	 * @brief	Expands a 5:6:5 color to 8 bits per channel.
+	 */
+	static void unpackColor565(UINT16 color, INT32* output)
+	{
+		INT32 r = (color >> 11) & 0x1F;
+		INT32 g = (color >> 5) & 0x3F;
+		INT32 b = color & 0x1F;
+
+		output[0] = (r << 3) | (r >> 2);
+		output[1] = (g << 2) | (g >> 4);
+		output[2] = (b << 3) | (b >> 2);
+	}
+
+	/**
+	 * @brief	Calculates the colors a color block with the provided endpoints decodes to.
+	 *
+	 * @param	fourColors	If true two colors are interpolated between the endpoints. Otherwise one
+	 *						color is interpolated and the last color is transparent black.
+	 */
+	static void buildColorPalette(UINT16 color0, UINT16 color1, bool fourColors, INT32 (&palette)[4][3])
+	{
+		unpackColor565(color0, palette[0]);
+		unpackColor565(color1, palette[1]);
+
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			if(fourColors)
+			{
+				palette[2][i] = (2 * palette[0][i] + palette[1][i]) / 3;
+				palette[3][i] = (palette[0][i] + 2 * palette[1][i]) / 3;
+			}
+			else
+			{
+				palette[2][i] = (palette[0][i] + palette[1][i]) / 2;
+				palette[3][i] = 0;
+			}
+		}
+	}
+
+	/**
+	 * @brief	Assigns the closest palette color to each pixel. Pixels in the transparent mask always
+	 *			get the last palette entry.
+	 *
+	 * @return	Sum of squared differences between the pixels and their assigned colors.
+	 */
+	static UINT32 selectColorIndices(const BlockPixels& pixels, const INT32 (&palette)[4][3], UINT32 numColors,
+		UINT32 transparentMask, UINT32& indices)
+	{
+		indices = 0;
+
+		UINT32 totalError = 0;
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			UINT32 bestIdx = 3;
+			UINT32 bestError = 0;
+
+			if((transparentMask & (1 << i)) == 0)
+			{
+				bestError = std::numeric_limits<UINT32>::max();
+				for(UINT32 j = 0; j < numColors; j++)
+				{
+					INT32 dr = pixels[i][0] - palette[j][0];
+					INT32 dg = pixels[i][1] - palette[j][1];
+					INT32 db = pixels[i][2] - palette[j][2];
+
+					UINT32 error = (UINT32)(dr * dr + dg * dg + db * db);
+					if(error < bestError)
+					{
+						bestError = error;
+						bestIdx = j;
+					}
+				}
+			}
+
+			indices |= bestIdx << (i * 2);
+			totalError += bestError;
+		}
+
+		return totalError;
+	}
+
+	/**
+	 * @brief	Picks endpoints from the corners of the bounding box of the opaque pixels, inset slightly
+	 *			towards its center.
+	 */
+	static void fitColorEndpointsFast(const BlockPixels& pixels, UINT32 transparentMask, float* start, float* end)
+	{
+		float minColor[3] = { 255.0f, 255.0f, 255.0f };
+		float maxColor[3] = { 0.0f, 0.0f, 0.0f };
+		float mean[3] = { 0.0f, 0.0f, 0.0f };
+
+		UINT32 numPixels = 0;
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			if((transparentMask & (1 << i)) != 0)
+				continue;
+
+			for(UINT32 j = 0; j < 3; j++)
+			{
+				minColor[j] = std::min(minColor[j], (float)pixels[i][j]);
+				maxColor[j] = std::max(maxColor[j], (float)pixels[i][j]);
+				mean[j] += pixels[i][j];
+			}
+
+			numPixels++;
+		}
+
+		if(numPixels == 0)
+		{
+			for(UINT32 i = 0; i < 3; i++)
+				start[i] = end[i] = 0.0f;
+
+			return;
+		}
+
+		for(UINT32 i = 0; i < 3; i++)
+			mean[i] /= numPixels;
+
+		// Bounding box diagonal from min to max might go against the trend of the colors, so flip the
+		// red and blue extents if they are inversely correlated with green
+		float covRG = 0.0f;
+		float covBG = 0.0f;
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			if((transparentMask & (1 << i)) != 0)
+				continue;
+
+			float dg = pixels[i][1] - mean[1];
+			covRG += (pixels[i][0] - mean[0]) * dg;
+			covBG += (pixels[i][2] - mean[2]) * dg;
+		}
+
+		if(covRG < 0.0f)
+			std::swap(minColor[0], maxColor[0]);
+
+		if(covBG < 0.0f)
+			std::swap(minColor[2], maxColor[2]);
+
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			float inset = (maxColor[i] - minColor[i]) / 16.0f;
+
+			start[i] = maxColor[i] - inset;
+			end[i] = minColor[i] + inset;
+		}
+	}
+
+	/**
+	 * @brief	Picks endpoints from the extents of the opaque pixels along their principal axis.
+	 */
+	static void fitColorEndpointsPCA(const BlockPixels& pixels, UINT32 transparentMask, float* start, float* end)
+	{
+		float mean[3] = { 0.0f, 0.0f, 0.0f };
+
+		UINT32 numPixels = 0;
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			if((transparentMask & (1 << i)) != 0)
+				continue;
+
+			for(UINT32 j = 0; j < 3; j++)
+				mean[j] += pixels[i][j];
+
+			numPixels++;
+		}
+
+		if(numPixels == 0)
+		{
+			for(UINT32 i = 0; i < 3; i++)
+				start[i] = end[i] = 0.0f;
+
+			return;
+		}
+
+		for(UINT32 i = 0; i < 3; i++)
+			mean[i] /= numPixels;
+
+		float covariance[3][3] = { { 0.0f } };
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			if((transparentMask & (1 << i)) != 0)
+				continue;
+
+			float diff[3];
+			for(UINT32 j = 0; j < 3; j++)
+				diff[j] = pixels[i][j] - mean[j];
+
+			for(UINT32 j = 0; j < 3; j++)
+			{
+				for(UINT32 k = 0; k < 3; k++)
+					covariance[j][k] += diff[j] * diff[k];
+			}
+		}
+
+		// Power iteration, starting from the covariance column of the channel with the largest variance
+		UINT32 maxVarianceIdx = 0;
+		for(UINT32 i = 1; i < 3; i++)
+		{
+			if(covariance[i][i] > covariance[maxVarianceIdx][maxVarianceIdx])
+				maxVarianceIdx = i;
+		}
+
+		float axis[3] = { covariance[0][maxVarianceIdx], covariance[1][maxVarianceIdx], covariance[2][maxVarianceIdx] };
+		for(UINT32 iter = 0; iter < 8; iter++)
+		{
+			float newAxis[3];
+			for(UINT32 j = 0; j < 3; j++)
+				newAxis[j] = covariance[j][0] * axis[0] + covariance[j][1] * axis[1] + covariance[j][2] * axis[2];
+
+			float maxComponent = std::max(std::abs(newAxis[0]), std::max(std::abs(newAxis[1]), std::abs(newAxis[2])));
+			if(maxComponent <= 0.0f)
+				break;
+
+			for(UINT32 j = 0; j < 3; j++)
+				axis[j] = newAxis[j] / maxComponent;
+		}
+
+		float axisLengthSqrd = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+		if(axisLengthSqrd <= 0.0f)
+		{
+			for(UINT32 i = 0; i < 3; i++)
+				start[i] = end[i] = mean[i];
+
+			return;
+		}
+
+		float minT = std::numeric_limits<float>::max();
+		float maxT = -std::numeric_limits<float>::max();
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			if((transparentMask & (1 << i)) != 0)
+				continue;
+
+			float t = 0.0f;
+			for(UINT32 j = 0; j < 3; j++)
+				t += (pixels[i][j] - mean[j]) * axis[j];
+
+			t /= axisLengthSqrd;
+			minT = std::min(minT, t);
+			maxT = std::max(maxT, t);
+		}
+
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			start[i] = Math::clamp(mean[i] + axis[i] * maxT, 0.0f, 255.0f);
+			end[i] = Math::clamp(mean[i] + axis[i] * minT, 0.0f, 255.0f);
+		}
+	}
+
+	/**
+	 * @brief	Finds endpoints that minimize the error of the opaque pixels for the provided index
+	 *			assignments, using least squares.
+	 *
+	 * @return	False if the endpoints cannot be determined from the indices (e.g. all pixels use the same index).
+	 */
+	static bool refineColorEndpoints(const BlockPixels& pixels, UINT32 transparentMask, UINT32 indices,
+		bool fourColors, float* start, float* end)
+	{
+		// Weight of the start endpoint for each index, end endpoint gets the remainder
+		static const float fourColorWeights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+		static const float threeColorWeights[4] = { 1.0f, 0.0f, 0.5f, 0.0f };
+
+		float aa = 0.0f;
+		float bb = 0.0f;
+		float ab = 0.0f;
+		float ax[3] = { 0.0f, 0.0f, 0.0f };
+		float bx[3] = { 0.0f, 0.0f, 0.0f };
+
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			if((transparentMask & (1 << i)) != 0)
+				continue;
+
+			UINT32 idx = (indices >> (i * 2)) & 0x3;
+			if(!fourColors && idx == 3)
+				continue;
+
+			float a = fourColors ? fourColorWeights[idx] : threeColorWeights[idx];
+			float b = 1.0f - a;
+
+			aa += a * a;
+			bb += b * b;
+			ab += a * b;
+
+			for(UINT32 j = 0; j < 3; j++)
+			{
+				ax[j] += a * pixels[i][j];
+				bx[j] += b * pixels[i][j];
+			}
+		}
+
+		float det = aa * bb - ab * ab;
+		if(std::abs(det) < 0.0001f)
+			return false;
+
+		float invDet = 1.0f / det;
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			start[i] = Math::clamp((ax[i] * bb - bx[i] * ab) * invDet, 0.0f, 255.0f);
+			end[i] = Math::clamp((bx[i] * aa - ax[i] * ab) * invDet, 0.0f, 255.0f);
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief	Quantizes the provided endpoints, orders them to select the wanted palette mode and
+	 *			assigns palette entries to the pixels.
+	 *
+	 * @param	pixels				Pixels to encode.
+	 * @param	transparentMask		Mask of pixels that should be transparent. If non-zero three color mode is used.
+	 * @param	alwaysFourColors	True if the block is decoded in four color mode regardless of endpoint order (BC2/BC3).
+	 * @param	start				First endpoint.
+	 * @param	end					Second endpoint.
+	 * @param	output				Output location for the 8 byte encoded block.
+	 *
+	 * @return	Sum of squared differences between the pixels and their decoded values.
+	 */
+	static UINT32 encodeColorEndpoints(const BlockPixels& pixels, UINT32 transparentMask, bool alwaysFourColors,
+		const float* start, const float* end, UINT8* output)
+	{
+		UINT16 color0 = packColor565(start);
+		UINT16 color1 = packColor565(end);
+
+		// Decoder uses four color mode if color0 > color1, and three color mode otherwise
+		bool wantFourColors = transparentMask == 0;
+		if(!alwaysFourColors && ((wantFourColors && color0 < color1) || (!wantFourColors && color0 > color1)))
+			std::swap(color0, color1);
+
+		bool fourColors = alwaysFourColors || color0 > color1;
+
+		INT32 palette[4][3];
+		buildColorPalette(color0, color1, fourColors, palette);
+
+		UINT32 indices = 0;
+		UINT32 error = selectColorIndices(pixels, palette, fourColors ? 4 : 3, transparentMask, indices);
+
+		output[0] = (UINT8)(color0 & 0xFF);
+		output[1] = (UINT8)(color0 >> 8);
+		output[2] = (UINT8)(color1 & 0xFF);
+		output[3] = (UINT8)(color1 >> 8);
+		output[4] = (UINT8)(indices & 0xFF);
+		output[5] = (UINT8)((indices >> 8) & 0xFF);
+		output[6] = (UINT8)((indices >> 16) & 0xFF);
+		output[7] = (UINT8)(indices >> 24);
+
+		return error;
+	}
+
+	/**
+	 * @brief	Encodes RGB channels of the pixels into an 8 byte color block.
+	 *
+	 * @param	pixels				Pixels to encode.
+	 * @param	transparentMask		Mask of pixels that should be transparent. If non-zero three color mode is used.
+	 * @param	alwaysFourColors	True if the block is decoded in four color mode regardless of endpoint order (BC2/BC3).
+	 * @param	highQuality			Determines how are the endpoints picked.
+	 * @param	output				Output location for the 8 byte encoded block.
+	 */
+	static void encodeColorBlock(const BlockPixels& pixels, UINT32 transparentMask, bool alwaysFourColors,
+		bool highQuality, UINT8* output)
+	{
+		float start[3];
+		float end[3];
+
+		if(!highQuality)
+		{
+			fitColorEndpointsFast(pixels, transparentMask, start, end);
+			encodeColorEndpoints(pixels, transparentMask, alwaysFourColors, start, end, output);
+
+			return;
+		}
+
+		fitColorEndpointsPCA(pixels, transparentMask, start, end);
+		UINT32 bestError = encodeColorEndpoints(pixels, transparentMask, alwaysFourColors, start, end, output);
+
+		// Alternate between picking indices for the endpoints and endpoints for the indices
+		for(UINT32 iter = 0; iter < 3 && bestError > 0; iter++)
+		{
+			UINT16 color0 = output[0] | (output[1] << 8);
+			UINT16 color1 = output[2] | (output[3] << 8);
+			UINT32 indices = output[4] | (output[5] << 8) | (output[6] << 16) | ((UINT32)output[7] << 24);
+			bool fourColors = alwaysFourColors || color0 > color1;
+
+			if(!refineColorEndpoints(pixels, transparentMask, indices, fourColors, start, end))
+				break;
+
+			UINT8 candidate[8];
+			UINT32 error = encodeColorEndpoints(pixels, transparentMask, alwaysFourColors, start, end, candidate);
+			if(error >= bestError)
+				break;
+
+			bestError = error;
+			memcpy(output, candidate, sizeof(candidate));
+		}
+	}
+
+	/**
+	 * @brief	Decodes an 8 byte color block into RGB channels of the pixels. Alpha channel is set to
+	 *			255, or 0 for transparent pixels of three color blocks.
+	 *
+	 * @param	block				Encoded block.
+	 * @param	alwaysFourColors	True if the block is decoded in four color mode regardless of endpoint order (BC2/BC3).
+	 * @param	pixels				Output pixels.
+	 */
+	static void decodeColorBlock(const UINT8* block, bool alwaysFourColors, BlockPixels& pixels)
+	{
+		UINT16 color0 = block[0] | (block[1] << 8);
+		UINT16 color1 = block[2] | (block[3] << 8);
+		UINT32 indices = block[4] | (block[5] << 8) | (block[6] << 16) | ((UINT32)block[7] << 24);
+
+		bool fourColors = alwaysFourColors || color0 > color1;
+
+		INT32 palette[4][3];
+		buildColorPalette(color0, color1, fourColors, palette);
+
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			UINT32 idx = (indices >> (i * 2)) & 0x3;
+
+			pixels[i][0] = (UINT8)palette[idx][0];
+			pixels[i][1] = (UINT8)palette[idx][1];
+			pixels[i][2] = (UINT8)palette[idx][2];
+			pixels[i][3] = (!fourColors && idx == 3) ? 0 : 255;
+		}
+	}
+
+	/************************************************************************/
+	/* 							SINGLE CHANNEL BLOCKS                  		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Calculates the values a single channel block with the provided endpoints decodes to.
+	 *			If alpha0 > alpha1 six values are interpolated between the endpoints. Otherwise four
+	 *			values are interpolated and the last two values are 0 and 255.
+	 */
+	static void buildChannelPalette(UINT8 value0, UINT8 value1, INT32 (&palette)[8])
+	{
+		palette[0] = value0;
+		palette[1] = value1;
+
+		if(value0 > value1)
+		{
+			for(UINT32 i = 1; i < 7; i++)
+				palette[i + 1] = ((7 - i) * value0 + i * value1) / 7;
+		}
+		else
+		{
+			for(UINT32 i = 1; i < 5; i++)
+				palette[i + 1] = ((5 - i) * value0 + i * value1) / 5;
+
+			palette[6] = 0;
+			palette[7] = 255;
+		}
+	}
+
+	/**
+	 * @brief	Encodes the values using the provided endpoints.
+	 *
+	 * @return	Sum of squared differences between the values and their decoded values.
+	 */
+	static UINT32 encodeChannelEndpoints(const UINT8 (&values)[16], UINT8 value0, UINT8 value1, UINT8* output)
+	{
+		INT32 palette[8];
+		buildChannelPalette(value0, value1, palette);
+
+		UINT64 indices = 0;
+		UINT32 totalError = 0;
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			UINT32 bestIdx = 0;
+			UINT32 bestError = std::numeric_limits<UINT32>::max();
+			for(UINT32 j = 0; j < 8; j++)
+			{
+				INT32 diff = values[i] - palette[j];
+
+				UINT32 error = (UINT32)(diff * diff);
+				if(error < bestError)
+				{
+					bestError = error;
+					bestIdx = j;
+				}
+			}
+
+			indices |= (UINT64)bestIdx << (i * 3);
+			totalError += bestError;
+		}
+
+		output[0] = value0;
+		output[1] = value1;
+
+		for(UINT32 i = 0; i < 6; i++)
+			output[2 + i] = (UINT8)((indices >> (i * 8)) & 0xFF);
+
+		return totalError;
+	}
+
+	/**
+	 * @brief	Encodes a single channel into an 8 byte block, as used by BC3 alpha, BC4 and BC5.
+	 *
+	 * @param	values		Values to encode.
+	 * @param	highQuality	If true both palette modes and endpoints near the value extents are evaluated.
+	 *						Otherwise endpoints are the value extents.
+	 * @param	output		Output location for the 8 byte encoded block.
+	 */
+	static void encodeChannelBlock(const UINT8 (&values)[16], bool highQuality, UINT8* output)
+	{
+		UINT8 minValue = 255;
+		UINT8 maxValue = 0;
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			minValue = std::min(minValue, values[i]);
+			maxValue = std::max(maxValue, values[i]);
+		}
+
+		UINT32 bestError = encodeChannelEndpoints(values, maxValue, minValue, output);
+		if(!highQuality || bestError == 0)
+			return;
+
+		UINT8 candidate[8];
+
+		// Six value mode has explicit 0 and 255, so interpolated values only need to cover the rest
+		UINT8 minInnerValue = 255;
+		UINT8 maxInnerValue = 0;
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			if(values[i] == 0 || values[i] == 255)
+				continue;
+
+			minInnerValue = std::min(minInnerValue, values[i]);
+			maxInnerValue = std::max(maxInnerValue, values[i]);
+		}
+
+		if(minInnerValue > maxInnerValue)
+			minInnerValue = maxInnerValue = 0;
+
+		UINT32 error = encodeChannelEndpoints(values, minInnerValue, maxInnerValue, candidate);
+		if(error < bestError)
+		{
+			bestError = error;
+			memcpy(output, candidate, sizeof(candidate));
+		}
+
+		// Search for better endpoints close to the extents in eight value mode
+		const INT32 SEARCH_RADIUS = 2;
+		for(INT32 i = -SEARCH_RADIUS; i <= SEARCH_RADIUS && bestError > 0; i++)
+		{
+			for(INT32 j = -SEARCH_RADIUS; j <= SEARCH_RADIUS && bestError > 0; j++)
+			{
+				INT32 value0 = Math::clamp((INT32)maxValue + i, 0, 255);
+				INT32 value1 = Math::clamp((INT32)minValue + j, 0, 255);
+				if(value0 <= value1)
+					continue;
+
+				error = encodeChannelEndpoints(values, (UINT8)value0, (UINT8)value1, candidate);
+				if(error < bestError)
+				{
+					bestError = error;
+					memcpy(output, candidate, sizeof(candidate));
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief	Decodes an 8 byte single channel block.
+	 */
+	static void decodeChannelBlock(const UINT8* block, UINT8 (&values)[16])
+	{
+		INT32 palette[8];
+		buildChannelPalette(block[0], block[1], palette);
+
+		UINT64 indices = 0;
+		for(UINT32 i = 0; i < 6; i++)
+			indices |= (UINT64)block[2 + i] << (i * 8);
+
+		for(UINT32 i = 0; i < 16; i++)
+			values[i] = (UINT8)palette[(indices >> (i * 3)) & 0x7];
+	}
+
+	/************************************************************************/
+	/* 									BLOCKS                        		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Returns the size of a single 4x4 block in the provided format, in bytes.
+	 */
+	static UINT32 getBlockSize(PixelFormat format)
+	{
+		if(format == PF_BC1 || format == PF_BC1a || format == PF_BC4)
+			return 8;
+
+		return 16;
+	}
+
+	/**
+	 * @brief	Encodes a 4x4 block of pixels in the specified format.
+	 */
+	static void encodeBlock(const BlockPixels& pixels, PixelFormat format, bool highQuality, UINT8* output)
+	{
+		UINT8 values[16];
+
+		switch(format)
+		{
+		case PF_BC1:
+			encodeColorBlock(pixels, 0, false, highQuality, output);
+			break;
+		case PF_BC1a:
+		{
+			UINT32 transparentMask = 0;
+			for(UINT32 i = 0; i < 16; i++)
+			{
+				if(pixels[i][3] < 128)
+					transparentMask |= 1 << i;
+			}
+
+			encodeColorBlock(pixels, transparentMask, false, highQuality, output);
+		}
+			break;
+		case PF_BC2:
+		{
+			UINT64 alpha = 0;
+			for(UINT32 i = 0; i < 16; i++)
+				alpha |= (UINT64)((pixels[i][3] * 15 + 127) / 255) << (i * 4);
+
+			for(UINT32 i = 0; i < 8; i++)
+				output[i] = (UINT8)((alpha >> (i * 8)) & 0xFF);
+
+			encodeColorBlock(pixels, 0, true, highQuality, output + 8);
+		}
+			break;
+		case PF_BC3:
+			for(UINT32 i = 0; i < 16; i++)
+				values[i] = pixels[i][3];
+
+			encodeChannelBlock(values, highQuality, output);
+			encodeColorBlock(pixels, 0, true, highQuality, output + 8);
+			break;
+		case PF_BC4:
+			for(UINT32 i = 0; i < 16; i++)
+				values[i] = pixels[i][0];
+
+			encodeChannelBlock(values, highQuality, output);
+			break;
+		case PF_BC5:
+			for(UINT32 i = 0; i < 16; i++)
+				values[i] = pixels[i][0];
+
+			encodeChannelBlock(values, highQuality, output);
+
+			for(UINT32 i = 0; i < 16; i++)
+				values[i] = pixels[i][1];
+
+			encodeChannelBlock(values, highQuality, output + 8);
+			break;
+		default:
+			break;
+		}
+	}
+
+	/**
+	 * @brief	Decodes a 4x4 block of pixels in the specified format. Channels not present in the format
+	 *			are set to 0, except alpha which is set to 255.
+	 */
+	static void decodeBlock(const UINT8* block, PixelFormat format, BlockPixels& pixels)
+	{
+		UINT8 values[16];
+
+		switch(format)
+		{
+		case PF_BC1:
+		case PF_BC1a:
+			decodeColorBlock(block, false, pixels);
+			break;
+		case PF_BC2:
+			decodeColorBlock(block + 8, true, pixels);
+
+			for(UINT32 i = 0; i < 16; i++)
+			{
+				UINT8 alpha = (block[i / 2] >> ((i % 2) * 4)) & 0xF;
+				pixels[i][3] = alpha * 17;
+			}
+			break;
+		case PF_BC3:
+			decodeColorBlock(block + 8, true, pixels);
+			decodeChannelBlock(block, values);
+
+			for(UINT32 i = 0; i < 16; i++)
+				pixels[i][3] = values[i];
+			break;
+		case PF_BC4:
+			decodeChannelBlock(block, values);
+
+			for(UINT32 i = 0; i < 16; i++)
+			{
+				pixels[i][0] = values[i];
+				pixels[i][1] = 0;
+				pixels[i][2] = 0;
+				pixels[i][3] = 255;
+			}
+			break;
+		case PF_BC5:
+			decodeChannelBlock(block, values);
+
+			for(UINT32 i = 0; i < 16; i++)
+			{
+				pixels[i][0] = values[i];
+				pixels[i][2] = 0;
+				pixels[i][3] = 255;
+			}
+
+			decodeChannelBlock(block + 8, values);
+
+			for(UINT32 i = 0; i < 16; i++)
+				pixels[i][1] = values[i];
+			break;
+		default:
+			break;
+		}
+	}
+
+	/**
+	 * @brief	Calls the provided function for every row of blocks. Rows are split between multiple
+	 *			tasks if the task scheduler is running.
+	 */
+	static void forEachBlockRow(UINT32 numBlockRows, const std::function<void(UINT32)>& func)
+	{
+		if(!TaskScheduler::isStarted() || numBlockRows <= BLOCK_ROWS_PER_TASK)
+		{
+			for(UINT32 i = 0; i < numBlockRows; i++)
+				func(i);
+
+			return;
+		}
+
+		Vector<TaskPtr> tasks;
+		for(UINT32 start = 0; start < numBlockRows; start += BLOCK_ROWS_PER_TASK)
+		{
+			UINT32 end = std::min(start + BLOCK_ROWS_PER_TASK, numBlockRows);
+
+			TaskPtr task = Task::create("BlockCompression", [&func, start, end]()
+			{
+				for(UINT32 i = start; i < end; i++)
+					func(i);
+			});
+
+			TaskScheduler::instance().addTask(task);
+			tasks.push_back(task);
+		}
+
+		for(auto& task : tasks)
+			task->wait();
+	}
+
+	void BlockCompression::compress(const PixelData& src, PixelData& dst, bool highQuality)
+	{
+		PixelFormat format = dst.getFormat();
+		if(!isSupported(format))
+			BS_EXCEPT(InvalidParametersException, "Unsupported compressed format: " + PixelUtil::getFormatName(format));
+
+		if(PixelUtil::isCompressed(src.getFormat()))
+			BS_EXCEPT(InvalidParametersException, "Source data cannot be compressed.");
+
+		if(src.getDepth() != 1)
+			BS_EXCEPT(InvalidParametersException, "3D textures are not supported.");
+
+		UINT32 width = src.getWidth();
+		UINT32 height = src.getHeight();
+
+		PixelData rgbaData(width, height, 1, PF_R8G8B8A8);
+		rgbaData.allocateInternalBuffer();
+		PixelUtil::bulkPixelConversion(src, rgbaData);
+
+		const UINT8* srcData = rgbaData.getData();
+		UINT8* dstData = dst.getData();
+
+		UINT32 blockSize = getBlockSize(format);
+		UINT32 numBlocksX = (width + 3) / 4;
+		UINT32 numBlocksY = (height + 3) / 4;
+
+		forEachBlockRow(numBlocksY, [&](UINT32 blockY)
+		{
+			UINT8* output = dstData + blockY * numBlocksX * blockSize;
+			for(UINT32 blockX = 0; blockX < numBlocksX; blockX++)
+			{
+				// Blocks on the right and bottom edges are padded by repeating the edge pixels
+				BlockPixels pixels;
+				for(UINT32 y = 0; y < 4; y++)
+				{
+					UINT32 srcY = std::min(blockY * 4 + y, height - 1);
+					for(UINT32 x = 0; x < 4; x++)
+					{
+						UINT32 srcX = std::min(blockX * 4 + x, width - 1);
+						memcpy(pixels[y * 4 + x], srcData + (srcY * width + srcX) * 4, 4);
+					}
+				}
+
+				encodeBlock(pixels, format, highQuality, output);
+				output += blockSize;
+			}
+		});
+
+		rgbaData.freeInternalBuffer();
+	}
+
+	void BlockCompression::decompress(const PixelData& src, PixelData& dst)
+	{
+		PixelFormat format = src.getFormat();
+		if(!isSupported(format))
+			BS_EXCEPT(InvalidParametersException, "Unsupported compressed format: " + PixelUtil::getFormatName(format));
+
+		if(PixelUtil::isCompressed(dst.getFormat()))
+			BS_EXCEPT(InvalidParametersException, "Destination data cannot be compressed.");
+
+		if(src.getDepth() != 1)
+			BS_EXCEPT(InvalidParametersException, "3D textures are not supported.");
+
+		UINT32 width = src.getWidth();
+		UINT32 height = src.getHeight();
+
+		PixelData rgbaData(width, height, 1, PF_R8G8B8A8);
+		rgbaData.allocateInternalBuffer();
+
+		const UINT8* srcData = src.getData();
+		UINT8* dstData = rgbaData.getData();
+
+		UINT32 blockSize = getBlockSize(format);
+		UINT32 numBlocksX = (width + 3) / 4;
+		UINT32 numBlocksY = (height + 3) / 4;
+
+		forEachBlockRow(numBlocksY, [&](UINT32 blockY)
+		{
+			const UINT8* input = srcData + blockY * numBlocksX * blockSize;
+			for(UINT32 blockX = 0; blockX < numBlocksX; blockX++)
+			{
+				BlockPixels pixels;
+				decodeBlock(input, format, pixels);
+
+				UINT32 numRows = std::min(4U, height - blockY * 4);
+				UINT32 numColumns = std::min(4U, width - blockX * 4);
+				for(UINT32 y = 0; y < numRows; y++)
+				{
+					UINT8* dstRow = dstData + ((blockY * 4 + y) * width + blockX * 4) * 4;
+					memcpy(dstRow, pixels[y * 4], numColumns * 4);
+				}
+
+				input += blockSize;
+			}
+		});
+
+		PixelUtil::bulkPixelConversion(rgbaData, dst);
+		rgbaData.freeInternalBuffer();
+	}
+
+	bool BlockCompression::isSupported(PixelFormat format)
+	{
+		switch(format)
+		{
+		case PF_BC1:
+		case PF_BC1a:
+		case PF_BC2:
+		case PF_BC3:
+		case PF_BC4:
+		case PF_BC5:
+			return true;
+		default:
+			return false;
+		}
+	}
+}
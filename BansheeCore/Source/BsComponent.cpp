@@ -8,7 +8,7 @@
 namespace BansheeEngine
 {
 	Component::Component(const HSceneObject& parent)
-		:mParent(parent)
+		:mParent(parent), mStorageIdx(0)
 	{
 		setName("Component");
 	}
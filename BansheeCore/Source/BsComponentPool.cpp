@@ -0,0 +1,69 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsComponentPool.h"
+
+namespace BansheeEngine
+{
+	const UINT32 ComponentPool::ALIGNMENT = 16;
+
+	ComponentPool::ComponentPool(UINT32 elementSize, UINT32 elementsPerBlock)
+		:mElementsPerBlock(std::max(elementsPerBlock, 1U)), mNumUsedInLastBlock(0), mFreeList(nullptr)
+	{
+		// Freed elements store the free list link in their memory
+		elementSize = std::max(elementSize, (UINT32)sizeof(void*));
+		mElementSize = (elementSize + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+		mNumUsedInLastBlock = mElementsPerBlock;
+	}
+
+	ComponentPool::~ComponentPool()
+	{
+		for(auto& block : mBlocks)
+			bs_free(block);
+	}
+
+	void* ComponentPool::allocate()
+	{
+		if(mFreeList != nullptr)
+		{
+			void* data = mFreeList;
+			mFreeList = *(void**)data;
+
+			return data;
+		}
+
+		if(mNumUsedInLastBlock == mElementsPerBlock)
+		{
+			mBlocks.push_back((UINT8*)bs_alloc(mElementSize * mElementsPerBlock));
+			mNumUsedInLastBlock = 0;
+		}
+
+		void* data = mBlocks.back() + mNumUsedInLastBlock * mElementSize;
+		mNumUsedInLastBlock++;
+
+		return data;
+	}
+
+	void ComponentPool::free(void* data)
+	{
+		*(void**)data = mFreeList;
+		mFreeList = data;
+	}
+
+	ComponentPool& ComponentPool::getPool(UINT32 typeId, UINT32 elementSize)
+	{
+		// Types not overriding RTTI share their parent's ID, so size is part of the key as well
+		static UnorderedMap<UINT64, ComponentPool*> pools;
+
+		UINT64 key = ((UINT64)typeId << 32) | elementSize;
+
+		auto iterFind = pools.find(key);
+		if(iterFind != pools.end())
+			return *iterFind->second;
+
+		ComponentPool* pool = bs_new<ComponentPool>(elementSize);
+		pools[key] = pool;
+
+		return *pool;
+	}
+}
@@ -48,6 +48,7 @@
 #include "BsPass.h"
 
 #include "BsRendererManager.h"
+#include "BsDebug.h"
 
 namespace BansheeEngine
 {
@@ -59,6 +60,7 @@ namespace BansheeEngine
 
 		Platform::_startUp();
 		MemStack::beginThread();
+		gDebug().getLog()._startWorker();
 
 		UUIDGenerator::startUp();
 		ProfilerCPU::startUp();
@@ -95,6 +97,9 @@ namespace BansheeEngine
 
 		Importer::startUp();
 
+		if (!desc.importCacheFolder.isEmpty())
+			Importer::instance().setCacheFolder(desc.importCacheFolder);
+
 		for (auto& importerName : desc.importers)
 			loadPlugin(importerName);
 
@@ -143,6 +148,8 @@ namespace BansheeEngine
 		ProfilerCPU::shutDown();
 		UUIDGenerator::shutDown();
 
+		gDebug().getLog()._stopWorker();
+
 		MemStack::endThread();
 		Platform::_shutDown();
 	}
@@ -158,6 +165,7 @@ namespace BansheeEngine
 			gCoreThread().update();
 			Platform::_update();
 			DeferredCallManager::instance()._update();
+			gResources()._update();
 			RenderWindowManager::instance()._update();
 			gInput()._update();
 			gTime().update();
@@ -169,6 +177,9 @@ namespace BansheeEngine
 
 			update();
 
+			// Glyphs rendered on demand during the update need to be uploaded before rendering
+			FontManager::instance()._update();
+
 			PROFILE_CALL(RendererManager::instance().getActive()->renderAll(), "Render");
 
 			// Core and sim thread run in lockstep. This will result in a larger input latency than if I was 
@@ -8,6 +8,7 @@
 namespace BansheeEngine
 {
 	CoreSceneManager::CoreSceneManager()
+		:mIterationDepth(0)
 	{
 		mRootNode = SceneObject::createInternal("SceneRoot");
 	}
@@ -16,28 +17,28 @@ namespace BansheeEngine
 	{
 		if(mRootNode != nullptr)
 			mRootNode->destroy();
+
+		for(auto& list : mComponentLists)
+			bs_delete(list);
 	}
 
 	void CoreSceneManager::_update()
 	{
-		Stack<HSceneObject> todo;
-		todo.push(mRootNode);
+		mIterationDepth++;
 
-		while(!todo.empty())
+		// Lists and components can be added during update, so don't cache sizes
+		for(UINT32 i = 0; i < (UINT32)mComponentLists.size(); i++)
 		{
-			HSceneObject currentGO = todo.top();
-			todo.pop();
-			                  
-			const Vector<HComponent>& components = currentGO->getComponents();
-
-			for(auto iter = components.begin(); iter != components.end(); ++iter)
+			ComponentList* list = mComponentLists[i];
+			for(UINT32 j = 0; j < (UINT32)list->components.size(); j++)
 			{
-				(*iter)->update();
+				Component* component = list->components[j];
+				if(component != nullptr)
+					component->update();
 			}
-
-			for(UINT32 i = 0; i < currentGO->getNumChildren(); i++)
-				todo.push(currentGO->getChild(i));
 		}
+
+		endIteration();
 	}
 
 	void CoreSceneManager::registerNewSO(const HSceneObject& node) 
@@ -46,8 +47,83 @@ namespace BansheeEngine
 			node->setParent(mRootNode);
 	}
 
-	void CoreSceneManager::notifyComponentAdded(const HComponent& component) { }
-	void CoreSceneManager::notifyComponentRemoved(const HComponent& component) { }
+	void CoreSceneManager::notifyComponentAdded(const HComponent& component)
+	{
+		UINT32 typeId = component->getTypeId();
+
+		ComponentList* list = findComponentList(typeId);
+		if(list == nullptr)
+		{
+			list = bs_new<ComponentList>();
+
+			mComponentLists.push_back(list);
+			mComponentListsPerType[typeId] = list;
+		}
+
+		component->mStorageIdx = (UINT32)list->components.size();
+		list->components.push_back(component.get());
+	}
+
+	void CoreSceneManager::notifyComponentRemoved(const HComponent& component)
+	{
+		ComponentList* list = findComponentList(component->getTypeId());
+		if(list == nullptr)
+			return;
+
+		UINT32 idx = component->mStorageIdx;
+		if(idx >= (UINT32)list->components.size() || list->components[idx] != component.get())
+			return;
+
+		// Moving elements would cause an ongoing iteration to skip or repeat components, 
+		// so leave a hole that gets cleaned up once iteration ends
+		if(mIterationDepth > 0)
+		{
+			list->components[idx] = nullptr;
+			list->numRemoved++;
+			return;
+		}
+
+		Component* last = list->components.back();
+		list->components[idx] = last;
+		last->mStorageIdx = idx;
+
+		list->components.pop_back();
+	}
+
+	CoreSceneManager::ComponentList* CoreSceneManager::findComponentList(UINT32 typeId) const
+	{
+		auto iterFind = mComponentListsPerType.find(typeId);
+		if(iterFind == mComponentListsPerType.end())
+			return nullptr;
+
+		return iterFind->second;
+	}
+
+	void CoreSceneManager::endIteration()
+	{
+		mIterationDepth--;
+		if(mIterationDepth > 0)
+			return;
+
+		for(auto& list : mComponentLists)
+		{
+			if(list->numRemoved == 0)
+				continue;
+
+			UINT32 numComponents = 0;
+			for(auto& component : list->components)
+			{
+				if(component == nullptr)
+					continue;
+
+				component->mStorageIdx = numComponents;
+				list->components[numComponents++] = component;
+			}
+
+			list->components.resize(numComponents);
+			list->numRemoved = 0;
+		}
+	}
 
 	CoreSceneManager& gSceneManager()
 	{
@@ -147,6 +147,11 @@ namespace BansheeEngine
 		mCommandQueue->queue(std::bind(&RenderSystem::drawIndexed, RenderSystem::instancePtr(), startIndex, indexCount, vertexOffset, vertexCount));
 	}
 
+	void CoreThreadAccessorBase::drawIndexedInstanced(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
+	{
+		mCommandQueue->queue(std::bind(&RenderSystem::drawIndexedInstanced, RenderSystem::instancePtr(), startIndex, indexCount, vertexOffset, vertexCount, instanceCount));
+	}
+
 	AsyncOp CoreThreadAccessorBase::writeSubresource(GpuResourcePtr resource, UINT32 subresourceIdx, const GpuResourceDataPtr& data, bool discardEntireBuffer)
 	{
 		data->_lock();
@@ -5,20 +5,139 @@
 #include "BsFontRTTI.h"
 #include "BsFontManager.h"
 #include "BsResources.h"
+#include "BsGlyphCache.h"
+#include "BsDebug.h"
 
 namespace BansheeEngine
 {
+	FontData::FontData()
+		:size(0)
+	{ }
+
+	FontData::FontData(const FontData& other)
+		:size(other.size), fontDesc(other.fontDesc), texturePages(other.texturePages), mGlyphCache(other.mGlyphCache)
+	{
+		buildLookupTables();
+	}
+
+	FontData& FontData::operator=(const FontData& other)
+	{
+		size = other.size;
+		fontDesc = other.fontDesc;
+		texturePages = other.texturePages;
+		mGlyphCache = other.mGlyphCache;
+
+		buildLookupTables();
+		return *this;
+	}
+
 	const CHAR_DESC& FontData::getCharDesc(UINT32 charId) const
 	{
-		auto iterFind = fontDesc.characters.find(charId);
-		if(iterFind != fontDesc.characters.end())
+		if(mGlyphCache != nullptr)
+			return mGlyphCache->getCharDesc(charId);
+
+		if(charId <= MAX_DIRECT_LOOKUP_CHAR)
+		{
+			if(charId < (UINT32)mDirectCharLookup.size() && mDirectCharLookup[charId] != nullptr)
+				return *mDirectCharLookup[charId];
+		}
+		else
 		{
-			return fontDesc.characters.at(charId);
+			auto iterFind = mExtendedCharLookup.find(charId);
+			if(iterFind != mExtendedCharLookup.end())
+				return *iterFind->second;
 		}
 
 		return fontDesc.missingGlyph;
 	}
 
+	INT32 FontData::getKerning(UINT32 charId, UINT32 nextCharId) const
+	{
+		if(mGlyphCache != nullptr)
+			return mGlyphCache->getKerning(charId, nextCharId);
+
+		if(mKerningLookup.empty())
+			return 0;
+
+		UINT64 key = ((UINT64)charId << 32) | nextCharId;
+
+		auto iterFind = mKerningLookup.find(key);
+		if(iterFind != mKerningLookup.end())
+			return iterFind->second;
+
+		return 0;
+	}
+
+	UINT32 FontData::getNumTexturePages() const
+	{
+		if(mGlyphCache != nullptr)
+			return mGlyphCache->getNumPages();
+
+		return (UINT32)texturePages.size();
+	}
+
+	const HTexture& FontData::getTexturePage(UINT32 idx) const
+	{
+		if(mGlyphCache != nullptr)
+			return mGlyphCache->getPage(idx);
+
+		return texturePages[idx];
+	}
+
+	void FontData::_setGlyphCache(const GlyphCachePtr& glyphCache)
+	{
+		mGlyphCache = glyphCache;
+
+		if(mGlyphCache != nullptr)
+		{
+			const FONT_DESC& cacheFontDesc = mGlyphCache->getFontDesc();
+
+			fontDesc.baselineOffset = cacheFontDesc.baselineOffset;
+			fontDesc.lineHeight = cacheFontDesc.lineHeight;
+			fontDesc.spaceWidth = cacheFontDesc.spaceWidth;
+			fontDesc.missingGlyph = cacheFontDesc.missingGlyph;
+		}
+	}
+
+	void FontData::buildLookupTables()
+	{
+		mDirectCharLookup.clear();
+		mExtendedCharLookup.clear();
+		mKerningLookup.clear();
+
+		// Characters are sorted, so the last one in BMP range determines the size of the direct table
+		UINT32 numDirectChars = 0;
+		for(auto iter = fontDesc.characters.rbegin(); iter != fontDesc.characters.rend(); ++iter)
+		{
+			if(iter->first <= MAX_DIRECT_LOOKUP_CHAR)
+			{
+				numDirectChars = iter->first + 1;
+				break;
+			}
+		}
+
+		mDirectCharLookup.resize(numDirectChars, nullptr);
+
+		for(auto& charEntry : fontDesc.characters)
+		{
+			const CHAR_DESC& charDesc = charEntry.second;
+
+			if(charEntry.first <= MAX_DIRECT_LOOKUP_CHAR)
+				mDirectCharLookup[charEntry.first] = &charDesc;
+			else
+				mExtendedCharLookup[charEntry.first] = &charDesc;
+
+			for(auto& kerningPair : charDesc.kerningPairs)
+			{
+				UINT64 key = ((UINT64)charDesc.charId << 32) | kerningPair.otherCharId;
+
+				// Keep the first pair if there are duplicates, same as a linear search would
+				if(mKerningLookup.find(key) == mKerningLookup.end())
+					mKerningLookup[key] = kerningPair.amount;
+			}
+		}
+	}
+
 	RTTITypeBase* FontData::getRTTIStatic()
 	{
 		return FontDataRTTI::instance();
@@ -30,7 +149,7 @@ namespace BansheeEngine
 	}
 
 	Font::Font()
-		:Resource(false)
+		:Resource(false), mDPI(72), mAntialiasing(true)
 	{ }
 
 	Font::~Font()
@@ -41,9 +160,29 @@ namespace BansheeEngine
 		for(auto iter = fontData.begin(); iter != fontData.end(); ++iter)
 			mFontDataPerSize[iter->size] = *iter;
 
+		if(isDynamic())
+			createGlyphCaches();
+
 		Resource::initialize();
 	}
 
+	void Font::createGlyphCaches()
+	{
+		for(auto& fontDataEntry : mFontDataPerSize)
+		{
+			GlyphRasterizerPtr rasterizer = FontManager::instance()._createGlyphRasterizer(mFontFileData.data(), 
+				(UINT32)mFontFileData.size(), fontDataEntry.first, mDPI, mAntialiasing);
+
+			if(rasterizer == nullptr)
+			{
+				LOGWRN("Unable to create a glyph rasterizer for a dynamic font. Make sure a font importer plugin is loaded.");
+				continue;
+			}
+
+			fontDataEntry.second._setGlyphCache(bs_shared_ptr<GlyphCache>(rasterizer));
+		}
+	}
+
 	const FontData* Font::getFontDataForSize(UINT32 size) const
 	{
 		auto iterFind = mFontDataPerSize.find(size);
@@ -86,6 +225,18 @@ namespace BansheeEngine
 		return bestSize;
 	}
 
+	void Font::getResourceDependencies(Vector<HResource>& dependencies) const
+	{
+		for(auto& fontDataEntry : mFontDataPerSize)
+		{
+			for(auto& texturePage : fontDataEntry.second.texturePages)
+			{
+				if(texturePage)
+					dependencies.push_back(texturePage);
+			}
+		}
+	}
+
 	HFont Font::create(const Vector<FontData>& fontData)
 	{
 		FontPtr newFont = _createPtr(fontData);
@@ -98,6 +249,11 @@ namespace BansheeEngine
 		return FontManager::instance().create(fontData);
 	}
 
+	FontPtr Font::_createDynamicPtr(const Vector<UINT8>& fontFileData, const Vector<UINT32>& fontSizes, UINT32 dpi, bool antialiasing)
+	{
+		return FontManager::instance().createDynamic(fontFileData, fontSizes, dpi, antialiasing);
+	}
+
 	RTTITypeBase* Font::getRTTIStatic()
 	{
 		return FontRTTI::instance();
@@ -7,7 +7,7 @@
 namespace BansheeEngine
 {
 	FontImportOptions::FontImportOptions()
-		:mDPI(72), mAntialiasing(true)
+		:mDPI(72), mAntialiasing(true), mDynamic(false)
 	{
 		mFontSizes.push_back(10);
 		mCharIndexRanges.push_back(std::make_pair(33, 166)); // Most used ASCII characters
@@ -3,6 +3,7 @@
 //________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
 #include "BsFontManager.h"
 #include "BsFont.h"
+#include "BsGlyphCache.h"
 
 namespace BansheeEngine
 {
@@ -15,6 +16,22 @@ namespace BansheeEngine
 		return newFont;
 	}
 
+	FontPtr FontManager::createDynamic(const Vector<UINT8>& fontFileData, const Vector<UINT32>& fontSizes, UINT32 dpi, bool antialiasing) const
+	{
+		Vector<FontData> fontData(fontSizes.size());
+		for(UINT32 i = 0; i < (UINT32)fontSizes.size(); i++)
+			fontData[i].size = fontSizes[i];
+
+		FontPtr newFont = bs_core_ptr<Font, PoolAlloc>(new (bs_alloc<Font, PoolAlloc>()) Font());
+		newFont->_setThisPtr(newFont);
+		newFont->mFontFileData = fontFileData;
+		newFont->mDPI = dpi;
+		newFont->mAntialiasing = antialiasing;
+		newFont->initialize(fontData);
+
+		return newFont;
+	}
+
 	FontPtr FontManager::_createEmpty() const
 	{
 		FontPtr newFont = bs_core_ptr<Font, PoolAlloc>(new (bs_alloc<Font, PoolAlloc>()) Font());
@@ -22,4 +39,34 @@ namespace BansheeEngine
 
 		return newFont;
 	}
+
+	GlyphRasterizerPtr FontManager::_createGlyphRasterizer(const UINT8* fontFileData, UINT32 fontFileSize, UINT32 fontSize, UINT32 dpi, bool antialiasing) const
+	{
+		if(mGlyphRasterizerFactory == nullptr)
+			return nullptr;
+
+		return mGlyphRasterizerFactory(fontFileData, fontFileSize, fontSize, dpi, antialiasing);
+	}
+
+	void FontManager::_registerGlyphCache(GlyphCache* glyphCache)
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		mGlyphCaches.insert(glyphCache);
+	}
+
+	void FontManager::_unregisterGlyphCache(GlyphCache* glyphCache)
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		mGlyphCaches.erase(glyphCache);
+	}
+
+	void FontManager::_update()
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		for(auto& glyphCache : mGlyphCaches)
+			glyphCache->_update();
+	}
 }
\ No newline at end of file
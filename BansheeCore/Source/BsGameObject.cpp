@@ -8,16 +8,24 @@
 namespace BansheeEngine
 {
 	GameObject::GameObject()
+		:mInstanceId(0), mSlotIdx(GameObjectHandleBase::INVALID_SLOT)
 	{ }
 
 	GameObject::~GameObject()
 	{ }
 
-	void GameObject::initialize(const std::shared_ptr<GameObject>& object, UINT64 instanceId)
+	void GameObject::initialize(UINT64 instanceId, UINT32 slotIdx)
 	{
-		mInstanceData = bs_shared_ptr<GameObjectInstanceData>();
-		mInstanceData->object = object;
-		mInstanceData->mInstanceId = instanceId;
+		mInstanceId = instanceId;
+		mSlotIdx = slotIdx;
+	}
+
+	GameObjectHandleBase GameObject::_getHandle() const
+	{
+		if(mSlotIdx >= GameObjectHandleBase::sNumSlots)
+			return GameObjectHandleBase(nullptr);
+
+		return GameObjectHandleBase(mSlotIdx, GameObjectHandleBase::sSlots[mSlotIdx].generation, mInstanceId);
 	}
 	
 	RTTITypeBase* GameObject::getRTTIStatic()
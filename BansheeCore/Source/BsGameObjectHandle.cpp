@@ -6,40 +6,46 @@
 #include "BsGameObjectHandle.h"
 #include "BsException.h"
 #include "BsGameObjectHandleRTTI.h"
+#include "BsGameObjectManager.h"
 
 namespace BansheeEngine
 {
-	GameObjectHandleBase::GameObjectHandleBase(const std::shared_ptr<GameObjectHandleData>& data)
-		:mData(data)
+	const UINT32 GameObjectHandleBase::INVALID_SLOT = (UINT32)-1;
+
+	GameObjectSlot* GameObjectHandleBase::sSlots = nullptr;
+	UINT32 GameObjectHandleBase::sNumSlots = 0;
+
+	GameObjectHandleBase::GameObjectHandleBase(UINT32 slotIdx, UINT32 generation, UINT64 instanceId)
+		:mSlotIdx(slotIdx), mGeneration(generation), mInstanceId(instanceId)
 	{ }
 
 	GameObjectHandleBase::GameObjectHandleBase(const std::shared_ptr<GameObject> ptr)
+		:mSlotIdx(ptr->mSlotIdx), mGeneration(0), mInstanceId(ptr->mInstanceId)
 	{
-		mData = bs_shared_ptr<GameObjectHandleData, PoolAlloc>(ptr->mInstanceData);
+		if(mSlotIdx < sNumSlots)
+			mGeneration = sSlots[mSlotIdx].generation;
 	}
 
 	GameObjectHandleBase::GameObjectHandleBase(std::nullptr_t ptr)
-	{
-		mData = bs_shared_ptr<GameObjectHandleData, PoolAlloc>(nullptr);
-	}
+		:mSlotIdx(INVALID_SLOT), mGeneration(0), mInstanceId(0)
+	{ }
 
 	GameObjectHandleBase::GameObjectHandleBase()
+		:mSlotIdx(INVALID_SLOT), mGeneration(0), mInstanceId(0)
+	{ }
+
+	void GameObjectHandleBase::destroy()
 	{
-		mData = bs_shared_ptr<GameObjectHandleData, PoolAlloc>(nullptr);
-	}
+		if(isDestroyed())
+			return;
 
-	void GameObjectHandleBase::_resolve(const GameObjectHandleBase& object) 
-	{ 
-		mData->mPtr = object.mData->mPtr;
-		mData->mInstanceId = object.mData->mInstanceId;
+		// Handle might be stored within the object being destroyed, so don't touch it after this call
+		GameObjectManager::instance().destroyObject(mSlotIdx);
 	}
 
-	void GameObjectHandleBase::throwIfDestroyed() const
+	void GameObjectHandleBase::throwDestroyedException()
 	{
-		if(isDestroyed()) 
-		{
-			BS_EXCEPT(InternalErrorException, "Trying to access an object that has been destroyed.");
-		}
+		BS_EXCEPT(InternalErrorException, "Trying to access an object that has been destroyed.");
 	}
 
 	RTTITypeBase* GameObjectHandleBase::getRTTIStatic()
@@ -7,20 +7,30 @@
 namespace BansheeEngine
 {
 	GameObjectManager::GameObjectManager()
-		:mNextAvailableID(1), mIsDeserializationActive(false)
+		:mNextAvailableID(1), mFirstFreeSlot(GameObjectHandleBase::INVALID_SLOT), mIsDeserializationActive(false)
 	{
 
 	}
 
 	GameObjectManager::~GameObjectManager()
-	{ }
+	{
+		// Invalidate all handles before releasing any objects, as objects might check their handles on destruction
+		for(auto& slot : mSlots)
+			slot.generation++;
+
+		for(auto& slot : mSlots)
+			slot.object = nullptr;
+
+		mSlots.clear();
+		updateSlotPointers();
+	}
 
 	GameObjectHandleBase GameObjectManager::getObject(UINT64 id) const 
 	{ 
 		auto iterFind = mObjects.find(id);
 
 		if(iterFind != mObjects.end())
-			return iterFind->second;
+			return GameObjectHandleBase(iterFind->second, mSlots[iterFind->second].generation, id);
 		
 		return nullptr;
 	}
@@ -31,7 +41,7 @@ namespace BansheeEngine
 
 		if(iterFind != mObjects.end())
 		{
-			object = iterFind->second;
+			object = GameObjectHandleBase(iterFind->second, mSlots[iterFind->second].generation, id);
 			return true;
 		}
 
@@ -45,13 +55,18 @@ namespace BansheeEngine
 
 	GameObjectHandleBase GameObjectManager::registerObject(const std::shared_ptr<GameObject>& object)
 	{
-		object->initialize(object, mNextAvailableID);
+		UINT32 slotIdx = allocateSlot();
+		UINT64 instanceId = mNextAvailableID++;
+
+		object->initialize(instanceId, slotIdx);
+
+		GameObjectSlot& slot = mSlots[slotIdx];
+		slot.object = object;
+		slot.instanceId = instanceId;
 
-		GameObjectHandleBase handle(object);
-		mObjects[mNextAvailableID] = handle;
-		mNextAvailableID++;
+		mObjects[instanceId] = slotIdx;
 
-		return handle;
+		return GameObjectHandleBase(slotIdx, slot.generation, instanceId);
 	}
 
 	void GameObjectManager::unregisterObject(const GameObjectHandleBase& object)
@@ -59,6 +74,65 @@ namespace BansheeEngine
 		mObjects.erase(object->getInstanceId());
 	}
 
+	void GameObjectManager::destroyObject(UINT32 slotIdx)
+	{
+		UINT32 primaryIdx = mSlots[slotIdx].primary;
+
+		auto iterFind = mSecondarySlots.find(primaryIdx);
+		if(iterFind != mSecondarySlots.end())
+		{
+			for(auto& secondaryIdx : iterFind->second)
+				freeSlot(secondaryIdx);
+
+			mSecondarySlots.erase(iterFind);
+		}
+
+		// Object destructor might access handles, so only release it after all of them are invalidated
+		std::shared_ptr<GameObject> object = mSlots[primaryIdx].object;
+		freeSlot(primaryIdx);
+	}
+
+	UINT32 GameObjectManager::allocateSlot()
+	{
+		UINT32 slotIdx;
+		if(mFirstFreeSlot != GameObjectHandleBase::INVALID_SLOT)
+		{
+			slotIdx = mFirstFreeSlot;
+			mFirstFreeSlot = mSlots[slotIdx].nextFree;
+		}
+		else
+		{
+			slotIdx = (UINT32)mSlots.size();
+			mSlots.push_back(GameObjectSlot());
+
+			updateSlotPointers();
+		}
+
+		GameObjectSlot& slot = mSlots[slotIdx];
+		slot.primary = slotIdx;
+		slot.nextFree = GameObjectHandleBase::INVALID_SLOT;
+
+		return slotIdx;
+	}
+
+	void GameObjectManager::freeSlot(UINT32 slotIdx)
+	{
+		GameObjectSlot& slot = mSlots[slotIdx];
+		slot.object = nullptr;
+		slot.instanceId = 0;
+		slot.generation++;
+		slot.primary = slotIdx;
+		slot.nextFree = mFirstFreeSlot;
+
+		mFirstFreeSlot = slotIdx;
+	}
+
+	void GameObjectManager::updateSlotPointers()
+	{
+		GameObjectHandleBase::sSlots = mSlots.size() > 0 ? &mSlots[0] : nullptr;
+		GameObjectHandleBase::sNumSlots = (UINT32)mSlots.size();
+	}
+
 	void GameObjectManager::startDeserialization()
 	{
 		assert(!mIsDeserializationActive);
@@ -70,9 +144,12 @@ namespace BansheeEngine
 	{
 		assert(mIsDeserializationActive);
 
-		for(auto& unresolvedHandle : mUnresolvedHandles)
+		// Objects referenced by handles deserialized before them are known now, so point the slots
+		// reserved for them to the actual objects
+		for(auto& unresolvedSlot : mUnresolvedSlots)
 		{
-			UINT64 instanceId = unresolvedHandle.getInstanceId();
+			UINT64 instanceId = unresolvedSlot.first;
+			UINT32 slotIdx = unresolvedSlot.second;
 
 			auto findIter = mIdMapping.find(instanceId);
 			if(findIter != mIdMapping.end())
@@ -81,11 +158,19 @@ namespace BansheeEngine
 			}
 
 			auto findIterObj = mObjects.find(instanceId);
-
 			if(findIterObj != mObjects.end())
-				unresolvedHandle._resolve(findIterObj->second);	
+			{
+				UINT32 primaryIdx = findIterObj->second;
+
+				GameObjectSlot& slot = mSlots[slotIdx];
+				slot.object = mSlots[primaryIdx].object;
+				slot.instanceId = instanceId;
+				slot.primary = primaryIdx;
+
+				mSecondarySlots[primaryIdx].push_back(slotIdx);
+			}
 			else
-				unresolvedHandle._resolve(nullptr);
+				freeSlot(slotIdx);
 		}
 
 		for(auto iter = mEndCallbacks.rbegin(); iter != mEndCallbacks.rend(); ++iter)
@@ -96,7 +181,7 @@ namespace BansheeEngine
 		mIsDeserializationActive = false;
 		mActiveDeserializedObject = nullptr;
 		mIdMapping.clear();
-		mUnresolvedHandles.clear();
+		mUnresolvedSlots.clear();
 		mEndCallbacks.clear();
 	}
 
@@ -112,7 +197,7 @@ namespace BansheeEngine
 		mIdMapping[serializedId] = actualId;
 	}
 
-	void GameObjectManager::registerUnresolvedHandle(const GameObjectHandleBase& object)
+	void GameObjectManager::registerUnresolvedHandle(GameObjectHandleBase& object)
 	{
 #if BS_DEBUG_MODE
 		if(!mIsDeserializationActive)
@@ -121,7 +206,39 @@ namespace BansheeEngine
 		}
 #endif
 
-		mUnresolvedHandles.push_back(object);
+		UINT64 instanceId = object.mInstanceId;
+		if(instanceId == 0)
+			return;
+
+		auto findIter = mIdMapping.find(instanceId);
+		if(findIter != mIdMapping.end())
+		{
+			auto findIterObj = mObjects.find(findIter->second);
+			if(findIterObj != mObjects.end())
+			{
+				object.mSlotIdx = findIterObj->second;
+				object.mGeneration = mSlots[findIterObj->second].generation;
+				object.mInstanceId = findIter->second;
+
+				return;
+			}
+		}
+
+		// Referenced object might not be deserialized yet, so reserve a slot for it. All handles with the same
+		// deserialized ID share the slot, and it gets pointed to the actual object once deserialization ends.
+		UINT32 slotIdx;
+
+		auto findIterSlot = mUnresolvedSlots.find(instanceId);
+		if(findIterSlot != mUnresolvedSlots.end())
+			slotIdx = findIterSlot->second;
+		else
+		{
+			slotIdx = allocateSlot();
+			mUnresolvedSlots[instanceId] = slotIdx;
+		}
+
+		object.mSlotIdx = slotIdx;
+		object.mGeneration = mSlots[slotIdx].generation;
 	}
 
 	void GameObjectManager::registerOnDeserializationEndCallback(std::function<void()> callback)
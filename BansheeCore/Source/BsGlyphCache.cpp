@@ -0,0 +1,333 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsGlyphCache.h"
+#include "BsGlyphRasterizer.h"
+#include "BsFontManager.h"
+#include "BsTexture.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsRenderSystem.h"
+#include "BsCoreThread.h"
+#include "BsDebug.h"
+
+using namespace std::placeholders;
+
+namespace BansheeEngine
+{
+	// Keeps bilinear filtering from sampling neighboring glyphs
+	const UINT32 GlyphCache::GLYPH_PADDING = 1;
+
+	GlyphCache::GlyphCache(const GlyphRasterizerPtr& rasterizer, UINT32 pageSize, UINT32 maxPages)
+		:mRasterizer(rasterizer), mPageSize(pageSize), mMaxPages(std::max(maxPages, 1U)), mUseCounter(0), mNumEvictions(0)
+	{
+		mRasterizer->getFontDesc(mFontDesc);
+
+		// Missing glyph is always resident, and is never evicted since it's not in the glyph map
+		Vector<UINT8> pixels;
+		mRasterizer->rasterizeMissingGlyph(mMissingGlyph.desc, pixels);
+
+		createPage();
+		if(!insertGlyph(mMissingGlyph, pixels))
+			LOGWRN("Missing glyph doesn't fit in a glyph cache page of size " + toString(mPageSize) + ".");
+
+		mFontDesc.missingGlyph = mMissingGlyph.desc;
+
+		if(FontManager::isStarted())
+			FontManager::instance()._registerGlyphCache(this);
+	}
+
+	GlyphCache::~GlyphCache()
+	{
+		if(FontManager::isStarted())
+			FontManager::instance()._unregisterGlyphCache(this);
+
+		for(auto& page : mPages)
+			bs_delete(page);
+	}
+
+	const CHAR_DESC& GlyphCache::getCharDesc(UINT32 charId)
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		Glyph* glyph = findOrCreateGlyph(charId);
+		if(glyph == nullptr)
+			return mMissingGlyph.desc;
+
+		return glyph->desc;
+	}
+
+	const CHAR_DESC& GlyphCache::acquireCharDesc(UINT32 charId)
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		Glyph* glyph = findOrCreateGlyph(charId);
+		if(glyph == nullptr)
+			return mMissingGlyph.desc;
+
+		glyph->numReferences++;
+		return glyph->desc;
+	}
+
+	UINT64 GlyphCache::releaseCharDescs(const CHAR_DESC** chars, UINT32 numChars)
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		for(UINT32 i = 0; i < numChars; i++)
+		{
+			if(chars[i] == &mMissingGlyph.desc)
+				continue;
+
+			auto iterFind = mGlyphs.find(chars[i]->charId);
+			if(iterFind == mGlyphs.end() || &iterFind->second.desc != chars[i])
+				continue;
+
+			Glyph& glyph = iterFind->second;
+			if(glyph.numReferences > 0)
+				glyph.numReferences--;
+		}
+
+		return mNumEvictions;
+	}
+
+	bool GlyphCache::reacquireCharDescs(const CHAR_DESC** chars, UINT32 numChars, UINT64 evictionCount)
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		// Nothing was evicted, so all released glyphs are still in the map at the same addresses
+		if(evictionCount != mNumEvictions)
+			return false;
+
+		for(UINT32 i = 0; i < numChars; i++)
+		{
+			if(chars[i] == &mMissingGlyph.desc)
+				continue;
+
+			auto iterFind = mGlyphs.find(chars[i]->charId);
+			if(iterFind == mGlyphs.end())
+				continue;
+
+			Glyph& glyph = iterFind->second;
+			glyph.numReferences++;
+			glyph.lastUsed = ++mUseCounter;
+		}
+
+		return true;
+	}
+
+	INT32 GlyphCache::getKerning(UINT32 charId, UINT32 nextCharId)
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		UINT64 key = ((UINT64)charId << 32) | nextCharId;
+
+		auto iterFind = mKerningCache.find(key);
+		if(iterFind != mKerningCache.end())
+			return iterFind->second;
+
+		INT32 kerning = mRasterizer->getKerning(charId, nextCharId);
+		mKerningCache[key] = kerning;
+
+		return kerning;
+	}
+
+	UINT32 GlyphCache::getNumPages() const
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		return (UINT32)mPages.size();
+	}
+
+	const HTexture& GlyphCache::getPage(UINT32 idx) const
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		return mPages[idx]->texture;
+	}
+
+	void GlyphCache::_update()
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		for(auto& page : mPages)
+		{
+			if(!page->isDirty)
+				continue;
+
+			const HTexture& texture = page->texture;
+			UINT32 subresourceIdx = texture->mapToSubresourceIdx(0, 0);
+
+			// System memory copy keeps changing while the core thread uploads, so send a snapshot
+			PixelDataPtr uploadData;
+			if(texture->getFormat() != page->pixels->getFormat())
+			{
+				uploadData = texture->allocateSubresourceBuffer(subresourceIdx);
+				PixelUtil::bulkPixelConversion(*page->pixels, *uploadData);
+			}
+			else
+			{
+				uploadData = bs_shared_ptr<PixelData>(mPageSize, mPageSize, 1, page->pixels->getFormat());
+				uploadData->allocateInternalBuffer();
+
+				memcpy(uploadData->getData(), page->pixels->getData(), page->pixels->getConsecutiveSize());
+			}
+
+			uploadData->_lock();
+			gCoreThread().queueReturnCommand(std::bind(&RenderSystem::writeSubresource,
+				RenderSystem::instancePtr(), texture.getInternalPtr(), subresourceIdx, uploadData, false, _1));
+
+			page->isDirty = false;
+		}
+	}
+
+	GlyphCache::Glyph* GlyphCache::findOrCreateGlyph(UINT32 charId)
+	{
+		auto iterFind = mGlyphs.find(charId);
+		if(iterFind != mGlyphs.end())
+		{
+			iterFind->second.lastUsed = ++mUseCounter;
+			return &iterFind->second;
+		}
+
+		if(mMissingChars.find(charId) != mMissingChars.end())
+			return nullptr;
+
+		Glyph glyph;
+		Vector<UINT8> pixels;
+		if(!mRasterizer->rasterizeGlyph(charId, glyph.desc, pixels))
+		{
+			mMissingChars.insert(charId);
+			return nullptr;
+		}
+
+		if(!insertGlyph(glyph, pixels))
+		{
+			LOGWRN("Unable to fit character " + toString(charId) + " in the glyph cache. All glyphs are in use.");
+			return nullptr;
+		}
+
+		auto insertResult = mGlyphs.insert(std::make_pair(charId, glyph));
+		return &insertResult.first->second;
+	}
+
+	bool GlyphCache::insertGlyph(Glyph& glyph, const Vector<UINT8>& pixels)
+	{
+		CHAR_DESC& desc = glyph.desc;
+
+		glyph.x = 0;
+		glyph.y = 0;
+		glyph.slotWidth = 0;
+		glyph.slotHeight = 0;
+		glyph.numReferences = 0;
+		glyph.lastUsed = ++mUseCounter;
+
+		desc.page = 0;
+		desc.uvX = 0.0f;
+		desc.uvY = 0.0f;
+		desc.uvWidth = 0.0f;
+		desc.uvHeight = 0.0f;
+
+		// Invisible glyphs only need their metrics
+		if(desc.width == 0 || desc.height == 0)
+			return true;
+
+		UINT32 slotWidth = desc.width + GLYPH_PADDING;
+		UINT32 slotHeight = desc.height + GLYPH_PADDING;
+
+		if(slotWidth > mPageSize || slotHeight > mPageSize)
+			return false;
+
+		UINT32 pageIdx = 0;
+		UINT32 x = 0;
+		UINT32 y = 0;
+		while(!allocateSlot(slotWidth, slotHeight, pageIdx, x, y))
+		{
+			if((UINT32)mPages.size() < mMaxPages)
+				createPage();
+			else if(!evictGlyph())
+				return false;
+		}
+
+		Page& page = *mPages[pageIdx];
+		UINT8* pageData = page.pixels->getData();
+
+		// Slot might have belonged to an evicted glyph, so clear it including the padding
+		for(UINT32 row = 0; row < slotHeight; row++)
+			memset(pageData + (y + row) * mPageSize + x, 0, slotWidth);
+
+		for(UINT32 row = 0; row < desc.height; row++)
+			memcpy(pageData + (y + row) * mPageSize + x, &pixels[row * desc.width], desc.width);
+
+		page.isDirty = true;
+
+		glyph.x = x;
+		glyph.y = y;
+		glyph.slotWidth = slotWidth;
+		glyph.slotHeight = slotHeight;
+
+		float invPageSize = 1.0f / mPageSize;
+
+		desc.page = pageIdx;
+		desc.uvX = invPageSize * x;
+		desc.uvY = invPageSize * y;
+		desc.uvWidth = invPageSize * desc.width;
+		desc.uvHeight = invPageSize * desc.height;
+
+		return true;
+	}
+
+	bool GlyphCache::allocateSlot(UINT32 width, UINT32 height, UINT32& page, UINT32& x, UINT32& y)
+	{
+		for(UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			if(mPages[i]->packer.insert(width, height, x, y))
+			{
+				page = i;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool GlyphCache::evictGlyph()
+	{
+		auto iterEvict = mGlyphs.end();
+		for(auto iter = mGlyphs.begin(); iter != mGlyphs.end(); ++iter)
+		{
+			const Glyph& glyph = iter->second;
+			if(glyph.numReferences > 0 || glyph.slotWidth == 0)
+				continue;
+
+			if(iterEvict == mGlyphs.end() || glyph.lastUsed < iterEvict->second.lastUsed)
+				iterEvict = iter;
+		}
+
+		if(iterEvict == mGlyphs.end())
+			return false;
+
+		const Glyph& glyph = iterEvict->second;
+		mPages[glyph.desc.page]->packer.remove(glyph.x, glyph.y, glyph.slotWidth, glyph.slotHeight);
+
+		mGlyphs.erase(iterEvict);
+		mNumEvictions++;
+
+		return true;
+	}
+
+	void GlyphCache::createPage()
+	{
+		Page* page = bs_new<Page>(mPageSize);
+
+		// No need to wait for the core thread, texture format and size are known as soon as it is created, and
+		// page uploads are queued after its initialization
+		page->texture = Texture::create(TEX_TYPE_2D, mPageSize, mPageSize, 0, PF_R8);
+		page->texture->setName("GlyphCachePage" + toString((UINT32)mPages.size()));
+
+		page->pixels = bs_shared_ptr<PixelData>(mPageSize, mPageSize, 1, PF_R8);
+		page->pixels->allocateInternalBuffer();
+		memset(page->pixels->getData(), 0, page->pixels->getConsecutiveSize());
+
+		mPages.push_back(page);
+	}
+}
@@ -0,0 +1,79 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsGpuParamBlockAllocator.h"
+#include "BsGpuParamBlockBuffer.h"
+#include "BsGpuParamBlock.h"
+#include "BsHardwareBufferManager.h"
+#include "BsRenderSystem.h"
+#include "BsRenderSystemCapabilities.h"
+
+namespace BansheeEngine
+{
+	GpuParamBlockAllocator::GpuParamBlockAllocator(UINT32 initialSize)
+		:mStagingData(nullptr), mSize(0), mAlignment(1), mFreePtr(0)
+	{
+		mAlignment = std::max(RenderSystem::instance().getCapabilities()->getParamBlockOffsetAlignment(), 1U);
+
+		createBuffer(initialSize);
+	}
+
+	GpuParamBlockAllocator::~GpuParamBlockAllocator()
+	{
+		if (mStagingData != nullptr)
+			bs_free(mStagingData);
+	}
+
+	void GpuParamBlockAllocator::beginFrame(UINT32 requiredSize)
+	{
+		mFreePtr = 0;
+
+		if (requiredSize > mSize)
+			createBuffer(std::max(requiredSize, mSize * 2));
+	}
+
+	UINT32 GpuParamBlockAllocator::allocate(const UINT8* data, UINT32 size)
+	{
+		UINT32 allocSize = getAllocationSize(size);
+		if ((mFreePtr + allocSize) > mSize)
+			return (UINT32)-1;
+
+		UINT32 offset = mFreePtr;
+		memcpy(mStagingData + offset, data, size);
+
+		mFreePtr += allocSize;
+		return offset;
+	}
+
+	void GpuParamBlockAllocator::endFrame()
+	{
+		if (mFreePtr == 0)
+			return;
+
+		// Discard lets the driver retire the previous frame's storage once the GPU is done with it
+		mBuffer->writeDataDiscard(mStagingData, 0, mFreePtr);
+	}
+
+	UINT32 GpuParamBlockAllocator::getAllocationSize(UINT32 size) const
+	{
+		return ((size + mAlignment - 1) / mAlignment) * mAlignment;
+	}
+
+	void GpuParamBlockAllocator::createBuffer(UINT32 size)
+	{
+		size = getAllocationSize(size);
+
+		if (mStagingData != nullptr)
+			bs_free(mStagingData);
+
+		mStagingData = (UINT8*)bs_alloc(size);
+		memset(mStagingData, 0, size);
+
+		mBuffer = HardwareBufferManager::instance().createGpuParamBlockBuffer(size, GPBU_DYNAMIC);
+		mSize = size;
+
+		// Buffer contents are only ever written through writeDataDiscard. A new buffer's CPU side block
+		// starts out dirty, and uploading it would overwrite the data with zeroes.
+		mBuffer->getParamBlock()->setDirty(false);
+	}
+}
@@ -36,6 +36,11 @@ namespace BansheeEngine
 		memcpy(mData, data, mSize);
 	}
 
+	void GenericGpuParamBlockBuffer::writeDataDiscard(const UINT8* data, UINT32 offset, UINT32 length)
+	{
+		memcpy(mData + offset, data, length);
+	}
+
 	void GenericGpuParamBlockBuffer::readData(UINT8* data) const
 	{
 		memcpy(data, mData, mSize);
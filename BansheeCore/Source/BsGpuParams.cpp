@@ -14,7 +14,7 @@ namespace BansheeEngine
 {
 	GpuParamsInternalData::GpuParamsInternalData()
 		:mTransposeMatrices(false), mData(nullptr), mNumParamBlocks(0), mNumTextures(0), mNumSamplerStates(0), mFrameAlloc(nullptr),
-		mParamBlocks(nullptr), mParamBlockBuffers(nullptr), mTextures(nullptr), mSamplerStates(nullptr), mCoreDirtyFlags(0xFFFFFFFF),
+		mParamBlocks(nullptr), mParamBlockBuffers(nullptr), mParamBlockOffsets(nullptr), mTextures(nullptr), mSamplerStates(nullptr), mCoreDirtyFlags(0xFFFFFFFF),
 		mIsDestroyed(false)
 	{ }
 
@@ -84,6 +84,7 @@ namespace BansheeEngine
 
 		mInternalData->mParamBlockBuffers[slot] = paramBlockBuffer;
 		mInternalData->mParamBlocks[slot] = paramBlockBuffer->getParamBlock();
+		mInternalData->mParamBlockOffsets[slot] = 0;
 
 		markCoreDirty();
 	}
@@ -100,6 +101,20 @@ namespace BansheeEngine
 
 		mInternalData->mParamBlockBuffers[iterFind->second.slot] = paramBlockBuffer;
 		mInternalData->mParamBlocks[iterFind->second.slot] = paramBlockBuffer != nullptr ? paramBlockBuffer->getParamBlock() : nullptr;
+		mInternalData->mParamBlockOffsets[iterFind->second.slot] = 0;
+
+		markCoreDirty();
+	}
+
+	void GpuParams::setParamBlockOffset(UINT32 slot, UINT32 offset)
+	{
+		if (slot < 0 || slot >= mInternalData->mNumParamBlocks)
+		{
+			BS_EXCEPT(InvalidParametersException, "Index out of range: Valid range: 0 .. " +
+				toString(mInternalData->mNumParamBlocks - 1) + ". Requested: " + toString(slot));
+		}
+
+		mInternalData->mParamBlockOffsets[slot] = offset;
 
 		markCoreDirty();
 	}
@@ -195,6 +210,17 @@ namespace BansheeEngine
 		return mInternalData->mParamBlockBuffers[slot];
 	}
 
+	UINT32 GpuParams::getParamBlockOffset(UINT32 slot) const
+	{
+		if (slot < 0 || slot >= mInternalData->mNumParamBlocks)
+		{
+			BS_EXCEPT(InvalidParametersException, "Index out of range: Valid range: 0 .. " +
+				toString(mInternalData->mNumParamBlocks - 1) + ". Requested: " + toString(slot));
+		}
+
+		return mInternalData->mParamBlockOffsets[slot];
+	}
+
 	HTexture GpuParams::getTexture(UINT32 slot)
 	{
 		if (slot < 0 || slot >= mInternalData->mNumTextures)
@@ -272,6 +298,7 @@ namespace BansheeEngine
 				myClone->mInternalData->mParamBlocks[i] = nullptr;
 
 			myClone->mInternalData->mParamBlockBuffers[i] = buffer;
+			myClone->mInternalData->mParamBlockOffsets[i] = mInternalData->mParamBlockOffsets[i];
 		}
 
 		for (UINT32 i = 0; i < mInternalData->mNumTextures; i++)
@@ -293,19 +320,23 @@ namespace BansheeEngine
 		UINT32 bufferSize = 0;
 		UINT32 paramBlockOffset = 0;
 		UINT32 paramBlockBufferOffset = 0;
+		UINT32 paramBlockOffsetsOffset = 0;
 		UINT32 textureOffset = 0;
 		UINT32 samplerStateOffset = 0;
 
 		UINT32 paramBlockBufferSize = mInternalData->mNumParamBlocks * sizeof(GpuParamBlockPtr);
 		UINT32 paramBlockBuffersBufferSize = mInternalData->mNumParamBlocks * sizeof(GpuParamBlockBufferPtr);
+		UINT32 paramBlockOffsetsBufferSize = mInternalData->mNumParamBlocks * sizeof(UINT32);
 		UINT32 textureBufferSize = mInternalData->mNumTextures * sizeof(HTexture);
 		UINT32 samplerStateBufferSize = mInternalData->mNumSamplerStates * sizeof(HSamplerState);
 
-		bufferSize = paramBlockBufferSize + paramBlockBuffersBufferSize + textureBufferSize + samplerStateBufferSize;
+		// Offsets go last so they don't break the alignment of other entries
+		bufferSize = paramBlockBufferSize + paramBlockBuffersBufferSize + textureBufferSize + samplerStateBufferSize + paramBlockOffsetsBufferSize;
 		paramBlockOffset = 0;
 		paramBlockBufferOffset = paramBlockOffset + paramBlockBufferSize;
 		textureOffset = paramBlockBufferOffset + paramBlockBuffersBufferSize;
 		samplerStateOffset = textureOffset + textureBufferSize;
+		paramBlockOffsetsOffset = samplerStateOffset + samplerStateBufferSize;
 
 		if (frameAlloc != nullptr)
 		{
@@ -322,6 +353,7 @@ namespace BansheeEngine
 		mInternalData->mParamBlockBuffers = (GpuParamBlockBufferPtr*)(mInternalData->mData + paramBlockBufferOffset);
 		mInternalData->mTextures = (HTexture*)(mInternalData->mData + textureOffset);
 		mInternalData->mSamplerStates = (HSamplerState*)(mInternalData->mData + samplerStateOffset);
+		mInternalData->mParamBlockOffsets = (UINT32*)(mInternalData->mData + paramBlockOffsetsOffset);
 
 		// Ensure everything is constructed
 		for (UINT32 i = 0; i < mInternalData->mNumParamBlocks; i++)
@@ -335,6 +367,8 @@ namespace BansheeEngine
 			GpuParamBlockBufferPtr* ptrToIdx = (&mInternalData->mParamBlockBuffers[i]);
 			ptrToIdx = new (&mInternalData->mParamBlockBuffers[i]) GpuParamBlockBufferPtr(nullptr);
 		}
+
+			mInternalData->mParamBlockOffsets[i] = 0;
 		}
 
 		for (UINT32 i = 0; i < mInternalData->mNumTextures; i++)
@@ -17,9 +17,10 @@ namespace BansheeEngine
     {
     }
 
-	VertexDeclarationPtr HardwareBufferManager::createVertexDeclaration(const VertexDeclaration::VertexElementList& elements)
+	VertexDeclarationPtr HardwareBufferManager::createVertexDeclaration(const VertexDeclaration::VertexElementList& elements,
+		const VertexDeclaration::InstanceStepRateMap& instanceStepRates)
     {
-        VertexDeclarationPtr decl = createVertexDeclarationImpl(elements);
+        VertexDeclarationPtr decl = createVertexDeclarationImpl(elements, instanceStepRates);
 		decl->_setThisPtr(decl);
 		decl->initialize();
         return decl;
@@ -64,8 +65,9 @@ namespace BansheeEngine
 		return gbuf;
 	}
 
-	VertexDeclarationPtr HardwareBufferManager::createVertexDeclarationImpl(const VertexDeclaration::VertexElementList& elements)
+	VertexDeclarationPtr HardwareBufferManager::createVertexDeclarationImpl(const VertexDeclaration::VertexElementList& elements,
+		const VertexDeclaration::InstanceStepRateMap& instanceStepRates)
 	{
-		return bs_core_ptr<VertexDeclaration, PoolAlloc>(new (bs_alloc<VertexDeclaration, PoolAlloc>()) VertexDeclaration(elements));
+		return bs_core_ptr<VertexDeclaration, PoolAlloc>(new (bs_alloc<VertexDeclaration, PoolAlloc>()) VertexDeclaration(elements, instanceStepRates));
 	}
 }
@@ -14,6 +14,11 @@
 #include "BsException.h"
 #include "BsUUID.h"
 #include "BsResources.h"
+#include "BsResourceManifest.h"
+#include "BsFileSerializer.h"
+#include "BsMemorySerializer.h"
+#include "BsTaskScheduler.h"
+#include <iomanip>
 
 namespace BansheeEngine
 {
@@ -58,43 +63,175 @@ namespace BansheeEngine
 
 	HResource Importer::import(const Path& inputFilePath, ConstImportOptionsPtr importOptions)
 	{
-		if(!FileSystem::isFile(inputFilePath))
-		{
-			LOGWRN("Trying to import asset that doesn't exists. Asset path: " + inputFilePath.toString());
+		ResourcePtr importedResource = importResource(inputFilePath, importOptions);
+		if(importedResource == nullptr)
 			return HResource();
+
+		return gResources()._createResourceHandle(importedResource);
+	}
+
+	void Importer::reimport(HResource& existingResource, const Path& inputFilePath, ConstImportOptionsPtr importOptions)
+	{
+		ResourcePtr importedResource = importResource(inputFilePath, importOptions);
+		if(importedResource == nullptr)
+			return;
+
+		existingResource._setHandleData(importedResource, existingResource.getUUID());
+	}
+
+	Vector<HResource> Importer::importBatch(const Vector<Path>& inputFilePaths, 
+		const Vector<ConstImportOptionsPtr>& importOptions, UINT32 maxInFlight)
+	{
+		struct PendingImport
+		{
+			UINT32 idx;
+			SpecificImporter* importer;
+			ConstImportOptionsPtr importOptions;
+		};
+
+		UINT32 numFiles = (UINT32)inputFilePaths.size();
+		Vector<ResourcePtr> importedResources(numFiles);
+		Vector<UINT64> cacheKeys(numFiles, 0);
+
+		Vector<PendingImport> parallelImports;
+		Vector<PendingImport> serialImports;
+		for(UINT32 i = 0; i < numFiles; i++)
+		{
+			ConstImportOptionsPtr fileImportOptions;
+			if(i < (UINT32)importOptions.size())
+				fileImportOptions = importOptions[i];
+
+			SpecificImporter* importer = prepareImport(inputFilePaths[i], fileImportOptions);
+			if(importer == nullptr)
+				continue;
+
+			if(!mCacheFolder.isEmpty())
+			{
+				cacheKeys[i] = calculateCacheKey(inputFilePaths[i], importer, fileImportOptions);
+
+				importedResources[i] = loadFromCache(cacheKeys[i], inputFilePaths[i]);
+				if(importedResources[i] != nullptr)
+					continue;
+			}
+
+			PendingImport pendingImport = { i, importer, fileImportOptions };
+			if(importer->isThreadSafe() && TaskScheduler::isStarted())
+				parallelImports.push_back(pendingImport);
+			else
+				serialImports.push_back(pendingImport);
 		}
 
-		SpecificImporter* importer = getImporterForFile(inputFilePath);
-		if(importer == nullptr)
-			return HResource();
+		if(maxInFlight == 0)
+			maxInFlight = std::max(1U, (UINT32)BS_THREAD_HARDWARE_CONCURRENCY);
 
-		if(importOptions == nullptr)
-			importOptions = importer->getDefaultImportOptions();
-		else
+		// Exceptions are caught on the worker threads and reported once all imports are done, so a single
+		// failed file doesn't discard the rest of the batch
+		Vector<String> importErrors(numFiles);
+		auto importFile = [&](const PendingImport& pendingImport)
 		{
-			ConstImportOptionsPtr defaultImportOptions = importer->getDefaultImportOptions();
-			if(importOptions->getTypeId() != defaultImportOptions->getTypeId())
+			try
 			{
-				BS_EXCEPT(InvalidParametersException, "Provided import options is not of valid type. " \
-					"Expected: " + defaultImportOptions->getTypeName() + ". Got: " + importOptions->getTypeName() + ".");
+				importedResources[pendingImport.idx] = pendingImport.importer->import(inputFilePaths[pendingImport.idx], pendingImport.importOptions);
+			}
+			catch(const std::exception& e)
+			{
+				importErrors[pendingImport.idx] = e.what();
+				if(importErrors[pendingImport.idx].empty())
+					importErrors[pendingImport.idx] = "Unknown error.";
+			}
+			catch(...)
+			{
+				importErrors[pendingImport.idx] = "Unknown error.";
+			}
+		};
+
+		UINT32 nextSerialImport = 0;
+		Queue<TaskPtr> activeTasks;
+		for(auto& pendingImport : parallelImports)
+		{
+			// Make progress on imports that cannot run in parallel while waiting for a free slot
+			while(activeTasks.size() >= maxInFlight)
+			{
+				if(activeTasks.front()->isComplete())
+					activeTasks.pop();
+				else if(nextSerialImport < (UINT32)serialImports.size())
+					importFile(serialImports[nextSerialImport++]);
+				else
+				{
+					activeTasks.front()->wait();
+					activeTasks.pop();
+				}
+			}
+
+			TaskPtr task = Task::create("Import", std::bind(importFile, pendingImport));
+			TaskScheduler::instance().addTask(task);
+
+			activeTasks.push(task);
+		}
+
+		for(; nextSerialImport < (UINT32)serialImports.size(); nextSerialImport++)
+			importFile(serialImports[nextSerialImport]);
+
+		while(!activeTasks.empty())
+		{
+			activeTasks.front()->wait();
+			activeTasks.pop();
+		}
+
+		Vector<HResource> output(numFiles);
+		for(UINT32 i = 0; i < numFiles; i++)
+		{
+			if(!importErrors[i].empty())
+			{
+				LOGWRN("Failed to import asset. Asset path: " + inputFilePaths[i].toString() + ". Error: " + importErrors[i]);
+				continue;
 			}
+
+			if(importedResources[i] == nullptr)
+				continue;
+
+			if(cacheKeys[i] != 0)
+				saveToCache(cacheKeys[i], importedResources[i]);
+
+			output[i] = gResources()._createResourceHandle(importedResources[i]);
 		}
 
+		return output;
+	}
+
+	ResourcePtr Importer::importResource(const Path& inputFilePath, ConstImportOptionsPtr importOptions)
+	{
+		SpecificImporter* importer = prepareImport(inputFilePath, importOptions);
+		if(importer == nullptr)
+			return nullptr;
+
+		if(mCacheFolder.isEmpty())
+			return importer->import(inputFilePath, importOptions);
+
+		UINT64 cacheKey = calculateCacheKey(inputFilePath, importer, importOptions);
+
+		ResourcePtr cachedResource = loadFromCache(cacheKey, inputFilePath);
+		if(cachedResource != nullptr)
+			return cachedResource;
+
 		ResourcePtr importedResource = importer->import(inputFilePath, importOptions);
-		return gResources()._createResourceHandle(importedResource);
+		if(importedResource != nullptr)
+			saveToCache(cacheKey, importedResource);
+
+		return importedResource;
 	}
 
-	void Importer::reimport(HResource& existingResource, const Path& inputFilePath, ConstImportOptionsPtr importOptions)
+	SpecificImporter* Importer::prepareImport(const Path& inputFilePath, ConstImportOptionsPtr& importOptions) const
 	{
 		if(!FileSystem::isFile(inputFilePath))
 		{
 			LOGWRN("Trying to import asset that doesn't exists. Asset path: " + inputFilePath.toString());
-			return;
+			return nullptr;
 		}
 
 		SpecificImporter* importer = getImporterForFile(inputFilePath);
 		if(importer == nullptr)
-			return;
+			return nullptr;
 
 		if(importOptions == nullptr)
 			importOptions = importer->getDefaultImportOptions();
@@ -108,8 +245,23 @@ namespace BansheeEngine
 			}
 		}
 
-		ResourcePtr importedResource = importer->import(inputFilePath, importOptions);
-		existingResource._setHandleData(importedResource, existingResource.getUUID());
+		return importer;
+	}
+
+	ResourcePtr Importer::loadFromCache(UINT64 key, const Path& inputFilePath) const
+	{
+		Path cachePath = getCachePath(key, 0);
+		if(!FileSystem::isFile(cachePath))
+			return nullptr;
+
+		FileSerializer fs;
+		std::shared_ptr<IReflectable> cachedData = fs.decode(cachePath);
+
+		if(cachedData != nullptr && cachedData->isDerivedFrom(Resource::getRTTIStatic()))
+			return std::static_pointer_cast<Resource>(cachedData);
+
+		LOGWRN("Invalid import cache entry, importing again. Asset path: " + inputFilePath.toString());
+		return nullptr;
 	}
 
 	ImportOptionsPtr Importer::createImportOptions(const Path& inputFilePath)
@@ -127,6 +279,117 @@ namespace BansheeEngine
 		return importer->createImportOptions();
 	}
 
+	void Importer::setCacheFolder(const Path& cacheFolder)
+	{
+		mCacheFolder = cacheFolder;
+		mCacheManifest = nullptr;
+
+		if(mCacheFolder.isEmpty())
+			return;
+
+		if(!FileSystem::exists(mCacheFolder))
+			FileSystem::createDir(mCacheFolder);
+
+		Path manifestPath = mCacheFolder;
+		manifestPath.append(L"ImportCache.manifest");
+
+		if(FileSystem::isFile(manifestPath))
+			mCacheManifest = ResourceManifest::load(manifestPath, mCacheFolder);
+		else
+			mCacheManifest = ResourceManifest::create("ImportCache");
+
+		gResources().registerResourceManifest(mCacheManifest);
+	}
+
+	UINT64 Importer::calculateCacheKey(const Path& inputFilePath, SpecificImporter* importer, const ConstImportOptionsPtr& importOptions) const
+	{
+		// 64-bit FNV-1a
+		static const UINT64 FNV_OFFSET = 14695981039346656037ULL;
+		static const UINT64 FNV_PRIME = 1099511628211ULL;
+		static const UINT32 READ_BUFFER_SIZE = 64 * 1024;
+
+		UINT64 hash = FNV_OFFSET;
+		auto hashData = [&](const UINT8* data, UINT32 size)
+		{
+			for(UINT32 i = 0; i < size; i++)
+			{
+				hash ^= data[i];
+				hash *= FNV_PRIME;
+			}
+		};
+
+		UINT8* readBuffer = (UINT8*)bs_alloc<ScratchAlloc>(READ_BUFFER_SIZE);
+
+		DataStreamPtr fileStream = FileSystem::openFile(inputFilePath);
+		while(!fileStream->eof())
+		{
+			UINT32 numRead = (UINT32)fileStream->read(readBuffer, READ_BUFFER_SIZE);
+			if(numRead == 0)
+				break;
+
+			hashData(readBuffer, numRead);
+		}
+
+		fileStream->close();
+		bs_free<ScratchAlloc>(readBuffer);
+
+		MemorySerializer ms;
+		UINT32 optionsSize = 0;
+		UINT8* optionsData = ms.encode(const_cast<ImportOptions*>(importOptions.get()), optionsSize);
+		hashData(optionsData, optionsSize);
+		bs_free(optionsData);
+
+		UINT32 version = importer->getVersion();
+		hashData((const UINT8*)&version, sizeof(version));
+
+		return hash;
+	}
+
+	Path Importer::getCachePath(UINT64 key, UINT32 dependencyIdx) const
+	{
+		StringStream fileName;
+		fileName << std::hex << std::setw(16) << std::setfill('0') << key;
+
+		if(dependencyIdx > 0)
+			fileName << "_" << std::dec << dependencyIdx;
+
+		fileName << ".asset";
+
+		Path cachePath = mCacheFolder;
+		cachePath.append(fileName.str());
+
+		return cachePath;
+	}
+
+	void Importer::saveToCache(UINT64 key, const ResourcePtr& resource)
+	{
+		// Referenced resources are saved as separate entries and registered in the cache manifest,
+		// so the references can be resolved when the cached resource is loaded
+		Vector<HResource> dependencies;
+		resource->getResourceDependencies(dependencies);
+
+		FileSerializer fs;
+
+		UINT32 dependencyIdx = 1;
+		for(auto& dependency : dependencies)
+		{
+			Path dependencyPath = getCachePath(key, dependencyIdx++);
+
+			fs.encode(dependency.get(), dependencyPath);
+			mCacheManifest->registerResource(dependency.getUUID(), dependencyPath);
+		}
+
+		fs.encode(resource.get(), getCachePath(key, 0));
+
+		if(!dependencies.empty())
+		{
+			Path manifestPath = mCacheFolder;
+			manifestPath.append(L"ImportCache.manifest");
+
+			ResourceManifest::save(mCacheManifest, manifestPath, mCacheFolder);
+		}
+	}
+
 	void Importer::_registerAssetImporter(SpecificImporter* importer)
 	{
 		if(!importer)
@@ -6,6 +6,8 @@
 #include "BsMeshData.h"
 #include "BsVector2.h"
 #include "BsVector3.h"
+#include "BsVector4.h"
+#include "BsQuaternion.h"
 #include "BsDebug.h"
 #include "BsHardwareBufferManager.h"
 #include "BsMeshManager.h"
@@ -20,7 +22,8 @@ namespace BansheeEngine
 	Mesh::Mesh(UINT32 numVertices, UINT32 numIndices, const VertexDataDescPtr& vertexDesc, 
 		MeshBufferType bufferType, DrawOperationType drawOp, IndexBuffer::IndexType indexType)
 		:MeshBase(numVertices, numIndices, drawOp), mVertexData(nullptr), mIndexBuffer(nullptr),
-		mVertexDesc(vertexDesc), mBufferType(bufferType), mIndexType(indexType)
+		mVertexDesc(vertexDesc), mBufferType(bufferType), mIndexType(indexType), mPositionOffset(Vector3::ZERO),
+		mPositionScale(1.0f)
 	{
 
 	}
@@ -28,7 +31,8 @@ namespace BansheeEngine
 	Mesh::Mesh(UINT32 numVertices, UINT32 numIndices, const VertexDataDescPtr& vertexDesc,
 		const Vector<SubMesh>& subMeshes, MeshBufferType bufferType, IndexBuffer::IndexType indexType)
 		:MeshBase(numVertices, numIndices, subMeshes), mVertexData(nullptr), mIndexBuffer(nullptr),
-		mVertexDesc(vertexDesc), mBufferType(bufferType), mIndexType(indexType)
+		mVertexDesc(vertexDesc), mBufferType(bufferType), mIndexType(indexType), mPositionOffset(Vector3::ZERO),
+		mPositionScale(1.0f)
 	{
 
 	}
@@ -36,7 +40,8 @@ namespace BansheeEngine
 	Mesh::Mesh(const MeshDataPtr& initialMeshData, MeshBufferType bufferType, DrawOperationType drawOp)
 		:MeshBase(initialMeshData->getNumVertices(), initialMeshData->getNumIndices(), drawOp), 
 		mVertexData(nullptr), mIndexBuffer(nullptr), mIndexType(initialMeshData->getIndexType()),
-		mVertexDesc(initialMeshData->getVertexDesc()), mTempInitialMeshData(initialMeshData)
+		mVertexDesc(initialMeshData->getVertexDesc()), mTempInitialMeshData(initialMeshData),
+		mPositionOffset(initialMeshData->getPositionDecodeOffset()), mPositionScale(initialMeshData->getPositionDecodeScale())
 	{
 
 	}
@@ -44,18 +49,28 @@ namespace BansheeEngine
 	Mesh::Mesh(const MeshDataPtr& initialMeshData, const Vector<SubMesh>& subMeshes, MeshBufferType bufferType)
 		:MeshBase(initialMeshData->getNumVertices(), initialMeshData->getNumIndices(), subMeshes),
 		mVertexData(nullptr), mIndexBuffer(nullptr), mIndexType(initialMeshData->getIndexType()),
-		mVertexDesc(initialMeshData->getVertexDesc()), mTempInitialMeshData(initialMeshData)
+		mVertexDesc(initialMeshData->getVertexDesc()), mTempInitialMeshData(initialMeshData),
+		mPositionOffset(initialMeshData->getPositionDecodeOffset()), mPositionScale(initialMeshData->getPositionDecodeScale())
 	{
 
 	}
 
 	Mesh::Mesh()
 		:MeshBase(0, 0, DOT_TRIANGLE_LIST), mVertexData(nullptr), mIndexBuffer(nullptr), 
-		mBufferType(MeshBufferType::Static), mIndexType(IndexBuffer::IT_32BIT)
+		mBufferType(MeshBufferType::Static), mIndexType(IndexBuffer::IT_32BIT), mPositionOffset(Vector3::ZERO),
+		mPositionScale(1.0f)
 	{
 
 	}
 
+	UINT32 Mesh::getGPUMemorySize() const
+	{
+		UINT32 vertexSize = mVertexDesc != nullptr ? mVertexDesc->getVertexStride() : 0;
+		UINT32 indexSize = mIndexType == IndexBuffer::IT_16BIT ? sizeof(UINT16) : sizeof(UINT32);
+
+		return mNumVertices * vertexSize + mNumIndices * indexSize;
+	}
+
 	Mesh::~Mesh()
 	{
 
@@ -255,6 +270,7 @@ namespace BansheeEngine
 			indexType = mIndexBuffer->getType();
 
 		MeshDataPtr meshData = bs_shared_ptr<MeshData>(mVertexData->vertexCount, mNumIndices, mVertexDesc, indexType);
+		meshData->setPositionDecode(mPositionOffset, mPositionScale);
 
 		return meshData;
 	}
@@ -333,13 +349,37 @@ namespace BansheeEngine
 		{
 			const VertexElement& curElement = vertexDesc->getElement(i);
 
-			if (curElement.getSemantic() != VES_POSITION || (curElement.getType() != VET_FLOAT3 && curElement.getType() != VET_FLOAT4))
+			if (curElement.getSemantic() != VES_POSITION)
 				continue;
 
-			UINT8* data = meshData.getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), curElement.getStreamIdx());
-			UINT32 stride = vertexDesc->getVertexStride(curElement.getStreamIdx());
+			if (curElement.getType() == VET_FLOAT3 || curElement.getType() == VET_FLOAT4)
+			{
+				UINT8* data = meshData.getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), curElement.getStreamIdx());
+				UINT32 stride = vertexDesc->getVertexStride(curElement.getStreamIdx());
+
+				mBounds = calculateBounds((UINT8*)data, mTempInitialMeshData->getNumVertices(), stride);
+			}
+			else if (curElement.getType() == VET_USHORT4_NORM)
+			{
+				// Bounds are kept in mesh space, so quantized positions need to be decoded first
+				VertexElemDecodeIter positionIter = meshData.getDecodedDataIter(curElement.getSemantic(), 
+					curElement.getSemanticIdx(), curElement.getStreamIdx());
+
+				Vector<Vector3> positions(positionIter.getNumElements());
+				for (UINT32 j = 0; j < positionIter.getNumElements(); j++)
+				{
+					Vector4 position = positionIter.getValue();
+					positions[j] = Vector3(position.x, position.y, position.z);
+
+					positionIter.moveNext();
+				}
+
+				if (positions.size() > 0)
+					mBounds = calculateBounds((UINT8*)&positions[0], (UINT32)positions.size(), sizeof(Vector3));
+			}
+			else
+				continue;
 
-			mBounds = calculateBounds((UINT8*)data, mTempInitialMeshData->getNumVertices(), stride);
 			markCoreDirty();
 
 			break;
@@ -389,13 +429,15 @@ namespace BansheeEngine
 		return bounds;
 	}
 
-	MeshProxyPtr Mesh::_createProxy(UINT32 subMeshIdx)
+	MeshProxyPtr Mesh::_createProxy(UINT32 subMeshIdx, UINT32 lodIdx)
 	{
 		MeshProxyPtr coreProxy = bs_shared_ptr<MeshProxy>();
 		coreProxy->mesh = std::static_pointer_cast<MeshBase>(getThisPtr());
 		coreProxy->bounds = mBounds;
-		coreProxy->subMesh = getSubMesh(subMeshIdx);
+		coreProxy->subMesh = getSubMesh(subMeshIdx, lodIdx);
 		coreProxy->submeshIdx = subMeshIdx;
+		coreProxy->positionDecode.setTRS(mPositionOffset, Quaternion::IDENTITY, 
+			Vector3(mPositionScale, mPositionScale, mPositionScale));
 
 		return coreProxy;
 	}
@@ -32,7 +32,7 @@ namespace BansheeEngine
 
 	}
 
-	const SubMesh& MeshBase::getSubMesh(UINT32 subMeshIdx) const
+	const SubMesh& MeshBase::getSubMesh(UINT32 subMeshIdx, UINT32 lodIdx) const
 	{
 		if(subMeshIdx < 0 || subMeshIdx >= mSubMeshes.size())
 		{
@@ -40,7 +40,16 @@ namespace BansheeEngine
 				+ toString(subMeshIdx) + "). Number of sub-meshes available: " + toString((int)mSubMeshes.size()));
 		}
 
-		return mSubMeshes[subMeshIdx];
+		if(lodIdx >= getNumLODs())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid level of detail index (" 
+				+ toString(lodIdx) + "). Number of levels available: " + toString(getNumLODs()));
+		}
+
+		if(lodIdx == 0)
+			return mSubMeshes[subMeshIdx];
+
+		return mLODSubMeshes[(lodIdx - 1) * mSubMeshes.size() + subMeshIdx];
 	}
 
 	UINT32 MeshBase::getNumSubMeshes() const
@@ -48,6 +57,46 @@ namespace BansheeEngine
 		return (UINT32)mSubMeshes.size();
 	}
 
+	UINT32 MeshBase::getNumLODs() const
+	{
+		return (UINT32)mLODScreenSizes.size() + 1;
+	}
+
+	float MeshBase::getLODScreenSize(UINT32 lodIdx) const
+	{
+		if(lodIdx >= getNumLODs())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid level of detail index (" 
+				+ toString(lodIdx) + "). Number of levels available: " + toString(getNumLODs()));
+		}
+
+		if(lodIdx == 0)
+			return std::numeric_limits<float>::infinity();
+
+		return mLODScreenSizes[lodIdx - 1];
+	}
+
+	void MeshBase::_setLODs(const Vector<SubMesh>& lodSubMeshes, const Vector<float>& lodScreenSizes)
+	{
+		if(lodSubMeshes.size() != lodScreenSizes.size() * mSubMeshes.size())
+		{
+			BS_EXCEPT(InvalidParametersException, "Each level of detail must contain " + toString((UINT32)mSubMeshes.size()) + 
+				" sub-meshes. Number of provided sub-meshes: " + toString((UINT32)lodSubMeshes.size()));
+		}
+
+		for(auto& subMesh : lodSubMeshes)
+		{
+			if(subMesh.indexOffset + subMesh.indexCount > mNumIndices)
+				BS_EXCEPT(InvalidParametersException, "Level of detail sub-mesh index range is out of bounds of the mesh index buffer.");
+		}
+
+		mLODSubMeshes = lodSubMeshes;
+		mLODScreenSizes = lodScreenSizes;
+		mActiveProxies.resize(mSubMeshes.size() * getNumLODs());
+
+		markCoreDirty();
+	}
+
 	/************************************************************************/
 	/* 								SERIALIZATION                      		*/
 	/************************************************************************/
@@ -4,6 +4,9 @@
 #include "BsMeshData.h"
 #include "BsVector2.h"
 #include "BsVector3.h"
+#include "BsVector4.h"
+#include "BsBitwise.h"
+#include "BsMeshQuantizer.h"
 #include "BsSphere.h"
 #include "BsAABox.h"
 #include "BsHardwareBufferManager.h"
@@ -14,14 +17,128 @@
 
 namespace BansheeEngine
 {
+	VertexElemDecodeIter::VertexElemDecodeIter(UINT8* data, UINT32 byteStride, UINT32 numElements, VertexElementType type,
+		VertexElementSemantic semantic, const Vector3& positionOffset, float positionScale)
+		:mData(data), mByteStride(byteStride), mNumElements(numElements), mType(type), mSemantic(semantic), 
+		mPositionOffset(positionOffset), mPositionScale(positionScale)
+	{
+		mEnd = mData + byteStride * numElements;
+	}
+
+	Vector4 VertexElemDecodeIter::getValue() const
+	{
+		Vector4 output(0.0f, 0.0f, 0.0f, 0.0f);
+
+		switch(mType)
+		{
+		case VET_FLOAT1:
+		case VET_FLOAT2:
+		case VET_FLOAT3:
+		case VET_FLOAT4:
+			memcpy(&output, mData, VertexElement::getTypeSize(mType));
+			break;
+		case VET_SHORT1:
+		case VET_SHORT2:
+		case VET_SHORT3:
+		case VET_SHORT4:
+			{
+				INT16* shortData = (INT16*)mData;
+				UINT32 count = VertexElement::getTypeCount(mType);
+				for(UINT32 i = 0; i < count; i++)
+					output[i] = (float)shortData[i];
+			}
+			break;
+		case VET_UBYTE4:
+			for(UINT32 i = 0; i < 4; i++)
+				output[i] = (float)mData[i];
+			break;
+		case VET_COLOR:
+		case VET_COLOR_ARGB:
+		case VET_COLOR_ABGR:
+			for(UINT32 i = 0; i < 4; i++)
+				output[i] = mData[i] / 255.0f;
+			break;
+		case VET_UINT4:
+			{
+				UINT32* uintData = (UINT32*)mData;
+				for(UINT32 i = 0; i < 4; i++)
+					output[i] = (float)uintData[i];
+			}
+			break;
+		case VET_SINT4:
+			{
+				INT32* intData = (INT32*)mData;
+				for(UINT32 i = 0; i < 4; i++)
+					output[i] = (float)intData[i];
+			}
+			break;
+		case VET_USHORT4_NORM:
+			{
+				UINT16* ushortData = (UINT16*)mData;
+				for(UINT32 i = 0; i < 4; i++)
+					output[i] = ushortData[i] / 65535.0f;
+
+				if(mSemantic == VES_POSITION)
+				{
+					output.x = mPositionOffset.x + output.x * mPositionScale;
+					output.y = mPositionOffset.y + output.y * mPositionScale;
+					output.z = mPositionOffset.z + output.z * mPositionScale;
+				}
+			}
+			break;
+		case VET_SHORT2_NORM:
+			{
+				INT16* shortData = (INT16*)mData;
+				Vector2 value(std::max(shortData[0] / 32767.0f, -1.0f), std::max(shortData[1] / 32767.0f, -1.0f));
+
+				if(mSemantic == VES_NORMAL || mSemantic == VES_TANGENT || mSemantic == VES_BITANGENT)
+				{
+					Vector3 direction = MeshQuantizer::decodeOctahedral(value);
+					output = Vector4(direction.x, direction.y, direction.z, 0.0f);
+				}
+				else
+				{
+					output.x = value.x;
+					output.y = value.y;
+				}
+			}
+			break;
+		case VET_HALF2:
+			{
+				UINT16* halfData = (UINT16*)mData;
+				output.x = Bitwise::halfToFloat(halfData[0]);
+				output.y = Bitwise::halfToFloat(halfData[1]);
+			}
+			break;
+		}
+
+		return output;
+	}
+
+	bool VertexElemDecodeIter::moveNext()
+	{
+#ifdef BS_DEBUG_MODE
+		if(mData >= mEnd)
+		{
+			BS_EXCEPT(InternalErrorException, "Vertex element iterator out of buffer bounds.");
+		}
+#endif
+
+		mData += mByteStride;
+
+		return mData < mEnd;
+	}
+
 	MeshData::MeshData(UINT32 numVertices, UINT32 numIndexes, const VertexDataDescPtr& vertexData, IndexBuffer::IndexType indexType)
-	   :mNumVertices(numVertices), mNumIndices(numIndexes), mVertexData(vertexData), mIndexType(indexType)
+	   :mNumVertices(numVertices), mNumIndices(numIndexes), mVertexData(vertexData), mIndexType(indexType),
+	   mPositionOffset(Vector3::ZERO), mPositionScale(1.0f)
 	{
 		allocateInternalBuffer();
 	}
 
 	MeshData::MeshData()
-		:mNumVertices(0), mNumIndices(0), mIndexType(IndexBuffer::IT_32BIT)
+		:mNumVertices(0), mNumIndices(0), mIndexType(IndexBuffer::IT_32BIT), mPositionOffset(Vector3::ZERO), 
+		mPositionScale(1.0f)
 	{ }
 
 	MeshData::~MeshData()
@@ -157,7 +274,7 @@ namespace BansheeEngine
 
 				if(meshData->getVertexDesc()->hasElement(element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx()))
 				{
-					UINT32 srcVertexStride = vertexData->getVertexStride(element.getStreamIdx());
+					UINT32 srcVertexStride = meshData->getVertexDesc()->getVertexStride(element.getStreamIdx());
 					UINT8* srcData = meshData->getElementData(element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
 
 					for(UINT32 i = 0; i < numSrcVertices; i++)
@@ -252,6 +369,26 @@ namespace BansheeEngine
 		return VertexElemIter<UINT32>(data, vertexStride, mNumVertices);
 	}
 
+	VertexElemDecodeIter MeshData::getDecodedDataIter(VertexElementSemantic semantic, UINT32 semanticIdx, UINT32 streamIdx) const
+	{
+		UINT8* data;
+		UINT32 vertexStride;
+		getDataForIterator(semantic, semanticIdx, streamIdx, data, vertexStride);
+
+		VertexElementType type = VET_FLOAT4;
+		for(UINT32 i = 0; i < mVertexData->getNumElements(); i++)
+		{
+			const VertexElement& element = mVertexData->getElement(i);
+			if(element.getSemantic() == semantic && element.getSemanticIdx() == semanticIdx && element.getStreamIdx() == streamIdx)
+			{
+				type = element.getType();
+				break;
+			}
+		}
+
+		return VertexElemDecodeIter(data, vertexStride, mNumVertices, type, semantic, mPositionOffset, mPositionScale);
+	}
+
 	void MeshData::getDataForIterator(VertexElementSemantic semantic, UINT32 semanticIdx, UINT32 streamIdx, UINT8*& data, UINT32& stride) const
 	{
 		if(!mVertexData->hasElement(semantic, semanticIdx, streamIdx))
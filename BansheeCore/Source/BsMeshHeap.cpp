@@ -10,16 +10,18 @@
 #include "BsMeshData.h"
 #include "BsMath.h"
 #include "BsEventQuery.h"
+#include "BsRenderStats.h"
+#include "BsDebug.h"
 
 namespace BansheeEngine
 {
 	const float MeshHeap::GrowPercent = 1.5f;
 
 	MeshHeap::MeshHeap(UINT32 numVertices, UINT32 numIndices, 
-		const VertexDataDescPtr& vertexDesc, IndexBuffer::IndexType indexType)
+		const VertexDataDescPtr& vertexDesc, IndexBuffer::IndexType indexType, bool isStreaming, UINT32 numFrames)
 		:mNumVertices(numVertices), mNumIndices(numIndices), mNextFreeId(0), 
 		mIndexType(indexType), mVertexDesc(vertexDesc), mCPUIndexData(nullptr),
-		mNextQueryId(0)
+		mNextQueryId(0), mIsStreaming(isStreaming), mNumFrames(std::max(numFrames, 1U)), mCurFrame(0)
 	{
 		for(UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
 		{
@@ -35,7 +37,19 @@ namespace BansheeEngine
 	MeshHeapPtr MeshHeap::create(UINT32 numVertices, UINT32 numIndices, 
 		const VertexDataDescPtr& vertexDesc, IndexBuffer::IndexType indexType)
 	{
-		MeshHeap* meshHeap = new (bs_alloc<MeshHeap>()) MeshHeap(numVertices, numIndices, vertexDesc, indexType); 
+		MeshHeap* meshHeap = new (bs_alloc<MeshHeap>()) MeshHeap(numVertices, numIndices, vertexDesc, indexType, false, 1); 
+		MeshHeapPtr meshHeapPtr = bs_core_ptr<MeshHeap, GenAlloc>(meshHeap);
+
+		meshHeapPtr->_setThisPtr(meshHeapPtr);
+		meshHeapPtr->initialize();
+
+		return meshHeapPtr;
+	}
+
+	MeshHeapPtr MeshHeap::createStreaming(UINT32 numVertices, UINT32 numIndices, 
+		const VertexDataDescPtr& vertexDesc, IndexBuffer::IndexType indexType, UINT32 numFrames)
+	{
+		MeshHeap* meshHeap = new (bs_alloc<MeshHeap>()) MeshHeap(numVertices, numIndices, vertexDesc, indexType, true, numFrames); 
 		MeshHeapPtr meshHeapPtr = bs_core_ptr<MeshHeap, GenAlloc>(meshHeap);
 
 		meshHeapPtr->_setThisPtr(meshHeapPtr);
@@ -48,8 +62,26 @@ namespace BansheeEngine
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
-		growVertexBuffer(mNumVertices);
-		growIndexBuffer(mNumIndices);
+		if(mIsStreaming)
+		{
+			for(UINT32 i = 0; i < mNumFrames; i++)
+			{
+				StreamFrameData frameData;
+				frameData.numUsedVertices = 0;
+				frameData.numUsedIndices = 0;
+				frameData.usedOnGPU = false;
+				frameData.eventQueryIdx = createEventQuery();
+
+				mStreamFrames.push_back(frameData);
+			}
+
+			growStreamingBuffers(mNumVertices, mNumIndices);
+		}
+		else
+		{
+			growVertexBuffer(mNumVertices);
+			growIndexBuffer(mNumIndices);
+		}
 
 		CoreObject::initialize_internal();
 	}
@@ -80,15 +112,36 @@ namespace BansheeEngine
 
 		mMeshes[meshIdx] = transientMeshPtr;
 
-		queueGpuCommand(getThisPtr(), std::bind(&MeshHeap::allocInternal, this, transientMeshPtr, meshData));
+		if(mIsStreaming)
+			queueGpuCommand(getThisPtr(), std::bind(&MeshHeap::allocStreamingInternal, this, transientMeshPtr, meshData));
+		else
+			queueGpuCommand(getThisPtr(), std::bind(&MeshHeap::allocInternal, this, transientMeshPtr, meshData));
 
 		return transientMeshPtr;
 	}
 
+	void MeshHeap::beginFrame()
+	{
+		if(!mIsStreaming)
+		{
+			LOGWRN("beginFrame() called on a mesh heap not created in streaming mode. Ignoring.");
+			return;
+		}
+
+		// Meshes from the previous frame are released in bulk, their data stays valid on the GPU until
+		// their frame region is reused
+		for(auto& entry : mMeshes)
+			entry.second->markAsDestroyed();
+
+		mMeshes.clear();
+
+		queueGpuCommand(getThisPtr(), std::bind(&MeshHeap::beginFrameInternal, this));
+	}
+
 	void MeshHeap::dealloc(const TransientMeshPtr& mesh)
 	{
 		auto iterFind = mMeshes.find(mesh->mId);
-		if(iterFind == mMeshes.end())
+		if(iterFind == mMeshes.end() || iterFind->second != mesh)
 			return;
 
 		mesh->markAsDestroyed();
@@ -309,10 +362,246 @@ namespace BansheeEngine
 		UINT8* idxDest = mCPUIndexData + idxChunkStart * idxSize;
 		memcpy(idxDest, meshData->getIndexData(), meshData->getNumIndices() * idxSize);
 		mIndexBuffer->writeData(idxChunkStart * idxSize, meshData->getNumIndices() * idxSize, idxDest, BufferWriteType::NoOverwrite);
+
+		BS_ADD_RENDER_STAT(NumBytesUploaded, meshData->getNumVertices() * mVertexDesc->getVertexStride() + 
+			meshData->getNumIndices() * idxSize);
+	}
+
+	void MeshHeap::allocStreamingInternal(TransientMeshPtr mesh, const MeshDataPtr& meshData)
+	{
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+
+		// Grow the frame regions if the current frame can't fit the mesh
+		StreamFrameData* frameData = &mStreamFrames[mCurFrame];
+		if((frameData->numUsedVertices + numVertices) > mNumVertices || (frameData->numUsedIndices + numIndices) > mNumIndices)
+		{
+			UINT32 newNumVertices = std::max(mNumVertices, 1U);
+			while(newNumVertices < (frameData->numUsedVertices + numVertices))
+				newNumVertices = std::max((UINT32)Math::roundToInt(newNumVertices * GrowPercent), newNumVertices + 1);
+
+			UINT32 newNumIndices = std::max(mNumIndices, 1U);
+			while(newNumIndices < (frameData->numUsedIndices + numIndices))
+				newNumIndices = std::max((UINT32)Math::roundToInt(newNumIndices * GrowPercent), newNumIndices + 1);
+
+			growStreamingBuffers(newNumVertices, newNumIndices);
+			frameData = &mStreamFrames[mCurFrame];
+		}
+
+		StreamAllocatedData allocData;
+		allocData.frameIdx = mCurFrame;
+		allocData.vertOffset = frameData->numUsedVertices;
+		allocData.idxOffset = frameData->numUsedIndices;
+
+		mStreamAllocData[mesh->getMeshHeapId()] = allocData;
+
+		frameData->numUsedVertices += numVertices;
+		frameData->numUsedIndices += numIndices;
+
+		UINT32 vertStart = mCurFrame * mNumVertices + allocData.vertOffset;
+		UINT32 idxStart = mCurFrame * mNumIndices + allocData.idxOffset;
+		UINT32 numBytesWritten = 0;
+
+		// GPU is guaranteed not to be using this frame region (see beginFrameInternal), so we can write
+		// directly into the buffer without overwrite checks or an intermediate CPU copy
+		for(UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
+		{
+			if(!mVertexDesc->hasStream(i))
+				continue;
+
+			if(!meshData->getVertexDesc()->hasStream(i))
+				continue;
+
+			// Ensure vertex sizes match
+			UINT32 vertSize = mVertexData->vertexDeclaration->getVertexSize(i);
+			UINT32 otherVertSize = meshData->getVertexDesc()->getVertexStride(i);
+			if(otherVertSize != vertSize)
+			{
+				BS_EXCEPT(InvalidParametersException, "Provided vertex size for stream " + toString(i) + " doesn't match meshes vertex size. Needed: " + 
+					toString(vertSize) + ". Got: " + toString(otherVertSize));
+			}
+
+			if(numVertices == 0)
+				continue;
+
+			VertexBufferPtr vertexBuffer = mVertexData->getBuffer(i);
+			UINT8* srcData = meshData->getStreamData(i);
+			UINT8* vertDest = (UINT8*)vertexBuffer->lock(vertStart * vertSize, numVertices * vertSize, GBL_WRITE_ONLY_NO_OVERWRITE);
+
+			if(vertexBuffer->vertexColorReqRGBFlip())
+			{
+				// Swizzle while copying so we never read back from the mapped memory
+				memcpy(vertDest, srcData, numVertices * vertSize);
+
+				for(INT32 semanticIdx = 0; semanticIdx < VertexBuffer::MAX_SEMANTIC_IDX; semanticIdx++)
+				{
+					if(!mVertexDesc->hasElement(VES_COLOR, semanticIdx, i))
+						continue;
+
+					UINT32 colorOffset = mVertexDesc->getElementOffsetFromStream(VES_COLOR, semanticIdx, i);
+					for(UINT32 j = 0; j < numVertices; j++)
+					{
+						UINT32 srcColor = *(UINT32*)(srcData + j * vertSize + colorOffset);
+						UINT32* destColor = (UINT32*)(vertDest + j * vertSize + colorOffset);
+
+						(*destColor) = (srcColor & 0xFF00FF00) | ((srcColor >> 16) & 0x000000FF) | ((srcColor << 16) & 0x00FF0000);
+					}
+				}
+			}
+			else
+				memcpy(vertDest, srcData, numVertices * vertSize);
+
+			vertexBuffer->unlock();
+			numBytesWritten += numVertices * vertSize;
+		}
+
+		UINT32 idxSize = mIndexBuffer->getIndexSize();
+
+		// Ensure index sizes match
+		if(meshData->getIndexElementSize() != idxSize)
+		{
+			BS_EXCEPT(InvalidParametersException, "Provided index size doesn't match meshes index size. Needed: " + 
+				toString(idxSize) + ". Got: " + toString(meshData->getIndexElementSize()));
+		}
+
+		if(numIndices > 0)
+		{
+			UINT8* idxDest = (UINT8*)mIndexBuffer->lock(idxStart * idxSize, numIndices * idxSize, GBL_WRITE_ONLY_NO_OVERWRITE);
+			memcpy(idxDest, meshData->getIndexData(), numIndices * idxSize);
+			mIndexBuffer->unlock();
+
+			numBytesWritten += numIndices * idxSize;
+		}
+
+		BS_ADD_RENDER_STAT(NumBytesUploaded, numBytesWritten);
+	}
+
+	void MeshHeap::beginFrameInternal()
+	{
+		MeshHeapPtr thisPtr = std::static_pointer_cast<MeshHeap>(getThisPtr());
+
+		// Fence the frame we just finished. Everything referencing this region was
+		// queued before this command, so a single query is enough for all of its meshes.
+		StreamFrameData& curFrame = mStreamFrames[mCurFrame];
+		if(curFrame.numUsedVertices > 0 || curFrame.numUsedIndices > 0)
+		{
+			QueryData& queryData = mEventQueries[curFrame.eventQueryIdx];
+			queryData.queryId = mNextQueryId++;
+			queryData.query->onTriggered.clear();
+			queryData.query->onTriggered.connect(std::bind(&MeshHeap::frameQueryTriggered, thisPtr, mCurFrame, queryData.queryId));
+			queryData.query->begin();
+
+			curFrame.usedOnGPU = true;
+		}
+
+		mCurFrame = (mCurFrame + 1) % mNumFrames;
+
+		StreamFrameData& nextFrame = mStreamFrames[mCurFrame];
+		if(nextFrame.usedOnGPU)
+		{
+			// GPU is lagging more than "mNumFrames" behind. Rather than stalling we discard the buffers,
+			// which makes the driver provide us with fresh memory while GPU keeps using the old one.
+			// All previously queued draws already reference the old memory, so every region becomes free.
+			for(UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
+			{
+				if(!mVertexDesc->hasStream(i))
+					continue;
+
+				VertexBufferPtr vertexBuffer = mVertexData->getBuffer(i);
+				vertexBuffer->lock(GBL_WRITE_ONLY_DISCARD);
+				vertexBuffer->unlock();
+			}
+
+			mIndexBuffer->lock(GBL_WRITE_ONLY_DISCARD);
+			mIndexBuffer->unlock();
+
+			for(auto& frameData : mStreamFrames)
+			{
+				frameData.usedOnGPU = false;
+				
+				// Invalidate any outstanding queries
+				mEventQueries[frameData.eventQueryIdx].queryId = mNextQueryId++;
+				mEventQueries[frameData.eventQueryIdx].query->onTriggered.clear();
+			}
+		}
+
+		nextFrame.numUsedVertices = 0;
+		nextFrame.numUsedIndices = 0;
+
+		for(auto iter = mStreamAllocData.begin(); iter != mStreamAllocData.end();)
+		{
+			if(iter->second.frameIdx == mCurFrame)
+				iter = mStreamAllocData.erase(iter);
+			else
+				++iter;
+		}
+	}
+
+	void MeshHeap::growStreamingBuffers(UINT32 numVertices, UINT32 numIndices)
+	{
+		UINT32 oldNumVertices = mNumVertices;
+		UINT32 oldNumIndices = mNumIndices;
+
+		std::shared_ptr<VertexData> oldVertexData = mVertexData;
+		IndexBufferPtr oldIndexBuffer = mIndexBuffer;
+
+		mNumVertices = numVertices;
+		mNumIndices = numIndices;
+
+		mVertexData = std::shared_ptr<VertexData>(bs_new<VertexData, PoolAlloc>());
+		mVertexData->vertexCount = mNumVertices * mNumFrames;
+		mVertexData->vertexDeclaration = mVertexDesc->createDeclaration();
+
+		const StreamFrameData& curFrame = mStreamFrames[mCurFrame];
+
+		// Data from previous frames is no longer needed on the CPU, and GPU keeps its references to the old
+		// buffers, so we only need to preserve data written during the current frame
+		for(UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
+		{
+			if(!mVertexDesc->hasStream(i))
+				continue;
+
+			UINT32 vertSize = mVertexData->vertexDeclaration->getVertexSize(i);
+			VertexBufferPtr vertexBuffer = HardwareBufferManager::instance().createVertexBuffer(
+				vertSize, mVertexData->vertexCount, GBU_DYNAMIC);
+
+			mVertexData->setBuffer(i, vertexBuffer);
+
+			if(oldVertexData != nullptr && curFrame.numUsedVertices > 0)
+			{
+				vertexBuffer->copyData(*oldVertexData->getBuffer(i), mCurFrame * oldNumVertices * vertSize, 
+					mCurFrame * mNumVertices * vertSize, curFrame.numUsedVertices * vertSize);
+			}
+		}
+
+		mIndexBuffer = HardwareBufferManager::instance().createIndexBuffer(mIndexType, mNumIndices * mNumFrames, GBU_DYNAMIC);
+
+		if(oldIndexBuffer != nullptr && curFrame.numUsedIndices > 0)
+		{
+			UINT32 idxSize = mIndexBuffer->getIndexSize();
+			mIndexBuffer->copyData(*oldIndexBuffer, mCurFrame * oldNumIndices * idxSize, 
+				mCurFrame * mNumIndices * idxSize, curFrame.numUsedIndices * idxSize);
+		}
+
+		// Buffers are brand new so GPU isn't using any of the regions
+		for(auto& frameData : mStreamFrames)
+		{
+			frameData.usedOnGPU = false;
+
+			mEventQueries[frameData.eventQueryIdx].queryId = mNextQueryId++;
+			mEventQueries[frameData.eventQueryIdx].query->onTriggered.clear();
+		}
 	}
 
 	void MeshHeap::deallocInternal(TransientMeshPtr mesh)
 	{
+		if(mIsStreaming)
+		{
+			// Streaming meshes are released in bulk when their frame region gets reused
+			mStreamAllocData.erase(mesh->getMeshHeapId());
+			return;
+		}
+
 		auto findIter = mMeshAllocData.find(mesh->getMeshHeapId());
 		assert(findIter != mMeshAllocData.end());
 
@@ -526,6 +815,14 @@ namespace BansheeEngine
 
 	UINT32 MeshHeap::getVertexOffset(UINT32 meshId) const
 	{
+		if(mIsStreaming)
+		{
+			auto findIter = mStreamAllocData.find(meshId);
+			assert(findIter != mStreamAllocData.end());
+
+			return findIter->second.frameIdx * mNumVertices + findIter->second.vertOffset;
+		}
+
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
@@ -535,6 +832,14 @@ namespace BansheeEngine
 
 	UINT32 MeshHeap::getIndexOffset(UINT32 meshId) const
 	{
+		if(mIsStreaming)
+		{
+			auto findIter = mStreamAllocData.find(meshId);
+			assert(findIter != mStreamAllocData.end());
+
+			return findIter->second.frameIdx * mNumIndices + findIter->second.idxOffset;
+		}
+
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
@@ -544,6 +849,10 @@ namespace BansheeEngine
 
 	void MeshHeap::notifyUsedOnGPU(UINT32 meshId)
 	{
+		// Streaming heaps fence whole frames instead of individual meshes
+		if(mIsStreaming)
+			return;
+
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
@@ -596,6 +905,18 @@ namespace BansheeEngine
 		queryData.query->onTriggered.clear();
 	}
 
+	void MeshHeap::frameQueryTriggered(MeshHeapPtr thisPtr, UINT32 frameIdx, UINT32 queryId)
+	{
+		StreamFrameData& frameData = thisPtr->mStreamFrames[frameIdx];
+		QueryData& queryData = thisPtr->mEventQueries[frameData.eventQueryIdx];
+
+		// Query ids won't match if the buffers were discarded or recreated in the meantime
+		if(queryId == queryData.queryId)
+			frameData.usedOnGPU = false;
+
+		queryData.query->onTriggered.clear();
+	}
+
 	void MeshHeap::mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx)
 	{
 		// Merge vertex chunks
@@ -0,0 +1,25 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsMeshImportOptions.h"
+#include "BsMeshImportOptionsRTTI.h"
+
+namespace BansheeEngine
+{
+	MeshImportOptions::MeshImportOptions()
+		:mOptimizeMesh(true), mNumLODs(1), mQuantizePositions(false), mQuantizeTexCoords(false)
+	{ }
+
+	/************************************************************************/
+	/* 								SERIALIZATION                      		*/
+	/************************************************************************/
+	RTTITypeBase* MeshImportOptions::getRTTIStatic()
+	{
+		return MeshImportOptionsRTTI::instance();
+	}
+
+	RTTITypeBase* MeshImportOptions::getRTTI() const
+	{
+		return MeshImportOptions::getRTTIStatic();
+	}
+}
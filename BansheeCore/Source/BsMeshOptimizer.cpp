@@ -0,0 +1,646 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsMeshOptimizer.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsVector3.h"
+#include "BsMath.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Size of the LRU cache modeled by the vertex scoring function.
+	 */
+	static const UINT32 SCORE_CACHE_SIZE = 32;
+
+	/**
+	 * @brief	Size of the FIFO cache simulated when splitting triangles into clusters.
+	 */
+	static const UINT32 CLUSTER_CACHE_SIZE = 16;
+
+	/**
+	 * @brief	Maximum increase of the cache miss ratio allowed by splitting triangles into smaller clusters,
+	 *			which allows for finer grained overdraw sorting.
+	 */
+	static const float OVERDRAW_THRESHOLD = 1.05f;
+
+	/**
+	 * @brief	Number of entries in the precomputed vertex valence score table. Vertices with more triangles
+	 *			have their score calculated directly.
+	 */
+	static const UINT32 MAX_VALENCE_SCORES = 32;
+
+	static const float CACHE_DECAY_POWER = 1.5f;
+	static const float LAST_TRIANGLE_SCORE = 0.75f;
+	static const float VALENCE_BOOST_SCALE = 2.0f;
+	static const float VALENCE_BOOST_POWER = 0.5f;
+
+	static const UINT32 INVALID_INDEX = 0xFFFFFFFF;
+
+	/**
+	 * @brief	Vertex scores used by Forsyth's algorithm. Vertices with higher scores are more preferable
+	 *			as the next vertex to render, depending on their position in the cache and the number of
+	 *			triangles still referencing them.
+	 */
+	class VertexScoring
+	{
+	public:
+		VertexScoring()
+		{
+			for(UINT32 i = 0; i < SCORE_CACHE_SIZE; i++)
+			{
+				if(i < 3)
+					mCacheScores[i] = LAST_TRIANGLE_SCORE;
+				else
+				{
+					float scaler = 1.0f / (SCORE_CACHE_SIZE - 3);
+					mCacheScores[i] = Math::pow(1.0f - (i - 3) * scaler, CACHE_DECAY_POWER);
+				}
+			}
+
+			mValenceScores[0] = 0.0f;
+			for(UINT32 i = 1; i < MAX_VALENCE_SCORES; i++)
+				mValenceScores[i] = VALENCE_BOOST_SCALE * Math::pow((float)i, -VALENCE_BOOST_POWER);
+		}
+
+		/**
+		 * @brief	Returns the score of a vertex at the specified cache position (negative if not in cache),
+		 *			referenced by the specified number of triangles that haven't been output yet.
+		 */
+		float getScore(INT32 cachePosition, UINT32 numRemainingTriangles) const
+		{
+			if(numRemainingTriangles == 0)
+				return -1.0f;
+
+			float score = 0.0f;
+			if(cachePosition >= 0)
+				score = mCacheScores[cachePosition];
+
+			if(numRemainingTriangles < MAX_VALENCE_SCORES)
+				score += mValenceScores[numRemainingTriangles];
+			else
+				score += VALENCE_BOOST_SCALE * Math::pow((float)numRemainingTriangles, -VALENCE_BOOST_POWER);
+
+			return score;
+		}
+
+	private:
+		float mCacheScores[SCORE_CACHE_SIZE];
+		float mValenceScores[MAX_VALENCE_SCORES];
+	};
+
+	/**
+	 * @brief	Simulates a FIFO vertex cache. Uses timestamps so the cache can be reset in constant time.
+	 */
+	class FIFOCacheSimulator
+	{
+	public:
+		FIFOCacheSimulator(UINT32 numVertices, UINT32 cacheSize)
+			:mTimestamps(numVertices, 0), mTime(cacheSize + 1), mCacheSize(cacheSize)
+		{ }
+
+		/**
+		 * @brief	Registers a vertex use, returns true if the vertex wasn't in the cache.
+		 */
+		bool access(UINT32 vertexIdx)
+		{
+			if(mTime - mTimestamps[vertexIdx] > mCacheSize)
+			{
+				mTimestamps[vertexIdx] = mTime++;
+				return true;
+			}
+
+			return false;
+		}
+
+		/**
+		 * @brief	Registers use of all three triangle vertices, returns the number of cache misses.
+		 */
+		UINT32 accessTriangle(const UINT32* triangle)
+		{
+			UINT32 numMisses = 0;
+			for(UINT32 i = 0; i < 3; i++)
+			{
+				if(access(triangle[i]))
+					numMisses++;
+			}
+
+			return numMisses;
+		}
+
+		/**
+		 * @brief	Removes all vertices from the cache.
+		 */
+		void reset()
+		{
+			mTime += mCacheSize + 1;
+		}
+
+	private:
+		Vector<UINT32> mTimestamps;
+		UINT32 mTime;
+		UINT32 mCacheSize;
+	};
+
+	/**
+	 * @brief	Reorders triangles to improve vertex cache use, using Tom Forsyth's "Linear-Speed Vertex Cache
+	 *			Optimisation" algorithm.
+	 *
+	 * @param	indices			Triangle list indices, in range [0, numVertices).
+	 * @param	numIndices		Number of indices in the list.
+	 * @param	numVertices		Number of vertices referenced by the indices.
+	 * @param	order			Output array that receives the triangle indices in optimized order.
+	 */
+	static void optimizeVertexCache(const UINT32* indices, UINT32 numIndices, UINT32 numVertices, Vector<UINT32>& order)
+	{
+		UINT32 numTriangles = numIndices / 3;
+		order.resize(numTriangles);
+
+		// Build a list of triangles referencing each vertex
+		Vector<UINT32> numRemaining(numVertices, 0);
+		for(UINT32 i = 0; i < numIndices; i++)
+			numRemaining[indices[i]]++;
+
+		Vector<UINT32> adjacencyOffsets(numVertices + 1);
+		adjacencyOffsets[0] = 0;
+		for(UINT32 i = 0; i < numVertices; i++)
+			adjacencyOffsets[i + 1] = adjacencyOffsets[i] + numRemaining[i];
+
+		Vector<UINT32> adjacency(numIndices);
+		Vector<UINT32> writeOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for(UINT32 i = 0; i < numIndices; i++)
+			adjacency[writeOffsets[indices[i]]++] = i / 3;
+
+		VertexScoring scoring;
+
+		Vector<INT32> cachePositions(numVertices, -1);
+		Vector<float> vertexScores(numVertices);
+		for(UINT32 i = 0; i < numVertices; i++)
+			vertexScores[i] = scoring.getScore(-1, numRemaining[i]);
+
+		Vector<float> triangleScores(numTriangles);
+		Vector<bool> emitted(numTriangles, false);
+
+		UINT32 bestTriangle = INVALID_INDEX;
+		float bestScore = -1.0f;
+		for(UINT32 i = 0; i < numTriangles; i++)
+		{
+			const UINT32* triangle = &indices[i * 3];
+			triangleScores[i] = vertexScores[triangle[0]] + vertexScores[triangle[1]] + vertexScores[triangle[2]];
+
+			if(triangleScores[i] > bestScore)
+			{
+				bestScore = triangleScores[i];
+				bestTriangle = i;
+			}
+		}
+
+		UINT32 cache[SCORE_CACHE_SIZE + 3];
+		UINT32 newCache[SCORE_CACHE_SIZE + 3];
+		UINT32 cacheSize = 0;
+		UINT32 nextInputTriangle = 0;
+
+		for(UINT32 i = 0; i < numTriangles; i++)
+		{
+			// No triangles adjacent to cached vertices left, continue with the next triangle in input order
+			if(bestTriangle == INVALID_INDEX)
+			{
+				while(emitted[nextInputTriangle])
+					nextInputTriangle++;
+
+				bestTriangle = nextInputTriangle;
+			}
+
+			order[i] = bestTriangle;
+			emitted[bestTriangle] = true;
+
+			// Remove the triangle from adjacency lists of its vertices, and push its vertices to the front of the cache
+			const UINT32* triangle = &indices[bestTriangle * 3];
+			UINT32 newCacheSize = 0;
+
+			for(UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 vertexIdx = triangle[j];
+
+				UINT32* vertexAdjacency = &adjacency[adjacencyOffsets[vertexIdx]];
+				UINT32 numAdjacent = numRemaining[vertexIdx];
+				for(UINT32 k = 0; k < numAdjacent; k++)
+				{
+					if(vertexAdjacency[k] == bestTriangle)
+					{
+						std::swap(vertexAdjacency[k], vertexAdjacency[numAdjacent - 1]);
+						break;
+					}
+				}
+
+				numRemaining[vertexIdx]--;
+				newCache[newCacheSize++] = vertexIdx;
+			}
+
+			for(UINT32 j = 0; j < cacheSize; j++)
+			{
+				UINT32 vertexIdx = cache[j];
+				if(vertexIdx != triangle[0] && vertexIdx != triangle[1] && vertexIdx != triangle[2])
+					newCache[newCacheSize++] = vertexIdx;
+			}
+
+			// Update scores of vertices in the cache (including the ones that were just evicted) and their triangles
+			for(UINT32 j = 0; j < newCacheSize; j++)
+			{
+				UINT32 vertexIdx = newCache[j];
+				cachePositions[vertexIdx] = j < SCORE_CACHE_SIZE ? (INT32)j : -1;
+				vertexScores[vertexIdx] = scoring.getScore(cachePositions[vertexIdx], numRemaining[vertexIdx]);
+			}
+
+			bestTriangle = INVALID_INDEX;
+			bestScore = -1.0f;
+			for(UINT32 j = 0; j < newCacheSize; j++)
+			{
+				UINT32 vertexIdx = newCache[j];
+				const UINT32* vertexAdjacency = &adjacency[adjacencyOffsets[vertexIdx]];
+
+				for(UINT32 k = 0; k < numRemaining[vertexIdx]; k++)
+				{
+					UINT32 triangleIdx = vertexAdjacency[k];
+					const UINT32* adjacentTriangle = &indices[triangleIdx * 3];
+
+					float score = vertexScores[adjacentTriangle[0]] + vertexScores[adjacentTriangle[1]] + vertexScores[adjacentTriangle[2]];
+					triangleScores[triangleIdx] = score;
+
+					if(score > bestScore)
+					{
+						bestScore = score;
+						bestTriangle = triangleIdx;
+					}
+				}
+			}
+
+			cacheSize = std::min(newCacheSize, SCORE_CACHE_SIZE);
+			memcpy(cache, newCache, cacheSize * sizeof(UINT32));
+		}
+	}
+
+	/**
+	 * @brief	Splits the cache optimized triangle list into clusters, and reorders the clusters so the ones facing
+	 *			away from the mesh center are rendered first. Based on "Fast Triangle Reordering for Vertex Locality
+	 *			and Reduced Overdraw" by Sander, Nehab and Barczak.
+	 *
+	 * @param	indices			Triangle list indices, in range [0, numVertices).
+	 * @param	numIndices		Number of indices in the list.
+	 * @param	numVertices		Number of vertices referenced by the indices.
+	 * @param	positions		Positions of the vertices referenced by the indices.
+	 * @param	order			Triangle indices in cache optimized order. Reordered on output.
+	 */
+	static void optimizeOverdraw(const UINT32* indices, UINT32 numIndices, UINT32 numVertices, const Vector<Vector3>& positions,
+		Vector<UINT32>& order)
+	{
+		UINT32 numTriangles = numIndices / 3;
+		if(numTriangles == 0)
+			return;
+
+		// Start a new cluster whenever all vertices of a triangle miss the cache, as the triangle is likely to be
+		// disjoint from the previous ones
+		Vector<UINT32> hardBoundaries;
+		hardBoundaries.push_back(0);
+
+		FIFOCacheSimulator cache(numVertices, CLUSTER_CACHE_SIZE);
+		for(UINT32 i = 0; i < numTriangles; i++)
+		{
+			if(cache.accessTriangle(&indices[order[i] * 3]) == 3 && i > 0)
+				hardBoundaries.push_back(i);
+		}
+
+		hardBoundaries.push_back(numTriangles);
+
+		// Split the clusters further, as long as their cache efficiency remains close to the original
+		Vector<UINT32> clusterStarts;
+		for(UINT32 i = 0; i < (UINT32)hardBoundaries.size() - 1; i++)
+		{
+			UINT32 start = hardBoundaries[i];
+			UINT32 end = hardBoundaries[i + 1];
+
+			cache.reset();
+			UINT32 numMisses = 0;
+			for(UINT32 j = start; j < end; j++)
+				numMisses += cache.accessTriangle(&indices[order[j] * 3]);
+
+			float threshold = OVERDRAW_THRESHOLD * numMisses / (float)(end - start);
+			UINT32 numClustersBefore = (UINT32)clusterStarts.size();
+			clusterStarts.push_back(start);
+
+			cache.reset();
+			UINT32 numRunningMisses = 0;
+			UINT32 numRunningTriangles = 0;
+			for(UINT32 j = start; j < end; j++)
+			{
+				numRunningMisses += cache.accessTriangle(&indices[order[j] * 3]);
+				numRunningTriangles++;
+
+				if(numRunningMisses / (float)numRunningTriangles <= threshold)
+				{
+					clusterStarts.push_back(j + 1);
+
+					cache.reset();
+					numRunningMisses = 0;
+					numRunningTriangles = 0;
+				}
+			}
+
+			// Last cluster is usually small with a bad miss ratio, merge it with the one before it. This also
+			// removes the boundary at the cluster end, if one was added.
+			if((UINT32)clusterStarts.size() - numClustersBefore > 1)
+				clusterStarts.pop_back();
+		}
+
+		UINT32 numClusters = (UINT32)clusterStarts.size();
+		clusterStarts.push_back(numTriangles);
+
+		// Sort clusters by how much they face away from the mesh center
+		Vector3 meshCenter = Vector3::ZERO;
+		float meshArea = 0.0f;
+
+		Vector<Vector3> clusterCenters(numClusters, Vector3::ZERO);
+		Vector<Vector3> clusterNormals(numClusters, Vector3::ZERO);
+		for(UINT32 i = 0; i < numClusters; i++)
+		{
+			float clusterArea = 0.0f;
+			for(UINT32 j = clusterStarts[i]; j < clusterStarts[i + 1]; j++)
+			{
+				const UINT32* triangle = &indices[order[j] * 3];
+				const Vector3& a = positions[triangle[0]];
+				const Vector3& b = positions[triangle[1]];
+				const Vector3& c = positions[triangle[2]];
+
+				Vector3 normal = (b - a).cross(c - a);
+				float area = normal.length();
+
+				Vector3 center = (a + b + c) * (area / 3.0f);
+
+				clusterCenters[i] += center;
+				clusterNormals[i] += normal;
+				clusterArea += area;
+
+				meshCenter += center;
+				meshArea += area;
+			}
+
+			if(clusterArea > 0.0f)
+				clusterCenters[i] /= clusterArea;
+
+			clusterNormals[i].normalize();
+		}
+
+		if(meshArea > 0.0f)
+			meshCenter /= meshArea;
+
+		Vector<std::pair<float, UINT32>> sortKeys(numClusters);
+		for(UINT32 i = 0; i < numClusters; i++)
+			sortKeys[i] = std::make_pair(-(clusterCenters[i] - meshCenter).dot(clusterNormals[i]), i);
+
+		std::stable_sort(sortKeys.begin(), sortKeys.end(),
+			[](const std::pair<float, UINT32>& a, const std::pair<float, UINT32>& b) { return a.first < b.first; });
+
+		Vector<UINT32> sortedOrder;
+		sortedOrder.reserve(numTriangles);
+		for(auto& sortKey : sortKeys)
+		{
+			UINT32 clusterIdx = sortKey.second;
+			for(UINT32 j = clusterStarts[clusterIdx]; j < clusterStarts[clusterIdx + 1]; j++)
+				sortedOrder.push_back(order[j]);
+		}
+
+		order.swap(sortedOrder);
+	}
+
+	/**
+	 * @brief	Reorders triangles of a single triangle list sub-mesh.
+	 *
+	 * @param	indices			Indices of the sub-mesh.
+	 * @param	numIndices		Number of indices in the sub-mesh.
+	 * @param	positionData	Pointer to the first vertex position in the mesh, or null if positions are not available.
+	 * @param	positionStride	Number of bytes between two vertex positions.
+	 * @param	localIndices	Scratch array with an entry for every vertex in the mesh. All entries must be
+	 *							INVALID_INDEX, and are INVALID_INDEX again when the method returns.
+	 */
+	template<class T>
+	static void optimizeTriangleOrder(T* indices, UINT32 numIndices, const UINT8* positionData, UINT32 positionStride,
+		Vector<UINT32>& localIndices)
+	{
+		numIndices -= numIndices % 3;
+		if(numIndices == 0)
+			return;
+
+		// Remap vertices used by the sub-mesh into a compact range
+		Vector<UINT32> subMeshIndices(numIndices);
+		Vector<UINT32> usedVertices;
+		for(UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32 vertexIdx = indices[i];
+			if(localIndices[vertexIdx] == INVALID_INDEX)
+			{
+				localIndices[vertexIdx] = (UINT32)usedVertices.size();
+				usedVertices.push_back(vertexIdx);
+			}
+
+			subMeshIndices[i] = localIndices[vertexIdx];
+		}
+
+		for(auto& vertexIdx : usedVertices)
+			localIndices[vertexIdx] = INVALID_INDEX;
+
+		UINT32 numVertices = (UINT32)usedVertices.size();
+
+		Vector<UINT32> order;
+		optimizeVertexCache(&subMeshIndices[0], numIndices, numVertices, order);
+
+		if(positionData != nullptr)
+		{
+			Vector<Vector3> positions(numVertices);
+			for(UINT32 i = 0; i < numVertices; i++)
+				memcpy(&positions[i], positionData + usedVertices[i] * positionStride, sizeof(Vector3));
+
+			optimizeOverdraw(&subMeshIndices[0], numIndices, numVertices, positions, order);
+		}
+
+		UINT32 numTriangles = numIndices / 3;
+		for(UINT32 i = 0; i < numTriangles; i++)
+		{
+			const UINT32* triangle = &subMeshIndices[order[i] * 3];
+			for(UINT32 j = 0; j < 3; j++)
+				indices[i * 3 + j] = (T)usedVertices[triangle[j]];
+		}
+	}
+
+	/**
+	 * @brief	Reorders vertices in the order they are first referenced by the index buffer, and updates the
+	 *			indices accordingly. Vertices not referenced by any index are moved to the end.
+	 *
+	 * @param	indices			All indices in the mesh.
+	 * @param	numIndices		Number of indices in the mesh.
+	 * @param	numVertices		Number of vertices in the mesh.
+	 * @param	remap			Output array that receives the new position of each vertex.
+	 */
+	template<class T>
+	static void optimizeVertexFetch(T* indices, UINT32 numIndices, UINT32 numVertices, Vector<UINT32>& remap)
+	{
+		remap.assign(numVertices, INVALID_INDEX);
+
+		UINT32 numRemapped = 0;
+		for(UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32 vertexIdx = indices[i];
+			if(remap[vertexIdx] == INVALID_INDEX)
+				remap[vertexIdx] = numRemapped++;
+
+			indices[i] = (T)remap[vertexIdx];
+		}
+
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			if(remap[i] == INVALID_INDEX)
+				remap[i] = numRemapped++;
+		}
+	}
+
+	/**
+	 * @brief	Simulates rendering of the indices using a FIFO cache and returns the number of cache misses.
+	 *			Optionally outputs the number of unique vertices referenced by the indices.
+	 */
+	template<class T>
+	static UINT32 simulateCache(const T* indices, UINT32 numIndices, UINT32 numVertices, UINT32 cacheSize, UINT32* numUniqueVertices)
+	{
+		FIFOCacheSimulator cache(numVertices, cacheSize);
+		Vector<bool> used(numVertices, false);
+
+		UINT32 numMisses = 0;
+		UINT32 numUsed = 0;
+		for(UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32 vertexIdx = indices[i];
+			if(cache.access(vertexIdx))
+				numMisses++;
+
+			if(!used[vertexIdx])
+			{
+				used[vertexIdx] = true;
+				numUsed++;
+			}
+		}
+
+		if(numUniqueVertices != nullptr)
+			*numUniqueVertices = numUsed;
+
+		return numMisses;
+	}
+
+	/**
+	 * @brief	Simulates rendering of the sub-mesh using a FIFO cache and returns the number of cache misses.
+	 *			Optionally outputs the number of unique vertices referenced by the sub-mesh.
+	 */
+	static UINT32 simulateCache(const MeshData& meshData, const SubMesh& subMesh, UINT32 cacheSize, UINT32* numUniqueVertices)
+	{
+		if(meshData.getIndexType() == IndexBuffer::IT_32BIT)
+		{
+			return simulateCache(meshData.getIndices32() + subMesh.indexOffset, subMesh.indexCount,
+				meshData.getNumVertices(), cacheSize, numUniqueVertices);
+		}
+		else
+		{
+			return simulateCache(meshData.getIndices16() + subMesh.indexOffset, subMesh.indexCount,
+				meshData.getNumVertices(), cacheSize, numUniqueVertices);
+		}
+	}
+
+	template<class T>
+	static void optimizeIndices(MeshData& meshData, T* indices, const Vector<SubMesh>& subMeshes, Vector<UINT32>& remap)
+	{
+		UINT32 numVertices = meshData.getNumVertices();
+		UINT32 numIndices = meshData.getNumIndices();
+
+		const VertexDataDescPtr& vertexDesc = meshData.getVertexDesc();
+
+		const UINT8* positionData = nullptr;
+		UINT32 positionStride = 0;
+
+		for(UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			if(element.getSemantic() == VES_POSITION && element.getSemanticIdx() == 0 && element.getType() == VET_FLOAT3)
+			{
+				positionData = meshData.getElementData(VES_POSITION, 0, element.getStreamIdx());
+				positionStride = vertexDesc->getVertexStride(element.getStreamIdx());
+				break;
+			}
+		}
+
+		Vector<UINT32> localIndices(numVertices, INVALID_INDEX);
+		for(auto& subMesh : subMeshes)
+		{
+			if(subMesh.drawOp != DOT_TRIANGLE_LIST)
+				continue;
+
+			optimizeTriangleOrder(indices + subMesh.indexOffset, subMesh.indexCount, positionData, positionStride, localIndices);
+		}
+
+		optimizeVertexFetch(indices, numIndices, numVertices, remap);
+	}
+
+	void MeshOptimizer::optimize(MeshData& meshData, const Vector<SubMesh>& subMeshes)
+	{
+		UINT32 numVertices = meshData.getNumVertices();
+		if(numVertices == 0 || meshData.getNumIndices() == 0)
+			return;
+
+		for(auto& subMesh : subMeshes)
+		{
+			if(subMesh.indexOffset + subMesh.indexCount > meshData.getNumIndices())
+				BS_EXCEPT(InvalidParametersException, "Sub-mesh index range is out of bounds of the provided mesh data.");
+		}
+
+		Vector<UINT32> remap;
+		if(meshData.getIndexType() == IndexBuffer::IT_32BIT)
+			optimizeIndices(meshData, meshData.getIndices32(), subMeshes, remap);
+		else
+			optimizeIndices(meshData, meshData.getIndices16(), subMeshes, remap);
+
+		// Move the vertex data to match the new indices
+		const VertexDataDescPtr& vertexDesc = meshData.getVertexDesc();
+		for(UINT32 i = 0; i <= vertexDesc->getMaxStreamIdx(); i++)
+		{
+			if(!vertexDesc->hasStream(i))
+				continue;
+
+			UINT32 vertexStride = vertexDesc->getVertexStride(i);
+			UINT32 streamSize = meshData.getStreamSize(i);
+			UINT8* streamData = meshData.getStreamData(i);
+
+			UINT8* reorderedData = (UINT8*)bs_alloc(streamSize);
+			for(UINT32 j = 0; j < numVertices; j++)
+				memcpy(reorderedData + remap[j] * vertexStride, streamData + j * vertexStride, vertexStride);
+
+			memcpy(streamData, reorderedData, streamSize);
+			bs_free(reorderedData);
+		}
+	}
+
+	float MeshOptimizer::calculateACMR(const MeshData& meshData, const SubMesh& subMesh, UINT32 cacheSize)
+	{
+		UINT32 numTriangles = subMesh.indexCount / 3;
+		if(numTriangles == 0)
+			return 0.0f;
+
+		return simulateCache(meshData, subMesh, cacheSize, nullptr) / (float)numTriangles;
+	}
+
+	float MeshOptimizer::calculateATVR(const MeshData& meshData, const SubMesh& subMesh, UINT32 cacheSize)
+	{
+		UINT32 numUniqueVertices = 0;
+		UINT32 numMisses = simulateCache(meshData, subMesh, cacheSize, &numUniqueVertices);
+
+		if(numUniqueVertices == 0)
+			return 0.0f;
+
+		return numMisses / (float)numUniqueVertices;
+	}
+}
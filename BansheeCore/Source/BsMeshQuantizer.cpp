@@ -0,0 +1,232 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsMeshQuantizer.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsBitwise.h"
+#include "BsMath.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Returns the type a vertex element should be stored as after quantization.
+	 */
+	static VertexElementType getQuantizedType(const VertexElement& element, bool quantizePositions,
+		bool quantizeDirections, bool quantizeTexCoords)
+	{
+		VertexElementType type = element.getType();
+		switch(element.getSemantic())
+		{
+		case VES_POSITION:
+			if(quantizePositions && (type == VET_FLOAT3 || type == VET_FLOAT4))
+				return VET_USHORT4_NORM;
+			break;
+		case VES_NORMAL:
+		case VES_TANGENT:
+		case VES_BITANGENT:
+			if(quantizeDirections && type == VET_FLOAT3)
+				return VET_SHORT2_NORM;
+			break;
+		case VES_TEXCOORD:
+			if(quantizeTexCoords && type == VET_FLOAT2)
+				return VET_HALF2;
+			break;
+		default:
+			break;
+		}
+
+		return type;
+	}
+
+	/**
+	 * @brief	Converts a value in [0, 1] range into a normalized unsigned 16-bit integer.
+	 */
+	static UINT16 toUNorm16(float value)
+	{
+		return (UINT16)Math::clamp(Math::floorToInt(value * 65535.0f + 0.5f), 0, 65535);
+	}
+
+	/**
+	 * @brief	Converts a value in [-1, 1] range into a normalized signed 16-bit integer.
+	 */
+	static INT16 toSNorm16(float value)
+	{
+		return (INT16)Math::clamp(Math::floorToInt(value * 32767.0f + 0.5f), -32767, 32767);
+	}
+
+	MeshDataPtr MeshQuantizer::quantize(const MeshDataPtr& meshData, bool quantizePositions, bool quantizeDirections,
+		bool quantizeTexCoords)
+	{
+		const VertexDataDescPtr& vertexDesc = meshData->getVertexDesc();
+		UINT32 numVertices = meshData->getNumVertices();
+
+		bool anyQuantized = false;
+		VertexDataDescPtr quantizedDesc = bs_shared_ptr<VertexDataDesc>();
+		for(UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			VertexElementType type = getQuantizedType(element, quantizePositions, quantizeDirections, quantizeTexCoords);
+
+			quantizedDesc->addVertElem(type, element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
+			anyQuantized |= type != element.getType();
+		}
+
+		if(!anyQuantized)
+			return meshData;
+
+		// Positions are stored relative to the mesh bounds, using the same scale on all axes so the decode
+		// transform doesn't introduce non-uniform scaling
+		Vector3 positionOffset = meshData->getPositionDecodeOffset();
+		float positionScale = meshData->getPositionDecodeScale();
+		if(quantizePositions)
+		{
+			Vector3 min(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+				std::numeric_limits<float>::infinity());
+			Vector3 max = -min;
+
+			for(UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+			{
+				const VertexElement& element = vertexDesc->getElement(i);
+				if(getQuantizedType(element, quantizePositions, false, false) != VET_USHORT4_NORM)
+					continue;
+
+				UINT8* data = meshData->getElementData(element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
+				UINT32 stride = vertexDesc->getVertexStride(element.getStreamIdx());
+
+				for(UINT32 j = 0; j < numVertices; j++)
+				{
+					Vector3 position;
+					memcpy(&position, data + j * stride, sizeof(Vector3));
+
+					min.floor(position);
+					max.ceil(position);
+				}
+			}
+
+			if(numVertices > 0)
+			{
+				Vector3 extents = max - min;
+				float maxExtent = std::max(extents.x, std::max(extents.y, extents.z));
+
+				positionOffset = min;
+				positionScale = maxExtent > 0.0f ? maxExtent : 1.0f;
+			}
+		}
+
+		MeshDataPtr output = bs_shared_ptr<MeshData>(numVertices, meshData->getNumIndices(), quantizedDesc, meshData->getIndexType());
+		output->setPositionDecode(positionOffset, positionScale);
+
+		UINT32 indexBufferSize = meshData->getNumIndices() * meshData->getIndexElementSize();
+		if(meshData->getIndexType() == IndexBuffer::IT_32BIT)
+			memcpy(output->getIndices32(), meshData->getIndices32(), indexBufferSize);
+		else
+			memcpy(output->getIndices16(), meshData->getIndices16(), indexBufferSize);
+
+		float invPositionScale = 1.0f / positionScale;
+		for(UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			VertexElementSemantic semantic = element.getSemantic();
+			UINT32 semanticIdx = element.getSemanticIdx();
+			UINT32 streamIdx = element.getStreamIdx();
+
+			UINT8* src = meshData->getElementData(semantic, semanticIdx, streamIdx);
+			UINT32 srcStride = vertexDesc->getVertexStride(streamIdx);
+
+			UINT8* dst = output->getElementData(semantic, semanticIdx, streamIdx);
+			UINT32 dstStride = quantizedDesc->getVertexStride(streamIdx);
+
+			VertexElementType type = getQuantizedType(element, quantizePositions, quantizeDirections, quantizeTexCoords);
+			switch(type)
+			{
+			case VET_USHORT4_NORM:
+				for(UINT32 j = 0; j < numVertices; j++)
+				{
+					Vector3 position;
+					memcpy(&position, src + j * srcStride, sizeof(Vector3));
+
+					Vector3 normalized = (position - positionOffset) * invPositionScale;
+
+					UINT16* quantized = (UINT16*)(dst + j * dstStride);
+					quantized[0] = toUNorm16(normalized.x);
+					quantized[1] = toUNorm16(normalized.y);
+					quantized[2] = toUNorm16(normalized.z);
+					quantized[3] = 65535;
+				}
+				break;
+			case VET_SHORT2_NORM:
+				for(UINT32 j = 0; j < numVertices; j++)
+				{
+					Vector3 direction;
+					memcpy(&direction, src + j * srcStride, sizeof(Vector3));
+
+					Vector2 encoded = encodeOctahedral(direction);
+
+					INT16* quantized = (INT16*)(dst + j * dstStride);
+					quantized[0] = toSNorm16(encoded.x);
+					quantized[1] = toSNorm16(encoded.y);
+				}
+				break;
+			case VET_HALF2:
+				for(UINT32 j = 0; j < numVertices; j++)
+				{
+					Vector2 texCoord;
+					memcpy(&texCoord, src + j * srcStride, sizeof(Vector2));
+
+					UINT16* quantized = (UINT16*)(dst + j * dstStride);
+					quantized[0] = Bitwise::floatToHalf(texCoord.x);
+					quantized[1] = Bitwise::floatToHalf(texCoord.y);
+				}
+				break;
+			default:
+				{
+					UINT32 elementSize = element.getSize();
+					for(UINT32 j = 0; j < numVertices; j++)
+						memcpy(dst + j * dstStride, src + j * srcStride, elementSize);
+				}
+				break;
+			}
+		}
+
+		return output;
+	}
+
+	Vector2 MeshQuantizer::encodeOctahedral(const Vector3& direction)
+	{
+		float sum = Math::abs(direction.x) + Math::abs(direction.y) + Math::abs(direction.z);
+		if(sum <= 0.0f)
+			return Vector2(0.0f, 0.0f);
+
+		Vector2 output(direction.x / sum, direction.y / sum);
+
+		// Fold the lower hemisphere over the diagonals
+		if(direction.z < 0.0f)
+		{
+			float x = (1.0f - Math::abs(output.y)) * (output.x >= 0.0f ? 1.0f : -1.0f);
+			float y = (1.0f - Math::abs(output.x)) * (output.y >= 0.0f ? 1.0f : -1.0f);
+
+			output.x = x;
+			output.y = y;
+		}
+
+		return output;
+	}
+
+	Vector3 MeshQuantizer::decodeOctahedral(const Vector2& encoded)
+	{
+		Vector3 output(encoded.x, encoded.y, 1.0f - Math::abs(encoded.x) - Math::abs(encoded.y));
+
+		if(output.z < 0.0f)
+		{
+			float x = (1.0f - Math::abs(encoded.y)) * (encoded.x >= 0.0f ? 1.0f : -1.0f);
+			float y = (1.0f - Math::abs(encoded.x)) * (encoded.y >= 0.0f ? 1.0f : -1.0f);
+
+			output.x = x;
+			output.y = y;
+		}
+
+		output.normalize();
+		return output;
+	}
+}
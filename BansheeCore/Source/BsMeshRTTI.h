@@ -38,6 +38,8 @@ namespace BansheeEngine
 		void setMeshData(Mesh* obj, MeshDataPtr meshData) 
 		{ 
 			obj->mTempInitialMeshData = meshData;
+			obj->mPositionOffset = meshData->getPositionDecodeOffset();
+			obj->mPositionScale = meshData->getPositionDecodeScale();
 		}
 
 	public:
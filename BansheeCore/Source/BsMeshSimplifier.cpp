@@ -0,0 +1,1009 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsMeshSimplifier.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsVector3.h"
+#include "BsMath.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	const float MeshSimplifier::LOD_SCREEN_SIZE = 0.5f;
+
+	static const UINT32 INVALID_INDEX = 0xFFFFFFFF;
+
+	/**
+	 * @brief	Weights of the quadrics keeping border and seam vertices on their edges. Borders are weighted more
+	 *			heavily as moving them changes the mesh silhouette.
+	 */
+	static const float BORDER_EDGE_WEIGHT = 10.0f;
+	static const float SEAM_EDGE_WEIGHT = 1.0f;
+
+	/**
+	 * @brief	Collapses in a single pass are limited to this multiple of the error of the collapse that would
+	 *			reach the target triangle count. Many collapses get skipped because they share vertices with
+	 *			collapses performed earlier in the pass, so the limit needs to be higher than the exact error.
+	 */
+	static const float PASS_ERROR_BOUND = 1.5f;
+
+	/**
+	 * @brief	Maximum error allowed for the first generated level of detail, relative to the mesh size. Each
+	 *			following level allows twice the error of the previous one.
+	 */
+	static const float LOD_MAX_ERROR = 0.01f;
+
+	/**
+	 * @brief	Level of detail generation stops once a level retains more than this portion of the indices of the
+	 *			previous level.
+	 */
+	static const float LOD_MIN_REDUCTION = 0.85f;
+
+	/**
+	 * @brief	Determines in which direction can vertices be moved during simplification.
+	 */
+	enum VertexKind
+	{
+		VK_Manifold, /**< Interior vertex, can be collapsed onto any neighbor. */
+		VK_Border, /**< Vertex on an open border, can only be collapsed along the border. */
+		VK_Seam, /**< Vertex with two attribute wedges, can only be collapsed along the seam. */
+		VK_Locked, /**< Vertex that cannot be moved (complex topology or shared with another sub-mesh). */
+		VK_Count
+	};
+
+	/**
+	 * @brief	Specifies whether a vertex of the first kind can be collapsed onto a vertex of the second kind.
+	 */
+	static const bool CAN_COLLAPSE[VK_Count][VK_Count] =
+	{
+		{ true, true, true, true },
+		{ false, true, false, false },
+		{ false, false, true, false },
+		{ false, false, false, false }
+	};
+
+	/**
+	 * @brief	Specifies whether an edge between vertices of the two kinds is guaranteed to have an opposite
+	 *			edge (ignoring attribute seams), meaning it will be encountered twice when iterating over triangles.
+	 */
+	static const bool HAS_OPPOSITE[VK_Count][VK_Count] =
+	{
+		{ true, true, true, false },
+		{ true, false, true, false },
+		{ true, true, true, false },
+		{ false, false, false, false }
+	};
+
+	/**
+	 * @brief	Symmetric 4x4 matrix accumulating squared distances to a set of weighted planes.
+	 */
+	struct Quadric
+	{
+		Quadric()
+			:a00(0.0f), a11(0.0f), a22(0.0f), a10(0.0f), a20(0.0f), a21(0.0f),
+			b0(0.0f), b1(0.0f), b2(0.0f), c(0.0f), w(0.0f)
+		{ }
+
+		/**
+		 * @brief	Adds a plane with the specified normal and distance from origin.
+		 */
+		void addPlane(const Vector3& n, float d, float weight)
+		{
+			a00 += weight * n.x * n.x;
+			a11 += weight * n.y * n.y;
+			a22 += weight * n.z * n.z;
+			a10 += weight * n.y * n.x;
+			a20 += weight * n.z * n.x;
+			a21 += weight * n.z * n.y;
+			b0 += weight * n.x * d;
+			b1 += weight * n.y * d;
+			b2 += weight * n.z * d;
+			c += weight * d * d;
+			w += weight;
+		}
+
+		void add(const Quadric& other)
+		{
+			a00 += other.a00; a11 += other.a11; a22 += other.a22;
+			a10 += other.a10; a20 += other.a20; a21 += other.a21;
+			b0 += other.b0; b1 += other.b1; b2 += other.b2;
+			c += other.c; w += other.w;
+		}
+
+		/**
+		 * @brief	Returns the weighted average of squared distances from the point to all the planes.
+		 */
+		float getError(const Vector3& p) const
+		{
+			float rx = b0 + a10 * p.y;
+			float ry = b1 + a21 * p.z;
+			float rz = b2 + a20 * p.x;
+
+			rx = rx * 2.0f + a00 * p.x;
+			ry = ry * 2.0f + a11 * p.y;
+			rz = rz * 2.0f + a22 * p.z;
+
+			float error = c + rx * p.x + ry * p.y + rz * p.z;
+			if(w == 0.0f)
+				return 0.0f;
+
+			return Math::abs(error) / w;
+		}
+
+		float a00, a11, a22;
+		float a10, a20, a21;
+		float b0, b1, b2;
+		float c, w;
+	};
+
+	/**
+	 * @brief	Candidate edge collapse, moving vertex v0 onto vertex v1.
+	 */
+	struct EdgeCollapse
+	{
+		UINT32 v0;
+		UINT32 v1;
+		bool bidirectional;
+		float error;
+	};
+
+	/**
+	 * @brief	Maps each vertex to the first vertex with the same position, and links vertices with the same
+	 *			position into circular lists (wedges).
+	 */
+	static void buildPositionRemap(const Vector<Vector3>& positions, Vector<UINT32>& remap, Vector<UINT32>& wedge)
+	{
+		UINT32 numVertices = (UINT32)positions.size();
+
+		Vector<UINT32> order(numVertices);
+		for(UINT32 i = 0; i < numVertices; i++)
+			order[i] = i;
+
+		std::sort(order.begin(), order.end(),
+			[&](UINT32 a, UINT32 b)
+		{
+			const Vector3& pa = positions[a];
+			const Vector3& pb = positions[b];
+
+			if(pa.x != pb.x)
+				return pa.x < pb.x;
+
+			if(pa.y != pb.y)
+				return pa.y < pb.y;
+
+			if(pa.z != pb.z)
+				return pa.z < pb.z;
+
+			return a < b;
+		});
+
+		remap.resize(numVertices);
+		wedge.resize(numVertices);
+
+		UINT32 groupStart = 0;
+		while(groupStart < numVertices)
+		{
+			UINT32 groupEnd = groupStart + 1;
+			while(groupEnd < numVertices && positions[order[groupEnd]] == positions[order[groupStart]])
+				groupEnd++;
+
+			for(UINT32 i = groupStart; i < groupEnd; i++)
+			{
+				remap[order[i]] = order[groupStart];
+				wedge[order[i]] = order[i + 1 < groupEnd ? i + 1 : groupStart];
+			}
+
+			groupStart = groupEnd;
+		}
+	}
+
+	/**
+	 * @brief	Builds a list of outgoing edges (as target vertices) for each vertex. Edges of a vertex are stored
+	 *			in range [offsets[i], offsets[i + 1]).
+	 */
+	static void buildEdgeAdjacency(const Vector<UINT32>& indices, UINT32 numVertices, Vector<UINT32>& offsets,
+		Vector<UINT32>& edges)
+	{
+		offsets.assign(numVertices + 1, 0);
+		for(auto& index : indices)
+			offsets[index + 1]++;
+
+		for(UINT32 i = 0; i < numVertices; i++)
+			offsets[i + 1] += offsets[i];
+
+		Vector<UINT32> counts(offsets.begin(), offsets.end() - 1);
+		edges.resize(indices.size());
+
+		UINT32 numIndices = (UINT32)indices.size();
+		for(UINT32 i = 0; i < numIndices; i += 3)
+		{
+			UINT32 a = indices[i + 0];
+			UINT32 b = indices[i + 1];
+			UINT32 c = indices[i + 2];
+
+			edges[counts[a]++] = b;
+			edges[counts[b]++] = c;
+			edges[counts[c]++] = a;
+		}
+	}
+
+	static bool hasEdge(const Vector<UINT32>& offsets, const Vector<UINT32>& edges, UINT32 a, UINT32 b)
+	{
+		for(UINT32 i = offsets[a]; i < offsets[a + 1]; i++)
+		{
+			if(edges[i] == b)
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief	Determines the kind of each vertex, and for border and seam vertices finds the vertices their
+	 *			open edges lead to (loop) and come from (loopback).
+	 */
+	static void classifyVertices(const Vector<UINT32>& indices, const Vector<UINT32>& remap, const Vector<UINT32>& wedge,
+		const Vector<bool>& locked, Vector<UINT8>& kinds, Vector<UINT32>& loop, Vector<UINT32>& loopback)
+	{
+		UINT32 numVertices = (UINT32)remap.size();
+
+		Vector<UINT32> offsets;
+		Vector<UINT32> edges;
+		buildEdgeAdjacency(indices, numVertices, offsets, edges);
+
+		// Find open edges. If a vertex has more than one open edge in the same direction, the entry points
+		// to the vertex itself.
+		loop.assign(numVertices, INVALID_INDEX);
+		loopback.assign(numVertices, INVALID_INDEX);
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			for(UINT32 j = offsets[i]; j < offsets[i + 1]; j++)
+			{
+				UINT32 target = edges[j];
+				if(hasEdge(offsets, edges, target, i))
+					continue;
+
+				loopback[target] = loopback[target] == INVALID_INDEX ? i : target;
+				loop[i] = loop[i] == INVALID_INDEX ? target : i;
+			}
+		}
+
+		kinds.resize(numVertices);
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			if(remap[i] != i)
+				continue;
+
+			UINT32 w = wedge[i];
+			if(locked[i])
+				kinds[i] = VK_Locked;
+			else if(w == i)
+			{
+				if(loop[i] == INVALID_INDEX && loopback[i] == INVALID_INDEX)
+					kinds[i] = VK_Manifold;
+				else if(loop[i] != INVALID_INDEX && loop[i] != i && loopback[i] != INVALID_INDEX && loopback[i] != i)
+					kinds[i] = VK_Border;
+				else
+					kinds[i] = VK_Locked;
+			}
+			else if(wedge[w] == i)
+			{
+				// Seam wedges must each have a single open edge in both directions, and the edges of the two wedges
+				// must connect the same positions
+				bool validEdges = loop[i] != INVALID_INDEX && loop[i] != i && loopback[i] != INVALID_INDEX && loopback[i] != i &&
+					loop[w] != INVALID_INDEX && loop[w] != w && loopback[w] != INVALID_INDEX && loopback[w] != w;
+
+				if(validEdges && remap[loopback[i]] == remap[loop[w]] && remap[loop[i]] == remap[loopback[w]])
+					kinds[i] = VK_Seam;
+				else
+					kinds[i] = VK_Locked;
+			}
+			else
+				kinds[i] = VK_Locked;
+		}
+
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			if(remap[i] != i)
+				kinds[i] = kinds[remap[i]];
+
+			if(kinds[i] != VK_Border && kinds[i] != VK_Seam)
+			{
+				loop[i] = INVALID_INDEX;
+				loopback[i] = INVALID_INDEX;
+			}
+		}
+	}
+
+	/**
+	 * @brief	Accumulates quadrics of triangle planes, weighted by triangle area, for every vertex position.
+	 */
+	static void addPlaneQuadrics(const Vector<UINT32>& indices, const Vector<Vector3>& positions,
+		const Vector<UINT32>& remap, Vector<Quadric>& quadrics)
+	{
+		UINT32 numIndices = (UINT32)indices.size();
+		for(UINT32 i = 0; i < numIndices; i += 3)
+		{
+			UINT32 i0 = indices[i + 0];
+			UINT32 i1 = indices[i + 1];
+			UINT32 i2 = indices[i + 2];
+
+			const Vector3& p0 = positions[i0];
+			Vector3 normal = (positions[i1] - p0).cross(positions[i2] - p0);
+			float area = normal.normalize();
+
+			Quadric quadric;
+			quadric.addPlane(normal, -normal.dot(p0), area);
+
+			quadrics[remap[i0]].add(quadric);
+			quadrics[remap[i1]].add(quadric);
+			quadrics[remap[i2]].add(quadric);
+		}
+	}
+
+	/**
+	 * @brief	Accumulates quadrics of planes perpendicular to border and seam edges, so vertices collapsing
+	 *			along those edges are penalized for moving them.
+	 */
+	static void addEdgeQuadrics(const Vector<UINT32>& indices, const Vector<Vector3>& positions,
+		const Vector<UINT32>& remap, const Vector<UINT8>& kinds, const Vector<UINT32>& loop,
+		const Vector<UINT32>& loopback, Vector<Quadric>& quadrics)
+	{
+		UINT32 numIndices = (UINT32)indices.size();
+		for(UINT32 i = 0; i < numIndices; i += 3)
+		{
+			for(UINT32 e = 0; e < 3; e++)
+			{
+				UINT32 i0 = indices[i + e];
+				UINT32 i1 = indices[i + (e + 1) % 3];
+				UINT32 i2 = indices[i + (e + 2) % 3];
+
+				UINT8 k0 = kinds[i0];
+				UINT8 k1 = kinds[i1];
+
+				bool open0 = k0 == VK_Border || k0 == VK_Seam;
+				bool open1 = k1 == VK_Border || k1 == VK_Seam;
+
+				if(!open0 && !open1)
+					continue;
+
+				if((open0 && loop[i0] != i1) || (open1 && loopback[i1] != i0))
+					continue;
+
+				// Seam edges are encountered twice, once from each side
+				if(HAS_OPPOSITE[k0][k1] && remap[i1] > remap[i0])
+					continue;
+
+				const Vector3& p0 = positions[i0];
+				const Vector3& p1 = positions[i1];
+
+				Vector3 edge = p1 - p0;
+				float length = edge.normalize();
+
+				Vector3 normal = positions[i2] - p0;
+				normal -= edge * normal.dot(edge);
+				normal.normalize();
+
+				float weight = (k0 == VK_Border || k1 == VK_Border) ? BORDER_EDGE_WEIGHT : SEAM_EDGE_WEIGHT;
+
+				Quadric quadric;
+				quadric.addPlane(normal, -normal.dot(p0), length * length * weight);
+
+				quadrics[remap[i0]].add(quadric);
+				quadrics[remap[i1]].add(quadric);
+			}
+		}
+	}
+
+	/**
+	 * @brief	Finds all edges that can be collapsed without breaking borders, seams or locked vertices.
+	 */
+	static void pickEdgeCollapses(const Vector<UINT32>& indices, const Vector<UINT32>& remap, const Vector<UINT8>& kinds,
+		const Vector<UINT32>& loop, Vector<EdgeCollapse>& collapses)
+	{
+		collapses.clear();
+
+		UINT32 numIndices = (UINT32)indices.size();
+		for(UINT32 i = 0; i < numIndices; i += 3)
+		{
+			for(UINT32 e = 0; e < 3; e++)
+			{
+				UINT32 i0 = indices[i + e];
+				UINT32 i1 = indices[i + (e + 1) % 3];
+
+				// Zero length edges are left alone, as they might be required for keeping the topology intact
+				if(remap[i0] == remap[i1])
+					continue;
+
+				UINT8 k0 = kinds[i0];
+				UINT8 k1 = kinds[i1];
+
+				if(!CAN_COLLAPSE[k0][k1] && !CAN_COLLAPSE[k1][k0])
+					continue;
+
+				if(HAS_OPPOSITE[k0][k1] && remap[i1] > remap[i0])
+					continue;
+
+				// Two border or seam vertices not directly connected by the border or seam belong to different
+				// edge loops
+				if(k0 == k1 && (k0 == VK_Border || k0 == VK_Seam) && loop[i0] != i1)
+					continue;
+
+				EdgeCollapse collapse;
+				collapse.error = 0.0f;
+
+				if(CAN_COLLAPSE[k0][k1] && CAN_COLLAPSE[k1][k0])
+				{
+					collapse.v0 = i0;
+					collapse.v1 = i1;
+					collapse.bidirectional = true;
+				}
+				else
+				{
+					collapse.v0 = CAN_COLLAPSE[k0][k1] ? i0 : i1;
+					collapse.v1 = CAN_COLLAPSE[k0][k1] ? i1 : i0;
+					collapse.bidirectional = false;
+				}
+
+				collapses.push_back(collapse);
+			}
+		}
+	}
+
+	/**
+	 * @brief	Calculates the error of each collapse and picks the cheaper direction of bidirectional collapses.
+	 */
+	static void rankEdgeCollapses(const Vector<Vector3>& positions, const Vector<UINT32>& remap,
+		const Vector<Quadric>& quadrics, Vector<EdgeCollapse>& collapses)
+	{
+		for(auto& collapse : collapses)
+		{
+			UINT32 i0 = collapse.v0;
+			UINT32 i1 = collapse.v1;
+
+			float error0 = quadrics[remap[i0]].getError(positions[i1]);
+			if(!collapse.bidirectional)
+			{
+				collapse.error = error0;
+				continue;
+			}
+
+			float error1 = quadrics[remap[i1]].getError(positions[i0]);
+			if(error1 < error0)
+			{
+				collapse.v0 = i1;
+				collapse.v1 = i0;
+				collapse.error = error1;
+			}
+			else
+				collapse.error = error0;
+		}
+	}
+
+	/**
+	 * @brief	Builds a list of triangles referencing each vertex position. Triangles of a position are stored
+	 *			in range [offsets[i], offsets[i + 1]).
+	 */
+	static void buildTriangleAdjacency(const Vector<UINT32>& indices, const Vector<UINT32>& remap,
+		Vector<UINT32>& offsets, Vector<UINT32>& triangles)
+	{
+		UINT32 numVertices = (UINT32)remap.size();
+
+		offsets.assign(numVertices + 1, 0);
+		for(auto& index : indices)
+			offsets[remap[index] + 1]++;
+
+		for(UINT32 i = 0; i < numVertices; i++)
+			offsets[i + 1] += offsets[i];
+
+		Vector<UINT32> counts(offsets.begin(), offsets.end() - 1);
+		triangles.resize(indices.size());
+
+		UINT32 numIndices = (UINT32)indices.size();
+		for(UINT32 i = 0; i < numIndices; i++)
+			triangles[counts[remap[indices[i]]]++] = i / 3;
+	}
+
+	/**
+	 * @brief	Checks would moving the position r0 onto position r1 flip any of the triangles around r0. Takes into
+	 *			account the collapses already performed in the current pass.
+	 */
+	static bool hasTriangleFlips(const Vector<UINT32>& indices, const Vector<Vector3>& positions, const Vector<UINT32>& remap,
+		const Vector<UINT32>& collapseRemap, const Vector<UINT32>& offsets, const Vector<UINT32>& triangles, UINT32 r0, UINT32 r1)
+	{
+		const Vector3& newPosition = positions[r1];
+
+		for(UINT32 i = offsets[r0]; i < offsets[r0 + 1]; i++)
+		{
+			UINT32 triIdx = triangles[i] * 3;
+			UINT32 a = remap[collapseRemap[indices[triIdx + 0]]];
+			UINT32 b = remap[collapseRemap[indices[triIdx + 1]]];
+			UINT32 c = remap[collapseRemap[indices[triIdx + 2]]];
+
+			// Triangles containing the collapsed edge are removed, as are the ones already collapsed in this pass
+			if(a == r1 || b == r1 || c == r1)
+				continue;
+
+			if(a == b || b == c || a == c)
+				continue;
+
+			// Rotate so the moved vertex is first
+			if(b == r0)
+			{
+				UINT32 temp = a;
+				a = b; b = c; c = temp;
+			}
+			else if(c == r0)
+			{
+				UINT32 temp = c;
+				c = b; b = a; a = temp;
+			}
+
+			const Vector3& pb = positions[b];
+			const Vector3& pc = positions[c];
+
+			Vector3 oldNormal = (pb - positions[a]).cross(pc - positions[a]);
+			Vector3 newNormal = (pb - newPosition).cross(pc - newPosition);
+
+			if(oldNormal.dot(newNormal) <= 0.0f)
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief	Performs the cheapest edge collapses that don't touch vertices already moved in this pass, until
+	 *			reaching the target number of removed triangles or the error limit.
+	 *
+	 * @return	Number of performed collapses.
+	 */
+	static UINT32 performEdgeCollapses(const Vector<UINT32>& indices, const Vector<Vector3>& positions,
+		const Vector<UINT32>& remap, const Vector<UINT32>& wedge, const Vector<UINT8>& kinds, const Vector<UINT32>& loop,
+		const Vector<UINT32>& loopback, const Vector<EdgeCollapse>& collapses, UINT32 triangleCollapseGoal, float maxError,
+		Vector<Quadric>& quadrics, Vector<UINT32>& collapseRemap)
+	{
+		UINT32 numVertices = (UINT32)positions.size();
+		UINT32 numCollapses = (UINT32)collapses.size();
+
+		Vector<UINT32> order(numCollapses);
+		for(UINT32 i = 0; i < numCollapses; i++)
+			order[i] = i;
+
+		std::sort(order.begin(), order.end(),
+			[&](UINT32 a, UINT32 b) { return collapses[a].error < collapses[b].error; });
+
+		// Each collapse removes about two triangles
+		UINT32 edgeCollapseGoal = triangleCollapseGoal / 2;
+		float errorGoal = std::numeric_limits<float>::max();
+		if(edgeCollapseGoal < numCollapses)
+			errorGoal = collapses[order[edgeCollapseGoal]].error * PASS_ERROR_BOUND;
+
+		Vector<UINT32> offsets;
+		Vector<UINT32> triangles;
+		buildTriangleAdjacency(indices, remap, offsets, triangles);
+
+		Vector<bool> lockedPositions(numVertices, false);
+		for(UINT32 i = 0; i < numVertices; i++)
+			collapseRemap[i] = i;
+
+		UINT32 numPerformed = 0;
+		UINT32 numCollapsedTriangles = 0;
+		for(UINT32 i = 0; i < numCollapses; i++)
+		{
+			const EdgeCollapse& collapse = collapses[order[i]];
+
+			if(collapse.error > maxError || collapse.error > errorGoal || numCollapsedTriangles >= triangleCollapseGoal)
+				break;
+
+			UINT32 i0 = collapse.v0;
+			UINT32 i1 = collapse.v1;
+			UINT32 r0 = remap[i0];
+			UINT32 r1 = remap[i1];
+
+			// Collapses are ranked once per pass, so vertices involved in a collapse can't be touched again
+			// until the next pass
+			if(lockedPositions[r0] || lockedPositions[r1])
+				continue;
+
+			if(hasTriangleFlips(indices, positions, remap, collapseRemap, offsets, triangles, r0, r1))
+				continue;
+
+			if(kinds[i0] == VK_Seam)
+			{
+				// Both wedges of the seam move together, each onto the wedge on its side of the seam
+				UINT32 s0 = wedge[i0];
+				UINT32 s1 = loop[i0] == i1 ? loopback[s0] : loop[s0];
+
+				if(s1 == INVALID_INDEX || remap[s1] != r1)
+					continue;
+
+				collapseRemap[i0] = i1;
+				collapseRemap[s0] = s1;
+			}
+			else
+				collapseRemap[i0] = i1;
+
+			quadrics[r1].add(quadrics[r0]);
+
+			lockedPositions[r0] = true;
+			lockedPositions[r1] = true;
+
+			numCollapsedTriangles += kinds[i0] == VK_Border ? 1 : 2;
+			numPerformed++;
+		}
+
+		return numPerformed;
+	}
+
+	/**
+	 * @brief	Updates the indices after a collapse pass, removing triangles that became degenerate.
+	 */
+	static void applyCollapses(Vector<UINT32>& indices, const Vector<UINT32>& remap, const Vector<UINT32>& collapseRemap)
+	{
+		UINT32 numIndices = (UINT32)indices.size();
+		UINT32 writeIdx = 0;
+		for(UINT32 i = 0; i < numIndices; i += 3)
+		{
+			UINT32 a = collapseRemap[indices[i + 0]];
+			UINT32 b = collapseRemap[indices[i + 1]];
+			UINT32 c = collapseRemap[indices[i + 2]];
+
+			if(remap[a] == remap[b] || remap[a] == remap[c] || remap[b] == remap[c])
+				continue;
+
+			indices[writeIdx++] = a;
+			indices[writeIdx++] = b;
+			indices[writeIdx++] = c;
+		}
+
+		indices.resize(writeIdx);
+	}
+
+	/**
+	 * @brief	Updates border and seam edge loops after a collapse pass.
+	 */
+	static void remapEdgeLoops(Vector<UINT32>& loop, const Vector<UINT32>& collapseRemap)
+	{
+		UINT32 numVertices = (UINT32)loop.size();
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			if(loop[i] == INVALID_INDEX)
+				continue;
+
+			UINT32 target = loop[i];
+			UINT32 newTarget = collapseRemap[target];
+
+			// Happens when a loop edge is collapsed in the direction opposite to the loop
+			if(newTarget == i)
+				loop[i] = loop[target];
+			else
+				loop[i] = newTarget;
+		}
+	}
+
+	/**
+	 * @brief	Simplifies a triangle list in place.
+	 *
+	 * @param	positions			Vertex positions, normalized to unit size.
+	 * @param	locked				Marks vertices that must not be moved.
+	 * @param	indices				Triangle list indices, simplified in place.
+	 * @param	targetIndexCount	Number of indices to reduce the list to.
+	 * @param	maxError			Maximum allowed distance between the original and the simplified surface.
+	 */
+	static void simplifyTriangles(const Vector<Vector3>& positions, const Vector<bool>& locked, Vector<UINT32>& indices,
+		UINT32 targetIndexCount, float maxError)
+	{
+		UINT32 numVertices = (UINT32)positions.size();
+
+		Vector<UINT32> remap;
+		Vector<UINT32> wedge;
+		buildPositionRemap(positions, remap, wedge);
+
+		Vector<UINT8> kinds;
+		Vector<UINT32> loop;
+		Vector<UINT32> loopback;
+		classifyVertices(indices, remap, wedge, locked, kinds, loop, loopback);
+
+		Vector<Quadric> quadrics(numVertices);
+		addPlaneQuadrics(indices, positions, remap, quadrics);
+		addEdgeQuadrics(indices, positions, remap, kinds, loop, loopback, quadrics);
+
+		float maxErrorSqrd = maxError * maxError;
+
+		Vector<EdgeCollapse> collapses;
+		Vector<UINT32> collapseRemap(numVertices);
+		while((UINT32)indices.size() > targetIndexCount)
+		{
+			pickEdgeCollapses(indices, remap, kinds, loop, collapses);
+			if(collapses.empty())
+				break;
+
+			rankEdgeCollapses(positions, remap, quadrics, collapses);
+
+			UINT32 triangleCollapseGoal = ((UINT32)indices.size() - targetIndexCount) / 3;
+			UINT32 numPerformed = performEdgeCollapses(indices, positions, remap, wedge, kinds, loop, loopback,
+				collapses, triangleCollapseGoal, maxErrorSqrd, quadrics, collapseRemap);
+
+			if(numPerformed == 0)
+				break;
+
+			applyCollapses(indices, remap, collapseRemap);
+			remapEdgeLoops(loop, collapseRemap);
+			remapEdgeLoops(loopback, collapseRemap);
+		}
+	}
+
+	/**
+	 * @brief	Reads VET_FLOAT3 positions of all vertices in the mesh data. Returns false if the mesh data has no positions.
+	 */
+	static bool readPositions(const MeshData& meshData, Vector<Vector3>& positions)
+	{
+		const VertexDataDescPtr& vertexDesc = meshData.getVertexDesc();
+
+		for(UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			if(element.getSemantic() != VES_POSITION || element.getSemanticIdx() != 0 || element.getType() != VET_FLOAT3)
+				continue;
+
+			UINT32 numVertices = meshData.getNumVertices();
+			UINT8* data = meshData.getElementData(VES_POSITION, 0, element.getStreamIdx());
+			UINT32 stride = vertexDesc->getVertexStride(element.getStreamIdx());
+
+			positions.resize(numVertices);
+			for(UINT32 j = 0; j < numVertices; j++)
+				memcpy(&positions[j], data + j * stride, sizeof(Vector3));
+
+			return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief	Reads a single index from the mesh data, regardless of the index type.
+	 */
+	static UINT32 readIndex(const MeshData& meshData, UINT32 idx)
+	{
+		if(meshData.getIndexType() == IndexBuffer::IT_32BIT)
+			return meshData.getIndices32()[idx];
+		else
+			return meshData.getIndices16()[idx];
+	}
+
+	/**
+	 * @brief	Simplifies all triangle list sub-meshes of the provided mesh data.
+	 *
+	 * @param	meshData		Mesh data to simplify.
+	 * @param	positions		Positions of all vertices in the mesh data, normalized to unit size.
+	 * @param	subMeshes		Sub-meshes to simplify.
+	 * @param	targetRatio		Portion of indices to keep in each sub-mesh.
+	 * @param	maxError		Maximum allowed distance between the original and the simplified surface.
+	 * @param	output			Simplified indices, appended at the end of the vector.
+	 * @param	outSubMeshes	Sub-meshes of the simplified indices, with offsets relative to the start of the output vector.
+	 */
+	static void simplifySubMeshes(const MeshData& meshData, const Vector<Vector3>& positions, const Vector<SubMesh>& subMeshes,
+		float targetRatio, float maxError, Vector<UINT32>& output, Vector<SubMesh>& outSubMeshes)
+	{
+		UINT32 numVertices = meshData.getNumVertices();
+
+		// Lock positions shared between multiple sub-meshes, so the sub-mesh boundaries stay intact
+		Vector<UINT32> remap;
+		Vector<UINT32> wedge;
+		buildPositionRemap(positions, remap, wedge);
+
+		Vector<UINT32> owners(numVertices, INVALID_INDEX);
+		Vector<bool> sharedPositions(numVertices, false);
+		for(UINT32 i = 0; i < (UINT32)subMeshes.size(); i++)
+		{
+			const SubMesh& subMesh = subMeshes[i];
+			for(UINT32 j = 0; j < subMesh.indexCount; j++)
+			{
+				UINT32 position = remap[readIndex(meshData, subMesh.indexOffset + j)];
+
+				if(owners[position] == INVALID_INDEX)
+					owners[position] = i;
+				else if(owners[position] != i)
+					sharedPositions[position] = true;
+			}
+		}
+
+		Vector<UINT32> localVertices(numVertices, INVALID_INDEX);
+		for(auto& subMesh : subMeshes)
+		{
+			UINT32 outputOffset = (UINT32)output.size();
+
+			if(subMesh.drawOp != DOT_TRIANGLE_LIST)
+			{
+				for(UINT32 i = 0; i < subMesh.indexCount; i++)
+					output.push_back(readIndex(meshData, subMesh.indexOffset + i));
+
+				outSubMeshes.push_back(SubMesh(outputOffset, subMesh.indexCount, subMesh.drawOp));
+				continue;
+			}
+
+			// Simplify using only the vertices referenced by the sub-mesh
+			Vector<UINT32> globalVertices;
+			Vector<Vector3> localPositions;
+			Vector<bool> localLocked;
+			Vector<UINT32> localIndices(subMesh.indexCount);
+
+			for(UINT32 i = 0; i < subMesh.indexCount; i++)
+			{
+				UINT32 vertexIdx = readIndex(meshData, subMesh.indexOffset + i);
+				if(localVertices[vertexIdx] == INVALID_INDEX)
+				{
+					localVertices[vertexIdx] = (UINT32)globalVertices.size();
+
+					globalVertices.push_back(vertexIdx);
+					localPositions.push_back(positions[vertexIdx]);
+					localLocked.push_back(sharedPositions[remap[vertexIdx]]);
+				}
+
+				localIndices[i] = localVertices[vertexIdx];
+			}
+
+			UINT32 targetIndexCount = (UINT32)(subMesh.indexCount * targetRatio) / 3 * 3;
+			simplifyTriangles(localPositions, localLocked, localIndices, targetIndexCount, maxError);
+
+			for(auto& index : localIndices)
+				output.push_back(globalVertices[index]);
+
+			for(auto& vertexIdx : globalVertices)
+				localVertices[vertexIdx] = INVALID_INDEX;
+
+			outSubMeshes.push_back(SubMesh(outputOffset, (UINT32)localIndices.size(), subMesh.drawOp));
+		}
+	}
+
+	/**
+	 * @brief	Scales the positions so the largest dimension of their bounds has unit size.
+	 */
+	static void normalizePositions(Vector<Vector3>& positions)
+	{
+		if(positions.empty())
+			return;
+
+		Vector3 min = positions[0];
+		Vector3 max = positions[0];
+		for(auto& position : positions)
+		{
+			min.floor(position);
+			max.ceil(position);
+		}
+
+		Vector3 size = max - min;
+		float extent = std::max(size.x, std::max(size.y, size.z));
+		if(extent <= 0.0f)
+			return;
+
+		float scale = 1.0f / extent;
+		for(auto& position : positions)
+			position = (position - min) * scale;
+	}
+
+	UINT32 MeshSimplifier::simplify(const MeshData& meshData, const SubMesh& subMesh, UINT32 targetIndexCount,
+		float maxError, Vector<UINT32>& output)
+	{
+		if(subMesh.indexOffset + subMesh.indexCount > meshData.getNumIndices())
+			BS_EXCEPT(InvalidParametersException, "Sub-mesh index range is out of bounds of the provided mesh data.");
+
+		if(subMesh.drawOp != DOT_TRIANGLE_LIST)
+			BS_EXCEPT(InvalidParametersException, "Only triangle list sub-meshes can be simplified.");
+
+		Vector<Vector3> positions;
+		if(!readPositions(meshData, positions))
+			BS_EXCEPT(InvalidParametersException, "Mesh data must contain a VET_FLOAT3 position element in order to be simplified.");
+
+		normalizePositions(positions);
+
+		UINT32 outputOffset = (UINT32)output.size();
+		float targetRatio = subMesh.indexCount > 0 ? targetIndexCount / (float)subMesh.indexCount : 1.0f;
+
+		Vector<SubMesh> subMeshes = { subMesh };
+		Vector<SubMesh> outSubMeshes;
+		simplifySubMeshes(meshData, positions, subMeshes, targetRatio, maxError, output, outSubMeshes);
+
+		return (UINT32)output.size() - outputOffset;
+	}
+
+	MeshDataPtr MeshSimplifier::generateLODs(const MeshDataPtr& meshData, const Vector<SubMesh>& subMeshes, UINT32 numLODs,
+		Vector<SubMesh>& lodSubMeshes, Vector<float>& lodScreenSizes)
+	{
+		lodSubMeshes.clear();
+		lodScreenSizes.clear();
+
+		if(meshData == nullptr || numLODs <= 1)
+			return meshData;
+
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32 numFullIndices = 0;
+		for(auto& subMesh : subMeshes)
+		{
+			if(subMesh.indexOffset + subMesh.indexCount > numIndices)
+				BS_EXCEPT(InvalidParametersException, "Sub-mesh index range is out of bounds of the provided mesh data.");
+
+			numFullIndices += subMesh.indexCount;
+		}
+
+		if(numFullIndices == 0)
+			return meshData;
+
+		Vector<Vector3> positions;
+		if(!readPositions(*meshData, positions))
+		{
+			LOGWRN("Cannot generate levels of detail for a mesh without a VET_FLOAT3 position element.");
+			return meshData;
+		}
+
+		normalizePositions(positions);
+
+		// Each level is simplified from the full detail mesh, so errors don't accumulate between levels
+		Vector<UINT32> lodIndices;
+		UINT32 prevIndexCount = numFullIndices;
+		float targetRatio = 1.0f;
+		float maxError = LOD_MAX_ERROR;
+		for(UINT32 i = 1; i < numLODs; i++)
+		{
+			targetRatio *= 0.5f;
+
+			UINT32 lodOffset = (UINT32)lodIndices.size();
+			Vector<SubMesh> curSubMeshes;
+			simplifySubMeshes(*meshData, positions, subMeshes, targetRatio, maxError, lodIndices, curSubMeshes);
+
+			UINT32 lodIndexCount = (UINT32)lodIndices.size() - lodOffset;
+			if(lodIndexCount > prevIndexCount * LOD_MIN_REDUCTION)
+			{
+				lodIndices.resize(lodOffset);
+				break;
+			}
+
+			for(auto& subMesh : curSubMeshes)
+			{
+				subMesh.indexOffset += numIndices;
+				lodSubMeshes.push_back(subMesh);
+			}
+
+			// Keep the number of triangles per unit of screen area roughly constant between levels
+			float indexRatio = lodIndexCount / (float)numFullIndices;
+			lodScreenSizes.push_back(LOD_SCREEN_SIZE * Math::sqrt(indexRatio * 2.0f));
+
+			prevIndexCount = lodIndexCount;
+			maxError *= 2.0f;
+		}
+
+		if(lodIndices.empty())
+			return meshData;
+
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numLODIndices = (UINT32)lodIndices.size();
+		const VertexDataDescPtr& vertexDesc = meshData->getVertexDesc();
+
+		MeshDataPtr output = bs_shared_ptr<MeshData>(numVertices, numIndices + numLODIndices, vertexDesc, meshData->getIndexType());
+
+		memcpy(output->getIndexData(), meshData->getIndexData(), meshData->getIndexBufferSize());
+		if(output->getIndexType() == IndexBuffer::IT_32BIT)
+		{
+			UINT32* indices = output->getIndices32() + numIndices;
+			memcpy(indices, &lodIndices[0], numLODIndices * sizeof(UINT32));
+		}
+		else
+		{
+			UINT16* indices = output->getIndices16() + numIndices;
+			for(UINT32 i = 0; i < numLODIndices; i++)
+				indices[i] = (UINT16)lodIndices[i];
+		}
+
+		for(UINT32 i = 0; i <= vertexDesc->getMaxStreamIdx(); i++)
+		{
+			if(!vertexDesc->hasStream(i))
+				continue;
+
+			memcpy(output->getStreamData(i), meshData->getStreamData(i), meshData->getStreamSize(i));
+		}
+
+		return output;
+	}
+}
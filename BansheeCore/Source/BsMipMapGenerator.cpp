@@ -0,0 +1,509 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsMipMapGenerator.h"
+#include "BsTaskScheduler.h"
+#include "BsMath.h"
+#include "BsException.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Number of rows processed by a single task.
+	 */
+	static const UINT32 ROWS_PER_TASK = 32;
+
+	/**
+	 * @brief	Calls the provided function for ranges of rows covering all the rows. Ranges are split
+	 *			between multiple tasks if the task scheduler is running.
+	 */
+	static void forEachRowRange(UINT32 numRows, const std::function<void(UINT32, UINT32)>& func)
+	{
+		if(!TaskScheduler::isStarted() || numRows <= ROWS_PER_TASK)
+		{
+			func(0, numRows);
+			return;
+		}
+
+		Vector<TaskPtr> tasks;
+		for(UINT32 start = 0; start < numRows; start += ROWS_PER_TASK)
+		{
+			UINT32 end = std::min(start + ROWS_PER_TASK, numRows);
+
+			TaskPtr task = Task::create("MipMapGenerator", [&func, start, end]()
+			{
+				func(start, end);
+			});
+
+			TaskScheduler::instance().addTask(task);
+			tasks.push_back(task);
+		}
+
+		for(auto& task : tasks)
+			task->wait();
+	}
+
+	/************************************************************************/
+	/* 									FILTERS                      		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Filter kernel used for downsampling. Kernel is evaluated in destination pixel units.
+	 */
+	struct MipFilterKernel
+	{
+		float radius;
+		float (*evaluate)(float x);
+	};
+
+	static float sinc(float x)
+	{
+		if(std::abs(x) < 0.0001f)
+			return 1.0f;
+
+		x *= Math::PI;
+		return std::sin(x) / x;
+	}
+
+	/**
+	 * @brief	Modified Bessel function of the first kind, of order zero.
+	 */
+	static float besselI0(float x)
+	{
+		float sum = 1.0f;
+		float term = 1.0f;
+		for(UINT32 i = 1; i < 20; i++)
+		{
+			term *= x / (2.0f * i);
+			sum += term * term;
+		}
+
+		return sum;
+	}
+
+	static float evaluateBox(float x)
+	{
+		return std::abs(x) <= 0.5f ? 1.0f : 0.0f;
+	}
+
+	static float evaluateTriangle(float x)
+	{
+		return std::max(0.0f, 1.0f - std::abs(x));
+	}
+
+	static float evaluateKaiser(float x)
+	{
+		const float RADIUS = 3.0f;
+		const float ALPHA = 4.0f;
+
+		float t = x / RADIUS;
+		if(t * t >= 1.0f)
+			return 0.0f;
+
+		return sinc(x) * besselI0(ALPHA * std::sqrt(1.0f - t * t)) / besselI0(ALPHA);
+	}
+
+	static float evaluateLanczos(float x)
+	{
+		const float RADIUS = 3.0f;
+
+		if(std::abs(x) >= RADIUS)
+			return 0.0f;
+
+		return sinc(x) * sinc(x / RADIUS);
+	}
+
+	/**
+	 * @brief	Available filter kernels, in the same order as entries in MipMapFilter.
+	 */
+	static const MipFilterKernel FILTER_KERNELS[] =
+	{
+		{ 0.5f, &evaluateBox },
+		{ 1.0f, &evaluateTriangle },
+		{ 3.0f, &evaluateKaiser },
+		{ 3.0f, &evaluateLanczos }
+	};
+
+	/**
+	 * @brief	Maps a possibly out of range pixel coordinate to a valid coordinate according to the wrap mode.
+	 */
+	static UINT32 wrapCoordinate(INT32 coord, UINT32 size, MipMapWrapMode wrapMode)
+	{
+		INT32 signedSize = (INT32)size;
+
+		switch(wrapMode)
+		{
+		case MipMapWrapMode::Repeat:
+			coord %= signedSize;
+			return (UINT32)(coord < 0 ? coord + signedSize : coord);
+		case MipMapWrapMode::Mirror:
+		{
+			INT32 period = signedSize * 2;
+			coord %= period;
+			if(coord < 0)
+				coord += period;
+
+			return (UINT32)(coord < signedSize ? coord : period - coord - 1);
+		}
+		default:
+			return (UINT32)Math::clamp(coord, 0, signedSize - 1);
+		}
+	}
+
+	/**
+	 * @brief	Source pixels and their weights contributing to each destination pixel along one axis.
+	 *			Every destination pixel has the same number of taps.
+	 */
+	struct FilterTaps
+	{
+		UINT32 numTaps;
+		Vector<UINT32> offsets; /**< Source pixel index for each tap, multiplied by the provided stride. */
+		Vector<float> weights;
+	};
+
+	/**
+	 * @brief	Calculates filter taps for downsampling along one axis.
+	 *
+	 * @param	srcSize		Number of source pixels along the axis.
+	 * @param	dstSize		Number of destination pixels along the axis.
+	 * @param	stride		Value to multiply the source pixel indices with when storing tap offsets.
+	 * @param	kernel		Filter kernel to use.
+	 * @param	wrapMode	Determines how are pixels outside of the source image handled.
+	 * @param	taps		Output taps.
+	 */
+	static void calculateFilterTaps(UINT32 srcSize, UINT32 dstSize, UINT32 stride, const MipFilterKernel& kernel,
+		MipMapWrapMode wrapMode, FilterTaps& taps)
+	{
+		float scale = srcSize / (float)dstSize;
+		float radius = kernel.radius * scale;
+
+		taps.numTaps = (UINT32)std::ceil(radius * 2.0f) + 1;
+		taps.offsets.resize(dstSize * taps.numTaps);
+		taps.weights.resize(dstSize * taps.numTaps);
+
+		for(UINT32 i = 0; i < dstSize; i++)
+		{
+			float center = (i + 0.5f) * scale;
+			INT32 first = (INT32)std::floor(center - radius);
+
+			UINT32* offsets = &taps.offsets[i * taps.numTaps];
+			float* weights = &taps.weights[i * taps.numTaps];
+
+			float totalWeight = 0.0f;
+			for(UINT32 j = 0; j < taps.numTaps; j++)
+			{
+				INT32 srcIdx = first + (INT32)j;
+
+				offsets[j] = wrapCoordinate(srcIdx, srcSize, wrapMode) * stride;
+				weights[j] = kernel.evaluate((srcIdx + 0.5f - center) / scale);
+				totalWeight += weights[j];
+			}
+
+			if(std::abs(totalWeight) > 0.0001f)
+			{
+				float invTotalWeight = 1.0f / totalWeight;
+				for(UINT32 j = 0; j < taps.numTaps; j++)
+					weights[j] *= invTotalWeight;
+			}
+			else
+			{
+				// Can only happen for degenerate kernels, fall back to point sampling
+				for(UINT32 j = 0; j < taps.numTaps; j++)
+					weights[j] = 0.0f;
+
+				offsets[0] = wrapCoordinate((INT32)center, srcSize, wrapMode) * stride;
+				weights[0] = 1.0f;
+			}
+		}
+	}
+
+	/************************************************************************/
+	/* 								POST-PROCESSING                    		*/
+	/************************************************************************/
+
+	static float linearToSRGB(float value)
+	{
+		value = Math::clamp(value, 0.0f, 1.0f);
+
+		if(value <= 0.0031308f)
+			return value * 12.92f;
+
+		return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+	}
+
+	static float sRGBToLinear(float value)
+	{
+		if(value <= 0.04045f)
+			return value / 12.92f;
+
+		return std::pow((value + 0.055f) / 1.055f, 2.4f);
+	}
+
+	/**
+	 * @brief	Returns the portion of pixels whose alpha is at least the cutoff value, after multiplying
+	 *			alpha with the provided scale.
+	 */
+	static float calculateAlphaCoverage(const float* pixels, UINT32 numPixels, float cutoff, float scale)
+	{
+		UINT32 numCovered = 0;
+		for(UINT32 i = 0; i < numPixels; i++)
+		{
+			if(pixels[i * 4 + 3] * scale >= cutoff)
+				numCovered++;
+		}
+
+		return numCovered / (float)numPixels;
+	}
+
+	/**
+	 * @brief	Finds a scale for the alpha channel that makes the portion of pixels passing the alpha cutoff
+	 *			as close to the target as possible.
+	 */
+	static float findAlphaCoverageScale(const float* pixels, UINT32 numPixels, float cutoff, float targetCoverage)
+	{
+		const float MAX_SCALE = 16.0f;
+
+		float minScale = 0.0f;
+		float maxScale = MAX_SCALE;
+		float bestScale = 1.0f;
+		float bestError = std::abs(calculateAlphaCoverage(pixels, numPixels, cutoff, 1.0f) - targetCoverage);
+
+		for(UINT32 i = 0; i < 16 && bestError > 0.0f; i++)
+		{
+			float scale = (minScale + maxScale) * 0.5f;
+			float coverage = calculateAlphaCoverage(pixels, numPixels, cutoff, scale);
+
+			float error = std::abs(coverage - targetCoverage);
+			if(error < bestError)
+			{
+				bestError = error;
+				bestScale = scale;
+			}
+
+			if(coverage < targetCoverage)
+				minScale = scale;
+			else
+				maxScale = scale;
+		}
+
+		return bestScale;
+	}
+
+	/**
+	 * @brief	Normalizes a normal stored in RGB channels of a pixel, mapped to [0, 1] range.
+	 */
+	static void normalizeNormal(float* pixel)
+	{
+		float x = pixel[0] * 2.0f - 1.0f;
+		float y = pixel[1] * 2.0f - 1.0f;
+		float z = pixel[2] * 2.0f - 1.0f;
+
+		float length = std::sqrt(x * x + y * y + z * z);
+		if(length <= 0.0001f)
+			return;
+
+		float invLength = 1.0f / length;
+		pixel[0] = x * invLength * 0.5f + 0.5f;
+		pixel[1] = y * invLength * 0.5f + 0.5f;
+		pixel[2] = z * invLength * 0.5f + 0.5f;
+	}
+
+	Vector<PixelDataPtr> MipMapGenerator::generate(const PixelData& src, const MipMapGenOptions& options, PixelFormat dstFormat)
+	{
+		if (src.getDepth() != 1)
+			BS_EXCEPT(InvalidParametersException, "3D textures are not supported.");
+
+		if (PixelUtil::isCompressed(src.getFormat()))
+			BS_EXCEPT(InvalidParametersException, "Source data cannot be compressed.");
+
+		if (dstFormat == PF_UNKNOWN)
+			dstFormat = src.getFormat();
+
+		bool isSRGB = options.isSRGB && !options.isNormalMap;
+		bool normalize = options.isNormalMap && options.normalizeMipmaps;
+		bool isCompressed = PixelUtil::isCompressed(dstFormat);
+		UINT32 dstElemSize = PixelUtil::getNumElemBytes(dstFormat);
+
+		Vector<PixelDataPtr> output;
+
+		PixelDataPtr baseLevel = bs_shared_ptr<PixelData>(src.getWidth(), src.getHeight(), 1, dstFormat);
+		baseLevel->allocateInternalBuffer();
+		PixelUtil::bulkPixelConversion(src, *baseLevel);
+		output.push_back(baseLevel);
+
+		UINT32 numMips = PixelUtil::getMaxMipmaps(src.getWidth(), src.getHeight(), 1, src.getFormat());
+		if (numMips == 0)
+			return output;
+
+		// Filtering happens on unquantized data in linear space, previous level is kept around as the source
+		PixelDataPtr prevLevel = bs_shared_ptr<PixelData>(src.getWidth(), src.getHeight(), 1, PF_FLOAT32_RGBA);
+		prevLevel->allocateInternalBuffer();
+		PixelUtil::bulkPixelConversion(src, *prevLevel);
+
+		if (isSRGB)
+		{
+			float* pixels = (float*)prevLevel->getData();
+			UINT32 width = src.getWidth();
+
+			forEachRowRange(src.getHeight(), [&](UINT32 start, UINT32 end)
+			{
+				for (UINT32 i = start * width; i < end * width; i++)
+				{
+					pixels[i * 4 + 0] = sRGBToLinear(pixels[i * 4 + 0]);
+					pixels[i * 4 + 1] = sRGBToLinear(pixels[i * 4 + 1]);
+					pixels[i * 4 + 2] = sRGBToLinear(pixels[i * 4 + 2]);
+				}
+			});
+		}
+
+		float targetCoverage = 0.0f;
+		if (options.preserveAlphaCoverage)
+		{
+			targetCoverage = calculateAlphaCoverage((float*)prevLevel->getData(), src.getWidth() * src.getHeight(),
+				options.alphaCoverageCutoff, 1.0f);
+		}
+
+		const MipFilterKernel& kernel = FILTER_KERNELS[(UINT32)options.filter];
+
+		UINT32 srcWidth = src.getWidth();
+		UINT32 srcHeight = src.getHeight();
+		for (UINT32 mip = 0; mip < numMips; mip++)
+		{
+			UINT32 dstWidth = std::max(1U, srcWidth / 2);
+			UINT32 dstHeight = std::max(1U, srcHeight / 2);
+
+			FilterTaps horzTaps;
+			calculateFilterTaps(srcWidth, dstWidth, 4, kernel, options.wrapMode, horzTaps);
+
+			FilterTaps vertTaps;
+			calculateFilterTaps(srcHeight, dstHeight, dstWidth * 4, kernel, options.wrapMode, vertTaps);
+
+			// Horizontal pass, downsamples every source row
+			PixelData horzData(dstWidth, srcHeight, 1, PF_FLOAT32_RGBA);
+			horzData.allocateInternalBuffer();
+
+			const float* srcPixels = (const float*)prevLevel->getData();
+			float* horzPixels = (float*)horzData.getData();
+
+			forEachRowRange(srcHeight, [&](UINT32 start, UINT32 end)
+			{
+				for (UINT32 y = start; y < end; y++)
+				{
+					const float* srcRow = srcPixels + y * srcWidth * 4;
+					float* dstRow = horzPixels + y * dstWidth * 4;
+
+					for (UINT32 x = 0; x < dstWidth; x++)
+					{
+						const UINT32* offsets = &horzTaps.offsets[x * horzTaps.numTaps];
+						const float* weights = &horzTaps.weights[x * horzTaps.numTaps];
+
+						float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+						for (UINT32 i = 0; i < horzTaps.numTaps; i++)
+						{
+							const float* pixel = srcRow + offsets[i];
+
+							sum[0] += pixel[0] * weights[i];
+							sum[1] += pixel[1] * weights[i];
+							sum[2] += pixel[2] * weights[i];
+							sum[3] += pixel[3] * weights[i];
+						}
+
+						memcpy(dstRow + x * 4, sum, sizeof(sum));
+					}
+				}
+			});
+
+			// Vertical pass, combines the downsampled rows
+			PixelDataPtr curLevel = bs_shared_ptr<PixelData>(dstWidth, dstHeight, 1, PF_FLOAT32_RGBA);
+			curLevel->allocateInternalBuffer();
+
+			float* dstPixels = (float*)curLevel->getData();
+
+			forEachRowRange(dstHeight, [&](UINT32 start, UINT32 end)
+			{
+				for (UINT32 y = start; y < end; y++)
+				{
+					const UINT32* offsets = &vertTaps.offsets[y * vertTaps.numTaps];
+					const float* weights = &vertTaps.weights[y * vertTaps.numTaps];
+
+					float* dstRow = dstPixels + y * dstWidth * 4;
+					memset(dstRow, 0, dstWidth * 4 * sizeof(float));
+
+					for (UINT32 i = 0; i < vertTaps.numTaps; i++)
+					{
+						if (weights[i] == 0.0f)
+							continue;
+
+						const float* srcRow = horzPixels + offsets[i];
+						for (UINT32 x = 0; x < dstWidth * 4; x++)
+							dstRow[x] += srcRow[x] * weights[i];
+					}
+				}
+			});
+
+			horzData.freeInternalBuffer();
+
+			float alphaScale = 1.0f;
+			if (options.preserveAlphaCoverage)
+				alphaScale = findAlphaCoverageScale(dstPixels, dstWidth * dstHeight, options.alphaCoverageCutoff, targetCoverage);
+
+			// Write the level in destination format, applying post-processing on a copy so the next level
+			// is filtered from the original data
+			PixelDataPtr mipData = bs_shared_ptr<PixelData>(dstWidth, dstHeight, 1, dstFormat);
+			mipData->allocateInternalBuffer();
+
+			bool postProcess = isSRGB || normalize || alphaScale != 1.0f;
+			auto writeRows = [&](UINT32 start, UINT32 end)
+			{
+				UINT32 numPixels = (end - start) * dstWidth;
+				float* rowPixels = dstPixels + start * dstWidth * 4;
+
+				Vector<float> processedPixels;
+				if (postProcess)
+				{
+					processedPixels.assign(rowPixels, rowPixels + numPixels * 4);
+					for (UINT32 i = 0; i < numPixels; i++)
+					{
+						float* pixel = &processedPixels[i * 4];
+
+						if (normalize)
+							normalizeNormal(pixel);
+
+						if (isSRGB)
+						{
+							pixel[0] = linearToSRGB(pixel[0]);
+							pixel[1] = linearToSRGB(pixel[1]);
+							pixel[2] = linearToSRGB(pixel[2]);
+						}
+
+						pixel[3] = std::min(pixel[3] * alphaScale, 1.0f);
+					}
+
+					rowPixels = processedPixels.data();
+				}
+
+				PixelData srcRows(dstWidth, end - start, 1, PF_FLOAT32_RGBA);
+				srcRows.setExternalBuffer((UINT8*)rowPixels);
+
+				PixelData dstRows(dstWidth, end - start, 1, dstFormat);
+				dstRows.setExternalBuffer(mipData->getData() + start * dstWidth * dstElemSize);
+
+				PixelUtil::bulkPixelConversion(srcRows, dstRows);
+			};
+
+			// Compressed formats are encoded in blocks, so they cannot be split into arbitrary row ranges
+			if (isCompressed)
+				writeRows(0, dstHeight);
+			else
+				forEachRowRange(dstHeight, writeRows);
+
+			output.push_back(mipData);
+
+			prevLevel = curLevel;
+			srcWidth = dstWidth;
+			srcHeight = dstHeight;
+		}
+
+		return output;
+	}
+}
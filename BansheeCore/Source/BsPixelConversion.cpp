@@ -0,0 +1,557 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsPixelConversion.h"
+#include "BsBitwise.h"
+
+#include <immintrin.h>
+
+#if BS_COMPILER == BS_COMPILER_MSVC
+#include <intrin.h>
+#define BS_SSE2_FUNC
+#define BS_SSSE3_FUNC
+#define BS_F16C_FUNC
+#else
+#include <cpuid.h>
+#define BS_SSE2_FUNC __attribute__((target("sse2")))
+#define BS_SSSE3_FUNC __attribute__((target("ssse3")))
+#define BS_F16C_FUNC __attribute__((target("f16c")))
+#endif
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Swizzle value signifying the destination channel isn't present in the source
+	 *			and should be set to its maximum value.
+	 */
+	static const UINT8 SWIZZLE_ONE = 0xFF;
+
+	/**
+	 * @brief	Instruction set extensions supported by the CPU.
+	 */
+	struct CPUFeatures
+	{
+		bool sse2;
+		bool ssse3;
+		bool f16c;
+	};
+
+	static CPUFeatures detectCPUFeatures()
+	{
+		UINT32 ecx = 0;
+		UINT32 edx = 0;
+
+#if BS_COMPILER == BS_COMPILER_MSVC
+		int info[4];
+		__cpuid(info, 1);
+
+		ecx = (UINT32)info[2];
+		edx = (UINT32)info[3];
+#else
+		UINT32 eax = 0;
+		UINT32 ebx = 0;
+		__get_cpuid(1, &eax, &ebx, &ecx, &edx);
+#endif
+
+		CPUFeatures features;
+		features.sse2 = (edx & (1 << 26)) != 0;
+		features.ssse3 = (ecx & (1 << 9)) != 0;
+		features.f16c = false;
+
+		// F16C instructions operate on AVX state, so the OS must save it on context switches as well
+		bool hasAVX = (ecx & (1 << 27)) != 0 && (ecx & (1 << 28)) != 0;
+		if(hasAVX && (ecx & (1 << 29)) != 0)
+		{
+#if BS_COMPILER == BS_COMPILER_MSVC
+			UINT64 enabledState = _xgetbv(0);
+#else
+			UINT32 stateLow = 0;
+			UINT32 stateHigh = 0;
+			asm volatile("xgetbv" : "=a" (stateLow), "=d" (stateHigh) : "c" (0));
+			UINT64 enabledState = ((UINT64)stateHigh << 32) | stateLow;
+#endif
+
+			features.f16c = (enabledState & 0x6) == 0x6;
+		}
+
+		return features;
+	}
+
+	/************************************************************************/
+	/* 						8-BIT CHANNEL REORDERING                   		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Reorders channels of pixels with one byte per channel. Each destination byte is copied
+	 *			from the source byte specified by the swizzle, or set to 255 if the swizzle is SWIZZLE_ONE.
+	 *
+	 * @tparam	srcSize	Size of a source pixel in bytes.
+	 * @tparam	dstSize	Size of a destination pixel in bytes.
+	 */
+	template<UINT32 srcSize, UINT32 dstSize>
+	static void swizzleBytes(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		for(UINT32 i = 0; i < numPixels; i++)
+		{
+			for(UINT32 j = 0; j < dstSize; j++)
+				dst[j] = swizzle[j] == SWIZZLE_ONE ? 255 : src[swizzle[j]];
+
+			src += srcSize;
+			dst += dstSize;
+		}
+	}
+
+	/**
+	 * @copydoc	swizzleBytes
+	 *
+	 * @note	Processes as many pixels as fit in a 16 byte register with a single shuffle.
+	 */
+	template<UINT32 srcSize, UINT32 dstSize>
+	BS_SSSE3_FUNC static void swizzleBytesSSSE3(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		const UINT32 pixelsPerStep = 16 / (srcSize > dstSize ? srcSize : dstSize);
+
+		UINT8 shuffleBytes[16];
+		UINT8 constantBytes[16];
+		for(UINT32 i = 0; i < 16; i++)
+		{
+			shuffleBytes[i] = 0x80; // Zeroes the byte
+			constantBytes[i] = 0;
+		}
+
+		for(UINT32 i = 0; i < pixelsPerStep; i++)
+		{
+			for(UINT32 j = 0; j < dstSize; j++)
+			{
+				UINT32 idx = i * dstSize + j;
+
+				if(swizzle[j] == SWIZZLE_ONE)
+					constantBytes[idx] = 0xFF;
+				else
+					shuffleBytes[idx] = (UINT8)(i * srcSize + swizzle[j]);
+			}
+		}
+
+		__m128i shuffle = _mm_loadu_si128((const __m128i*)shuffleBytes);
+		__m128i constant = _mm_loadu_si128((const __m128i*)constantBytes);
+
+		// Loads and stores are always 16 bytes wide, so stop while they still fit within the row. Bytes stored
+		// past the last processed pixel get overwritten by the following step.
+		UINT32 i = 0;
+		for(; (numPixels - i) * srcSize >= 16 && (numPixels - i) * dstSize >= 16; i += pixelsPerStep)
+		{
+			__m128i pixels = _mm_loadu_si128((const __m128i*)src);
+			pixels = _mm_or_si128(_mm_shuffle_epi8(pixels, shuffle), constant);
+			_mm_storeu_si128((__m128i*)dst, pixels);
+
+			src += pixelsPerStep * srcSize;
+			dst += pixelsPerStep * dstSize;
+		}
+
+		swizzleBytes<srcSize, dstSize>(src, dst, numPixels - i, swizzle);
+	}
+
+	/**
+	 * @brief	Helper for reordering bytes within each 32-bit lane using only SSE2 instructions.
+	 */
+	struct SwizzleSSE2
+	{
+		BS_SSE2_FUNC SwizzleSSE2(const UINT8* swizzle)
+		{
+			constant = _mm_setzero_si128();
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				if(swizzle[i] == SWIZZLE_ONE)
+				{
+					isConstant[i] = true;
+					constant = _mm_or_si128(constant, _mm_set1_epi32((int)(0xFFU << (i * 8))));
+				}
+				else
+				{
+					isConstant[i] = false;
+					srcShift[i] = _mm_cvtsi32_si128(swizzle[i] * 8);
+					dstShift[i] = _mm_cvtsi32_si128(i * 8);
+				}
+			}
+		}
+
+		BS_SSE2_FUNC __m128i apply(__m128i pixels) const
+		{
+			const __m128i byteMask = _mm_set1_epi32(0xFF);
+
+			__m128i output = constant;
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				if(isConstant[i])
+					continue;
+
+				__m128i channel = _mm_and_si128(_mm_srl_epi32(pixels, srcShift[i]), byteMask);
+				output = _mm_or_si128(output, _mm_sll_epi32(channel, dstShift[i]));
+			}
+
+			return output;
+		}
+
+		__m128i srcShift[4];
+		__m128i dstShift[4];
+		__m128i constant;
+		bool isConstant[4];
+	};
+
+	/**
+	 * @copydoc	swizzleBytes
+	 *
+	 * @note	Only for four byte source and destination pixels.
+	 */
+	BS_SSE2_FUNC static void swizzleBytes4SSE2(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		SwizzleSSE2 swizzler(swizzle);
+
+		UINT32 i = 0;
+		for(; i + 4 <= numPixels; i += 4)
+		{
+			__m128i pixels = _mm_loadu_si128((const __m128i*)src);
+			_mm_storeu_si128((__m128i*)dst, swizzler.apply(pixels));
+
+			src += 16;
+			dst += 16;
+		}
+
+		swizzleBytes<4, 4>(src, dst, numPixels - i, swizzle);
+	}
+
+	/************************************************************************/
+	/* 						8-BIT <-> FLOAT32 CONVERSION               		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Converts four byte pixels into four channel 32-bit floating point pixels. Each float channel
+	 *			is read from the source byte specified by the swizzle.
+	 */
+	static void bytesToFloats(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		float* dstData = (float*)dst;
+		for(UINT32 i = 0; i < numPixels; i++)
+		{
+			for(UINT32 j = 0; j < 4; j++)
+				dstData[j] = Bitwise::fixedToFloat(src[swizzle[j]], 8);
+
+			src += 4;
+			dstData += 4;
+		}
+	}
+
+	/**
+	 * @copydoc	bytesToFloats
+	 */
+	BS_SSE2_FUNC static void bytesToFloatsSSE2(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		SwizzleSSE2 swizzler(swizzle);
+
+		const __m128i zero = _mm_setzero_si128();
+		const __m128 maxValue = _mm_set1_ps(255.0f);
+
+		float* dstData = (float*)dst;
+
+		UINT32 i = 0;
+		for(; i + 4 <= numPixels; i += 4)
+		{
+			__m128i pixels = swizzler.apply(_mm_loadu_si128((const __m128i*)src));
+
+			__m128i low = _mm_unpacklo_epi8(pixels, zero);
+			__m128i high = _mm_unpackhi_epi8(pixels, zero);
+
+			// Divide instead of multiplying by reciprocal so the results match Bitwise::fixedToFloat exactly
+			_mm_storeu_ps(dstData + 0, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), maxValue));
+			_mm_storeu_ps(dstData + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), maxValue));
+			_mm_storeu_ps(dstData + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), maxValue));
+			_mm_storeu_ps(dstData + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), maxValue));
+
+			src += 16;
+			dstData += 16;
+		}
+
+		bytesToFloats(src, (UINT8*)dstData, numPixels - i, swizzle);
+	}
+
+	/**
+	 * @brief	Converts four channel 32-bit floating point pixels into four byte pixels. Each destination
+	 *			byte is converted from the float channel specified by the swizzle.
+	 */
+	static void floatsToBytes(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		const float* srcData = (const float*)src;
+		for(UINT32 i = 0; i < numPixels; i++)
+		{
+			for(UINT32 j = 0; j < 4; j++)
+				dst[j] = (UINT8)Bitwise::floatToFixed(srcData[swizzle[j]], 8);
+
+			srcData += 4;
+			dst += 4;
+		}
+	}
+
+	/**
+	 * @copydoc	floatsToBytes
+	 */
+	BS_SSE2_FUNC static void floatsToBytesSSE2(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		SwizzleSSE2 swizzler(swizzle);
+
+		// Same as Bitwise::floatToFixed: scale by 256 and clamp, so values in [255/256, 1) map to 255
+		const __m128 scale = _mm_set1_ps(256.0f);
+		const __m128 minValue = _mm_setzero_ps();
+		const __m128 maxValue = _mm_set1_ps(255.0f);
+
+		const float* srcData = (const float*)src;
+
+		UINT32 i = 0;
+		for(; i + 4 <= numPixels; i += 4)
+		{
+			__m128i values[4];
+			for(UINT32 j = 0; j < 4; j++)
+			{
+				__m128 pixel = _mm_mul_ps(_mm_loadu_ps(srcData + j * 4), scale);
+				pixel = _mm_max_ps(_mm_min_ps(pixel, maxValue), minValue);
+
+				values[j] = _mm_cvttps_epi32(pixel);
+			}
+
+			__m128i low = _mm_packs_epi32(values[0], values[1]);
+			__m128i high = _mm_packs_epi32(values[2], values[3]);
+			__m128i pixels = _mm_packus_epi16(low, high);
+
+			_mm_storeu_si128((__m128i*)dst, swizzler.apply(pixels));
+
+			srcData += 16;
+			dst += 16;
+		}
+
+		floatsToBytes((const UINT8*)srcData, dst, numPixels - i, swizzle);
+	}
+
+	/************************************************************************/
+	/* 						FLOAT16 <-> FLOAT32 CONVERSION             		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Converts pixels with 16-bit floating point channels into pixels with the same number
+	 *			of 32-bit floating point channels.
+	 */
+	template<UINT32 numChannels>
+	static void halfsToFloats(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		const UINT16* srcData = (const UINT16*)src;
+		float* dstData = (float*)dst;
+
+		UINT32 numValues = numPixels * numChannels;
+		for(UINT32 i = 0; i < numValues; i++)
+			dstData[i] = Bitwise::halfToFloat(srcData[i]);
+	}
+
+	/**
+	 * @copydoc	halfsToFloats
+	 */
+	template<UINT32 numChannels>
+	BS_F16C_FUNC static void halfsToFloatsF16C(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		const UINT16* srcData = (const UINT16*)src;
+		float* dstData = (float*)dst;
+
+		UINT32 numValues = numPixels * numChannels;
+
+		UINT32 i = 0;
+		for(; i + 4 <= numValues; i += 4)
+			_mm_storeu_ps(dstData + i, _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)(srcData + i))));
+
+		for(; i < numValues; i++)
+			dstData[i] = Bitwise::halfToFloat(srcData[i]);
+	}
+
+	/**
+	 * @brief	Converts pixels with 32-bit floating point channels into pixels with the same number
+	 *			of 16-bit floating point channels.
+	 */
+	template<UINT32 numChannels>
+	static void floatsToHalfs(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		const float* srcData = (const float*)src;
+		UINT16* dstData = (UINT16*)dst;
+
+		UINT32 numValues = numPixels * numChannels;
+		for(UINT32 i = 0; i < numValues; i++)
+			dstData[i] = Bitwise::floatToHalf(srcData[i]);
+	}
+
+	/**
+	 * @copydoc	floatsToHalfs
+	 *
+	 * @note	Rounds towards zero like Bitwise::floatToHalf, but unlike it keeps denormals and
+	 *			clamps out of range values to the largest half instead of infinity.
+	 */
+	template<UINT32 numChannels>
+	BS_F16C_FUNC static void floatsToHalfsF16C(const UINT8* src, UINT8* dst, UINT32 numPixels, const UINT8* swizzle)
+	{
+		const float* srcData = (const float*)src;
+		UINT16* dstData = (UINT16*)dst;
+
+		UINT32 numValues = numPixels * numChannels;
+
+		UINT32 i = 0;
+		for(; i + 4 <= numValues; i += 4)
+			_mm_storel_epi64((__m128i*)(dstData + i), _mm_cvtps_ph(_mm_loadu_ps(srcData + i), _MM_FROUND_TO_ZERO));
+
+		for(; i < numValues; i++)
+			dstData[i] = Bitwise::floatToHalf(srcData[i]);
+	}
+
+	/************************************************************************/
+	/* 								REGISTRY                         		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Contains kernels for all supported format pairs, picked according to the
+	 *			features of the current CPU.
+	 */
+	class PixelConversionRegistry
+	{
+		/**
+		 * @brief	Memory layout of a format with one byte per channel.
+		 */
+		struct ByteLayout
+		{
+			PixelFormat format;
+			UINT32 size;
+			UINT8 channels[4]; /**< Channel stored in each byte, 0 - red, 1 - green, 2 - blue, 3 - alpha. */
+		};
+
+	public:
+		PixelConversionRegistry()
+		{
+			CPUFeatures cpu = detectCPUFeatures();
+
+			// Formats with an X channel are handled by aliasing them with their alpha counterparts
+			static const ByteLayout layouts[] =
+			{
+				{ PF_R8G8B8, 3, { 0, 1, 2, 0 } },
+				{ PF_B8G8R8, 3, { 2, 1, 0, 0 } },
+				{ PF_R8G8B8A8, 4, { 0, 1, 2, 3 } },
+				{ PF_B8G8R8A8, 4, { 2, 1, 0, 3 } },
+				{ PF_A8R8G8B8, 4, { 3, 0, 1, 2 } },
+				{ PF_A8B8G8R8, 4, { 3, 2, 1, 0 } }
+			};
+
+			const UINT32 numLayouts = sizeof(layouts) / sizeof(layouts[0]);
+			for(UINT32 i = 0; i < numLayouts; i++)
+			{
+				const ByteLayout& src = layouts[i];
+
+				for(UINT32 j = 0; j < numLayouts; j++)
+				{
+					const ByteLayout& dst = layouts[j];
+					if(i == j)
+						continue;
+
+					PixelConversionKernel& kernel = mKernels[src.format][dst.format];
+					for(UINT32 k = 0; k < dst.size; k++)
+						kernel.swizzle[k] = findChannel(src, dst.channels[k]);
+
+					kernel.func = getSwizzleFunc(src.size, dst.size, cpu);
+				}
+
+				if(src.size != 4)
+					continue;
+
+				PixelConversionKernel& toFloat = mKernels[src.format][PF_FLOAT32_RGBA];
+				for(UINT8 k = 0; k < 4; k++)
+					toFloat.swizzle[k] = findChannel(src, k);
+
+				toFloat.func = cpu.sse2 ? &bytesToFloatsSSE2 : &bytesToFloats;
+
+				PixelConversionKernel& fromFloat = mKernels[PF_FLOAT32_RGBA][src.format];
+				for(UINT32 k = 0; k < 4; k++)
+					fromFloat.swizzle[k] = src.channels[k];
+
+				fromFloat.func = cpu.sse2 ? &floatsToBytesSSE2 : &floatsToBytes;
+			}
+
+			registerHalfKernels<1>(PF_FLOAT16_R, PF_FLOAT32_R, cpu);
+			registerHalfKernels<2>(PF_FLOAT16_RG, PF_FLOAT32_RG, cpu);
+			registerHalfKernels<3>(PF_FLOAT16_RGB, PF_FLOAT32_RGB, cpu);
+			registerHalfKernels<4>(PF_FLOAT16_RGBA, PF_FLOAT32_RGBA, cpu);
+		}
+
+		/**
+		 * @copydoc	PixelConversion::findKernel
+		 */
+		const PixelConversionKernel* find(PixelFormat srcFormat, PixelFormat dstFormat) const
+		{
+			const PixelConversionKernel& kernel = mKernels[srcFormat][dstFormat];
+			if(kernel.func == nullptr)
+				return nullptr;
+
+			return &kernel;
+		}
+
+	private:
+		/**
+		 * @brief	Returns the index of the byte containing the channel in the provided layout,
+		 *			or SWIZZLE_ONE if the layout doesn't contain the channel.
+		 */
+		static UINT8 findChannel(const ByteLayout& layout, UINT8 channel)
+		{
+			for(UINT32 i = 0; i < layout.size; i++)
+			{
+				if(layout.channels[i] == channel)
+					return (UINT8)i;
+			}
+
+			return SWIZZLE_ONE;
+		}
+
+		/**
+		 * @brief	Returns the fastest channel reordering function for the provided pixel sizes.
+		 */
+		static PixelConversionKernel::Func getSwizzleFunc(UINT32 srcSize, UINT32 dstSize, const CPUFeatures& cpu)
+		{
+			if(srcSize == 3)
+			{
+				if(dstSize == 3)
+					return cpu.ssse3 ? &swizzleBytesSSSE3<3, 3> : &swizzleBytes<3, 3>;
+				else
+					return cpu.ssse3 ? &swizzleBytesSSSE3<3, 4> : &swizzleBytes<3, 4>;
+			}
+			else
+			{
+				if(dstSize == 3)
+					return cpu.ssse3 ? &swizzleBytesSSSE3<4, 3> : &swizzleBytes<4, 3>;
+
+				if(cpu.ssse3)
+					return &swizzleBytesSSSE3<4, 4>;
+
+				return cpu.sse2 ? &swizzleBytes4SSE2 : &swizzleBytes<4, 4>;
+			}
+		}
+
+		/**
+		 * @brief	Registers kernels converting between 16 and 32-bit floating point formats
+		 *			with the same number of channels.
+		 */
+		template<UINT32 numChannels>
+		void registerHalfKernels(PixelFormat halfFormat, PixelFormat floatFormat, const CPUFeatures& cpu)
+		{
+			mKernels[halfFormat][floatFormat].func = cpu.f16c ? &halfsToFloatsF16C<numChannels> : &halfsToFloats<numChannels>;
+			mKernels[floatFormat][halfFormat].func = cpu.f16c ? &floatsToHalfsF16C<numChannels> : &floatsToHalfs<numChannels>;
+		}
+
+		PixelConversionKernel mKernels[PF_COUNT][PF_COUNT];
+	};
+
+	// Constructed on library load, before any conversions can happen
+	static PixelConversionRegistry sRegistry;
+
+	const PixelConversionKernel* PixelConversion::findKernel(PixelFormat srcFormat, PixelFormat dstFormat)
+	{
+		return sRegistry.find(srcFormat, dstFormat);
+	}
+}
@@ -2,6 +2,10 @@
 //_____________________________________ www.banshee-project.com __________________________________________________//
 //________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
 #include "BsPixelUtil.h"
+#include "BsPixelConversion.h"
+#include "BsBlockCompression.h"
+#include "BsMipMapGenerator.h"
+#include "BsSeparableResampler.h"
 #include "BsBitwise.h"
 #include "BsColor.h"
 #include "BsMath.h"
@@ -835,42 +839,6 @@ namespace BansheeEngine
 		UINT8* bufferEnd;
 	};
 
-	/**
-	 * @brief	Handles output from NVTT library for a mip-map chain.
-	 */
-	struct NVTTMipmapOutputHandler : public nvtt::OutputHandler
-	{
-		NVTTMipmapOutputHandler(const Vector<PixelDataPtr>& buffers)
-			:buffers(buffers), bufferWritePos(nullptr), bufferEnd(nullptr)
-		{ }
-
-		virtual void beginImage(int size, int width, int height, int depth, int face, int miplevel)
-		{ 
-			assert(miplevel >= 0 && miplevel < buffers.size());
-			assert(size == buffers[miplevel]->getConsecutiveSize());
-
-			activeBuffer = buffers[miplevel];
-
-			bufferWritePos = activeBuffer->getData();
-			bufferEnd = bufferWritePos + activeBuffer->getConsecutiveSize();
-		}
-
-		virtual bool writeData(const void* data, int size)
-		{
-			assert((bufferWritePos + size) <= bufferEnd);
-			memcpy(bufferWritePos, data, size);
-			bufferWritePos += size;
-
-			return true;
-		}
-
-		Vector<PixelDataPtr> buffers;
-		PixelDataPtr activeBuffer;
-
-		UINT8* bufferWritePos;
-		UINT8* bufferEnd;
-	};
-
 	nvtt::Format toNVTTFormat(PixelFormat format)
 	{
 		switch (format)
@@ -927,22 +895,6 @@ namespace BansheeEngine
 		return nvtt::AlphaMode_None;
 	}
 
-	nvtt::WrapMode toNVTTWrapMode(MipMapWrapMode wrapMode)
-	{
-		switch (wrapMode)
-		{
-		case MipMapWrapMode::Clamp:
-			return nvtt::WrapMode_Clamp;
-		case MipMapWrapMode::Mirror:
-			return nvtt::WrapMode_Mirror;
-		case MipMapWrapMode::Repeat:
-			return nvtt::WrapMode_Repeat;
-		}
-
-		// Unknown alpha mode
-		return nvtt::WrapMode_Mirror;
-	}
-
     UINT32 PixelUtil::getNumElemBytes(PixelFormat format)
     {
         return getDescriptionFor(format).elemBytes;
@@ -1335,7 +1287,7 @@ namespace BansheeEngine
 			   src.getHeight() == dst.getHeight() &&
 			   src.getDepth() == dst.getDepth());
 
-		// Check for compressed formats, we don't support decompression
+		// Check for decompression
 		if(PixelUtil::isCompressed(src.getFormat()))
 		{
 			if(src.getFormat() == dst.getFormat())
@@ -1343,9 +1295,14 @@ namespace BansheeEngine
 				memcpy(dst.getData(), src.getData(), src.getConsecutiveSize());
 				return;
 			}
+			else if(!PixelUtil::isCompressed(dst.getFormat()) && BlockCompression::isSupported(src.getFormat()))
+			{
+				BlockCompression::decompress(src, dst);
+				return;
+			}
 			else
 			{
-				BS_EXCEPT(NotImplementedException, "This method can not be used to compress or decompress images");
+				BS_EXCEPT(NotImplementedException, "This method can not be used to decompress images in this format.");
 			}
 		}
 
@@ -1417,7 +1374,10 @@ namespace BansheeEngine
 			// Do the same conversion, with PF_A8R8G8B8, which has a lot of
 			// optimized conversions
 			PixelFormat tempFormat = dst.getFormat() == PF_X8R8G8B8?PF_A8R8G8B8:PF_A8B8G8R8;
-			PixelData tempdst(dst.getWidth(), dst.getHeight(), dst.getDepth(), tempFormat);
+			PixelData tempdst(dst.getExtents(), tempFormat);
+			tempdst.setRowPitch(dst.getRowPitch());
+			tempdst.setSlicePitch(dst.getSlicePitch());
+			tempdst.setExternalBuffer(dst.getData());
 			bulkPixelConversion(src, tempdst);
 			return;
 		}
@@ -1429,7 +1389,9 @@ namespace BansheeEngine
 			// Do the same conversion, with PF_A8R8G8B8, which has a lot of
 			// optimized conversions
 			PixelFormat tempFormat = src.getFormat()==PF_X8R8G8B8?PF_A8R8G8B8:PF_A8B8G8R8;
-			PixelData tempsrc(src.getWidth(), src.getHeight(), src.getDepth(), tempFormat);
+			PixelData tempsrc(src.getExtents(), tempFormat);
+			tempsrc.setRowPitch(src.getRowPitch());
+			tempsrc.setSlicePitch(src.getSlicePitch());
 			tempsrc.setExternalBuffer(src.getData());
 			bulkPixelConversion(tempsrc, dst);
 			return;
@@ -1448,6 +1410,30 @@ namespace BansheeEngine
 		const UINT32 dstRowSkipBytes = dst.getRowSkip()*dstPixelSize;
 		const UINT32 dstSliceSkipBytes = dst.getSliceSkip()*dstPixelSize;
 
+		// Use a specialized routine converting whole rows at once, if there is one for this pair of formats
+		const PixelConversionKernel* kernel = PixelConversion::findKernel(src.getFormat(), dst.getFormat());
+		if(kernel != nullptr)
+		{
+			const UINT32 srcRowPitchBytes = src.getRowPitch()*srcPixelSize;
+			const UINT32 dstRowPitchBytes = dst.getRowPitch()*dstPixelSize;
+
+			for (UINT32 z = src.getFront(); z < src.getBack(); z++)
+			{
+				for (UINT32 y = src.getTop(); y < src.getBottom(); y++)
+				{
+					kernel->convert(srcptr, dstptr, src.getWidth());
+
+					srcptr += srcRowPitchBytes;
+					dstptr += dstRowPitchBytes;
+				}
+
+				srcptr += srcSliceSkipBytes;
+				dstptr += dstSliceSkipBytes;
+			}
+
+			return;
+		}
+
         // The brute force fallback
         float r,g,b,a;
 		for (UINT32 z = src.getFront(); z<src.getBack(); z++)
@@ -1520,6 +1506,17 @@ namespace BansheeEngine
 
 			break;
 
+		case FILTER_BICUBIC:
+		case FILTER_MITCHELL:
+		case FILTER_LANCZOS3:
+		case FILTER_AREA:
+			if (src.getDepth() == 1 && scaled.getDepth() == 1)
+			{
+				SeparableResampler::scale(src, scaled, filter);
+				break;
+			}
+
+			// Else, fall through to linear filtering
 		case FILTER_LINEAR:
 			switch (src.getFormat()) 
 			{
@@ -1633,6 +1630,27 @@ namespace BansheeEngine
 		if (isCompressed(src.getFormat()))
 			BS_EXCEPT(InvalidParametersException, "Source data cannot be compressed.");
 
+		if (options.backend == CompressionBackend::Builtin)
+		{
+			if (!BlockCompression::isSupported(pf))
+				BS_EXCEPT(InvalidParametersException, "Specified format is not supported by the built-in compressor.");
+
+			if (options.alphaMode != AlphaMode::None)
+				BS_EXCEPT(InvalidParametersException, "Built-in compressor doesn't support alpha modes.");
+
+			if (options.isSRGB)
+				BS_EXCEPT(InvalidParametersException, "Built-in compressor doesn't support sRGB data.");
+
+			if (options.isNormalMap && pf != PF_BC4 && pf != PF_BC5)
+				BS_EXCEPT(InvalidParametersException, "Built-in compressor only supports normal maps in BC4 and BC5 formats.");
+
+			PixelData output(src.getWidth(), src.getHeight(), 1, pf);
+			output.setExternalBuffer(dst.getData());
+
+			BlockCompression::compress(src, output, options.quality != CompressionQuality::Fastest);
+			return;
+		}
+
 		PixelData bgraData(src.getWidth(), src.getHeight(), 1, PF_B8G8R8A8);
 		bgraData.allocateInternalBuffer();
 		bulkPixelConversion(src, bgraData);
@@ -1664,83 +1682,8 @@ namespace BansheeEngine
 			BS_EXCEPT(InternalErrorException, "Compressing failed.");
 	}
 
-	Vector<PixelDataPtr> PixelUtil::genMipmaps(const PixelData& src, const MipMapGenOptions& options)
+	Vector<PixelDataPtr> PixelUtil::genMipmaps(const PixelData& src, const MipMapGenOptions& options, PixelFormat dstFormat)
 	{
-		if (src.getDepth() != 1)
-			BS_EXCEPT(InvalidParametersException, "3D textures are not supported.");
-
-		// Note: Add support for floating point mips, no reason they shouldn't be supported other than
-		// nvtt doesn't support them natively
-		if (isCompressed(src.getFormat()) || isFloatingPoint(src.getFormat()))
-			BS_EXCEPT(InvalidParametersException, "Source data cannot be compressed or in floating point format.");
-
-		if (!Math::isPow2(src.getWidth()) || !Math::isPow2(src.getHeight()))
-			BS_EXCEPT(InvalidParametersException, "Texture width & height must be powers of 2.");
-
-		PixelData argbData(src.getWidth(), src.getHeight(), 1, PF_A8R8G8B8);
-		argbData.allocateInternalBuffer();
-		bulkPixelConversion(src, argbData);
-
-		nvtt::InputOptions io;
-		io.setTextureLayout(nvtt::TextureType_2D, src.getWidth(), src.getHeight());
-		io.setMipmapData(argbData.getData(), src.getWidth(), src.getHeight());
-		io.setMipmapGeneration(true);
-		io.setNormalMap(options.isNormalMap);
-		io.setNormalizeMipmaps(options.normalizeMipmaps);
-		io.setWrapMode(toNVTTWrapMode(options.wrapMode));
-
-		nvtt::CompressionOptions co;
-		co.setFormat(nvtt::Format_RGBA);
-		
-		UINT32 numMips = getMaxMipmaps(src.getWidth(), src.getHeight(), 1, src.getFormat());
-
-		Vector<PixelDataPtr> argbMipBuffers;
-
-		// Note: This can be done more effectively without creating so many temp buffers
-		// and working with the original formats directly, but it would complicate the code
-		// too much at the moment.
-		UINT32 curWidth = src.getWidth();
-		UINT32 curHeight = src.getHeight();
-		for (UINT32 i = 0; i < numMips; i++)
-		{
-			argbMipBuffers.push_back(bs_shared_ptr<PixelData>(curWidth, curHeight, 1, PF_A8R8G8B8));
-			argbMipBuffers.back()->allocateInternalBuffer();
-
-			if (curWidth > 1) 
-				curWidth = curWidth / 2;
-
-			if (curHeight > 1)
-				curHeight = curHeight / 2;
-		}
-
-		argbMipBuffers.push_back(bs_shared_ptr<PixelData>(curWidth, curHeight, 1, PF_A8R8G8B8));
-		argbMipBuffers.back()->allocateInternalBuffer();
-
-		NVTTMipmapOutputHandler outputHandler(argbMipBuffers);
-
-		nvtt::OutputOptions oo;
-		oo.setOutputHeader(false);
-		oo.setOutputHandler(&outputHandler);
-
-		nvtt::Compressor compressor;
-		if (!compressor.process(io, co, oo))
-			BS_EXCEPT(InternalErrorException, "Mipmap generation failed.");
-
-		argbData.freeInternalBuffer();
-
-		Vector<PixelDataPtr> outputMipBuffers;
-		for (UINT32 i = 0; i < (UINT32)argbMipBuffers.size(); i++)
-		{
-			PixelDataPtr argbBuffer = argbMipBuffers[i];
-			PixelDataPtr outputBuffer = bs_shared_ptr<PixelData>(argbBuffer->getWidth(), argbBuffer->getHeight(), 1, src.getFormat());
-			outputBuffer->allocateInternalBuffer();
-
-			bulkPixelConversion(*argbBuffer, *outputBuffer);
-			argbBuffer->freeInternalBuffer();
-
-			outputMipBuffers.push_back(outputBuffer);
-		}
-
-		return outputMipBuffers;
+		return MipMapGenerator::generate(src, options, dstFormat);
 	}
 }
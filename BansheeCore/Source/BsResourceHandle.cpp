@@ -19,7 +19,27 @@ namespace BansheeEngine
 
 	ResourceHandleBase::~ResourceHandleBase() 
 	{ 
+		releaseData();
+	}
+
+	ResourceHandleBase& ResourceHandleBase::operator=(const ResourceHandleBase& other)
+	{
+		if(mData != other.mData)
+		{
+			releaseData();
+			mData = other.mData;
+		}
 
+		return *this;
+	}
+
+	void ResourceHandleBase::releaseData()
+	{
+		// The other remaining reference is the one held by Resources, which the budget may now unload
+		if(mData != nullptr && mData->mIsCreated && mData.use_count() == 2 && Resources::isStarted())
+			gResources()._notifyHandleReleased(mData->mUUID);
+
+		mData = nullptr;
 	}
 
 	bool ResourceHandleBase::isLoaded() const 
@@ -44,7 +64,7 @@ namespace BansheeEngine
 		mData->mPtr->synchronize();
 	}
 
-	void ResourceHandleBase::_setHandleData(std::shared_ptr<Resource> ptr, const String& uuid)
+	void ResourceHandleBase::_setHandleData(std::shared_ptr<Resource> ptr, const Guid& uuid)
 	{
 		mData->mPtr = ptr;
 
@@ -30,7 +30,7 @@ namespace BansheeEngine
 		return bs_shared_ptr<ResourceManifest>(ConstructPrivately());
 	}
 
-	void ResourceManifest::registerResource(const String& uuid, const Path& filePath)
+	void ResourceManifest::registerResource(const Guid& uuid, const Path& filePath)
 	{
 		auto iterFind = mUUIDToFilePath.find(uuid);
 
@@ -51,7 +51,7 @@ namespace BansheeEngine
 		}
 	}
 
-	void ResourceManifest::unregisterResource(const String& uuid)
+	void ResourceManifest::unregisterResource(const Guid& uuid)
 	{
 		auto iterFind = mUUIDToFilePath.find(uuid);
 
@@ -62,7 +62,7 @@ namespace BansheeEngine
 		}
 	}
 
-	bool ResourceManifest::uuidToFilePath(const String& uuid, Path& filePath) const
+	bool ResourceManifest::uuidToFilePath(const Guid& uuid, Path& filePath) const
 	{
 		auto iterFind = mUUIDToFilePath.find(uuid);
 
@@ -78,7 +78,7 @@ namespace BansheeEngine
 		}
 	}
 
-	bool ResourceManifest::filePathToUUID(const Path& filePath, String& outUUID) const
+	bool ResourceManifest::filePathToUUID(const Path& filePath, Guid& outUUID) const
 	{
 		auto iterFind = mFilePathToUUID.find(filePath);
 
@@ -89,12 +89,12 @@ namespace BansheeEngine
 		}
 		else
 		{
-			outUUID = StringUtil::BLANK;
+			outUUID = Guid::EMPTY;
 			return false;
 		}
 	}
 
-	bool ResourceManifest::uuidExists(const String& uuid) const
+	bool ResourceManifest::uuidExists(const Guid& uuid) const
 	{
 		auto iterFind = mUUIDToFilePath.find(uuid);
 
@@ -138,6 +138,17 @@ namespace BansheeEngine
 			copy->mUUIDToFilePath[elem.first] = elementRelativePath;
 		}
 
+		if(manifest->isPackaged())
+		{
+			if(!relativePath.includes(manifest->mPackagePath))
+			{
+				BS_EXCEPT(InvalidStateException, "Path in resource manifest cannot be made relative to: \"" + 
+					relativePath.toString() + "\". Path: \"" + manifest->mPackagePath.toString() + "\"");
+			}
+
+			copy->mPackagePath = manifest->mPackagePath.getRelative(relativePath);
+		}
+
 		FileSerializer fs;
 		fs.encode(copy.get(), path);
 	}
@@ -161,6 +172,9 @@ namespace BansheeEngine
 			copy->mUUIDToFilePath[elem.first] = absPath;
 		}
 
+		if(manifest->isPackaged())
+			copy->mPackagePath = manifest->mPackagePath.getAbsolute(relativePath);
+
 		return copy;
 	}
 
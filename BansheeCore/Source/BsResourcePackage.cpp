@@ -0,0 +1,236 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsResourcePackage.h"
+#include "BsResource.h"
+#include "BsResourceManifest.h"
+#include "BsMappedFile.h"
+#include "BsCompression.h"
+#include "BsMemorySerializer.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsException.h"
+
+namespace BansheeEngine
+{
+	// Archive layout:
+	//  - Header: magic, version, number of entries, reserved (4x UINT32)
+	//  - Table of contents: one entry per resource, sorted by UUID
+	//  - Resource data, each entry aligned to DATA_ALIGNMENT
+	const UINT32 ResourcePackage::MAGIC = 0x4B505342; // "BSPK"
+	const UINT32 ResourcePackage::VERSION = 1;
+	const UINT32 ResourcePackage::HEADER_SIZE = 4 * sizeof(UINT32);
+	const UINT32 ResourcePackage::TOC_ENTRY_SIZE = sizeof(Guid) + sizeof(UINT64) + 4 * sizeof(UINT32);
+	const UINT32 ResourcePackage::DATA_ALIGNMENT = 16;
+
+	ResourcePackage::ResourcePackage(const Path& path)
+		:mPath(path)
+	{
+		mFile = bs_shared_ptr<MappedFile>(path);
+
+		const UINT8* data = mFile->getData();
+		UINT64 fileSize = mFile->getSize();
+
+		if (fileSize < HEADER_SIZE)
+			BS_EXCEPT(InternalErrorException, "Invalid resource package: " + path.toString());
+
+		UINT32 header[4];
+		memcpy(header, data, sizeof(header));
+
+		if (header[0] != MAGIC)
+			BS_EXCEPT(InternalErrorException, "File is not a resource package: " + path.toString());
+
+		if (header[1] != VERSION)
+			BS_EXCEPT(InternalErrorException, "Unsupported resource package version: " + toString(header[1]));
+
+		UINT32 numEntries = header[2];
+		if (fileSize < HEADER_SIZE + (UINT64)numEntries * TOC_ENTRY_SIZE)
+			BS_EXCEPT(InternalErrorException, "Resource package table of contents is truncated: " + path.toString());
+
+		mEntries.resize(numEntries);
+
+		const UINT8* tocData = data + HEADER_SIZE;
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			Entry& entry = mEntries[i];
+
+			memcpy(&entry.uuid, tocData, sizeof(Guid));
+			tocData += sizeof(Guid);
+
+			memcpy(&entry.offset, tocData, sizeof(UINT64));
+			tocData += sizeof(UINT64);
+
+			memcpy(&entry.size, tocData, sizeof(UINT32));
+			tocData += sizeof(UINT32);
+
+			memcpy(&entry.uncompressedSize, tocData, sizeof(UINT32));
+			tocData += sizeof(UINT32);
+
+			memcpy(&entry.flags, tocData, sizeof(UINT32));
+			tocData += 2 * sizeof(UINT32); // Skip padding
+
+			if (entry.offset + entry.size > fileSize)
+				BS_EXCEPT(InternalErrorException, "Resource package entry out of bounds: " + path.toString());
+		}
+	}
+
+	bool ResourcePackage::contains(const Guid& uuid) const
+	{
+		return findEntry(uuid) != nullptr;
+	}
+
+	const ResourcePackage::Entry* ResourcePackage::findEntry(const Guid& uuid) const
+	{
+		auto iterFind = std::lower_bound(mEntries.begin(), mEntries.end(), uuid,
+			[](const Entry& entry, const Guid& value) { return entry.uuid < value; });
+
+		if (iterFind == mEntries.end() || iterFind->uuid != uuid)
+			return nullptr;
+
+		return &(*iterFind);
+	}
+
+	ResourcePtr ResourcePackage::load(const Guid& uuid) const
+	{
+		const Entry* entry = findEntry(uuid);
+		if (entry == nullptr)
+			BS_EXCEPT(InvalidParametersException, "Resource with UUID '" + uuid.toString() + "' is not in package: " + mPath.toString());
+
+		// Serializer only reads from the buffer, so uncompressed entries are decoded straight from mapped memory
+		UINT8* entryData = const_cast<UINT8*>(mFile->getData() + entry->offset);
+
+		MemorySerializer ms;
+		std::shared_ptr<IReflectable> loadedData;
+		if ((entry->flags & EF_Compressed) != 0)
+		{
+			UINT8* buffer = (UINT8*)bs_alloc<ScratchAlloc>(entry->uncompressedSize);
+
+			if (!Compression::decompress(entryData, entry->size, buffer, entry->uncompressedSize))
+			{
+				bs_free<ScratchAlloc>(buffer);
+				BS_EXCEPT(InternalErrorException, "Resource package entry is corrupt: " + uuid.toString());
+			}
+
+			loadedData = ms.decode(buffer, entry->uncompressedSize);
+			bs_free<ScratchAlloc>(buffer);
+		}
+		else
+			loadedData = ms.decode(entryData, entry->size);
+
+		if (loadedData == nullptr)
+			BS_EXCEPT(InternalErrorException, "Unable to load resource.");
+
+		if (!loadedData->isDerivedFrom(Resource::getRTTIStatic()))
+			BS_EXCEPT(InternalErrorException, "Loaded class doesn't derive from Resource.");
+
+		return std::static_pointer_cast<Resource>(loadedData);
+	}
+
+	ResourcePackagePtr ResourcePackage::open(const Path& path)
+	{
+		return bs_shared_ptr<ResourcePackage>(path);
+	}
+
+	void ResourcePackage::build(const ResourceManifestPtr& manifest, const Path& path, bool compress)
+	{
+		Vector<std::pair<Guid, Path>> resources(manifest->mUUIDToFilePath.begin(), manifest->mUUIDToFilePath.end());
+		std::sort(resources.begin(), resources.end(),
+			[](const std::pair<Guid, Path>& a, const std::pair<Guid, Path>& b) { return a.first < b.first; });
+
+		UINT32 numEntries = (UINT32)resources.size();
+		UINT64 tocEnd = HEADER_SIZE + (UINT64)numEntries * TOC_ENTRY_SIZE;
+
+		if (FileSystem::isFile(path))
+			FileSystem::remove(path);
+
+		DataStreamPtr stream = FileSystem::createAndOpenFile(path);
+
+		// Table of contents is written last, once all offsets are known
+		UINT8 padding[DATA_ALIGNMENT];
+		memset(padding, 0, sizeof(padding));
+
+		UINT64 offset = tocEnd;
+		for (UINT64 i = 0; i < tocEnd; i += DATA_ALIGNMENT)
+			stream->write(padding, (size_t)std::min((UINT64)DATA_ALIGNMENT, tocEnd - i));
+
+		Vector<Entry> entries(numEntries);
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			const Path& filePath = resources[i].second;
+
+			UINT64 fileSize = FileSystem::getFileSize(filePath);
+			if (fileSize > std::numeric_limits<UINT32>::max())
+				BS_EXCEPT(InternalErrorException, "Resource file too large to be packaged: " + filePath.toString());
+
+			UINT32 size = (UINT32)fileSize;
+			UINT8* fileData = (UINT8*)bs_alloc<ScratchAlloc>(size);
+
+			DataStreamPtr fileStream = FileSystem::openFile(filePath);
+			fileStream->read(fileData, size);
+			fileStream->close();
+
+			UINT32 alignedOffset = (UINT32)((DATA_ALIGNMENT - (offset % DATA_ALIGNMENT)) % DATA_ALIGNMENT);
+			if (alignedOffset > 0)
+			{
+				stream->write(padding, alignedOffset);
+				offset += alignedOffset;
+			}
+
+			Entry& entry = entries[i];
+			entry.uuid = resources[i].first;
+			entry.offset = offset;
+			entry.uncompressedSize = size;
+			entry.flags = 0;
+
+			UINT8* compressedData = nullptr;
+			UINT32 compressedSize = 0;
+			if (compress && size > 0)
+			{
+				compressedData = (UINT8*)bs_alloc<ScratchAlloc>(Compression::getMaxCompressedSize(size));
+				compressedSize = Compression::compress(fileData, size, compressedData);
+			}
+
+			// Only keep compressed data if it saves at least an eighth of the space, otherwise decompression isn't worth it
+			if (compressedData != nullptr && compressedSize < (size - size / 8))
+			{
+				stream->write(compressedData, compressedSize);
+
+				entry.size = compressedSize;
+				entry.flags |= EF_Compressed;
+			}
+			else
+			{
+				stream->write(fileData, size);
+				entry.size = size;
+			}
+
+			offset += entry.size;
+
+			if (compressedData != nullptr)
+				bs_free<ScratchAlloc>(compressedData);
+
+			bs_free<ScratchAlloc>(fileData);
+		}
+
+		stream->seek(0);
+
+		UINT32 header[4] = { MAGIC, VERSION, numEntries, 0 };
+		stream->write(header, sizeof(header));
+
+		for (auto& entry : entries)
+		{
+			UINT32 entryPadding = 0;
+
+			stream->write(&entry.uuid, sizeof(Guid));
+			stream->write(&entry.offset, sizeof(UINT64));
+			stream->write(&entry.size, sizeof(UINT32));
+			stream->write(&entry.uncompressedSize, sizeof(UINT32));
+			stream->write(&entry.flags, sizeof(UINT32));
+			stream->write(&entryPadding, sizeof(UINT32));
+		}
+
+		stream->close();
+
+		manifest->setPackagePath(path);
+	}
+}
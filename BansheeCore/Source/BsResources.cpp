@@ -4,6 +4,7 @@
 #include "BsResources.h"
 #include "BsResource.h"
 #include "BsResourceManifest.h"
+#include "BsResourcePackage.h"
 #include "BsException.h"
 #include "BsFileSerializer.h"
 #include "BsFileSystem.h"
@@ -11,10 +12,12 @@
 #include "BsUUID.h"
 #include "BsPath.h"
 #include "BsDebug.h"
+#include "BsRTTIType.h"
 
 namespace BansheeEngine
 {
 	Resources::Resources()
+		:mResidentBytes(0), mMemoryBudget(0)
 	{
 		mDefaultResourceManifest = ResourceManifest::create("Default");
 		mResourceManifests.push_back(mDefaultResourceManifest);
@@ -23,14 +26,14 @@ namespace BansheeEngine
 	Resources::~Resources()
 	{
 		// Unload and invalidate all resources
-		UnorderedMap<String, HResource> loadedResourcesCopy = mLoadedResources;
+		UnorderedMap<Guid, HResource> loadedResourcesCopy = mLoadedResources;
 
 		for (auto& loadedResourcePair : loadedResourcesCopy)
 		{
 			unload(loadedResourcePair.second);
 
 			// Invalidate the handle
-			loadedResourcePair.second._setHandleData(nullptr, "");
+			loadedResourcePair.second._setHandleData(nullptr, Guid::EMPTY);
 		}
 	}
 
@@ -44,70 +47,53 @@ namespace BansheeEngine
 		return loadInternal(filePath, false);
 	}
 
-	HResource Resources::loadFromUUID(const String& uuid)
+	HResource Resources::loadFromUUID(const Guid& uuid)
 	{
+		// Check the cache first so resolving handles to already loaded resources doesn't need to go through manifests
+		HResource existingResource = findLoaded(uuid, true);
+		if(existingResource.getHandleData() != nullptr)
+			return existingResource;
+
 		Path filePath;
-		bool foundPath = false;
 
 		// Default manifest is at 0th index but all other take priority since Default manifest could
 		// contain obsolete data. 
-		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
+		if(!getFilePathFromUUID(uuid, filePath))
 		{
-			if((*iter)->uuidToFilePath(uuid, filePath))
-			{
-				foundPath = true;
-				break;
-			}
-		}
-
-		if(!foundPath)
-		{
-			gDebug().logWarning("Cannot load resource. Resource with UUID '" + uuid + "' doesn't exist.");
+			gDebug().logWarning("Cannot load resource. Resource with UUID '" + uuid.toString() + "' doesn't exist.");
 			return HResource();
 		}
 
-		return load(filePath);
+		return loadInternal(uuid, filePath, true);
 	}
 
-	HResource Resources::loadFromUUIDAsync(const String& uuid)
+	HResource Resources::loadFromUUIDAsync(const Guid& uuid)
 	{
-		Path filePath;
-		bool foundPath = false;
-
-		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
-		{
-			if((*iter)->uuidToFilePath(uuid, filePath))
-			{
-				foundPath = true;
-				break;
-			}
-		}
+		HResource existingResource = findLoaded(uuid, false);
+		if(existingResource.getHandleData() != nullptr)
+			return existingResource;
 
-		if(!foundPath)
+		Path filePath;
+		if(!getFilePathFromUUID(uuid, filePath))
 		{
-			gDebug().logWarning("Cannot load resource. Resource with UUID '" + uuid + "' doesn't exist.");
+			gDebug().logWarning("Cannot load resource. Resource with UUID '" + uuid.toString() + "' doesn't exist.");
 			return HResource();
 		}
 
-		return loadAsync(filePath);
+		return loadInternal(uuid, filePath, false);
 	}
 
 	HResource Resources::loadInternal(const Path& filePath, bool synchronous)
 	{
-		String uuid;
-		bool foundUUID = false;
-		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
-		{
-			if((*iter)->filePathToUUID(filePath, uuid))
-			{
-				foundUUID = true;
-				break;
-			}
-		}
-
-		if(!foundUUID)
+		Guid uuid;
+		if(!getUUIDFromFilePath(filePath, uuid))
 			uuid = UUIDGenerator::instance().generateRandom();
 
+		return loadInternal(uuid, filePath, synchronous);
+	}
+
+	HResource Resources::findLoaded(const Guid& uuid, bool synchronous)
+	{
 		{
 			BS_LOCK_MUTEX(mLoadedResourceMutex);
 			auto iterFind = mLoadedResources.find(uuid);
@@ -132,18 +118,22 @@ namespace BansheeEngine
 
 		if(resourceLoadingInProgress) // We're already loading this resource
 		{
-			if(!synchronous)
-				return existingResource;
-			else
-			{
-				// Previously being loaded as async but now we want it synced, so we wait
+			// Previously being loaded as async but now we want it synced, so we wait
+			if(synchronous)
 				existingResource.synchronize();
-
-				return existingResource;
-			}
 		}
 
-		if(!FileSystem::isFile(filePath))
+		return existingResource;
+	}
+
+	HResource Resources::loadInternal(const Guid& uuid, const Path& filePath, bool synchronous)
+	{
+		HResource existingResource = findLoaded(uuid, synchronous);
+		if(existingResource.getHandleData() != nullptr)
+			return existingResource;
+
+		ResourcePackagePtr package = findPackage(uuid);
+		if(package == nullptr && !FileSystem::isFile(filePath))
 		{
 			gDebug().logWarning("Specified file: " + filePath.toString() + " doesn't exist.");
 			return HResource();
@@ -158,20 +148,42 @@ namespace BansheeEngine
 
 		if(synchronous)
 		{
-			loadCallback(filePath, newResource);
+			loadCallback(filePath, package, newResource);
 		}
 		else
 		{
 			String fileName = filePath.getFilename();
 			String taskName = "Resource load: " + fileName;
 
-			TaskPtr task = Task::create(taskName, std::bind(&Resources::loadCallback, this, filePath, newResource));
+			TaskPtr task = Task::create(taskName, std::bind(&Resources::loadCallback, this, filePath, package, newResource));
 			TaskScheduler::instance().addTask(task);
 		}
 
 		return newResource;
 	}
 
+	ResourcePackagePtr Resources::findPackage(const Guid& uuid) const
+	{
+		// Same priority as when resolving file paths, so a loose file in a later manifest overrides a packaged one
+		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
+		{
+			const ResourceManifestPtr& manifest = *iter;
+			if(!manifest->uuidExists(uuid))
+				continue;
+
+			if(!manifest->isPackaged())
+				return nullptr;
+
+			auto iterFind = mResourcePackages.find(manifest->getName());
+			if(iterFind == mResourcePackages.end() || !iterFind->second->contains(uuid))
+				return nullptr;
+
+			return iterFind->second;
+		}
+
+		return nullptr;
+	}
+
 	ResourcePtr Resources::loadFromDiskAndDeserialize(const Path& filePath)
 	{
 		FileSerializer fs;
@@ -197,6 +209,7 @@ namespace BansheeEngine
 		{
 			BS_LOCK_MUTEX(mLoadedResourceMutex);
 			mLoadedResources.erase(resource.getUUID());
+			removeResidency(resource.getUUID());
 		}
 	}
 
@@ -219,6 +232,148 @@ namespace BansheeEngine
 		}
 	}
 
+	void Resources::setMemoryBudget(UINT64 numBytes)
+	{
+		BS_LOCK_MUTEX(mLoadedResourceMutex);
+		mMemoryBudget = numBytes;
+	}
+
+	UINT64 Resources::getMemoryBudget() const
+	{
+		BS_LOCK_MUTEX(mLoadedResourceMutex);
+		return mMemoryBudget;
+	}
+
+	UINT64 Resources::getResidentBytes() const
+	{
+		BS_LOCK_MUTEX(mLoadedResourceMutex);
+		return mResidentBytes;
+	}
+
+	Map<UINT32, ResourceMemoryStats> Resources::getResidentMemoryPerType() const
+	{
+		Map<UINT32, ResourceMemoryStats> output;
+
+		BS_LOCK_MUTEX(mLoadedResourceMutex);
+		for(auto& entry : mResidency)
+		{
+			const ResidencyData& residency = entry.second;
+			ResourceMemoryStats& stats = output[residency.typeId];
+
+			stats.numResources++;
+			stats.cpuBytes += residency.cpuBytes;
+			stats.gpuBytes += residency.gpuBytes;
+		}
+
+		return output;
+	}
+
+	void Resources::_update()
+	{
+		Vector<Guid> releasedResources;
+
+		{
+			BS_LOCK_MUTEX(mReleasedResourcesMutex);
+			std::swap(releasedResources, mReleasedResources);
+		}
+
+		Vector<HResource> resourcesToUnload;
+
+		{
+			BS_LOCK_MUTEX(mLoadedResourceMutex);
+
+			// Resources are queued in the order they were released, so moving each one to the front keeps
+			// the unused list sorted from most to least recently released
+			for(auto& uuid : releasedResources)
+			{
+				auto iterFind = mResidency.find(uuid);
+				if(iterFind == mResidency.end())
+					continue;
+
+				// Only resources we can find again through a manifest may be unloaded
+				Path filePath;
+				if(!getFilePathFromUUID(uuid, filePath))
+					continue;
+
+				ResidencyData& residency = iterFind->second;
+				if(residency.isUnused)
+					mUnusedResources.erase(residency.unusedIter);
+
+				mUnusedResources.push_front(uuid);
+				residency.unusedIter = mUnusedResources.begin();
+				residency.isUnused = true;
+			}
+
+			if(mMemoryBudget == 0 || mResidentBytes <= mMemoryBudget)
+				return;
+
+			UINT64 residentBytes = mResidentBytes;
+			auto iter = mUnusedResources.end();
+			while(iter != mUnusedResources.begin() && residentBytes > mMemoryBudget)
+			{
+				--iter;
+
+				ResidencyData& residency = mResidency[*iter];
+
+				auto iterFindLoaded = mLoadedResources.find(*iter);
+				bool isUnused = false;
+				if(iterFindLoaded != mLoadedResources.end())
+				{
+					const HResource& handle = iterFindLoaded->second;
+					isUnused = handle.getHandleData().unique() && handle.isLoaded() && handle.getInternalPtr().unique();
+				}
+
+				// Referenced again since it was released. It will be queued again once its handles are released.
+				if(!isUnused)
+				{
+					residency.isUnused = false;
+					iter = mUnusedResources.erase(iter);
+					continue;
+				}
+
+				residentBytes -= residency.cpuBytes + residency.gpuBytes;
+				resourcesToUnload.push_back(iterFindLoaded->second);
+			}
+		}
+
+		for(auto& resource : resourcesToUnload)
+			unload(resource);
+	}
+
+	void Resources::_notifyHandleReleased(const Guid& uuid)
+	{
+		BS_LOCK_MUTEX(mReleasedResourcesMutex);
+		mReleasedResources.push_back(uuid);
+	}
+
+	void Resources::addResidency(const Guid& uuid, const ResourcePtr& resource)
+	{
+		removeResidency(uuid);
+
+		ResidencyData residency;
+		residency.typeId = resource->getRTTI()->getRTTIId();
+		residency.cpuBytes = resource->getCPUMemorySize();
+		residency.gpuBytes = resource->getGPUMemorySize();
+		residency.isUnused = false;
+
+		mResidency[uuid] = residency;
+		mResidentBytes += residency.cpuBytes + residency.gpuBytes;
+	}
+
+	void Resources::removeResidency(const Guid& uuid)
+	{
+		auto iterFind = mResidency.find(uuid);
+		if(iterFind == mResidency.end())
+			return;
+
+		ResidencyData& residency = iterFind->second;
+		if(residency.isUnused)
+			mUnusedResources.erase(residency.unusedIter);
+
+		mResidentBytes -= residency.cpuBytes + residency.gpuBytes;
+		mResidency.erase(iterFind);
+	}
+
 	void Resources::save(HResource resource, const Path& filePath, bool overwrite)
 	{
 		if(!resource.isLoaded())
@@ -249,6 +404,15 @@ namespace BansheeEngine
 			mResourceManifests.push_back(manifest);
 		else
 			*findIter = manifest;
+
+		if(manifest->isPackaged())
+		{
+			auto iterFind = mResourcePackages.find(manifest->getName());
+			if(iterFind == mResourcePackages.end() || iterFind->second->getPath() != manifest->getPackagePath())
+				mResourcePackages[manifest->getName()] = ResourcePackage::open(manifest->getPackagePath());
+		}
+		else
+			mResourcePackages.erase(manifest->getName());
 	}
 
 	ResourceManifestPtr Resources::getResourceManifest(const String& name) const
@@ -264,19 +428,20 @@ namespace BansheeEngine
 
 	HResource Resources::_createResourceHandle(const ResourcePtr& obj)
 	{
-		String uuid = UUIDGenerator::instance().generateRandom();
+		Guid uuid = UUIDGenerator::instance().generateRandom();
 		HResource newHandle(obj, uuid);
 
 		{
 			BS_LOCK_MUTEX(mLoadedResourceMutex);
 
 			mLoadedResources[uuid] = newHandle;
+			addResidency(uuid, obj);
 		}
 	
 		return newHandle;
 	}
 
-	bool Resources::getFilePathFromUUID(const String& uuid, Path& filePath) const
+	bool Resources::getFilePathFromUUID(const Guid& uuid, Path& filePath) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
 		{
@@ -287,7 +452,7 @@ namespace BansheeEngine
 		return false;
 	}
 
-	bool Resources::getUUIDFromFilePath(const Path& path, String& uuid) const
+	bool Resources::getUUIDFromFilePath(const Path& path, Guid& uuid) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
 		{
@@ -298,9 +463,13 @@ namespace BansheeEngine
 		return false;
 	}
 
-	void Resources::loadCallback(const Path& filePath, HResource& resource)
+	void Resources::loadCallback(const Path& filePath, const ResourcePackagePtr& package, HResource& resource)
 	{
-		ResourcePtr rawResource = loadFromDiskAndDeserialize(filePath);
+		ResourcePtr rawResource;
+		if(package != nullptr)
+			rawResource = package->load(resource.getUUID());
+		else
+			rawResource = loadFromDiskAndDeserialize(filePath);
 
 		{
 			BS_LOCK_MUTEX(mInProgressResourcesMutex);
@@ -312,6 +481,7 @@ namespace BansheeEngine
 		{
 			BS_LOCK_MUTEX(mLoadedResourceMutex);
 			mLoadedResources[resource.getUUID()] = resource;
+			addResidency(resource.getUUID(), rawResource);
 		}
 	}
 
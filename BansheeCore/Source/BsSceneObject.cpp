@@ -448,7 +448,7 @@ namespace BansheeEngine
 			if(x.isDestroyed())
 				return false;
 
-			return x._getHandleData()->mPtr->object.get() == component; }
+			return x.get() == component; }
 		);
 
 		if(iterFind != mComponents.end())
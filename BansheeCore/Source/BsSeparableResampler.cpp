@@ -0,0 +1,670 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsSeparableResampler.h"
+#include "BsTaskScheduler.h"
+#include "BsMath.h"
+
+#if BS_ARCH_TYPE == BS_ARCHITECTURE_x86_64 || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BS_RESAMPLER_SSE2 1
+#include <emmintrin.h>
+#else
+#define BS_RESAMPLER_SSE2 0
+#endif
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Number of rows processed by a single task.
+	 */
+	static const UINT32 ROWS_PER_TASK = 32;
+
+	/**
+	 * @brief	Number of fractional bits in fixed point weights used for resampling 8-bit data.
+	 */
+	static const UINT32 WEIGHT_BITS = 14;
+
+	/**
+	 * @brief	Calls the provided function for ranges of rows covering all the rows. Ranges are split
+	 *			between multiple tasks if the task scheduler is running.
+	 */
+	static void forEachRowRange(UINT32 numRows, const std::function<void(UINT32, UINT32)>& func)
+	{
+		if(!TaskScheduler::isStarted() || numRows <= ROWS_PER_TASK)
+		{
+			func(0, numRows);
+			return;
+		}
+
+		Vector<TaskPtr> tasks;
+		for(UINT32 start = 0; start < numRows; start += ROWS_PER_TASK)
+		{
+			UINT32 end = std::min(start + ROWS_PER_TASK, numRows);
+
+			TaskPtr task = Task::create("SeparableResampler", [&func, start, end]()
+			{
+				func(start, end);
+			});
+
+			TaskScheduler::instance().addTask(task);
+			tasks.push_back(task);
+		}
+
+		for(auto& task : tasks)
+			task->wait();
+	}
+
+	/************************************************************************/
+	/* 									WEIGHTS                      		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Evaluates a cubic filter from the Mitchell-Netravali family.
+	 */
+	static float evaluateCubic(float x, float B, float C)
+	{
+		x = std::abs(x);
+
+		if(x < 1.0f)
+			return ((12.0f - 9.0f * B - 6.0f * C) * x * x * x + (-18.0f + 12.0f * B + 6.0f * C) * x * x + (6.0f - 2.0f * B)) / 6.0f;
+
+		if(x < 2.0f)
+			return ((-B - 6.0f * C) * x * x * x + (6.0f * B + 30.0f * C) * x * x + (-12.0f * B - 48.0f * C) * x + (8.0f * B + 24.0f * C)) / 6.0f;
+
+		return 0.0f;
+	}
+
+	static float sinc(float x)
+	{
+		if(std::abs(x) < 0.0001f)
+			return 1.0f;
+
+		x *= Math::PI;
+		return std::sin(x) / x;
+	}
+
+	/**
+	 * @brief	Returns the distance from the center at which the filter falls off to zero.
+	 */
+	static float getFilterRadius(PixelUtil::Filter filter)
+	{
+		switch(filter)
+		{
+		case PixelUtil::FILTER_BICUBIC:
+		case PixelUtil::FILTER_MITCHELL:
+			return 2.0f;
+		case PixelUtil::FILTER_LANCZOS3:
+			return 3.0f;
+		default:
+			return 0.5f;
+		}
+	}
+
+	static float evaluateFilter(PixelUtil::Filter filter, float x)
+	{
+		switch(filter)
+		{
+		case PixelUtil::FILTER_BICUBIC:
+			return evaluateCubic(x, 0.0f, 0.5f);
+		case PixelUtil::FILTER_MITCHELL:
+			return evaluateCubic(x, 1.0f / 3.0f, 1.0f / 3.0f);
+		case PixelUtil::FILTER_LANCZOS3:
+			return std::abs(x) < 3.0f ? sinc(x) * sinc(x / 3.0f) : 0.0f;
+		default:
+			return std::abs(x) <= 0.5f ? 1.0f : 0.0f;
+		}
+	}
+
+	/**
+	 * @brief	Source pixels and their weights contributing to each destination pixel along one axis.
+	 *			Each destination pixel is affected by a contiguous range of source pixels.
+	 */
+	struct ResampleWeights
+	{
+		UINT32 maxTaps;
+		Vector<UINT32> starts; /**< Index of the first source pixel for each destination pixel. */
+		Vector<UINT32> counts; /**< Number of source pixels for each destination pixel. */
+		Vector<float> weights; /**< maxTaps entries for each destination pixel. */
+		Vector<INT16> fixedWeights; /**< Weights in fixed point with WEIGHT_BITS fractional bits. */
+	};
+
+	/**
+	 * @brief	Calculates weights for resampling along one axis. Source pixels outside of the image
+	 *			are ignored and the remaining weights renormalized.
+	 */
+	static void calculateWeights(UINT32 srcSize, UINT32 dstSize, PixelUtil::Filter filter, ResampleWeights& output)
+	{
+		float scale = srcSize / (float)dstSize;
+		float filterScale = std::max(1.0f, scale);
+		float radius = getFilterRadius(filter) * filterScale;
+
+		output.maxTaps = std::min((UINT32)std::ceil(radius * 2.0f) + 2, srcSize);
+		output.starts.resize(dstSize);
+		output.counts.resize(dstSize);
+		output.weights.resize(dstSize * output.maxTaps);
+		output.fixedWeights.resize(dstSize * output.maxTaps);
+
+		for(UINT32 i = 0; i < dstSize; i++)
+		{
+			float center = (i + 0.5f) * scale;
+			INT32 start = std::max((INT32)std::floor(center - radius), 0);
+			INT32 end = std::min((INT32)std::ceil(center + radius), (INT32)srcSize);
+			UINT32 count = (UINT32)std::min(end - start, (INT32)output.maxTaps);
+
+			float* weights = &output.weights[i * output.maxTaps];
+
+			float totalWeight = 0.0f;
+			for(UINT32 j = 0; j < count; j++)
+			{
+				float srcPos = (float)(start + j);
+
+				// Area filter is integrated exactly over the source pixel, so non-integer ratios are averaged correctly
+				if(filter == PixelUtil::FILTER_AREA)
+					weights[j] = std::max(0.0f, std::min(srcPos + 1.0f, center + radius) - std::max(srcPos, center - radius));
+				else
+					weights[j] = evaluateFilter(filter, (srcPos + 0.5f - center) / filterScale);
+
+				totalWeight += weights[j];
+			}
+
+			// Trim taps that don't contribute
+			UINT32 first = 0;
+			while(first < count && weights[first] == 0.0f)
+				first++;
+
+			while(count > first && weights[count - 1] == 0.0f)
+				count--;
+
+			if(first == count || std::abs(totalWeight) < 0.0001f)
+			{
+				// Degenerate filter, fall back to nearest source pixel
+				output.starts[i] = std::min((UINT32)center, srcSize - 1);
+				output.counts[i] = 1;
+				weights[0] = 1.0f;
+			}
+			else
+			{
+				output.starts[i] = start + first;
+				output.counts[i] = count - first;
+
+				float invTotalWeight = 1.0f / totalWeight;
+				for(UINT32 j = first; j < count; j++)
+					weights[j - first] = weights[j] * invTotalWeight;
+			}
+
+			// Rounding errors are added to the largest weight so the fixed point weights still sum up to one
+			INT16* fixedWeights = &output.fixedWeights[i * output.maxTaps];
+
+			INT32 totalFixedWeight = 0;
+			UINT32 largestIdx = 0;
+			for(UINT32 j = 0; j < output.counts[i]; j++)
+			{
+				fixedWeights[j] = (INT16)Math::floorToInt(weights[j] * (1 << WEIGHT_BITS) + 0.5f);
+				totalFixedWeight += fixedWeights[j];
+
+				if(weights[j] > weights[largestIdx])
+					largestIdx = j;
+			}
+
+			fixedWeights[largestIdx] += (INT16)((1 << WEIGHT_BITS) - totalFixedWeight);
+		}
+	}
+
+	/************************************************************************/
+	/* 								8-BIT KERNELS                      		*/
+	/************************************************************************/
+
+	static UINT8 fixedToByte(INT32 value)
+	{
+		return (UINT8)Math::clamp(value >> WEIGHT_BITS, 0, 255);
+	}
+
+	/**
+	 * @brief	Packs two fixed point weights into the low and high halves of a 32-bit value.
+	 */
+	static INT32 packWeights(INT16 low, INT16 high)
+	{
+		return (INT32)(((UINT32)(UINT16)high << 16) | (UINT16)low);
+	}
+
+	/**
+	 * @brief	Resamples a row of pixels with one byte per channel.
+	 */
+	template<UINT32 channels>
+	static void resampleRowBytes(const UINT8* src, UINT8* dst, UINT32 dstWidth, const ResampleWeights& weights)
+	{
+		for(UINT32 x = 0; x < dstWidth; x++)
+		{
+			const UINT8* pixels = src + weights.starts[x] * channels;
+			const INT16* pixelWeights = &weights.fixedWeights[x * weights.maxTaps];
+			UINT32 count = weights.counts[x];
+
+			INT32 sum[channels];
+			for(UINT32 c = 0; c < channels; c++)
+				sum[c] = 1 << (WEIGHT_BITS - 1);
+
+			for(UINT32 i = 0; i < count; i++)
+			{
+				for(UINT32 c = 0; c < channels; c++)
+					sum[c] += pixels[i * channels + c] * pixelWeights[i];
+			}
+
+			for(UINT32 c = 0; c < channels; c++)
+				dst[x * channels + c] = fixedToByte(sum[c]);
+		}
+	}
+
+	/**
+	 * @brief	Resamples a column of bytes, combining rows of the source into a single destination row.
+	 *
+	 * @param	src			First source row contributing to the destination row.
+	 * @param	srcStride	Distance between source rows in bytes.
+	 * @param	dst			Destination row.
+	 * @param	numBytes	Number of bytes in a row.
+	 * @param	weights		Fixed point weights of each source row.
+	 * @param	count		Number of source rows.
+	 */
+	static void resampleColumnBytes(const UINT8* src, UINT32 srcStride, UINT8* dst, UINT32 numBytes,
+		const INT16* weights, UINT32 count)
+	{
+		UINT32 i = 0;
+
+#if BS_RESAMPLER_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i rounding = _mm_set1_epi32(1 << (WEIGHT_BITS - 1));
+
+		// Bytes from two rows are interleaved so a single multiply-add applies the weights of both
+		for(; i + 16 <= numBytes; i += 16)
+		{
+			__m128i sum0 = rounding;
+			__m128i sum1 = rounding;
+			__m128i sum2 = rounding;
+			__m128i sum3 = rounding;
+
+			UINT32 j = 0;
+			for(; j + 2 <= count; j += 2)
+			{
+				__m128i row0 = _mm_loadu_si128((const __m128i*)(src + j * srcStride + i));
+				__m128i row1 = _mm_loadu_si128((const __m128i*)(src + (j + 1) * srcStride + i));
+				__m128i rowWeights = _mm_set1_epi32(packWeights(weights[j], weights[j + 1]));
+
+				__m128i low = _mm_unpacklo_epi8(row0, row1);
+				__m128i high = _mm_unpackhi_epi8(row0, row1);
+
+				sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_unpacklo_epi8(low, zero), rowWeights));
+				sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_unpackhi_epi8(low, zero), rowWeights));
+				sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpacklo_epi8(high, zero), rowWeights));
+				sum3 = _mm_add_epi32(sum3, _mm_madd_epi16(_mm_unpackhi_epi8(high, zero), rowWeights));
+			}
+
+			if(j < count)
+			{
+				__m128i row = _mm_loadu_si128((const __m128i*)(src + j * srcStride + i));
+				__m128i rowWeights = _mm_set1_epi32(packWeights(weights[j], 0));
+
+				__m128i low = _mm_unpacklo_epi8(row, zero);
+				__m128i high = _mm_unpackhi_epi8(row, zero);
+
+				sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_unpacklo_epi16(low, zero), rowWeights));
+				sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_unpackhi_epi16(low, zero), rowWeights));
+				sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpacklo_epi16(high, zero), rowWeights));
+				sum3 = _mm_add_epi32(sum3, _mm_madd_epi16(_mm_unpackhi_epi16(high, zero), rowWeights));
+			}
+
+			__m128i low = _mm_packs_epi32(_mm_srai_epi32(sum0, WEIGHT_BITS), _mm_srai_epi32(sum1, WEIGHT_BITS));
+			__m128i high = _mm_packs_epi32(_mm_srai_epi32(sum2, WEIGHT_BITS), _mm_srai_epi32(sum3, WEIGHT_BITS));
+			_mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(low, high));
+		}
+#endif
+
+		for(; i < numBytes; i++)
+		{
+			INT32 sum = 1 << (WEIGHT_BITS - 1);
+			for(UINT32 j = 0; j < count; j++)
+				sum += src[j * srcStride + i] * weights[j];
+
+			dst[i] = fixedToByte(sum);
+		}
+	}
+
+#if BS_RESAMPLER_SSE2
+	/**
+	 * @copydoc	resampleRowBytes
+	 *
+	 * @note	Specialized for four channels, pairs of source pixels are interleaved per channel so a single
+	 *			multiply-add applies the weights of both.
+	 */
+	template<>
+	void resampleRowBytes<4>(const UINT8* src, UINT8* dst, UINT32 dstWidth, const ResampleWeights& weights)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i rounding = _mm_set1_epi32(1 << (WEIGHT_BITS - 1));
+
+		for(UINT32 x = 0; x < dstWidth; x++)
+		{
+			const UINT8* pixels = src + weights.starts[x] * 4;
+			const INT16* pixelWeights = &weights.fixedWeights[x * weights.maxTaps];
+			UINT32 count = weights.counts[x];
+
+			__m128i sum = rounding;
+
+			UINT32 i = 0;
+			for(; i + 2 <= count; i += 2)
+			{
+				__m128i pixelPair = _mm_loadl_epi64((const __m128i*)(pixels + i * 4));
+				__m128i interleaved = _mm_unpacklo_epi8(pixelPair, _mm_srli_si128(pixelPair, 4));
+				__m128i pairWeights = _mm_set1_epi32(packWeights(pixelWeights[i], pixelWeights[i + 1]));
+
+				sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_unpacklo_epi8(interleaved, zero), pairWeights));
+			}
+
+			if(i < count)
+			{
+				INT32 pixelBits;
+				memcpy(&pixelBits, pixels + i * 4, sizeof(pixelBits));
+
+				__m128i pixel = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(pixelBits), zero), zero);
+				sum = _mm_add_epi32(sum, _mm_madd_epi16(pixel, _mm_set1_epi32(packWeights(pixelWeights[i], 0))));
+			}
+
+			sum = _mm_srai_epi32(sum, WEIGHT_BITS);
+			sum = _mm_packs_epi32(sum, sum);
+			sum = _mm_packus_epi16(sum, sum);
+
+			INT32 output = _mm_cvtsi128_si32(sum);
+			memcpy(dst + x * 4, &output, sizeof(output));
+		}
+	}
+#endif
+
+	/************************************************************************/
+	/* 								FLOAT KERNELS                      		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Resamples a row of pixels with one float per channel.
+	 */
+	template<UINT32 channels>
+	static void resampleRowFloats(const float* src, float* dst, UINT32 dstWidth, const ResampleWeights& weights)
+	{
+		for(UINT32 x = 0; x < dstWidth; x++)
+		{
+			const float* pixels = src + weights.starts[x] * channels;
+			const float* pixelWeights = &weights.weights[x * weights.maxTaps];
+			UINT32 count = weights.counts[x];
+
+			float sum[channels];
+			for(UINT32 c = 0; c < channels; c++)
+				sum[c] = 0.0f;
+
+			for(UINT32 i = 0; i < count; i++)
+			{
+				for(UINT32 c = 0; c < channels; c++)
+					sum[c] += pixels[i * channels + c] * pixelWeights[i];
+			}
+
+			for(UINT32 c = 0; c < channels; c++)
+				dst[x * channels + c] = sum[c];
+		}
+	}
+
+#if BS_RESAMPLER_SSE2
+	/**
+	 * @copydoc	resampleRowFloats
+	 *
+	 * @note	Specialized for four channels, a whole pixel is processed in a single register.
+	 */
+	template<>
+	void resampleRowFloats<4>(const float* src, float* dst, UINT32 dstWidth, const ResampleWeights& weights)
+	{
+		for(UINT32 x = 0; x < dstWidth; x++)
+		{
+			const float* pixels = src + weights.starts[x] * 4;
+			const float* pixelWeights = &weights.weights[x * weights.maxTaps];
+			UINT32 count = weights.counts[x];
+
+			__m128 sum = _mm_setzero_ps();
+			for(UINT32 i = 0; i < count; i++)
+				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(pixels + i * 4), _mm_set1_ps(pixelWeights[i])));
+
+			_mm_storeu_ps(dst + x * 4, sum);
+		}
+	}
+#endif
+
+	/**
+	 * @brief	Resamples a column of floats, combining rows of the source into a single destination row.
+	 *
+	 * @param	src			First source row contributing to the destination row.
+	 * @param	srcStride	Distance between source rows in floats.
+	 * @param	dst			Destination row.
+	 * @param	numFloats	Number of floats in a row.
+	 * @param	weights		Weights of each source row.
+	 * @param	count		Number of source rows.
+	 */
+	static void resampleColumnFloats(const float* src, UINT32 srcStride, float* dst, UINT32 numFloats,
+		const float* weights, UINT32 count)
+	{
+		UINT32 i = 0;
+
+#if BS_RESAMPLER_SSE2
+		for(; i + 4 <= numFloats; i += 4)
+		{
+			__m128 sum = _mm_setzero_ps();
+			for(UINT32 j = 0; j < count; j++)
+				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + j * srcStride + i), _mm_set1_ps(weights[j])));
+
+			_mm_storeu_ps(dst + i, sum);
+		}
+#endif
+
+		for(; i < numFloats; i++)
+		{
+			float sum = 0.0f;
+			for(UINT32 j = 0; j < count; j++)
+				sum += src[j * srcStride + i] * weights[j];
+
+			dst[i] = sum;
+		}
+	}
+
+	/************************************************************************/
+	/* 									PASSES                       		*/
+	/************************************************************************/
+
+	/**
+	 * @brief	Returns the address of the first pixel in the specified row of the pixel box, relative to the top
+	 *			of the box.
+	 */
+	static UINT8* getRowData(const PixelData& data, UINT32 y, UINT32 pixelSize)
+	{
+		return data.getData() + (data.getLeft() + (data.getTop() + y) * data.getRowPitch() +
+			data.getFront() * data.getSlicePitch()) * pixelSize;
+	}
+
+	/**
+	 * @brief	Resamples two dimensional data with one byte per channel, without format conversion.
+	 */
+	template<UINT32 channels>
+	static void resampleBytes(const PixelData& source, const PixelData& dest, const ResampleWeights& horzWeights,
+		const ResampleWeights& vertWeights)
+	{
+		UINT32 srcHeight = source.getHeight();
+		UINT32 dstWidth = dest.getWidth();
+		UINT32 dstHeight = dest.getHeight();
+		UINT32 tempStride = dstWidth * channels;
+
+		UINT8* tempData = (UINT8*)bs_alloc(tempStride * srcHeight);
+
+		forEachRowRange(srcHeight, [&](UINT32 start, UINT32 end)
+		{
+			for(UINT32 y = start; y < end; y++)
+			{
+				const UINT8* srcRow = getRowData(source, y, channels);
+				resampleRowBytes<channels>(srcRow, tempData + y * tempStride, dstWidth, horzWeights);
+			}
+		});
+
+		forEachRowRange(dstHeight, [&](UINT32 start, UINT32 end)
+		{
+			for(UINT32 y = start; y < end; y++)
+			{
+				UINT8* dstRow = getRowData(dest, y, channels);
+				const INT16* rowWeights = &vertWeights.fixedWeights[y * vertWeights.maxTaps];
+
+				resampleColumnBytes(tempData + vertWeights.starts[y] * tempStride, tempStride, dstRow, tempStride,
+					rowWeights, vertWeights.counts[y]);
+			}
+		});
+
+		bs_free(tempData);
+	}
+
+	/**
+	 * @brief	Resamples two dimensional data with one float per channel, without format conversion.
+	 */
+	template<UINT32 channels>
+	static void resampleFloats(const PixelData& source, const PixelData& dest, const ResampleWeights& horzWeights,
+		const ResampleWeights& vertWeights)
+	{
+		UINT32 srcHeight = source.getHeight();
+		UINT32 dstWidth = dest.getWidth();
+		UINT32 dstHeight = dest.getHeight();
+		UINT32 tempStride = dstWidth * channels;
+
+		float* tempData = (float*)bs_alloc(tempStride * srcHeight * sizeof(float));
+
+		forEachRowRange(srcHeight, [&](UINT32 start, UINT32 end)
+		{
+			for(UINT32 y = start; y < end; y++)
+			{
+				const float* srcRow = (const float*)getRowData(source, y, channels * sizeof(float));
+				resampleRowFloats<channels>(srcRow, tempData + y * tempStride, dstWidth, horzWeights);
+			}
+		});
+
+		forEachRowRange(dstHeight, [&](UINT32 start, UINT32 end)
+		{
+			for(UINT32 y = start; y < end; y++)
+			{
+				float* dstRow = (float*)getRowData(dest, y, channels * sizeof(float));
+				const float* rowWeights = &vertWeights.weights[y * vertWeights.maxTaps];
+
+				resampleColumnFloats(tempData + vertWeights.starts[y] * tempStride, tempStride, dstRow, tempStride,
+					rowWeights, vertWeights.counts[y]);
+			}
+		});
+
+		bs_free(tempData);
+	}
+
+	/**
+	 * @brief	Checks does the format store every channel in a single byte, in which case it can be
+	 *			resampled directly.
+	 */
+	static bool isByteFormat(PixelFormat format)
+	{
+		switch(format)
+		{
+		case PF_R8:
+		case PF_R8G8:
+		case PF_R8G8B8: case PF_B8G8R8:
+		case PF_R8G8B8A8: case PF_B8G8R8A8:
+		case PF_A8B8G8R8: case PF_A8R8G8B8:
+		case PF_X8B8G8R8: case PF_X8R8G8B8:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	/**
+	 * @brief	Checks does the format store every channel in a single float, in which case it can be
+	 *			resampled directly.
+	 */
+	static bool isFloatFormat(PixelFormat format)
+	{
+		switch(format)
+		{
+		case PF_FLOAT32_R:
+		case PF_FLOAT32_RG:
+		case PF_FLOAT32_RGB:
+		case PF_FLOAT32_RGBA:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	void SeparableResampler::scale(const PixelData& source, const PixelData& dest, PixelUtil::Filter filter)
+	{
+		assert(source.getDepth() == 1 && dest.getDepth() == 1);
+
+		ResampleWeights horzWeights;
+		calculateWeights(source.getWidth(), dest.getWidth(), filter, horzWeights);
+
+		ResampleWeights vertWeights;
+		calculateWeights(source.getHeight(), dest.getHeight(), filter, vertWeights);
+
+		PixelFormat srcFormat = source.getFormat();
+		UINT32 srcElemSize = PixelUtil::getNumElemBytes(srcFormat);
+
+		if(isByteFormat(srcFormat) || isFloatFormat(srcFormat))
+		{
+			// Resample in source format, and convert afterwards if needed
+			PixelData temp;
+			if(srcFormat == dest.getFormat())
+				temp = dest;
+			else
+			{
+				temp = PixelData(dest.getWidth(), dest.getHeight(), 1, srcFormat);
+				temp.allocateInternalBuffer();
+			}
+
+			if(isByteFormat(srcFormat))
+			{
+				switch(srcElemSize)
+				{
+				case 1: resampleBytes<1>(source, temp, horzWeights, vertWeights); break;
+				case 2: resampleBytes<2>(source, temp, horzWeights, vertWeights); break;
+				case 3: resampleBytes<3>(source, temp, horzWeights, vertWeights); break;
+				case 4: resampleBytes<4>(source, temp, horzWeights, vertWeights); break;
+				}
+			}
+			else
+			{
+				switch(srcElemSize / sizeof(float))
+				{
+				case 1: resampleFloats<1>(source, temp, horzWeights, vertWeights); break;
+				case 2: resampleFloats<2>(source, temp, horzWeights, vertWeights); break;
+				case 3: resampleFloats<3>(source, temp, horzWeights, vertWeights); break;
+				case 4: resampleFloats<4>(source, temp, horzWeights, vertWeights); break;
+				}
+			}
+
+			if(temp.getData() != dest.getData())
+			{
+				PixelData output = dest;
+				PixelUtil::bulkPixelConversion(temp, output);
+				temp.freeInternalBuffer();
+			}
+
+			return;
+		}
+
+		// Other formats are resampled in floating point
+		PixelData floatSource(source.getWidth(), source.getHeight(), 1, PF_FLOAT32_RGBA);
+		floatSource.allocateInternalBuffer();
+		PixelUtil::bulkPixelConversion(source, floatSource);
+
+		PixelData floatDest(dest.getWidth(), dest.getHeight(), 1, PF_FLOAT32_RGBA);
+		floatDest.allocateInternalBuffer();
+
+		resampleFloats<4>(floatSource, floatDest, horzWeights, vertWeights);
+		floatSource.freeInternalBuffer();
+
+		PixelData output = dest;
+		PixelUtil::bulkPixelConversion(floatDest, output);
+		floatDest.freeInternalBuffer();
+	}
+}
@@ -12,7 +12,7 @@ namespace BansheeEngine
 {
 	Shader::Shader(const String& name)
 		:mName(name), mQueueSortType(QueueSortType::FrontToBack), mQueuePriority((UINT32)QueuePriority::Opaque), 
-		mSeparablePasses(true), mCoreDirtyFlags(0xFFFFFFFF)
+		mSeparablePasses(true), mInstancing(false), mCoreDirtyFlags(0xFFFFFFFF)
 	{
 
 	}
@@ -87,6 +87,13 @@ namespace BansheeEngine
 		markCoreDirty();
 	}
 
+	void Shader::setAllowInstancing(bool enable)
+	{
+		mInstancing = enable;
+
+		markCoreDirty();
+	}
+
 	void Shader::addParameter(const String& name, const String& gpuVariableName, GpuParamDataType type, UINT32 rendererSemantic, UINT32 arraySize, UINT32 elementSize)
 	{
 		if(type == GPDT_STRUCT && elementSize <= 0)
@@ -255,6 +262,7 @@ namespace BansheeEngine
 		proxy->queuePriority = mQueuePriority;
 		proxy->queueSortType = mQueueSortType;
 		proxy->separablePasses = mSeparablePasses;
+		proxy->instancing = mInstancing;
 
 		return proxy;
 	}
@@ -3,6 +3,7 @@
 //________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
 #include "BsTextData.h"
 #include "BsFont.h"
+#include "BsGlyphCache.h"
 #include "BsVector2.h"
 #include "BsDebug.h"
 
@@ -21,23 +22,11 @@ namespace BansheeEngine
 	}
 
 	// Assumes charIdx is an index right after last char in the list (if any). All chars need to be sequential.
-	UINT32 TextData::TextWord::addChar(UINT32 charIdx, const CHAR_DESC& desc)
+	UINT32 TextData::TextWord::addChar(UINT32 charIdx, const CHAR_DESC& desc, const FontData& fontData)
 	{
 		UINT32 charWidth = desc.xAdvance;
 		if(mLastChar != nullptr)
-		{
-			UINT32 kerning = 0;
-			for(size_t j = 0; j < mLastChar->kerningPairs.size(); j++)
-			{
-				if(mLastChar->kerningPairs[j].otherCharId == desc.charId)
-				{
-					kerning = mLastChar->kerningPairs[j].amount;
-					break;
-				}
-			}
-
-			charWidth += kerning;
-		}
+			charWidth += fontData.getKerning(mLastChar->charId, desc.charId);
 
 		mWidth += charWidth;
 		mHeight = std::max(mHeight, desc.height);
@@ -88,7 +77,7 @@ namespace BansheeEngine
 		}
 
 		TextWord& lastWord = TextData::WordBuffer[mWordsEnd];
-		charWidth = lastWord.addChar(charIdx, charDesc);
+		charWidth = lastWord.addChar(charIdx, charDesc, *mTextData->mFontData);
 
 		mWidth += charWidth;
 		mHeight = std::max(mHeight, lastWord.getHeight());
@@ -219,14 +208,7 @@ namespace BansheeEngine
 					if((j + 1) <= word.getCharsEnd())
 					{
 						const CHAR_DESC& nextChar = mTextData->getChar(j + 1);
-						for(size_t j = 0; j < curChar.kerningPairs.size(); j++)
-						{
-							if(curChar.kerningPairs[j].otherCharId == nextChar.charId)
-							{
-								kerning = curChar.kerningPairs[j].amount;
-								break;
-							}
-						}
+						kerning = mTextData->mFontData->getKerning(curChar.charId, nextChar.charId);
 					}
 
 					if(curChar.page != page)
@@ -308,7 +290,8 @@ namespace BansheeEngine
 
 	TextData::TextData(const WString& text, const HFont& font, UINT32 fontSize, UINT32 width, UINT32 height, bool wordWrap)
 		:mFont(font), mChars(nullptr), mFontData(nullptr),
-		mNumChars(0), mWords(nullptr), mNumWords(0), mLines(nullptr), mNumLines(0), mPageInfos(nullptr), mNumPageInfos(0), mData(nullptr)
+		mNumChars(0), mWords(nullptr), mNumWords(0), mLines(nullptr), mNumLines(0), mPageInfos(nullptr), mNumPageInfos(0), mData(nullptr), 
+		mNumGlyphPins(1), mUnpinEvictionCount(0)
 	{
 		// In order to reduce number of memory allocations algorithm first calculates data into temporary buffers and then copies the results
 		initAlloc();
@@ -319,7 +302,7 @@ namespace BansheeEngine
 			mFontData = font->getFontDataForSize(nearestSize);
 		}
 
-		if(mFontData == nullptr || mFontData->texturePages.size() == 0)
+		if(mFontData == nullptr || mFontData->getNumTexturePages() == 0)
 			return;
 
 		if(mFontData->size != fontSize)
@@ -330,17 +313,23 @@ namespace BansheeEngine
 		bool widthIsLimited = width > 0;
 		mFont = font;
 
+		// Characters of dynamic fonts are referenced for the lifetime of this object so they don't get evicted
+		mGlyphCache = mFontData->getGlyphCache();
+
 		UINT32 curLineIdx = allocLine(this);
 		UINT32 curHeight = mFontData->fontDesc.lineHeight;
 		UINT32 charIdx = 0;
 
+		allocChars((UINT32)text.size());
+
 		while(true)
 		{
 			if(charIdx >= text.size())
 				break;
 
 			UINT32 charId = text[charIdx];
-			const CHAR_DESC& charDesc = mFontData->getCharDesc(charId);
+			const CHAR_DESC& charDesc = mGlyphCache != nullptr ? mGlyphCache->acquireCharDesc(charId) : mFontData->getCharDesc(charId);
+			CharBuffer[charIdx] = &charDesc;
 
 			TextLine* curLine = &LineBuffer[curLineIdx];
 
@@ -412,14 +401,7 @@ namespace BansheeEngine
 
 		UINT8* dataPtr = (UINT8*)mData;
 		mChars = (const CHAR_DESC**)dataPtr;
-
-		for(UINT32 i = 0; i < mNumChars; i++)
-		{
-			UINT32 charId = text[i];
-			const CHAR_DESC& charDesc = mFontData->getCharDesc(charId);
-
-			mChars[i] = &charDesc;
-		}
+		memcpy(mChars, CharBuffer, charArraySize);
 
 		dataPtr += charArraySize;
 		mWords = (TextWord*)dataPtr;
@@ -438,13 +420,38 @@ namespace BansheeEngine
 
 	TextData::~TextData()
 	{
+		if(mGlyphCache != nullptr && mNumGlyphPins > 0)
+			mGlyphCache->releaseCharDescs(mChars, mNumChars);
+
 		if(mData != nullptr)
 			bs_free(mData);
 	}
 
+	bool TextData::_pinGlyphs()
+	{
+		if(mNumGlyphPins == 0 && mGlyphCache != nullptr)
+		{
+			if(!mGlyphCache->reacquireCharDescs(mChars, mNumChars, mUnpinEvictionCount))
+				return false;
+		}
+
+		mNumGlyphPins++;
+		return true;
+	}
+
+	void TextData::_unpinGlyphs()
+	{
+		if(mNumGlyphPins == 0)
+			return;
+
+		mNumGlyphPins--;
+		if(mNumGlyphPins == 0 && mGlyphCache != nullptr)
+			mUnpinEvictionCount = mGlyphCache->releaseCharDescs(mChars, mNumChars);
+	}
+
 	const HTexture& TextData::getTextureForPage(UINT32 page) const 
 	{ 
-		return mFontData->texturePages[page]; 
+		return mFontData->getTexturePage(page); 
 	}
 
 	INT32 TextData::getBaselineOffset() const 
@@ -464,6 +471,9 @@ namespace BansheeEngine
 
 	bool TextData::BuffersInitialized = false;
 
+	const CHAR_DESC** TextData::CharBuffer = nullptr;
+	UINT32 TextData::CharBufferSize = 0;
+
 	TextData::TextWord* TextData::WordBuffer = nullptr;
 	UINT32 TextData::NextFreeWord = 0;
 	UINT32 TextData::WordBufferSize = 0;
@@ -480,10 +490,12 @@ namespace BansheeEngine
 	{
 		if(!BuffersInitialized)
 		{
+			CharBufferSize = 2000;
 			WordBufferSize = 2000;
 			LineBufferSize = 500;
 			PageBufferSize = 20;
 
+			CharBuffer = (const CHAR_DESC**)bs_alloc(CharBufferSize * sizeof(const CHAR_DESC*));
 			WordBuffer = bs_newN<TextWord>(WordBufferSize);
 			LineBuffer = bs_newN<TextLine>(LineBufferSize);
 			PageBuffer = bs_newN<PageInfo>(PageBufferSize);
@@ -492,13 +504,25 @@ namespace BansheeEngine
 		}
 	}
 
+	void TextData::allocChars(UINT32 numChars)
+	{
+		if(numChars <= CharBufferSize)
+			return;
+
+		UINT32 newBufferSize = std::max(numChars, CharBufferSize * 2);
+
+		bs_free(CharBuffer);
+		CharBuffer = (const CHAR_DESC**)bs_alloc(newBufferSize * sizeof(const CHAR_DESC*));
+		CharBufferSize = newBufferSize;
+	}
+
 	UINT32 TextData::allocWord(bool spacer)
 	{
 		if(NextFreeWord >= WordBufferSize)
 		{
 			UINT32 newBufferSize = WordBufferSize * 2;
 			TextWord* newBuffer = bs_newN<TextWord>(newBufferSize);
-			memcpy(WordBuffer, newBuffer, WordBufferSize);
+			memcpy(newBuffer, WordBuffer, WordBufferSize * sizeof(TextWord));
 
 			bs_deleteN(WordBuffer, WordBufferSize);
 			WordBuffer = newBuffer;
@@ -516,7 +540,7 @@ namespace BansheeEngine
 		{
 			UINT32 newBufferSize = LineBufferSize * 2;
 			TextLine* newBuffer = bs_newN<TextLine>(newBufferSize);
-			memcpy(LineBuffer, newBuffer, LineBufferSize);
+			memcpy(newBuffer, LineBuffer, LineBufferSize * sizeof(TextLine));
 
 			bs_deleteN(LineBuffer, LineBufferSize);
 			LineBuffer = newBuffer;
@@ -541,7 +565,8 @@ namespace BansheeEngine
 		{
 			UINT32 newBufferSize = PageBufferSize * 2;
 			PageInfo* newBuffer = bs_newN<PageInfo>(newBufferSize);
-			memcpy(PageBuffer, newBuffer, PageBufferSize);
+			for(UINT32 i = 0; i < PageBufferSize; i++)
+				newBuffer[i] = PageBuffer[i];
 
 			bs_deleteN(PageBuffer, PageBufferSize);
 			PageBuffer = newBuffer;
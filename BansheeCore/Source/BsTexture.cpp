@@ -51,6 +51,25 @@ namespace BansheeEngine
         return getNumFaces() * PixelUtil::getMemorySize(mWidth, mHeight, mDepth, mFormat);
 	}
 
+	UINT32 Texture::getGPUMemorySize() const
+	{
+		UINT32 width = mWidth;
+		UINT32 height = mHeight;
+		UINT32 depth = mDepth;
+
+		UINT32 size = 0;
+		for(UINT32 mip = 0; mip <= mNumMipmaps; mip++)
+		{
+			size += PixelUtil::getMemorySize(width, height, depth, mFormat);
+
+			if(width != 1) width /= 2;
+			if(height != 1) height /= 2;
+			if(depth != 1) depth /= 2;
+		}
+
+		return size * getNumFaces() * std::max(mMultisampleCount, 1U);
+	}
+
 	UINT32 Texture::getNumFaces() const
 	{
 		return getTextureType() == TEX_TYPE_CUBE_MAP ? 6 : 1;
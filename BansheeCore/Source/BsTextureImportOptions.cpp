@@ -7,7 +7,8 @@
 namespace BansheeEngine
 {
 	TextureImportOptions::TextureImportOptions()
-		:mFormat(PF_B8G8R8A8), mGenerateMips(false), mMaxMip(0)
+		:mFormat(PF_B8G8R8A8), mGenerateMips(false), mMaxMip(0), mSRGB(false), mPreserveAlphaCoverage(false), 
+		mAlphaCutoff(0.5f)
 	{ }
 
 	/************************************************************************/
@@ -58,7 +58,7 @@ namespace BansheeEngine
 		mParentHeap->notifyUsedOnGPU(mId);
 	}
 
-	MeshProxyPtr TransientMesh::_createProxy(UINT32 subMeshIdx)
+	MeshProxyPtr TransientMesh::_createProxy(UINT32 subMeshIdx, UINT32 lodIdx)
 	{
 		MeshProxyPtr coreProxy = bs_shared_ptr<MeshProxy>();
 		coreProxy->mesh = std::static_pointer_cast<MeshBase>(getThisPtr());
@@ -9,35 +9,77 @@ using namespace std::chrono;
 
 namespace BansheeEngine
 {
-	UUIDGenerator::UUIDGenerator()
-		:mRandomGenerator((unsigned int)system_clock::now().time_since_epoch().count())
+	Guid Guid::EMPTY;
+
+	Guid::Guid(const String& uuid)
 	{
-		mHaveMacAddress = Platform::getMACAddress(mMACAddress);
+		mData[0] = 0;
+		mData[1] = 0;
+		mData[2] = 0;
+		mData[3] = 0;
+
+		UINT32 numDigits = 0;
+		UINT32 data[4] = { 0, 0, 0, 0 };
+		for (auto& entry : uuid)
+		{
+			if (entry == '-')
+				continue;
+
+			UINT32 digit = 0;
+			if (entry >= '0' && entry <= '9')
+				digit = entry - '0';
+			else if (entry >= 'a' && entry <= 'f')
+				digit = entry - 'a' + 10;
+			else if (entry >= 'A' && entry <= 'F')
+				digit = entry - 'A' + 10;
+			else
+				return;
+
+			if (numDigits >= 32)
+				return;
+
+			UINT32 wordIdx = numDigits / 8;
+			data[wordIdx] = (data[wordIdx] << 4) | digit;
+			numDigits++;
+		}
+
+		if (numDigits != 32)
+			return;
+
+		mData[0] = data[0];
+		mData[1] = data[1];
+		mData[2] = data[2];
+		mData[3] = data[3];
 	}
 
-	void appendHex(String& str, UINT8 n)
+	String Guid::toString() const
 	{
 		static const char* digits = "0123456789abcdef";
-		str += digits[(n >> 4) & 0xF];
-		str += digits[n & 0xF];
-	}
 
+		String result;
+		result.reserve(36);
 
-	void appendHex(String& str, UINT16 n)
-	{
-		appendHex(str, UINT8(n >> 8));
-		appendHex(str, UINT8(n & 0xFF));
-	}
+		for (UINT32 i = 0; i < 16; i++)
+		{
+			if (i == 4 || i == 6 || i == 8 || i == 10)
+				result += '-';
 
+			UINT8 n = (UINT8)(mData[i / 4] >> (24 - (i % 4) * 8));
 
-	void appendHex(String& str, UINT32 n)
-	{
-		appendHex(str, UINT16(n >> 16));
-		appendHex(str, UINT16(n & 0xFFFF));
+			result += digits[(n >> 4) & 0xF];
+			result += digits[n & 0xF];
+		}
+
+		return result;
 	}
 
+	UUIDGenerator::UUIDGenerator()
+		:mRandomGenerator((unsigned int)system_clock::now().time_since_epoch().count())
+	{
+		mHaveMacAddress = Platform::getMACAddress(mMACAddress);
+	}
 
-	String UUIDGenerator::generateRandom()
+	Guid UUIDGenerator::generateRandom()
 	{
 		mSpinLock.lock();
 
@@ -48,33 +90,25 @@ namespace BansheeEngine
 		UINT16 timeHiAndVersion = UINT16((timestamp >> 48) & 0x0FFF) + (UUIDV_TimeBased << 12);
 		UINT16 clockSeq = (UINT16(mRandomGenerator() >> 4) & 0x3FFF) | 0x8000;
 
-		String result;
-		result.reserve(36);
-
-		appendHex(result, timeLow);
-		result += '-';
-
-		appendHex(result, timeMid);
-		result += '-';
-
-		appendHex(result, timeHiAndVersion);
-		result += '-';
-
-		appendHex(result, clockSeq);
-		result += '-';
-
+		UINT8 node[6];
 		if (mHaveMacAddress)
 		{
 			for (int i = 0; i < sizeof(MACAddress); ++i)
-				appendHex(result, mMACAddress.value[i]);
+				node[i] = mMACAddress.value[i];
 		}
 		else
 		{
 			for (int i = 0; i < sizeof(MACAddress); ++i)
-				appendHex(result, (UINT8)(mRandomGenerator() % 255));
+				node[i] = (UINT8)(mRandomGenerator() % 255);
 		}
 
 		mSpinLock.unlock();
-		return result;
+
+		UINT32 data0 = timeLow;
+		UINT32 data1 = ((UINT32)timeMid << 16) | timeHiAndVersion;
+		UINT32 data2 = ((UINT32)clockSeq << 16) | ((UINT32)node[0] << 8) | node[1];
+		UINT32 data3 = ((UINT32)node[2] << 24) | ((UINT32)node[3] << 16) | ((UINT32)node[4] << 8) | node[5];
+
+		return Guid(data0, data1, data2, data3);
 	}
 };
\ No newline at end of file
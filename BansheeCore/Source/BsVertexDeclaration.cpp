@@ -46,6 +46,12 @@ namespace BansheeEngine
 			return sizeof(short)*4;
 		case VET_UBYTE4:
 			return sizeof(unsigned char)*4;
+		case VET_USHORT4_NORM:
+			return sizeof(unsigned short)*4;
+		case VET_SHORT2_NORM:
+			return sizeof(short)*2;
+		case VET_HALF2:
+			return sizeof(UINT16)*2;
 		}
 
 		return 0;
@@ -77,6 +83,12 @@ namespace BansheeEngine
 			return 4;
 		case VET_UBYTE4:
 			return 4;
+		case VET_USHORT4_NORM:
+			return 4;
+		case VET_SHORT2_NORM:
+			return 2;
+		case VET_HALF2:
+			return 2;
 		}
 
 		BS_EXCEPT(InvalidParametersException, "Invalid type");
@@ -118,7 +130,8 @@ namespace BansheeEngine
 		return !(*this == rhs);
 	}
 
-	VertexDeclaration::VertexDeclaration(const VertexElementList& elements)
+	VertexDeclaration::VertexDeclaration(const VertexElementList& elements, const InstanceStepRateMap& instanceStepRates)
+		:mInstanceStepRates(instanceStepRates)
 	{
 		for (auto& elem : elements)
 		{
@@ -149,7 +162,7 @@ namespace BansheeEngine
 				return false;
 		}
 
-		return true;
+		return mInstanceStepRates == rhs.mInstanceStepRates;
 	}
 
 	bool VertexDeclaration::operator!= (const VertexDeclaration& rhs) const
@@ -212,6 +225,15 @@ namespace BansheeEngine
 		return size;
 	}
 
+	UINT32 VertexDeclaration::getInstanceStepRate(UINT16 source) const
+	{
+		auto iterFind = mInstanceStepRates.find(source);
+		if (iterFind != mInstanceStepRates.end())
+			return iterFind->second;
+
+		return 0;
+	}
+
 	/************************************************************************/
 	/* 								SERIALIZATION                      		*/
 	/************************************************************************/
@@ -41,6 +41,11 @@ namespace BansheeEngine
 		 */
 		ID3D11DeviceContext* getImmediateContext() const { return mImmediateContext; }
 
+		/**
+		 * @brief	Returns DX11.1 immediate context object, or null if the DX11.1 runtime is not available.
+		 */
+		ID3D11DeviceContext1* getImmediateContext1() const { return mImmediateContext1; }
+
 		/**
 		 * @brief	Returns DX11 class linkage object.
 		 */
@@ -78,6 +83,7 @@ namespace BansheeEngine
 
 		ID3D11Device* mD3D11Device;
 		ID3D11DeviceContext* mImmediateContext;
+		ID3D11DeviceContext1* mImmediateContext1;
 		ID3D11InfoQueue* mInfoQueue; 
 		ID3D11ClassLinkage* mClassLinkage;
 	};
@@ -7,13 +7,14 @@
 namespace BansheeEngine
 {
 	D3D11Device::D3D11Device() 
-		:mD3D11Device(nullptr), mImmediateContext(nullptr), mClassLinkage(nullptr)
+		:mD3D11Device(nullptr), mImmediateContext(nullptr), mImmediateContext1(nullptr), mClassLinkage(nullptr)
 	{
 	}
 
 	D3D11Device::D3D11Device(ID3D11Device* device)
 		: mD3D11Device(device)
 		, mImmediateContext(nullptr)
+		, mImmediateContext1(nullptr)
 		, mInfoQueue(nullptr)
 		, mClassLinkage(nullptr)
 	{
@@ -23,6 +24,10 @@ namespace BansheeEngine
 		{
 			device->GetImmediateContext(&mImmediateContext);
 
+			// Only available with the DX11.1 runtime
+			if (FAILED(mImmediateContext->QueryInterface(__uuidof(ID3D11DeviceContext1), (LPVOID*)&mImmediateContext1)))
+				mImmediateContext1 = nullptr;
+
 #if BS_DEBUG_MODE
 			// This interface is not available unless we created the device with debug layer
 			HRESULT hr = mD3D11Device->QueryInterface(__uuidof(ID3D11InfoQueue), (LPVOID*)&mInfoQueue);
@@ -60,6 +65,7 @@ namespace BansheeEngine
 
 		SAFE_RELEASE(mInfoQueue);
 		SAFE_RELEASE(mD3D11Device);
+		SAFE_RELEASE(mImmediateContext1);
 		SAFE_RELEASE(mImmediateContext);
 		SAFE_RELEASE(mClassLinkage);
 	}
@@ -54,6 +54,13 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
 	}
 
+	void D3D11GpuParamBlockBuffer::writeDataDiscard(const UINT8* data, UINT32 offset, UINT32 length)
+	{
+		mBuffer->writeData(offset, length, data, BufferWriteType::Discard);
+
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
+	}
+
 	void D3D11GpuParamBlockBuffer::readData(UINT8* data) const
 	{
 		mBuffer->readData(0, mSize, data);
@@ -97,8 +97,12 @@ namespace BansheeEngine
 			declElements[idx].Format				= D3D11Mappings::get(iter->getType());
 			declElements[idx].InputSlot				= iter->getStreamIdx();
 			declElements[idx].AlignedByteOffset		= static_cast<WORD>(iter->getOffset());
-			declElements[idx].InputSlotClass		= D3D11_INPUT_PER_VERTEX_DATA;
-			declElements[idx].InstanceDataStepRate	= 0;
+			declElements[idx].InstanceDataStepRate	= vertexBufferDecl->getInstanceStepRate(iter->getStreamIdx());
+
+			if(declElements[idx].InstanceDataStepRate > 0)
+				declElements[idx].InputSlotClass	= D3D11_INPUT_PER_INSTANCE_DATA;
+			else
+				declElements[idx].InputSlotClass	= D3D11_INPUT_PER_VERTEX_DATA;
 
 			idx++;
 		}
@@ -311,6 +311,15 @@ namespace BansheeEngine
 		case VET_SINT4:
 			return DXGI_FORMAT_R32G32B32A32_SINT;
 			break;
+		case VET_USHORT4_NORM:
+			return DXGI_FORMAT_R16G16B16A16_UNORM;
+			break;
+		case VET_SHORT2_NORM:
+			return DXGI_FORMAT_R16G16_SNORM;
+			break;
+		case VET_HALF2:
+			return DXGI_FORMAT_R16G16_FLOAT;
+			break;
 		}
 
 		// Unsupported type
@@ -519,6 +519,8 @@ namespace BansheeEngine
 		// TODO - I assign constant buffers one by one but it might be more efficient to do them all at once?
 
 		ID3D11Buffer* bufferArray[1];
+		ID3D11DeviceContext1* context1 = mDevice->getImmediateContext1();
+		bool supportsOffsets = mCurrentCapabilities->hasCapability(RSC_PARAM_BLOCK_OFFSETS);
 
 		for(auto iter = paramDesc.paramBlocks.begin(); iter != paramDesc.paramBlocks.end(); ++iter)
 		{
@@ -532,25 +534,54 @@ namespace BansheeEngine
 			else
 				bufferArray[0] = nullptr;
 
+			// Offset and size are specified in 16 byte constants, and must be multiples of 16 constants. Bind a range
+			// only if it fits in the buffer, otherwise the whole buffer is bound (which is always the case for normal,
+			// non-shared, buffers).
+			UINT32 offset = bindableParams->getParamBlockOffset(iter->second.slot);
+			UINT firstConstant = offset / 16;
+			UINT numConstants = ((iter->second.blockSize * sizeof(UINT32) + 255) / 256) * 16;
+
+			bool useOffset = false;
+			if (supportsOffsets && currentBlockBuffer != nullptr)
+				useOffset = (offset + numConstants * 16) <= currentBlockBuffer->getSize();
+
 			switch(gptype)
 			{
 			case GPT_VERTEX_PROGRAM:
-				mDevice->getImmediateContext()->VSSetConstantBuffers(iter->second.slot, 1, bufferArray);
+				if (useOffset)
+					context1->VSSetConstantBuffers1(iter->second.slot, 1, bufferArray, &firstConstant, &numConstants);
+				else
+					mDevice->getImmediateContext()->VSSetConstantBuffers(iter->second.slot, 1, bufferArray);
 				break;
 			case GPT_FRAGMENT_PROGRAM:
-				mDevice->getImmediateContext()->PSSetConstantBuffers(iter->second.slot, 1, bufferArray);
+				if (useOffset)
+					context1->PSSetConstantBuffers1(iter->second.slot, 1, bufferArray, &firstConstant, &numConstants);
+				else
+					mDevice->getImmediateContext()->PSSetConstantBuffers(iter->second.slot, 1, bufferArray);
 				break;
 			case GPT_GEOMETRY_PROGRAM:
-				mDevice->getImmediateContext()->GSSetConstantBuffers(iter->second.slot, 1, bufferArray);
+				if (useOffset)
+					context1->GSSetConstantBuffers1(iter->second.slot, 1, bufferArray, &firstConstant, &numConstants);
+				else
+					mDevice->getImmediateContext()->GSSetConstantBuffers(iter->second.slot, 1, bufferArray);
 				break;
 			case GPT_HULL_PROGRAM:
-				mDevice->getImmediateContext()->HSSetConstantBuffers(iter->second.slot, 1, bufferArray);
+				if (useOffset)
+					context1->HSSetConstantBuffers1(iter->second.slot, 1, bufferArray, &firstConstant, &numConstants);
+				else
+					mDevice->getImmediateContext()->HSSetConstantBuffers(iter->second.slot, 1, bufferArray);
 				break;
 			case GPT_DOMAIN_PROGRAM:
-				mDevice->getImmediateContext()->DSSetConstantBuffers(iter->second.slot, 1, bufferArray);
+				if (useOffset)
+					context1->DSSetConstantBuffers1(iter->second.slot, 1, bufferArray, &firstConstant, &numConstants);
+				else
+					mDevice->getImmediateContext()->DSSetConstantBuffers(iter->second.slot, 1, bufferArray);
 				break;
 			case GPT_COMPUTE_PROGRAM:
-				mDevice->getImmediateContext()->CSSetConstantBuffers(iter->second.slot, 1, bufferArray);
+				if (useOffset)
+					context1->CSSetConstantBuffers1(iter->second.slot, 1, bufferArray, &firstConstant, &numConstants);
+				else
+					mDevice->getImmediateContext()->CSSetConstantBuffers(iter->second.slot, 1, bufferArray);
 				break;
 			};
 
@@ -577,6 +608,7 @@ namespace BansheeEngine
 		UINT32 primCount = vertexCountToPrimCount(mActiveDrawOp, vertexCount);
 
 		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumInstances, 1);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
@@ -597,10 +629,32 @@ namespace BansheeEngine
 		UINT32 primCount = vertexCountToPrimCount(mActiveDrawOp, vertexCount);
 
 		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumInstances, 1);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
 
+	void D3D11RenderSystem::drawIndexedInstanced(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		applyInputLayout();
+
+		mDevice->getImmediateContext()->DrawIndexedInstanced(indexCount, instanceCount, startIndex, vertexOffset, 0);
+
+#if BS_DEBUG_MODE
+		if(mDevice->hasError())
+			LOGWRN(mDevice->getErrorDescription());
+#endif
+
+		UINT32 primCount = vertexCountToPrimCount(mActiveDrawOp, vertexCount);
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumInstances, instanceCount);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount * instanceCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, primCount * instanceCount);
+	}
+
 	void D3D11RenderSystem::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
 	{
 		THROW_IF_NOT_CORE_THREAD;
@@ -754,6 +808,22 @@ namespace BansheeEngine
 		rsc->setCapability(RSC_STENCIL_WRAP);
 		rsc->setCapability(RSC_HWOCCLUSION);
 		rsc->setCapability(RSC_HWOCCLUSION_ASYNCHRONOUS);
+		rsc->setCapability(RSC_INSTANCING);
+
+		if (mDevice->getImmediateContext1() != nullptr)
+		{
+			D3D11_FEATURE_DATA_D3D11_OPTIONS options;
+			ZeroMemory(&options, sizeof(options));
+
+			HRESULT hr = mDevice->getD3D11Device()->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options));
+			if (SUCCEEDED(hr) && options.ConstantBufferOffsetting)
+			{
+				rsc->setCapability(RSC_PARAM_BLOCK_OFFSETS);
+
+				// Offsets are specified in multiples of 16 constants, 16 bytes each
+				rsc->setParamBlockOffsetAlignment(256);
+			}
+		}
 
 		if(mFeatureLevel >= D3D_FEATURE_LEVEL_10_1)
 			rsc->setMaxBoundVertexBuffers(32);
@@ -21,7 +21,8 @@ namespace BansheeEngine
 		/**
 		 * @copydoc	HardwareBufferManager::createVertexDeclarationImpl
 		 */
-		VertexDeclarationPtr createVertexDeclarationImpl(const VertexDeclaration::VertexElementList& elements);
+		VertexDeclarationPtr createVertexDeclarationImpl(const VertexDeclaration::VertexElementList& elements,
+			const VertexDeclaration::InstanceStepRateMap& instanceStepRates);
 
 		/**
 		 * @copydoc HardwareBufferManager::createVertexBufferImpl
@@ -124,6 +124,11 @@ namespace BansheeEngine
 		 */
 		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount);
 
+		/**
+		 * @copydoc RenderSystem::drawIndexedInstanced()
+		 */
+		void drawIndexedInstanced(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount);
+
 		/**
 		 * @copydoc RenderSystem::setScissorRect()
 		 */
@@ -567,5 +572,6 @@ namespace BansheeEngine
 		RECT mScissorRect;
 
 		DrawOperationType mCurrentDrawOperation;
+		VertexDeclarationPtr mActiveVertexDeclaration;
 	};
 }
\ No newline at end of file
@@ -35,7 +35,8 @@ namespace BansheeEngine
 	protected:
 		friend class D3D9HardwareBufferManager;
 
-		D3D9VertexDeclaration(const VertexDeclaration::VertexElementList& elements);
+		D3D9VertexDeclaration(const VertexDeclaration::VertexElementList& elements, 
+			const VertexDeclaration::InstanceStepRateMap& instanceStepRates);
 
 		/**
 		 * @brief	Releases the internal DirectX 9 vertex declaration object.
@@ -48,9 +48,10 @@ namespace BansheeEngine
 		return bs_core_ptr<D3D9GpuBuffer, PoolAlloc>(buffer);
 	}
 
-	VertexDeclarationPtr D3D9HardwareBufferManager::createVertexDeclarationImpl(const VertexDeclaration::VertexElementList& elements)
+	VertexDeclarationPtr D3D9HardwareBufferManager::createVertexDeclarationImpl(const VertexDeclaration::VertexElementList& elements,
+		const VertexDeclaration::InstanceStepRateMap& instanceStepRates)
     {
-		D3D9VertexDeclaration* decl = new (bs_alloc<D3D9VertexDeclaration, PoolAlloc>()) D3D9VertexDeclaration(elements);
+		D3D9VertexDeclaration* decl = new (bs_alloc<D3D9VertexDeclaration, PoolAlloc>()) D3D9VertexDeclaration(elements, instanceStepRates);
 		return bs_core_ptr<D3D9VertexDeclaration, PoolAlloc>(decl);
     }
 }
@@ -361,6 +361,15 @@ namespace BansheeEngine
         case VET_UBYTE4:
             return D3DDECLTYPE_UBYTE4;
             break;
+		case VET_USHORT4_NORM:
+			return D3DDECLTYPE_USHORT4N;
+			break;
+		case VET_SHORT2_NORM:
+			return D3DDECLTYPE_SHORT2N;
+			break;
+		case VET_HALF2:
+			return D3DDECLTYPE_FLOAT16_2;
+			break;
 		}
 
 		return D3DDECLTYPE_FLOAT3;
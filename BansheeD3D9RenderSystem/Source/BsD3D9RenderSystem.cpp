@@ -1152,6 +1152,8 @@ namespace BansheeEngine
 		{
 			BS_EXCEPT(RenderingAPIException, "Unable to set D3D9 vertex declaration");
 		}
+
+		mActiveVertexDeclaration = decl;
 	}
 
 	void D3D9RenderSystem::setVertexBuffers(UINT32 index, VertexBufferPtr* buffers, UINT32 numBuffers)
@@ -1222,6 +1224,7 @@ namespace BansheeEngine
 		}
 
 		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumInstances, 1);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
@@ -1247,10 +1250,79 @@ namespace BansheeEngine
 		}
 
 		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumInstances, 1);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
 
+	void D3D9RenderSystem::drawIndexedInstanced(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
+	{
+		if (mActiveVertexDeclaration == nullptr)
+		{
+			LOGWRN("Cannot draw instanced because vertex declaration is not set.");
+			return;
+		}
+
+		IDirect3DDevice9* device = getActiveD3D9Device();
+
+		// D3D9 doesn't store step rates in the declaration, instead every stream used by it needs a frequency
+		bool usedStreams[MAX_BOUND_VERTEX_BUFFERS];
+		bool instancedStreams[MAX_BOUND_VERTEX_BUFFERS];
+		memset(usedStreams, 0, sizeof(usedStreams));
+		memset(instancedStreams, 0, sizeof(instancedStreams));
+
+		for (auto& elem : mActiveVertexDeclaration->getElements())
+		{
+			UINT16 streamIdx = elem.getStreamIdx();
+			if (streamIdx >= MAX_BOUND_VERTEX_BUFFERS)
+				continue;
+
+			usedStreams[streamIdx] = true;
+			if (mActiveVertexDeclaration->getInstanceStepRate(streamIdx) > 0)
+				instancedStreams[streamIdx] = true;
+		}
+
+		for (UINT32 i = 0; i < MAX_BOUND_VERTEX_BUFFERS; i++)
+		{
+			if (!usedStreams[i])
+				continue;
+
+			if (instancedStreams[i])
+				device->SetStreamSourceFreq(i, D3DSTREAMSOURCE_INSTANCEDATA | 1);
+			else
+				device->SetStreamSourceFreq(i, D3DSTREAMSOURCE_INDEXEDDATA | instanceCount);
+		}
+
+		UINT32 primCount = vertexCountToPrimCount(mCurrentDrawOperation, indexCount);
+
+		HRESULT hr = device->DrawIndexedPrimitive(
+			getD3D9PrimitiveType(), 
+			static_cast<UINT>(vertexOffset), 
+			0, 
+			static_cast<UINT>(vertexCount), 
+			static_cast<UINT>(startIndex), 
+			static_cast<UINT>(primCount)
+			);
+
+		// Restore default frequencies so non-instanced draws aren't affected
+		for (UINT32 i = 0; i < MAX_BOUND_VERTEX_BUFFERS; i++)
+		{
+			if (usedStreams[i])
+				device->SetStreamSourceFreq(i, 1);
+		}
+
+		if(FAILED(hr))
+		{
+			String msg = DXGetErrorDescription(hr);
+			BS_EXCEPT(RenderingAPIException, "Failed to DrawIndexedPrimitive : " + msg);
+		}
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumInstances, instanceCount);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount * instanceCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, primCount * instanceCount);
+	}
+
 	void D3D9RenderSystem::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
 	{
 		THROW_IF_NOT_CORE_THREAD;
@@ -1767,6 +1839,8 @@ namespace BansheeEngine
 		// Vertex textures
 		if (rsc->isShaderProfileSupported("vs_3_0"))
 		{
+			// Stream frequency based instancing is available with SM3 hardware
+			rsc->setCapability(RSC_INSTANCING);
 			rsc->setCapability(RSC_VERTEX_TEXTURE_FETCH);
 			rsc->setNumTextureUnits(GPT_VERTEX_PROGRAM, 4);
 			rsc->setNumCombinedTextureUnits(rsc->getNumTextureUnits(GPT_FRAGMENT_PROGRAM) +
@@ -10,8 +10,9 @@
 
 namespace BansheeEngine 
 {
-	D3D9VertexDeclaration::D3D9VertexDeclaration(const VertexDeclaration::VertexElementList& elements)
-		:VertexDeclaration(elements)
+	D3D9VertexDeclaration::D3D9VertexDeclaration(const VertexDeclaration::VertexElementList& elements, 
+		const VertexDeclaration::InstanceStepRateMap& instanceStepRates)
+		:VertexDeclaration(elements, instanceStepRates)
     { }
 
     D3D9VertexDeclaration::~D3D9VertexDeclaration()
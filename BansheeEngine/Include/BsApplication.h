@@ -33,7 +33,7 @@ namespace BansheeEngine
 	class BS_EXPORT Application : public CoreApplication
 	{
 	public:
-		Application(RENDER_WINDOW_DESC& primaryWindowDesc, RenderSystemPlugin renderSystem, RendererPlugin renderer);
+		Application(RENDER_WINDOW_DESC& primaryWindowDesc, RenderSystemPlugin renderSystem, RendererPlugin renderer, const Path& importCacheFolder);
 		virtual ~Application();
 
 		/**
@@ -42,8 +42,12 @@ namespace BansheeEngine
 		 * @param	primaryWindowDesc	Description of the primary render window that will be created on startup.
 		 * @param	renderSystem		Render system to use.
 		 * @param	renderer			Renderer to use.
+		 * @param	importCacheFolder	Folder in which to cache imported resources, so resources imported on every
+		 *								start-up (like the built-in ones) don't need to be imported again. Leave
+		 *								empty to disable the import cache.
 		 */
-		static void startUp(RENDER_WINDOW_DESC& primaryWindowDesc, RenderSystemPlugin renderSystem, RendererPlugin renderer = RendererPlugin::Default);
+		static void startUp(RENDER_WINDOW_DESC& primaryWindowDesc, RenderSystemPlugin renderSystem, RendererPlugin renderer = RendererPlugin::Default, 
+			const Path& importCacheFolder = Path::BLANK);
 
 		/**
 		 * @brief	Returns the primary viewport of the application.
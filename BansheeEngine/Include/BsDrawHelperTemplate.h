@@ -5,6 +5,7 @@
 
 #include "BsPrerequisites.h"
 #include "BsDebugDrawMaterialInfo.h"
+#include "BsDrawOps.h"
 #include "BsColor.h"
 #include "BsAABox.h"
 
@@ -35,7 +36,8 @@ namespace BansheeEngine
 	 */
 	struct DebugDrawCommand
 	{
-		HMesh mesh;
+		MeshDataPtr meshData;
+		DrawOperationType drawOp;
 
 		DebugDraw2DClipSpaceMatInfo matInfo2DClipSpace;
 		DebugDraw2DScreenSpaceMatInfo matInfo2DScreenSpace;
@@ -53,13 +55,23 @@ namespace BansheeEngine
 	class BS_EXPORT DrawHelperTemplateBase
 	{
 	public:
+		DrawHelperTemplateBase();
+
 		/**
 		 * @brief	Called by the renderer when it is ready to render objects into the provided camera.
+		 *
+		 * @note	Geometry of all commands is uploaded into a streaming mesh heap every frame, so commands that
+		 *			are displayed for multiple frames don't need a mesh of their own.
 		 */
 		void render(const HCamera& camera, DrawList& drawList);
 
 	protected:
+		static const UINT32 MESH_HEAP_INITIAL_NUM_VERTS;
+		static const UINT32 MESH_HEAP_INITIAL_NUM_INDICES;
+
 		UnorderedMap<const Viewport*, Vector<DebugDrawCommand>> mCommandsPerViewport;
+		MeshHeapPtr mMeshHeap;
+		unsigned long mLastFrameNumber;
 	};
 
 	/**
@@ -131,6 +131,13 @@ namespace BansheeEngine
 		 */
 		void _markAsClean() { mIsDirty = 0; }
 
+		/**
+		 * @brief	Marks the elements contents as dirty, which causes the sprite meshes to be recreated from scratch.
+		 *
+		 * @note	Internal method.
+		 */
+		void _markContentAsDirty() { markContentAsDirty(); }
+
 		/**
 		 * @brief	Returns true if render elements need to be recalculated by calling updateRenderElements.
 		 *
@@ -49,14 +49,16 @@ namespace BansheeEngine
 		struct GUIRenderData
 		{
 			GUIRenderData()
-				:isDirty(true)
+				:isDirty(true), isStreaming(false)
 			{ }
 
 			Vector<TransientMeshPtr> cachedMeshes;
+			Vector<MeshDataPtr> cachedMeshData;
 			Vector<GUIMaterialInfo> cachedMaterials;
 			Vector<GUIWidget*> cachedWidgetsPerMesh;
 			Vector<GUIWidget*> widgets;
 			bool isDirty;
+			bool isStreaming;
 		};
 
 		/**
@@ -341,6 +343,7 @@ namespace BansheeEngine
 		Vector<WidgetInfo> mWidgets;
 		UnorderedMap<const Viewport*, GUIRenderData> mCachedGUIData;
 		MeshHeapPtr mMeshHeap;
+		MeshHeapPtr mStreamingMeshHeap;
 
 		VertexDataDescPtr mVertexDesc;
 
@@ -385,6 +388,8 @@ namespace BansheeEngine
 		HSpriteTexture mTextSelectionTexture;
 		Color mTextSelectionColor;
 
+		UINT32 mStringTableVersion;
+
 		Map<const RenderTexture*, const GUIElement*> mInputBridge;
 
 		HEvent mOnPointerMovedConn;
@@ -78,10 +78,12 @@ namespace BansheeEngine
 	class GUIDropDownHitBox;
 	class RenderableProxy;
 	class RenderableHandler;
+	class StaticBatcher;
 	class ProfilerOverlay;
 
 	// 2D
 	class TextSprite;
+	class TextDataCache;
 	class ImageSprite;
 	class SpriteTexture;
 	class OverlayManager;
@@ -92,6 +94,7 @@ namespace BansheeEngine
 	class Camera;
 
 	typedef std::shared_ptr<TextSprite> TextSpritePtr;
+	typedef std::shared_ptr<TextData> TextDataPtr;
 	typedef std::shared_ptr<SpriteTexture> SpriteTexturePtr;
 	typedef std::shared_ptr<Overlay> OverlayPtr;
 	typedef std::shared_ptr<Camera> CameraPtr;
@@ -14,13 +14,25 @@ namespace BansheeEngine
 	struct BS_EXPORT RenderQueueElement
 	{
 		RenderQueueElement()
-			:passIdx(0)
+			:passIdx(0), instanceOffset(0), numInstances(0)
 		{ }
 
 		RenderableElement* renderElem;
 		MaterialProxyPtr material;
 		MeshProxyPtr mesh;
 		UINT32 passIdx;
+
+		/**
+		 * @brief	Index of the first renderable element to draw, in the list returned by 
+		 *			RenderQueue::getSortedInstances. Only relevant if ::numInstances is non-zero.
+		 */
+		UINT32 instanceOffset;
+
+		/**
+		 * @brief	Number of renderable elements to draw with a single instanced draw call. Zero
+		 *			if the element isn't instanced.
+		 */
+		UINT32 numInstances;
 	};
 
 	/**
@@ -53,6 +65,16 @@ namespace BansheeEngine
 		 */
 		void add(RenderableElement* element, float distFromCamera);
 
+		/**
+		 * @brief	Adds a new entry to the render queue, rendering the element using a different mesh than its 
+		 *			own (e.g. one of its levels of detail).
+		 *
+		 * @param	element			Renderable element to add to the queue.
+		 * @param	mesh			Mesh to render the element with.
+		 * @param	distFromCamera	Distance of this object from the camera. Used for distance sorting.
+		 */
+		void add(RenderableElement* element, const MeshProxyPtr& mesh, float distFromCamera);
+
 		/**
 		 * @brief	Adds a new entry to the render queue.
 		 *
@@ -74,6 +96,10 @@ namespace BansheeEngine
 		
 		/**
 		 * @brief	Sorts all the render operations using user-defined rules.
+		 *
+		 * @note	Renderable elements whose shader allows instancing are merged with other elements
+		 *			using the same material and mesh within the same priority group, unless they 
+		 *			are sorted back to front.
 		 */
 		virtual void sort();
 
@@ -83,6 +109,12 @@ namespace BansheeEngine
 		 */
 		const Vector<RenderQueueElement>& getSortedElements() const;
 
+		/**
+		 * @brief	Returns a list of renderable elements referenced by instanced render 
+		 *			elements. Caller must ensure "sort" is called before this method.
+		 */
+		const Vector<RenderableElement*>& getSortedInstances() const;
+
 	protected:
 		/**
 		 * @brief	Callback used for sorting elements.
@@ -91,5 +123,6 @@ namespace BansheeEngine
 
 		Set<SortData, std::function<bool(const SortData&, const SortData&)>> mRenderElements;
 		Vector<RenderQueueElement> mSortedRenderElements;
+		Vector<RenderableElement*> mSortedInstances;
 	};
 }
\ No newline at end of file
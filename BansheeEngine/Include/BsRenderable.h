@@ -70,6 +70,26 @@ namespace BansheeEngine
 		 */
 		UINT64 getLayer() const { return mLayer; }
 
+		/**
+		 * @brief	Marks the renderable as static. Static renderables are expected to never move,
+		 *			which allows the renderer to merge them with other static renderables using
+		 *			the same material, and draw them together with a single draw call.
+		 *
+		 * @note	Moving a static renderable is allowed but expensive, as the whole batch
+		 *			it is part of needs to be rebuilt.
+		 */
+		void setIsStatic(bool isStatic);
+
+		/**
+		 * @brief	Checks is the renderable static. See ::setIsStatic.
+		 */
+		bool getIsStatic() const { return mIsStatic; }
+
+		/**
+		 * @brief	Returns the mesh to render.
+		 */
+		HMesh getMesh() const { return mMeshData.mesh; }
+
 		/**
 		 * @brief	Returns the material used for rendering a sub-mesh with
 		 *			the specified index.
@@ -126,6 +146,7 @@ namespace BansheeEngine
 		MeshData mMeshData;
 		Vector<MaterialData> mMaterialData;
 		UINT64 mLayer;
+		bool mIsStatic;
 		Vector<AABox> mWorldBounds;
 
 		RenderableProxyPtr mActiveProxy;
@@ -155,6 +176,6 @@ namespace BansheeEngine
 		virtual RTTITypeBase* getRTTI() const;
 
 	protected:
-		Renderable() {} // Serialization only
+		Renderable() :mIsStatic(false) {} // Serialization only
 	};
 }
\ No newline at end of file
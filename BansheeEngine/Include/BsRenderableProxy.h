@@ -41,6 +41,18 @@ namespace BansheeEngine
 		 */
 		MeshProxyPtr mesh;
 
+		/**
+		 * @brief	Proxies of the sub-mesh in simplified levels of detail, starting with the first level after
+		 *			the full detail one.
+		 */
+		Vector<MeshProxyPtr> lodMeshes;
+
+		/**
+		 * @brief	Screen sizes below which the matching entry in ::lodMeshes should be rendered instead
+		 *			of the full detail mesh. See MeshBase::getLODScreenSize.
+		 */
+		Vector<float> lodScreenSizes;
+
 		/**
 		 * @brief	Proxy of the material to render the mesh with.
 		 */
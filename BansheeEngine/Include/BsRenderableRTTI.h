@@ -19,6 +19,9 @@ namespace BansheeEngine
 		UINT64& getLayer(Renderable* obj) { return obj->mLayer; }
 		void setLayer(Renderable* obj, UINT64& val) { obj->mLayer = val; }
 
+		bool& getIsStatic(Renderable* obj) { return obj->mIsStatic; }
+		void setIsStatic(Renderable* obj, bool& val) { obj->mIsStatic = val; }
+
 		HMaterial& getMaterial(Renderable* obj, UINT32 idx) { return obj->mMaterialData[idx].material; }
 		void setMaterial(Renderable* obj, UINT32 idx, HMaterial& val) { obj->setMaterial(idx, val); }
 		UINT32 getNumMaterials(Renderable* obj) { return (UINT32)obj->mMaterialData.size(); }
@@ -30,6 +33,7 @@ namespace BansheeEngine
 			addReflectableField("mMesh", 0, &RenderableRTTI::getMesh, &RenderableRTTI::setMesh);
 			addPlainField("mLayer", 1, &RenderableRTTI::getLayer, &RenderableRTTI::setLayer);
 			addReflectableArrayField("mMaterials", 2, &RenderableRTTI::getMaterial, &RenderableRTTI::getNumMaterials, &RenderableRTTI::setMaterial, &RenderableRTTI::setNumMaterials);
+			addPlainField("mIsStatic", 3, &RenderableRTTI::getIsStatic, &RenderableRTTI::setIsStatic);
 		}
 
 		virtual const String& getRTTIName()
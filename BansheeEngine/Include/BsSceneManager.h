@@ -18,16 +18,6 @@ namespace BansheeEngine
 		SceneManager() {}
 		virtual ~SceneManager() {}
 
-		/**
-		 * @brief	Returns all cameras in the scene.
-		 */
-		virtual const Vector<HCamera>& getAllCameras() const = 0;
-
-		/**
-		 * @brief	Returns all renderables in the scene.
-		 */
-		virtual const Vector<HRenderable>& getAllRenderables() const = 0;
-
 		/**
 		 * @brief	Updates dirty transforms on any scene objects with a Renderable component.
 		 */
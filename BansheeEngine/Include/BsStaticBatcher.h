@@ -0,0 +1,150 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsRenderableProxy.h"
+#include "BsSubMesh.h"
+#include "BsMatrix4.h"
+#include "BsUUID.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Merges sub-meshes of static renderables into combined meshes so they can be rendered
+	 *			with a single draw call. Sub-meshes are grouped by their material and by a cell of a uniform
+	 *			spatial grid, so each batch remains compact enough to be culled as a whole.
+	 *
+	 *			Batches are cached between frames and only batches whose members changed are rebuilt.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_EXPORT StaticBatcher
+	{
+	public:
+		/**
+		 * @brief	Uniquely identifies a batch. Only sub-meshes with the same key can be merged.
+		 */
+		struct BatchKey
+		{
+			bool operator< (const BatchKey& rhs) const;
+
+			Guid material;
+			UINT64 layer;
+			size_t vertexLayout;
+			INT32 cellX, cellY, cellZ;
+		};
+
+		/**
+		 * @brief	A single sub-mesh of a static renderable that is part of a batch.
+		 */
+		struct BatchMember
+		{
+			UINT64 renderableId;
+			HMesh mesh;
+			UINT32 subMeshIdx;
+			Matrix4 worldTransform;
+		};
+
+		/**
+		 * @brief	Group of sub-meshes merged into a single mesh.
+		 */
+		struct Batch
+		{
+			HMaterial material;
+			UINT64 layer;
+			Vector<BatchMember> members;
+
+			HMesh mesh; /**< Merged mesh in world space, contains a single sub-mesh spanning all members. */
+			Vector<SubMesh> memberRanges; /**< Index ranges of individual members in the merged mesh, in same order as "members". */
+			RenderableProxyPtr proxy;
+			bool isDirty;
+		};
+
+	public:
+		/**
+		 * @brief	Constructs a new batcher.
+		 *
+		 * @param	cellSize	Size of a single cell of the grid used for spatially grouping sub-meshes, in world units.
+		 */
+		StaticBatcher(float cellSize = 50.0f);
+		~StaticBatcher();
+
+		/**
+		 * @brief	Adds a static renderable to the batches, or refreshes its batches if it was added before.
+		 *			Should be called whenever the renderable or its transform changes.
+		 *
+		 * @return	False if the renderable cannot be batched, in which case it must be rendered normally.
+		 *			This happens if its resources aren't loaded yet, or if it has sub-meshes that
+		 *			aren't triangle lists.
+		 */
+		bool addRenderable(const HRenderable& renderable);
+
+		/**
+		 * @brief	Removes a previously added renderable from its batches. Does nothing if
+		 *			the renderable isn't part of any batch.
+		 */
+		void removeRenderable(const HRenderable& renderable);
+
+		/**
+		 * @brief	Checks is the renderable part of any batch.
+		 */
+		bool isBatched(const HRenderable& renderable) const;
+
+		/**
+		 * @brief	Rebuilds all batches whose members changed since the last call.
+		 *
+		 * @param	addedProxies	Output list of proxies of rebuilt batches, to be added to the renderer.
+		 * @param	removedProxies	Output list of proxies of rebuilt or removed batches, to be removed from the renderer.
+		 *
+		 * @note	Source mesh data of newly added meshes is read from the GPU, which blocks until the core thread
+		 *			finishes all queued commands.
+		 */
+		void update(Vector<RenderableProxyPtr>& addedProxies, Vector<RenderableProxyPtr>& removedProxies);
+
+		/**
+		 * @brief	Returns all current batches.
+		 */
+		const Map<BatchKey, Batch*>& getBatches() const { return mBatches; }
+
+	private:
+		/**
+		 * @brief	Cached CPU copy of a mesh used by one or multiple batch members.
+		 */
+		struct SourceMesh
+		{
+			HMesh mesh;
+			MeshDataPtr data;
+			UINT32 numReferences;
+		};
+
+		/**
+		 * @brief	Reads data of all source meshes that aren't cached yet.
+		 */
+		void readSourceMeshes();
+
+		/**
+		 * @brief	Creates a new merged mesh and a proxy for the provided batch.
+		 */
+		void buildBatch(Batch& batch);
+
+		/**
+		 * @brief	Creates mesh data containing only the vertices and indices used by the provided sub-mesh,
+		 *			transformed into world space. Output always uses 32-bit indices. Quantized positions and
+		 *			directions are decoded into floating point values.
+		 */
+		static MeshDataPtr createMemberData(const MeshData& source, const SubMesh& subMesh, const Matrix4& worldTransform);
+
+		/**
+		 * @brief	Returns a hash value identifying the layout of vertices described by the provided description.
+		 */
+		static size_t getVertexLayout(const VertexDataDesc& vertexDesc);
+
+		float mCellSize;
+
+		Map<BatchKey, Batch*> mBatches;
+		UnorderedMap<UINT64, Vector<BatchKey>> mRenderableBatches;
+		UnorderedMap<Guid, SourceMesh> mSourceMeshes;
+	};
+}
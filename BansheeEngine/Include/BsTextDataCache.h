@@ -0,0 +1,126 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsModule.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Keeps a bounded set of recently laid out text, so identical strings don't need
+	 *			to be laid out over and over. Least recently used entries are discarded once the
+	 *			cache is full.
+	 *
+	 *			Glyphs of dynamic fonts are only kept resident while the returned text data is referenced
+	 *			outside of the cache. If the glyph cache evicts glyphs while a cached text isn't in use, the
+	 *			text is laid out again on next request.
+	 *
+	 * @note	Returned text data is immutable and may be shared by any number of users. Entries
+	 *			discarded from the cache stay valid for as long as someone references them.
+	 *
+	 *			Thread safe.
+	 */
+	class BS_EXPORT TextDataCache : public Module<TextDataCache>
+	{
+		/**
+		 * @brief	Uniquely identifies a single laid out text.
+		 */
+		struct Key
+		{
+			Key(const WString& text, const Font* font, UINT32 fontSize, UINT32 width, bool wordWrap);
+
+			WString text;
+			const Font* font;
+			UINT32 fontSize;
+			UINT32 width;
+			bool wordWrap;
+			size_t hash;
+		};
+
+		struct KeyHash
+		{
+			size_t operator()(const Key& key) const { return key.hash; }
+		};
+
+		struct KeyEqual
+		{
+			bool operator()(const Key& a, const Key& b) const;
+		};
+
+		struct Entry
+		{
+			TextDataPtr textData;
+			std::weak_ptr<TextData> userData; /**< Pointer handed out to users, releases the glyphs once destroyed. */
+			List<const Key*>::iterator lruIter;
+		};
+
+		/**
+		 * @brief	Deleter of the pointers handed out to users. Releases the glyph reference taken when the
+		 *			pointer was created, and the reference to the text data.
+		 */
+		struct UserDataDeleter
+		{
+			UserDataDeleter(const TextDataPtr& textData);
+
+			void operator()(TextData* ptr);
+
+			TextDataPtr textData;
+		};
+
+	public:
+		TextDataCache(UINT32 maxEntries = 1024);
+
+		/**
+		 * @brief	Returns laid out text for the provided parameters, either from the cache or by
+		 *			laying it out and adding it to the cache. Parameters match the ones of TextData.
+		 */
+		TextDataPtr getTextData(const WString& text, const HFont& font, UINT32 fontSize, UINT32 width, bool wordWrap);
+
+		/**
+		 * @brief	Sets the maximum number of entries to keep in the cache.
+		 */
+		void setMaxEntries(UINT32 maxEntries);
+
+		/**
+		 * @brief	Returns the maximum number of entries kept in the cache.
+		 */
+		UINT32 getMaxEntries() const { return mMaxEntries; }
+
+		/**
+		 * @brief	Removes all entries from the cache.
+		 */
+		void clear();
+
+	private:
+		/**
+		 * @brief	Finds an entry for the provided key and returns a user pointer to its text data. Returns null
+		 *			if there is no entry, or if the entry's glyphs were evicted in which case it is removed.
+		 *
+		 * @note	Caller must hold the cache mutex.
+		 */
+		TextDataPtr findUserData(const Key& key);
+
+		/**
+		 * @brief	Creates a new user pointer for the text data of the provided entry. Caller must have added a glyph
+		 *			reference to the text data, which the pointer releases once it is destroyed.
+		 *
+		 * @note	Caller must hold the cache mutex.
+		 */
+		TextDataPtr createUserData(Entry& entry);
+
+		/**
+		 * @brief	Removes least recently used entries until the number of entries is in the limit.
+		 *
+		 * @note	Caller must hold the cache mutex.
+		 */
+		void trim();
+
+		UnorderedMap<Key, Entry, KeyHash, KeyEqual> mEntries;
+		List<const Key*> mLRU; // Most recently used entry first
+		UINT32 mMaxEntries;
+
+		BS_MUTEX(mMutex);
+	};
+}
@@ -59,6 +59,9 @@ namespace BansheeEngine
 
 		/**
 		 * @brief	Recreates internal sprite data according the specified description structure.
+		 *
+		 * @note	Text layout is retrieved from TextDataCache. If neither the layout nor its placement
+		 *			changed since the last update, the existing quads are kept.
 		 */
 		void update(const TEXT_SPRITE_DESC& desc);
 
@@ -116,5 +119,14 @@ namespace BansheeEngine
 		static UINT32 genTextQuads(const TextData& textData, UINT32 width, UINT32 height, 
 			TextHorzAlign horzAlign, TextVertAlign vertAlign, SpriteAnchor anchor, Vector2* vertices, Vector2* uv, UINT32* indices, 
 			UINT32 bufferSizeQuads);
+
+	private:
+		TextDataPtr mTextData;
+		UINT32 mWidth;
+		UINT32 mHeight;
+		SpriteAnchor mAnchor;
+		TextHorzAlign mHorzAlign;
+		TextVertAlign mVertAlign;
+		Color mColor;
 	};
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "BsGUIMaterialManager.h"
 #include "BsGUIManager.h"
 #include "BsOverlayManager.h"
+#include "BsTextDataCache.h"
 #include "BsDrawHelper2D.h"
 #include "BsDrawHelper3D.h"
 #include "BsBuiltinMaterialManager.h"
@@ -19,7 +20,7 @@
 
 namespace BansheeEngine
 {
-	START_UP_DESC createStartUpDesc(RENDER_WINDOW_DESC& primaryWindowDesc, const String& renderSystem, const String& renderer)
+	START_UP_DESC createStartUpDesc(RENDER_WINDOW_DESC& primaryWindowDesc, const String& renderSystem, const String& renderer, const Path& importCacheFolder)
 	{
 		START_UP_DESC desc;
 		desc.renderSystem = renderSystem;
@@ -31,12 +32,13 @@ namespace BansheeEngine
 		desc.importers.push_back("BansheeFreeImgImporter");
 		desc.importers.push_back("BansheeFBXImporter");
 		desc.importers.push_back("BansheeFontImporter");
+		desc.importCacheFolder = importCacheFolder;
 
 		return desc;
 	}
 
-	Application::Application(RENDER_WINDOW_DESC& primaryWindowDesc, RenderSystemPlugin renderSystem, RendererPlugin renderer)
-		:CoreApplication(createStartUpDesc(primaryWindowDesc, getLibNameForRenderSystem(renderSystem), getLibNameForRenderer(renderer))),
+	Application::Application(RENDER_WINDOW_DESC& primaryWindowDesc, RenderSystemPlugin renderSystem, RendererPlugin renderer, const Path& importCacheFolder)
+		:CoreApplication(createStartUpDesc(primaryWindowDesc, getLibNameForRenderSystem(renderSystem), getLibNameForRenderer(renderer), importCacheFolder)),
 		mMonoPlugin(nullptr), mSBansheeEnginePlugin(nullptr)
 	{
 		VirtualInput::startUp();
@@ -44,6 +46,7 @@ namespace BansheeEngine
 		GUIManager::startUp();
 		GUIMaterialManager::startUp();
 		OverlayManager::startUp();
+		TextDataCache::startUp();
 
 		BuiltinMaterialManager::startUp();
 		BuiltinMaterialManager::instance().addFactory(bs_new<D3D9BuiltinMaterialFactory>());
@@ -82,6 +85,7 @@ namespace BansheeEngine
 
 		BuiltinMaterialManager::shutDown();
 
+		TextDataCache::shutDown();
 		OverlayManager::shutDown();
 		GUIManager::shutDown();
 		GUIMaterialManager::shutDown();
@@ -96,9 +100,9 @@ namespace BansheeEngine
 		Cursor::instance().setCursor(CursorType::Arrow);
 	}
 
-	void Application::startUp(RENDER_WINDOW_DESC& primaryWindowDesc, RenderSystemPlugin renderSystem, RendererPlugin renderer)
+	void Application::startUp(RENDER_WINDOW_DESC& primaryWindowDesc, RenderSystemPlugin renderSystem, RendererPlugin renderer, const Path& importCacheFolder)
 	{
-		CoreApplication::startUp<Application>(primaryWindowDesc, renderSystem, renderer);
+		CoreApplication::startUp<Application>(primaryWindowDesc, renderSystem, renderer, importCacheFolder);
 	}
 
 	void Application::update()
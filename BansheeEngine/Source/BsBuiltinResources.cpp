@@ -181,7 +181,6 @@ namespace BansheeEngine
 		gCoreAccessor().submitToCoreThread(true);
 
 		// Label
-		// TODO - Instead of importing font every time, try to save a resource and then just load it?
 		HFont font;
 
 		{
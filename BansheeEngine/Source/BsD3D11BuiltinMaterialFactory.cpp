@@ -10,6 +10,8 @@
 #include "BsMaterial.h"
 #include "BsBlendState.h"
 #include "BsDepthStencilState.h"
+#include "BsRenderSystem.h"
+#include "BsRenderSystemCapabilities.h"
 
 namespace BansheeEngine
 {
@@ -464,7 +466,28 @@ namespace BansheeEngine
 
 	void D3D11BuiltinMaterialFactory::initDummyShader()
 	{
-		String vsCode = "float4x4 matWorldViewProj;				\
+		// If instancing is supported the renderer provides the world view projection matrix rows as 
+		// per-instance inputs, otherwise the matrix is a regular parameter
+		bool instancing = RenderSystem::instance().getCapabilities()->hasCapability(RSC_INSTANCING);
+
+		String vsCode;
+		if (instancing)
+		{
+			vsCode = "void vs_main(							\
+						 in float3 inPos : POSITION,			\
+						 in float4 inWVP0 : TEXCOORD4,			\
+						 in float4 inWVP1 : TEXCOORD5,			\
+						 in float4 inWVP2 : TEXCOORD6,			\
+						 in float4 inWVP3 : TEXCOORD7,			\
+						 out float4 oPosition : SV_Position)	\
+						 {										\
+							 float4 pos = float4(inPos.xyz, 1);	\
+							 oPosition = float4(dot(inWVP0, pos), dot(inWVP1, pos), dot(inWVP2, pos), dot(inWVP3, pos)); \
+						 }";
+		}
+		else
+		{
+			vsCode = "float4x4 matWorldViewProj;				\
 																\
 						 void vs_main(							\
 						 in float3 inPos : POSITION,			\
@@ -472,6 +495,7 @@ namespace BansheeEngine
 						 {										\
 							 oPosition = mul(matWorldViewProj, float4(inPos.xyz, 1)); \
 						 }";
+		}
 
 		String psCode = "float4 ps_main() : SV_Target				\
 						 {											\
@@ -485,8 +509,10 @@ namespace BansheeEngine
 		psProgram.synchronize();
 
 		mDummyShader = Shader::create("DummyShader");
+		mDummyShader->setAllowInstancing(instancing);
 
-		mDummyShader->addParameter("matWorldViewProj", "matWorldViewProj", GPDT_MATRIX_4X4);
+		if (!instancing)
+			mDummyShader->addParameter("matWorldViewProj", "matWorldViewProj", GPDT_MATRIX_4X4);
 
 		TechniquePtr newTechnique = mDummyShader->addTechnique("D3D11RenderSystem", RendererManager::getCoreRendererName());
 		PassPtr newPass = newTechnique->addPass();
@@ -9,6 +9,8 @@
 #include "BsMaterial.h"
 #include "BsBlendState.h"
 #include "BsDepthStencilState.h"
+#include "BsRenderSystem.h"
+#include "BsRenderSystemCapabilities.h"
 #include "BsRendererManager.h"
 
 namespace BansheeEngine
@@ -462,7 +464,28 @@ namespace BansheeEngine
 
 	void D3D9BuiltinMaterialFactory::initDummyShader()
 	{
-		String vsCode = "float4x4 matWorldViewProj;			\
+		// If instancing is supported the renderer provides the world view projection matrix rows as 
+		// per-instance inputs, otherwise the matrix is a regular parameter
+		bool instancing = RenderSystem::instance().getCapabilities()->hasCapability(RSC_INSTANCING);
+
+		String vsCode;
+		if (instancing)
+		{
+			vsCode = "void vs_main(						\
+						 in float3 inPos : POSITION,		\
+						 in float4 inWVP0 : TEXCOORD4,		\
+						 in float4 inWVP1 : TEXCOORD5,		\
+						 in float4 inWVP2 : TEXCOORD6,		\
+						 in float4 inWVP3 : TEXCOORD7,		\
+						 out float4 oPosition : POSITION)	\
+						 {									\
+							 float4 pos = float4(inPos.xyz, 1);	\
+							 oPosition = float4(dot(inWVP0, pos), dot(inWVP1, pos), dot(inWVP2, pos), dot(inWVP3, pos)); \
+						 }";
+		}
+		else
+		{
+			vsCode = "float4x4 matWorldViewProj;			\
 															\
 						 void vs_main(						\
 						 in float3 inPos : POSITION,		\
@@ -470,21 +493,28 @@ namespace BansheeEngine
 						 {									\
 							 oPosition = mul(matWorldViewProj, float4(inPos.xyz, 1));	\
 						 }";
+		}
 
 		String psCode = "float4 ps_main() : COLOR0					\
 						 {											\
 						 	return float4(0.5f, 0.5f, 0.5f, 0.5f);	\
 						 }";
 
-		HGpuProgram vsProgram = GpuProgram::create(vsCode, "vs_main", "hlsl", GPT_VERTEX_PROGRAM, GPP_VS_2_0);
-		HGpuProgram psProgram = GpuProgram::create(psCode, "ps_main", "hlsl", GPT_FRAGMENT_PROGRAM, GPP_PS_2_0);
+		// Instancing requires SM3, and SM3 vertex programs can only be paired with SM3 fragment programs
+		GpuProgramProfile vsProfile = instancing ? GPP_VS_3_0 : GPP_VS_2_0;
+		GpuProgramProfile psProfile = instancing ? GPP_PS_3_0 : GPP_PS_2_0;
+
+		HGpuProgram vsProgram = GpuProgram::create(vsCode, "vs_main", "hlsl", GPT_VERTEX_PROGRAM, vsProfile);
+		HGpuProgram psProgram = GpuProgram::create(psCode, "ps_main", "hlsl", GPT_FRAGMENT_PROGRAM, psProfile);
 
 		vsProgram.synchronize();
 		psProgram.synchronize();
 
 		mDummyShader = Shader::create("DummyShader");
+		mDummyShader->setAllowInstancing(instancing);
 
-		mDummyShader->addParameter("matWorldViewProj", "matWorldViewProj", GPDT_MATRIX_4X4);
+		if (!instancing)
+			mDummyShader->addParameter("matWorldViewProj", "matWorldViewProj", GPDT_MATRIX_4X4);
 
 		TechniquePtr newTechnique = mDummyShader->addTechnique("D3D9RenderSystem", RendererManager::getCoreRendererName());
 		PassPtr newPass = newTechnique->addPass();
@@ -14,6 +14,7 @@
 #include "BsCoreThreadAccessor.h"
 #include "BsBuiltinMaterialManager.h"
 #include "BsVertexDataDesc.h"
+#include "BsMeshHeap.h"
 
 namespace BansheeEngine
 {
@@ -24,6 +25,8 @@ namespace BansheeEngine
 		mVertexDesc = bs_shared_ptr<VertexDataDesc>();
 		mVertexDesc->addVertElem(VET_FLOAT2, VES_POSITION);
 		mVertexDesc->addVertElem(VET_COLOR, VES_COLOR);
+
+		mMeshHeap = MeshHeap::createStreaming(MESH_HEAP_INITIAL_NUM_VERTS, MESH_HEAP_INITIAL_NUM_INDICES, mVertexDesc);
 	}
 
 	void DrawHelper2D::quad(const RectF& area, const MeshDataPtr& meshData, UINT32 vertexOffset, UINT32 indexOffset)
@@ -100,9 +103,8 @@ namespace BansheeEngine
 		colors = (UINT32*)(colorData + vertexStride * 3);
 		(*colors) = color.getAsRGBA();
 
-		HMesh mesh = Mesh::create(meshData);
-
-		dbgCmd.mesh = mesh;
+		dbgCmd.meshData = meshData;
+		dbgCmd.drawOp = DOT_TRIANGLE_LIST;
 		dbgCmd.worldCenter = Vector3::ZERO;
 
 		if(coordType == DebugDrawCoordType::Normalized)
@@ -139,9 +141,8 @@ namespace BansheeEngine
 
 		line_Pixel(actualA, actualB, color, meshData, 0, 0);
 
-		HMesh mesh = Mesh::create(meshData, MeshBufferType::Static, DOT_LINE_LIST);
-
-		dbgCmd.mesh = mesh;
+		dbgCmd.meshData = meshData;
+		dbgCmd.drawOp = DOT_LINE_LIST;
 		dbgCmd.worldCenter = Vector3::ZERO;
 
 		if(coordType == DebugDrawCoordType::Normalized)
@@ -178,9 +179,8 @@ namespace BansheeEngine
 
 		line_AA(actualA, actualB, width, borderWidth, color, meshData, 0, 0);
 
-		HMesh mesh = Mesh::create(meshData);
-
-		dbgCmd.mesh = mesh;
+		dbgCmd.meshData = meshData;
+		dbgCmd.drawOp = DOT_TRIANGLE_LIST;
 		dbgCmd.worldCenter = Vector3::ZERO;
 
 		if(coordType == DebugDrawCoordType::Normalized)
@@ -223,9 +223,8 @@ namespace BansheeEngine
 			lineList_Pixel(linePoints, color, meshData, 0, 0);
 		}		
 
-		HMesh mesh = Mesh::create(meshData, MeshBufferType::Static, DOT_LINE_LIST);
-
-		dbgCmd.mesh = mesh;
+		dbgCmd.meshData = meshData;
+		dbgCmd.drawOp = DOT_LINE_LIST;
 		dbgCmd.worldCenter = Vector3::ZERO;
 
 		if(coordType == DebugDrawCoordType::Normalized)
@@ -267,9 +266,8 @@ namespace BansheeEngine
 			lineList_AA(linePoints, width, borderWidth, color, meshData, 0, 0);
 		}		
 
-		HMesh mesh = Mesh::create(meshData);
-
-		dbgCmd.mesh = mesh;
+		dbgCmd.meshData = meshData;
+		dbgCmd.drawOp = DOT_TRIANGLE_LIST;
 		dbgCmd.worldCenter = Vector3::ZERO;
 
 		if(coordType == DebugDrawCoordType::Normalized)
@@ -14,6 +14,7 @@
 #include "BsCamera.h"
 #include "BsBuiltinMaterialManager.h"
 #include "BsVertexDataDesc.h"
+#include "BsMeshHeap.h"
 
 namespace BansheeEngine
 {
@@ -22,6 +23,8 @@ namespace BansheeEngine
 		mVertexDesc = bs_shared_ptr<VertexDataDesc>();
 		mVertexDesc->addVertElem(VET_FLOAT2, VES_POSITION);
 		mVertexDesc->addVertElem(VET_COLOR, VES_COLOR);
+
+		mMeshHeap = MeshHeap::createStreaming(MESH_HEAP_INITIAL_NUM_VERTS, MESH_HEAP_INITIAL_NUM_INDICES, mVertexDesc);
 	}
 
 	void DrawHelper3D::aabox(const AABox& box, const MeshDataPtr& meshData, UINT32 vertexOffset, UINT32 indexOffset)
@@ -76,9 +79,8 @@ namespace BansheeEngine
 		UINT8* positionData = meshData->getElementData(VES_POSITION);
 		dbgCmd.worldCenter = calcCenter(positionData, meshData->getNumVertices(), mVertexDesc->getVertexStride());
 
-		HMesh mesh = Mesh::create(meshData, MeshBufferType::Static, DOT_LINE_LIST);
-
-		dbgCmd.mesh = mesh;
+		dbgCmd.meshData = meshData;
+		dbgCmd.drawOp = DOT_LINE_LIST;
 		dbgCmd.type = DebugDrawType::WorldSpace;
 		dbgCmd.matInfo3D = BuiltinMaterialManager::instance().createDebugDraw3DMaterial();
 	}
@@ -100,9 +102,8 @@ namespace BansheeEngine
 		UINT8* positionData = meshData->getElementData(VES_POSITION);
 		dbgCmd.worldCenter = calcCenter(positionData, meshData->getNumVertices(), mVertexDesc->getVertexStride());
 
-		HMesh mesh = Mesh::create(meshData);
-
-		dbgCmd.mesh = mesh;
+		dbgCmd.meshData = meshData;
+		dbgCmd.drawOp = DOT_TRIANGLE_LIST;
 		dbgCmd.type = DebugDrawType::WorldSpace;
 		dbgCmd.matInfo3D = BuiltinMaterialManager::instance().createDebugDraw3DMaterial();
 	}
@@ -125,9 +126,8 @@ namespace BansheeEngine
 		UINT8* positionData = meshData->getElementData(VES_POSITION);
 		dbgCmd.worldCenter = calcCenter(positionData, meshData->getNumVertices(), mVertexDesc->getVertexStride());
 
-		HMesh mesh = Mesh::create(meshData, MeshBufferType::Static, DOT_LINE_LIST);
-
-		dbgCmd.mesh = mesh;
+		dbgCmd.meshData = meshData;
+		dbgCmd.drawOp = DOT_LINE_LIST;
 		dbgCmd.type = DebugDrawType::WorldSpace;
 		dbgCmd.matInfo3D = BuiltinMaterialManager::instance().createDebugDraw3DMaterial();
 	}
@@ -150,9 +150,8 @@ namespace BansheeEngine
 		UINT8* positionData = meshData->getElementData(VES_POSITION);
 		dbgCmd.worldCenter = calcCenter(positionData, meshData->getNumVertices(), mVertexDesc->getVertexStride());
 
-		HMesh mesh = Mesh::create(meshData);
-
-		dbgCmd.mesh = mesh;
+		dbgCmd.meshData = meshData;
+		dbgCmd.drawOp = DOT_TRIANGLE_LIST;
 		dbgCmd.type = DebugDrawType::WorldSpace;
 		dbgCmd.matInfo3D = BuiltinMaterialManager::instance().createDebugDraw3DMaterial();
 	}
@@ -185,9 +184,8 @@ namespace BansheeEngine
 		UINT8* positionData = meshData->getElementData(VES_POSITION);
 		dbgCmd.worldCenter = calcCenter(positionData, meshData->getNumVertices(), mVertexDesc->getVertexStride());
 
-		HMesh mesh = Mesh::create(meshData);
-
-		dbgCmd.mesh = mesh;
+		dbgCmd.meshData = meshData;
+		dbgCmd.drawOp = DOT_TRIANGLE_LIST;
 		dbgCmd.type = DebugDrawType::WorldSpace;
 		dbgCmd.matInfo3D = BuiltinMaterialManager::instance().createDebugDraw3DMaterial();
 	}
@@ -12,11 +12,28 @@
 #include "BsDrawList.h"
 #include "BsCamera.h"
 #include "BsBuiltinMaterialManager.h"
+#include "BsMeshHeap.h"
+#include "BsTransientMesh.h"
 
 namespace BansheeEngine
 {
+	const UINT32 DrawHelperTemplateBase::MESH_HEAP_INITIAL_NUM_VERTS = 4096;
+	const UINT32 DrawHelperTemplateBase::MESH_HEAP_INITIAL_NUM_INDICES = 12288;
+
+	DrawHelperTemplateBase::DrawHelperTemplateBase()
+		:mLastFrameNumber((unsigned long)-1)
+	{ }
+
 	void DrawHelperTemplateBase::render(const HCamera& camera, DrawList& drawList)
 	{
+		// Meshes from the last frame are no longer needed once all cameras rendered
+		unsigned long frameNumber = gTime().getCurrentFrameNumber();
+		if(frameNumber != mLastFrameNumber)
+		{
+			mMeshHeap->beginFrame();
+			mLastFrameNumber = frameNumber;
+		}
+
 		const Viewport* viewport = camera->getViewport().get();
 		Vector<DebugDrawCommand>& commands = mCommandsPerViewport[viewport];
 
@@ -29,7 +46,7 @@ namespace BansheeEngine
 
 		for(auto& cmd : commands)
 		{
-			if(cmd.mesh == nullptr || !cmd.mesh.isLoaded() || !cmd.mesh->isInitialized())
+			if(cmd.meshData == nullptr)
 				continue;
 
 			if(cmd.type == DebugDrawType::ClipSpace)
@@ -39,7 +56,7 @@ namespace BansheeEngine
 				if(mat == nullptr || !mat.isLoaded() || !mat->isInitialized())
 					continue;
 
-				drawList.add(mat.getInternalPtr(), cmd.mesh.getInternalPtr(), 0, cmd.worldCenter);
+				drawList.add(mat.getInternalPtr(), mMeshHeap->alloc(cmd.meshData, cmd.drawOp), 0, cmd.worldCenter);
 			}
 			else if(cmd.type == DebugDrawType::ScreenSpace)
 			{
@@ -51,7 +68,7 @@ namespace BansheeEngine
 				cmd.matInfo2DScreenSpace.invViewportWidth.set(invViewportWidth);
 				cmd.matInfo2DScreenSpace.invViewportHeight.set(invViewportHeight);
 
-				drawList.add(mat.getInternalPtr(), cmd.mesh.getInternalPtr(), 0, cmd.worldCenter);
+				drawList.add(mat.getInternalPtr(), mMeshHeap->alloc(cmd.meshData, cmd.drawOp), 0, cmd.worldCenter);
 			}
 			else if(cmd.type == DebugDrawType::WorldSpace)
 			{
@@ -62,7 +79,7 @@ namespace BansheeEngine
 
 				cmd.matInfo3D.matViewProj.set(viewProjMatrix);
 
-				drawList.add(mat.getInternalPtr(), cmd.mesh.getInternalPtr(), 0, cmd.worldCenter);
+				drawList.add(mat.getInternalPtr(), mMeshHeap->alloc(cmd.meshData, cmd.drawOp), 0, cmd.worldCenter);
 			}
 		}
 
@@ -9,6 +9,8 @@
 #include "BsGpuProgram.h"
 #include "BsBlendState.h"
 #include "BsDepthStencilState.h"
+#include "BsRenderSystem.h"
+#include "BsRenderSystemCapabilities.h"
 #include "BsRendererManager.h"
 
 namespace BansheeEngine
@@ -485,7 +487,30 @@ namespace BansheeEngine
 
 void GLBuiltinMaterialFactory::initDummyShader()
 	{
-		String vsCode = "#version 400\n								\
+		// If instancing is supported the renderer provides the world view projection matrix rows as 
+		// per-instance inputs, otherwise the matrix is a regular parameter
+		bool instancing = RenderSystem::instance().getCapabilities()->hasCapability(RSC_INSTANCING);
+
+		String vsCode;
+		if (instancing)
+		{
+			vsCode = "#version 400\n								\
+																	\
+						in vec3 bs_position;						\
+						in vec4 bs_texcoord4;						\
+						in vec4 bs_texcoord5;						\
+						in vec4 bs_texcoord6;						\
+						in vec4 bs_texcoord7;						\
+																	\
+						void main()									\
+						{											\
+							vec4 pos = vec4(bs_position.xyz, 1);	\
+							gl_Position = vec4(dot(bs_texcoord4, pos), dot(bs_texcoord5, pos), dot(bs_texcoord6, pos), dot(bs_texcoord7, pos)); \
+						}";
+		}
+		else
+		{
+			vsCode = "#version 400\n								\
 																	\
 						uniform mat4 matWorldViewProj;				\
 																	\
@@ -495,6 +520,7 @@ void GLBuiltinMaterialFactory::initDummyShader()
 						{											\
 							gl_Position = matWorldViewProj * vec4(bs_position.xyz, 1);		\
 						}";
+		}
 
 		String psCode = "#version 400\n						\
 															\
@@ -512,8 +538,10 @@ void GLBuiltinMaterialFactory::initDummyShader()
 		psProgram.synchronize();
 
 		mDummyShader = Shader::create("DummyShader");
+		mDummyShader->setAllowInstancing(instancing);
 
-		mDummyShader->addParameter("matWorldViewProj", "matWorldViewProj", GPDT_MATRIX_4X4);
+		if (!instancing)
+			mDummyShader->addParameter("matWorldViewProj", "matWorldViewProj", GPDT_MATRIX_4X4);
 
 		TechniquePtr newTechnique = mDummyShader->addTechnique("GLRenderSystem", RendererManager::getCoreRendererName());
 		PassPtr newPass = newTechnique->addPass();
@@ -2,6 +2,7 @@
 //_____________________________________ www.banshee-project.com __________________________________________________//
 //________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
 #include "BsGUIHelper.h"
+#include "BsTextDataCache.h"
 #include "BsSpriteTexture.h"
 #include "BsGUIElementStyle.h"
 #include "BsGUILayoutOptions.h"
@@ -49,10 +50,10 @@ namespace BansheeEngine
 
 		if(style.font != nullptr)
 		{
-			TextData textData(text, style.font, style.fontSize, wordWrapWidth, 0, style.wordWrap);
+			TextDataPtr textData = TextDataCache::instance().getTextData(text, style.font, style.fontSize, wordWrapWidth, style.wordWrap);
 
-			contentWidth += textData.getWidth();
-			contentHeight += textData.getNumLines() * textData.getLineHeight(); 
+			contentWidth += textData->getWidth();
+			contentHeight += textData->getNumLines() * textData->getLineHeight(); 
 		}
 
 		return Vector2I(contentWidth, contentHeight);
@@ -2,6 +2,7 @@
 //_____________________________________ www.banshee-project.com __________________________________________________//
 //________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
 #include "BsGUIInputTool.h"
+#include "BsTextDataCache.h"
 #include "BsGUIElement.h"
 #include "BsMath.h"
 #include "BsVector2.h"
@@ -23,8 +24,9 @@ namespace BansheeEngine
 
 		mLineDescs.clear();
 
-		TextData textData(mTextDesc.text, mTextDesc.font, mTextDesc.fontSize, 
-			mTextDesc.width, mTextDesc.height, mTextDesc.wordWrap);
+		TextDataPtr textDataPtr = TextDataCache::instance().getTextData(mTextDesc.text, mTextDesc.font, mTextDesc.fontSize, 
+			mTextDesc.width, mTextDesc.wordWrap);
+		const TextData& textData = *textDataPtr;
 
 		UINT32 numLines = textData.getNumLines();
 		UINT32 numPages = textData.getNumPages();
@@ -50,7 +50,13 @@ namespace BansheeEngine
 		mDesc.vertAlign = _getStyle()->textVertAlign;
 		mDesc.width = mWidth;
 		mDesc.height = mHeight;
-		mDesc.text = mContent.getText();
+
+		// Write directly into the existing text buffer instead of copying the string value, as labels whose
+		// parameters change every frame (e.g. profiler overlay) are rebuilt every frame
+		const HString& text = mContent.getText();
+		mDesc.text.resize(text.getLength());
+		if(!mDesc.text.empty())
+			text.getValue(&mDesc.text[0], (UINT32)mDesc.text.size());
 
 		mTextSprite->update(mDesc);
 
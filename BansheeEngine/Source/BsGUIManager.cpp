@@ -30,6 +30,7 @@
 #include "BsGUIContextMenu.h"
 #include "BsDragAndDropManager.h"
 #include "BsGUIDropDownBoxManager.h"
+#include "BsStringTable.h"
 #include "BsGUIContextMenu.h"
 #include "BsProfilerCPU.h"
 #include "BsMeshHeap.h"
@@ -72,7 +73,7 @@ namespace BansheeEngine
 		:mSeparateMeshesByWidget(true), mActiveMouseButton(GUIMouseButton::Left),
 		mCaretBlinkInterval(0.5f), mCaretLastBlinkTime(0.0f), mCaretColor(1.0f, 0.6588f, 0.0f), mIsCaretOn(false),
 		mTextSelectionColor(1.0f, 0.6588f, 0.0f), mInputCaret(nullptr), mInputSelection(nullptr), mDragState(DragState::NoDrag),
-		mActiveCursor(CursorType::Arrow)
+		mActiveCursor(CursorType::Arrow), mStringTableVersion(0)
 	{
 		mOnPointerMovedConn = gInput().onPointerMoved.connect(std::bind(&GUIManager::onPointerMoved, this, _1));
 		mOnPointerPressedConn = gInput().onPointerPressed.connect(std::bind(&GUIManager::onPointerPressed, this, _1));
@@ -100,6 +101,7 @@ namespace BansheeEngine
 		mVertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
 
 		mMeshHeap = MeshHeap::create(MESH_HEAP_INITIAL_NUM_VERTS, MESH_HEAP_INITIAL_NUM_INDICES, mVertexDesc);
+		mStreamingMeshHeap = MeshHeap::createStreaming(MESH_HEAP_INITIAL_NUM_VERTS, MESH_HEAP_INITIAL_NUM_INDICES, mVertexDesc);
 
 		// Need to defer this call because I want to make sure all managers are initialized first
 		deferredCall(std::bind(&GUIManager::updateCaretTexture, this));
@@ -176,10 +178,14 @@ namespace BansheeEngine
 
 		if(renderData.widgets.size() == 0)
 		{
-			for (auto& mesh : renderData.cachedMeshes)
+			// Streamed meshes are released by the streaming heap at the start of the next frame
+			if (!renderData.isStreaming)
 			{
-				if (mesh != nullptr)
-					mMeshHeap->dealloc(mesh);
+				for (auto& mesh : renderData.cachedMeshes)
+				{
+					if (mesh != nullptr)
+						mMeshHeap->dealloc(mesh);
+				}
 			}
 
 			mCachedGUIData.erase(renderTarget);
@@ -192,6 +198,20 @@ namespace BansheeEngine
 	{
 		DragAndDropManager::instance()._update();
 
+		// Localized strings don't notify elements when the string table changes, so rebuild contents
+		// of all elements whenever it is modified (e.g. when active language changes)
+		UINT32 stringTableVersion = StringTable::instance().getVersion();
+		if(stringTableVersion != mStringTableVersion)
+		{
+			for(auto& widgetInfo : mWidgets)
+			{
+				for(auto& element : widgetInfo.widget->getElements())
+					element->_markContentAsDirty();
+			}
+
+			mStringTableVersion = stringTableVersion;
+		}
+
 		// Update layouts
 		gProfilerCPU().beginSample("UpdateLayout");
 		for(auto& widgetInfo : mWidgets)
@@ -348,6 +368,8 @@ namespace BansheeEngine
 
 	void GUIManager::updateMeshes()
 	{
+		mStreamingMeshHeap->beginFrame();
+
 		for(auto& cachedMeshData : mCachedGUIData)
 		{
 			GUIRenderData& renderData = cachedMeshData.second;
@@ -365,7 +387,21 @@ namespace BansheeEngine
 			}
 
 			if(!isDirty)
+			{
+				// Contents were rebuilt last frame but didn't change since, so move them from the streaming heap
+				// into the persistent one. This way contents that keep changing (e.g. profiler overlay) are streamed
+				// every frame, and contents that stay the same are only uploaded once more.
+				if(renderData.isStreaming)
+				{
+					for(UINT32 i = 0; i < (UINT32)renderData.cachedMeshData.size(); i++)
+						renderData.cachedMeshes[i] = mMeshHeap->alloc(renderData.cachedMeshData[i]);
+
+					renderData.cachedMeshData.clear();
+					renderData.isStreaming = false;
+				}
+
 				continue;
+			}
 
 			// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
 			auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
@@ -520,13 +556,21 @@ namespace BansheeEngine
 			}
 
 			UINT32 numMeshes = (UINT32)sortedGroups.size();
-			UINT32 oldNumMeshes = (UINT32)renderData.cachedMeshes.size();
 
-			if(numMeshes < oldNumMeshes)
+			// Rebuilt contents are written into the streaming heap, see above
+			if(!renderData.isStreaming)
 			{
-				renderData.cachedMeshes.resize(numMeshes);
+				for(auto& mesh : renderData.cachedMeshes)
+				{
+					if(mesh != nullptr)
+						mMeshHeap->dealloc(mesh);
+				}
 			}
 
+			renderData.cachedMeshes.resize(numMeshes);
+			renderData.cachedMeshData.resize(numMeshes);
+			renderData.isStreaming = true;
+
 			renderData.cachedMaterials.resize(numMeshes);
 
 			if(mSeparateMeshesByWidget)
@@ -573,15 +617,8 @@ namespace BansheeEngine
 					quadOffset += numQuads;
 				}
 
-				if(groupIdx < (UINT32)renderData.cachedMeshes.size())
-				{
-					mMeshHeap->dealloc(renderData.cachedMeshes[groupIdx]);
-					renderData.cachedMeshes[groupIdx] = mMeshHeap->alloc(meshData);
-				}
-				else
-				{
-					renderData.cachedMeshes.push_back(mMeshHeap->alloc(meshData));
-				}
+				renderData.cachedMeshData[groupIdx] = meshData;
+				renderData.cachedMeshes[groupIdx] = mStreamingMeshHeap->alloc(meshData);
 
 				groupIdx++;
 			}
@@ -19,16 +19,22 @@ namespace BansheeEngine
 	{
 		mRenderElements.clear();
 		mSortedRenderElements.clear();
+		mSortedInstances.clear();
 	}
 
 	void RenderQueue::add(RenderableElement* element, float distFromCamera)
+	{
+		add(element, element->mesh, distFromCamera);
+	}
+
+	void RenderQueue::add(RenderableElement* element, const MeshProxyPtr& mesh, float distFromCamera)
 	{
 		SortData sortData;
 
 		RenderQueueElement& renderOp = sortData.element;
 		renderOp.renderElem = element;
 		renderOp.material = element->material;
-		renderOp.mesh = element->mesh;
+		renderOp.mesh = mesh;
 
 		sortData.distFromCamera = distFromCamera;
 		sortData.priority = element->material->shader->queuePriority;
@@ -62,7 +68,7 @@ namespace BansheeEngine
 		for (auto& elem : renderQueue.mRenderElements)
 		{
 			if (elem.element.renderElem != nullptr)
-				add(elem.element.renderElem, elem.distFromCamera);
+				add(elem.element.renderElem, elem.element.mesh, elem.distFromCamera);
 			else
 				add(elem.element.material, elem.element.mesh, elem.distFromCamera);
 		}
@@ -70,10 +76,67 @@ namespace BansheeEngine
 
 	void RenderQueue::sort()
 	{
-		// TODO - I'm ignoring "separate pass" material parameter.
+		static const UINT32 NO_GROUP = (UINT32)-1;
+
+		// Merge instanced elements into the first element of their group. Groups are
+		// restricted to a single priority, so priority ordering is preserved.
+		Map<std::pair<MaterialProxy*, MeshProxy*>, UINT32> groupLookup;
+		Vector<Vector<RenderableElement*>> instanceGroups;
+		Vector<std::pair<const SortData*, UINT32>> orderedElements;
+
+		UINT32 curPriority = 0;
 		for (auto& sortData : mRenderElements)
 		{
 			const RenderQueueElement& renderElem = sortData.element;
+
+			if (sortData.priority != curPriority)
+			{
+				groupLookup.clear();
+				curPriority = sortData.priority;
+			}
+
+			UINT32 groupIdx = NO_GROUP;
+			if (renderElem.renderElem != nullptr && renderElem.material->shader->instancing)
+			{
+				// Back to front sorted elements are drawn one by one, as merging them would break the order
+				if (sortData.sortType != QueueSortType::BackToFront)
+				{
+					auto key = std::make_pair(renderElem.material.get(), renderElem.mesh.get());
+
+					auto iterFind = groupLookup.find(key);
+					if (iterFind != groupLookup.end())
+					{
+						instanceGroups[iterFind->second].push_back(renderElem.renderElem);
+						continue;
+					}
+
+					groupLookup[key] = (UINT32)instanceGroups.size();
+				}
+
+				groupIdx = (UINT32)instanceGroups.size();
+				instanceGroups.push_back(Vector<RenderableElement*>());
+				instanceGroups.back().push_back(renderElem.renderElem);
+			}
+
+			orderedElements.push_back(std::make_pair(&sortData, groupIdx));
+		}
+
+		// TODO - I'm ignoring "separate pass" material parameter.
+		for (auto& orderedElement : orderedElements)
+		{
+			const RenderQueueElement& renderElem = orderedElement.first->element;
+
+			UINT32 instanceOffset = 0;
+			UINT32 numInstances = 0;
+			if (orderedElement.second != NO_GROUP)
+			{
+				const Vector<RenderableElement*>& instanceGroup = instanceGroups[orderedElement.second];
+
+				instanceOffset = (UINT32)mSortedInstances.size();
+				numInstances = (UINT32)instanceGroup.size();
+				mSortedInstances.insert(mSortedInstances.end(), instanceGroup.begin(), instanceGroup.end());
+			}
+
 			UINT32 numPasses = (UINT32)renderElem.material->passes.size();
 			for (UINT32 i = 0; i < numPasses; i++)
 			{
@@ -84,6 +147,8 @@ namespace BansheeEngine
 				sortedElem.material = renderElem.material;
 				sortedElem.mesh = renderElem.mesh;
 				sortedElem.passIdx = i;
+				sortedElem.instanceOffset = instanceOffset;
+				sortedElem.numInstances = numInstances;
 			}
 		}
 	}
@@ -111,4 +176,9 @@ namespace BansheeEngine
 	{
 		return mSortedRenderElements;
 	}
+
+	const Vector<RenderableElement*>& RenderQueue::getSortedInstances() const
+	{
+		return mSortedInstances;
+	}
 }
\ No newline at end of file
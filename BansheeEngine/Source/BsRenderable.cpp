@@ -24,7 +24,7 @@ namespace BansheeEngine
 	}
 
 	Renderable::Renderable(const HSceneObject& parent)
-		:Component(parent), mLayer(1), mCoreDirtyFlags(0xFFFFFFFF), mActiveProxy(nullptr)
+		:Component(parent), mLayer(1), mIsStatic(false), mCoreDirtyFlags(0xFFFFFFFF), mActiveProxy(nullptr)
 	{
 		setName("Renderable");
 
@@ -70,6 +70,12 @@ namespace BansheeEngine
 		markCoreDirty();
 	}
 
+	void Renderable::setIsStatic(bool isStatic)
+	{
+		mIsStatic = isStatic;
+		markCoreDirty();
+	}
+
 	bool Renderable::_isCoreDirty() const
 	{ 
 		updateResourceLoadStates();
@@ -134,14 +140,23 @@ namespace BansheeEngine
 			renElement->layer = mLayer;
 			renElement->worldTransform = SO()->getWorldTfrm();
 
+			UINT32 numLODs = mMeshData.mesh->getNumLODs();
 			if (mMeshData.mesh->_isCoreDirty(MeshDirtyFlag::Proxy))
 			{
-				mMeshData.mesh->_setActiveProxy(i, mMeshData.mesh->_createProxy(i));
+				for (UINT32 j = 0; j < numLODs; j++)
+					mMeshData.mesh->_setActiveProxy(i, mMeshData.mesh->_createProxy(i, j), j);
+
 				markMeshProxyClean = true;
 			}
 
 			renElement->mesh = mMeshData.mesh->_getActiveProxy(i);
 
+			for (UINT32 j = 1; j < numLODs; j++)
+			{
+				renElement->lodMeshes.push_back(mMeshData.mesh->_getActiveProxy(i, j));
+				renElement->lodScreenSizes.push_back(mMeshData.mesh->getLODScreenSize(j));
+			}
+
 			HMaterial material;
 			if (mMaterialData[i].material != nullptr)
 				material = mMaterialData[i].material;
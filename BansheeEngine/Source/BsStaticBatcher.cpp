@@ -0,0 +1,443 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsStaticBatcher.h"
+#include "BsRenderable.h"
+#include "BsSceneObject.h"
+#include "BsMesh.h"
+#include "BsMeshData.h"
+#include "BsMaterial.h"
+#include "BsVertexDataDesc.h"
+#include "BsResources.h"
+#include "BsCoreThread.h"
+#include "BsBounds.h"
+#include "BsMath.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Returns the type the provided element is stored as in batched meshes. Quantized positions
+	 *			and directions are stored as VET_FLOAT3, since their decode parameters differ between meshes
+	 *			and they need to be transformed into world space anyway.
+	 */
+	static VertexElementType getBatchedType(const VertexElement& element)
+	{
+		VertexElementType type = element.getType();
+		switch (element.getSemantic())
+		{
+		case VES_POSITION:
+			if (type == VET_USHORT4_NORM)
+				return VET_FLOAT3;
+			break;
+		case VES_NORMAL:
+		case VES_TANGENT:
+		case VES_BITANGENT:
+			if (type == VET_SHORT2_NORM)
+				return VET_FLOAT3;
+			break;
+		default:
+			break;
+		}
+
+		return type;
+	}
+
+	bool StaticBatcher::BatchKey::operator< (const BatchKey& rhs) const
+	{
+		if (material != rhs.material)
+			return material < rhs.material;
+
+		if (layer != rhs.layer)
+			return layer < rhs.layer;
+
+		if (vertexLayout != rhs.vertexLayout)
+			return vertexLayout < rhs.vertexLayout;
+
+		if (cellX != rhs.cellX)
+			return cellX < rhs.cellX;
+
+		if (cellY != rhs.cellY)
+			return cellY < rhs.cellY;
+
+		return cellZ < rhs.cellZ;
+	}
+
+	StaticBatcher::StaticBatcher(float cellSize)
+		:mCellSize(cellSize)
+	{ }
+
+	StaticBatcher::~StaticBatcher()
+	{
+		for (auto& entry : mBatches)
+		{
+			Batch* batch = entry.second;
+
+			if (batch->mesh != nullptr)
+				gResources().unload(batch->mesh);
+
+			bs_delete(batch);
+		}
+	}
+
+	bool StaticBatcher::addRenderable(const HRenderable& renderable)
+	{
+		removeRenderable(renderable);
+
+		HMesh mesh = renderable->getMesh();
+		if (mesh == nullptr || !mesh.isLoaded())
+			return false;
+
+		// Strips and other primitive types can't be appended to each other without extra geometry
+		UINT32 numSubMeshes = mesh->getNumSubMeshes();
+		for (UINT32 i = 0; i < numSubMeshes; i++)
+		{
+			if (mesh->getSubMesh(i).drawOp != DOT_TRIANGLE_LIST)
+				return false;
+
+			HMaterial material = renderable->getMaterial(i);
+			if (material == nullptr || !material.isLoaded())
+				return false;
+		}
+
+		const Matrix4& worldTransform = renderable->SO()->getWorldTfrm();
+
+		Bounds worldBounds = mesh->getBounds();
+		worldBounds.transformAffine(worldTransform);
+		Vector3 center = worldBounds.getBox().getCenter();
+
+		BatchKey key;
+		key.layer = renderable->getLayer();
+		key.vertexLayout = getVertexLayout(*mesh->getVertexDesc());
+		key.cellX = Math::floorToInt(center.x / mCellSize);
+		key.cellY = Math::floorToInt(center.y / mCellSize);
+		key.cellZ = Math::floorToInt(center.z / mCellSize);
+
+		auto iterFindSource = mSourceMeshes.find(mesh.getUUID());
+		if (iterFindSource == mSourceMeshes.end())
+		{
+			SourceMesh sourceMesh;
+			sourceMesh.mesh = mesh;
+			sourceMesh.numReferences = 0;
+
+			iterFindSource = mSourceMeshes.insert(std::make_pair(mesh.getUUID(), sourceMesh)).first;
+		}
+		else if (mesh->_isCoreDirty(MeshDirtyFlag::Mesh))
+			iterFindSource->second.data = nullptr; // Contents changed, read them again
+
+		iterFindSource->second.numReferences += numSubMeshes;
+
+		UINT64 renderableId = renderable.getInstanceId();
+		Vector<BatchKey>& batchKeys = mRenderableBatches[renderableId];
+		for (UINT32 i = 0; i < numSubMeshes; i++)
+		{
+			HMaterial material = renderable->getMaterial(i);
+			key.material = material.getUUID();
+
+			Batch*& batch = mBatches[key];
+			if (batch == nullptr)
+			{
+				batch = bs_new<Batch>();
+				batch->material = material;
+				batch->layer = key.layer;
+			}
+
+			BatchMember member;
+			member.renderableId = renderableId;
+			member.mesh = mesh;
+			member.subMeshIdx = i;
+			member.worldTransform = worldTransform;
+
+			batch->members.push_back(member);
+			batch->isDirty = true;
+
+			auto iterFindKey = std::find_if(batchKeys.begin(), batchKeys.end(),
+				[&](const BatchKey& x) { return !(x < key) && !(key < x); });
+
+			if (iterFindKey == batchKeys.end())
+				batchKeys.push_back(key);
+		}
+
+		return true;
+	}
+
+	void StaticBatcher::removeRenderable(const HRenderable& renderable)
+	{
+		UINT64 renderableId = renderable.getInstanceId();
+
+		auto iterFind = mRenderableBatches.find(renderableId);
+		if (iterFind == mRenderableBatches.end())
+			return;
+
+		for (auto& key : iterFind->second)
+		{
+			auto iterFindBatch = mBatches.find(key);
+			if (iterFindBatch == mBatches.end())
+				continue;
+
+			Batch* batch = iterFindBatch->second;
+			for (auto iter = batch->members.begin(); iter != batch->members.end();)
+			{
+				if (iter->renderableId != renderableId)
+				{
+					++iter;
+					continue;
+				}
+
+				auto iterFindSource = mSourceMeshes.find(iter->mesh.getUUID());
+				if (iterFindSource != mSourceMeshes.end())
+				{
+					SourceMesh& sourceMesh = iterFindSource->second;
+					sourceMesh.numReferences--;
+
+					if (sourceMesh.numReferences == 0)
+						mSourceMeshes.erase(iterFindSource);
+				}
+
+				iter = batch->members.erase(iter);
+			}
+
+			// Empty batches are destroyed on next update, after their proxies are removed
+			batch->isDirty = true;
+		}
+
+		mRenderableBatches.erase(iterFind);
+	}
+
+	bool StaticBatcher::isBatched(const HRenderable& renderable) const
+	{
+		return mRenderableBatches.find(renderable.getInstanceId()) != mRenderableBatches.end();
+	}
+
+	void StaticBatcher::update(Vector<RenderableProxyPtr>& addedProxies, Vector<RenderableProxyPtr>& removedProxies)
+	{
+		readSourceMeshes();
+
+		for (auto iter = mBatches.begin(); iter != mBatches.end();)
+		{
+			Batch* batch = iter->second;
+			if (!batch->isDirty)
+			{
+				++iter;
+				continue;
+			}
+
+			if (batch->proxy != nullptr)
+			{
+				removedProxies.push_back(batch->proxy);
+				batch->proxy = nullptr;
+			}
+
+			if (batch->mesh != nullptr)
+			{
+				gResources().unload(batch->mesh);
+				batch->mesh = HMesh();
+			}
+
+			if (batch->members.size() == 0)
+			{
+				bs_delete(batch);
+				iter = mBatches.erase(iter);
+
+				continue;
+			}
+
+			buildBatch(*batch);
+			addedProxies.push_back(batch->proxy);
+
+			batch->isDirty = false;
+			++iter;
+		}
+	}
+
+	void StaticBatcher::readSourceMeshes()
+	{
+		bool anyReads = false;
+		for (auto& entry : mSourceMeshes)
+		{
+			SourceMesh& sourceMesh = entry.second;
+			if (sourceMesh.data != nullptr)
+				continue;
+
+			sourceMesh.data = sourceMesh.mesh->allocateSubresourceBuffer(0);
+			gCoreAccessor().readSubresource(sourceMesh.mesh.getInternalPtr(), 0, sourceMesh.data);
+			anyReads = true;
+		}
+
+		// Wait for all reads at once, instead of once per mesh
+		if (anyReads)
+			gCoreAccessor().submitToCoreThread(true);
+	}
+
+	void StaticBatcher::buildBatch(Batch& batch)
+	{
+		Vector<MeshDataPtr> memberData;
+		Vector<Vector<SubMesh>> memberSubMeshes;
+		for (auto& member : batch.members)
+		{
+			const SourceMesh& sourceMesh = mSourceMeshes[member.mesh.getUUID()];
+			const SubMesh& subMesh = member.mesh->getSubMesh(member.subMeshIdx);
+
+			MeshDataPtr data = createMemberData(*sourceMesh.data, subMesh, member.worldTransform);
+
+			Vector<SubMesh> subMeshes;
+			subMeshes.push_back(SubMesh(0, data->getNumIndices(), DOT_TRIANGLE_LIST));
+
+			memberData.push_back(data);
+			memberSubMeshes.push_back(subMeshes);
+		}
+
+		batch.memberRanges.clear();
+		MeshDataPtr combinedData = MeshData::combine(memberData, memberSubMeshes, batch.memberRanges);
+
+		// Whole batch is drawn with a single draw call, member ranges are only kept for reference
+		Vector<SubMesh> subMeshes;
+		subMeshes.push_back(SubMesh(0, combinedData->getNumIndices(), DOT_TRIANGLE_LIST));
+
+		batch.mesh = Mesh::create(combinedData, subMeshes);
+		batch.mesh->_setActiveProxy(0, batch.mesh->_createProxy(0));
+		batch.mesh->_markCoreClean(MeshDirtyFlag::Proxy);
+
+		if (batch.material->_isCoreDirty(MaterialDirtyFlag::Proxy))
+		{
+			batch.material->_setActiveProxy(batch.material->_createProxy());
+			batch.material->_markCoreClean(MaterialDirtyFlag::Proxy);
+		}
+
+		// Geometry is already in world space, and mesh bounds cover the entire cluster
+		RenderableElement* renElement = bs_new<RenderableElement>();
+		renElement->layer = batch.layer;
+		renElement->worldTransform = Matrix4::IDENTITY;
+		renElement->mesh = batch.mesh->_getActiveProxy(0);
+		renElement->material = batch.material->_getActiveProxy();
+
+		batch.proxy = bs_shared_ptr<RenderableProxy>();
+		batch.proxy->renderableElements.push_back(renElement);
+		batch.proxy->renderableType = RenType_LitTextured;
+	}
+
+	MeshDataPtr StaticBatcher::createMemberData(const MeshData& source, const SubMesh& subMesh, const Matrix4& worldTransform)
+	{
+		UINT32 numSrcVertices = source.getNumVertices();
+
+		// Maps source vertex indices to member vertex indices, only for vertices referenced by the sub-mesh
+		Vector<UINT32> remap(numSrcVertices, (UINT32)-1);
+		Vector<UINT32> usedVertices;
+		Vector<UINT32> indices(subMesh.indexCount);
+
+		for (UINT32 i = 0; i < subMesh.indexCount; i++)
+		{
+			UINT32 srcIdx;
+			if (source.getIndexType() == IndexBuffer::IT_16BIT)
+				srcIdx = source.getIndices16()[subMesh.indexOffset + i];
+			else
+				srcIdx = source.getIndices32()[subMesh.indexOffset + i];
+
+			if (remap[srcIdx] == (UINT32)-1)
+			{
+				remap[srcIdx] = (UINT32)usedVertices.size();
+				usedVertices.push_back(srcIdx);
+			}
+
+			indices[i] = remap[srcIdx];
+		}
+
+		const VertexDataDescPtr& srcVertexDesc = source.getVertexDesc();
+		UINT32 numVertices = (UINT32)usedVertices.size();
+
+		VertexDataDescPtr vertexDesc = bs_shared_ptr<VertexDataDesc>();
+		for (UINT32 i = 0; i < srcVertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = srcVertexDesc->getElement(i);
+			vertexDesc->addVertElem(getBatchedType(element), element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
+		}
+
+		MeshDataPtr memberData = bs_shared_ptr<MeshData, PoolAlloc>(numVertices, subMesh.indexCount, vertexDesc);
+		if (subMesh.indexCount > 0)
+			memcpy(memberData->getIndices32(), &indices[0], subMesh.indexCount * sizeof(UINT32));
+
+		Matrix4 normalTransform = worldTransform.inverseAffine().transpose();
+		for (UINT32 i = 0; i < srcVertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = srcVertexDesc->getElement(i);
+
+			VertexElementSemantic semantic = element.getSemantic();
+			UINT32 semanticIdx = element.getSemanticIdx();
+			UINT32 streamIdx = element.getStreamIdx();
+
+			UINT32 stride = vertexDesc->getVertexStride(streamIdx);
+			UINT8* dstData = memberData->getElementData(semantic, semanticIdx, streamIdx);
+
+			VertexElementType type = getBatchedType(element);
+			if (type == element.getType())
+			{
+				UINT32 srcStride = srcVertexDesc->getVertexStride(streamIdx);
+				UINT32 elementSize = element.getSize();
+				UINT8* srcData = source.getElementData(semantic, semanticIdx, streamIdx);
+
+				for (UINT32 j = 0; j < numVertices; j++)
+					memcpy(dstData + j * stride, srcData + usedVertices[j] * srcStride, elementSize);
+			}
+			else
+			{
+				// Quantized element, decode all source vertices since the iterator only moves forward
+				Vector<Vector3> decoded(numSrcVertices);
+				VertexElemDecodeIter iter = source.getDecodedDataIter(semantic, semanticIdx, streamIdx);
+				for (UINT32 j = 0; j < numSrcVertices; j++)
+				{
+					Vector4 value = iter.getValue();
+					decoded[j] = Vector3(value.x, value.y, value.z);
+
+					iter.moveNext();
+				}
+
+				for (UINT32 j = 0; j < numVertices; j++)
+					memcpy(dstData + j * stride, &decoded[usedVertices[j]], sizeof(Vector3));
+			}
+
+			if (type != VET_FLOAT3 && type != VET_FLOAT4)
+				continue;
+
+			if (semantic == VES_POSITION)
+			{
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					Vector3* position = (Vector3*)(dstData + j * stride);
+					*position = worldTransform.multiply3x4(*position);
+				}
+			}
+			else if (semantic == VES_NORMAL || semantic == VES_TANGENT || semantic == VES_BITANGENT)
+			{
+				// Normals need the inverse transpose to remain perpendicular under non-uniform scale, tangent
+				// space handedness stored in "w" is preserved
+				const Matrix4& dirTransform = semantic == VES_NORMAL ? normalTransform : worldTransform;
+
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					Vector3* direction = (Vector3*)(dstData + j * stride);
+
+					Vector4 transformed = dirTransform.multiply3x4(Vector4(direction->x, direction->y, direction->z, 0.0f));
+					*direction = Vector3(transformed.x, transformed.y, transformed.z);
+					direction->normalize();
+				}
+			}
+		}
+
+		return memberData;
+	}
+
+	size_t StaticBatcher::getVertexLayout(const VertexDataDesc& vertexDesc)
+	{
+		size_t hash = 0;
+		for (UINT32 i = 0; i < vertexDesc.getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc.getElement(i);
+
+			hash_combine(hash, (UINT32)getBatchedType(element));
+			hash_combine(hash, (UINT32)element.getSemantic());
+			hash_combine(hash, element.getSemanticIdx());
+			hash_combine(hash, element.getStreamIdx());
+		}
+
+		return hash;
+	}
+}
@@ -0,0 +1,154 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTextDataCache.h"
+#include "BsTextData.h"
+#include "BsFont.h"
+
+namespace BansheeEngine
+{
+	TextDataCache::Key::Key(const WString& text, const Font* font, UINT32 fontSize, UINT32 width, bool wordWrap)
+		:text(text), font(font), fontSize(fontSize), width(width), wordWrap(wordWrap), hash(0)
+	{
+		hash_combine(hash, text);
+		hash_combine(hash, font);
+		hash_combine(hash, fontSize);
+		hash_combine(hash, width);
+		hash_combine(hash, wordWrap);
+	}
+
+	bool TextDataCache::KeyEqual::operator()(const Key& a, const Key& b) const
+	{
+		return a.hash == b.hash && a.font == b.font && a.fontSize == b.fontSize && a.width == b.width &&
+			a.wordWrap == b.wordWrap && a.text == b.text;
+	}
+
+	TextDataCache::UserDataDeleter::UserDataDeleter(const TextDataPtr& textData)
+		:textData(textData)
+	{ }
+
+	void TextDataCache::UserDataDeleter::operator()(TextData* ptr)
+	{
+		// Glyph references are only modified while holding the cache mutex
+		if(TextDataCache::isStarted())
+		{
+			TextDataCache& cache = TextDataCache::instance();
+
+			BS_LOCK_MUTEX(cache.mMutex);
+			textData->_unpinGlyphs();
+		}
+		else
+			textData->_unpinGlyphs();
+
+		textData = nullptr;
+	}
+
+	TextDataCache::TextDataCache(UINT32 maxEntries)
+		:mMaxEntries(maxEntries)
+	{ }
+
+	TextDataPtr TextDataCache::getTextData(const WString& text, const HFont& font, UINT32 fontSize, UINT32 width, bool wordWrap)
+	{
+		// Width only matters when wrapping, so don't let it split otherwise identical entries
+		if(!wordWrap)
+			width = 0;
+
+		// Entries keep the font loaded, so its address cannot be reused while it is in the cache
+		const Font* fontPtr = font != nullptr ? font.get() : nullptr;
+		Key key(text, fontPtr, fontSize, width, wordWrap);
+
+		{
+			BS_LOCK_MUTEX(mMutex);
+
+			TextDataPtr userData = findUserData(key);
+			if(userData != nullptr)
+				return userData;
+		}
+
+		TextDataPtr textData = bs_shared_ptr<TextData>(text, font, fontSize, width, 0, wordWrap);
+
+		{
+			BS_LOCK_MUTEX(mMutex);
+
+			// Another thread might have laid out the same text in the meantime
+			TextDataPtr userData = findUserData(key);
+			if(userData != nullptr)
+				return userData;
+
+			auto insertResult = mEntries.insert(std::make_pair(key, Entry()));
+			Entry& entry = insertResult.first->second;
+
+			mLRU.push_front(&insertResult.first->first);
+			entry.textData = textData;
+			entry.lruIter = mLRU.begin();
+
+			// Newly created text data holds a glyph reference, which the user pointer takes over
+			userData = createUserData(entry);
+			trim();
+
+			return userData;
+		}
+	}
+
+	TextDataPtr TextDataCache::findUserData(const Key& key)
+	{
+		auto iterFind = mEntries.find(key);
+		if(iterFind == mEntries.end())
+			return nullptr;
+
+		Entry& entry = iterFind->second;
+
+		TextDataPtr userData = entry.userData.lock();
+		if(userData == nullptr)
+		{
+			// Glyphs were evicted while nobody used the text, so it needs to be laid out again
+			if(!entry.textData->_pinGlyphs())
+			{
+				mLRU.erase(entry.lruIter);
+				mEntries.erase(iterFind);
+
+				return nullptr;
+			}
+
+			userData = createUserData(entry);
+		}
+
+		mLRU.splice(mLRU.begin(), mLRU, entry.lruIter);
+		return userData;
+	}
+
+	TextDataPtr TextDataCache::createUserData(Entry& entry)
+	{
+		TextDataPtr userData(entry.textData.get(), UserDataDeleter(entry.textData), StdAlloc<GenAlloc>());
+		entry.userData = userData;
+
+		return userData;
+	}
+
+	void TextDataCache::setMaxEntries(UINT32 maxEntries)
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		mMaxEntries = maxEntries;
+		trim();
+	}
+
+	void TextDataCache::clear()
+	{
+		BS_LOCK_MUTEX(mMutex);
+
+		mEntries.clear();
+		mLRU.clear();
+	}
+
+	void TextDataCache::trim()
+	{
+		while(mEntries.size() > mMaxEntries)
+		{
+			auto iterFind = mEntries.find(*mLRU.back());
+			mLRU.pop_back();
+
+			mEntries.erase(iterFind);
+		}
+	}
+}
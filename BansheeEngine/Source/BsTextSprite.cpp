@@ -4,6 +4,7 @@
 #include "BsTextSprite.h"
 #include "BsGUIMaterialManager.h"
 #include "BsTextData.h"
+#include "BsTextDataCache.h"
 #include "BsFont.h"
 #include "BsVector2.h"
 
@@ -12,13 +13,32 @@
 namespace BansheeEngine
 {
 	TextSprite::TextSprite()
+		:mWidth(0), mHeight(0), mAnchor(SA_TopLeft), mHorzAlign(THA_Left), mVertAlign(TVA_Top)
 	{
 
 	}
 
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc)
 	{
-		TextData textData(desc.text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap);
+		TextDataPtr textDataPtr = TextDataCache::instance().getTextData(desc.text, desc.font, desc.fontSize, desc.width, desc.wordWrap);
+
+		// Cache returns the same text data for the same layout, so if placement didn't change either existing quads are still valid
+		if(textDataPtr == mTextData && desc.width == mWidth && desc.height == mHeight && desc.anchor == mAnchor &&
+			desc.horzAlign == mHorzAlign && desc.vertAlign == mVertAlign && desc.color == mColor &&
+			mCachedRenderElements.size() == textDataPtr->getNumPages())
+		{
+			return;
+		}
+
+		mTextData = textDataPtr;
+		mWidth = desc.width;
+		mHeight = desc.height;
+		mAnchor = desc.anchor;
+		mHorzAlign = desc.horzAlign;
+		mVertAlign = desc.vertAlign;
+		mColor = desc.color;
+
+		const TextData& textData = *textDataPtr;
 
 		UINT32 numLines = textData.getNumLines();
 		UINT32 numPages = textData.getNumPages();
@@ -7,12 +7,101 @@
 #include "BsSpecificImporter.h"
 #include "BsImporter.h"
 #include "BsSubMesh.h"
+#include "BsVector2.h"
+#include "BsVector4.h"
+#include "BsMatrix4.h"
 
 #define FBXSDK_NEW_API
 #include <fbxsdk.h>
 
 namespace BansheeEngine
 {
+	class FrameAlloc;
+
+	/**
+	 * @brief	Contents of a single FBX geometry element (e.g. normals or UV coordinates), copied out
+	 *			of the FBX SDK so they can be processed without touching the SDK.
+	 */
+	struct FBXImportElement
+	{
+		FBXImportElement();
+
+		/**
+		 * @brief	Checks does the mesh contain this element.
+		 */
+		bool isPresent() const { return data != nullptr; }
+
+		Vector4* data;
+		UINT32 numData;
+		INT32* indices;
+		UINT32 numIndices;
+		FbxGeometryElement::EMappingMode mappingMode;
+		FbxGeometryElement::EReferenceMode referenceMode;
+	};
+
+	/**
+	 * @brief	A single vertex of an imported mesh, with all the attributes the importer supports. 
+	 *			Unused attributes are always zero so vertices can be compared byte by byte.
+	 */
+	struct FBXImportVertex
+	{
+		Vector3 position;
+		Vector3 normal;
+		Vector3 tangent;
+		Vector3 bitangent;
+		Vector2 uv0;
+		Vector2 uv1;
+		UINT32 color;
+	};
+
+	/**
+	 * @brief	Raw data of a single FBX mesh extracted from the FBX SDK, and the vertices and
+	 *			indices it was converted to. All arrays are allocated from the mesh's arena and
+	 *			are freed together with it.
+	 */
+	struct FBXImportMesh
+	{
+		FBXImportMesh(UINT32 arenaSize);
+		~FBXImportMesh();
+
+		FrameAlloc* arena;
+
+		/** Input */
+		Vector3* controlPoints;
+		UINT32 numControlPoints;
+		INT32* polygonVertices;
+		UINT32 numPolygonVertices;
+		UINT32* polygonStarts;
+		UINT32 numPolygons;
+		INT32* materials;
+		UINT32 numMaterialIndices;
+		UINT32 numMaterials;
+
+		FBXImportElement colors;
+		FBXImportElement normals;
+		FBXImportElement tangents;
+		FBXImportElement bitangents;
+		FBXImportElement UV0;
+		FBXImportElement UV1;
+
+		Matrix4 transform;
+		Matrix4 transformIT;
+
+		/** Output */
+		FBXImportVertex* vertices;
+		UINT32 numVertices;
+		UINT32* indices;
+		UINT32 numIndices;
+		Vector<SubMesh> subMeshes;
+
+		bool hasColor;
+		bool hasNormal;
+		bool hasTangent;
+		bool hasBitangent;
+		bool hasUV0;
+		bool hasUV1;
+	};
+
 	/**
 	 * @brief	Importer implementation that handles FBX/OBJ/DAE/3DS file import 
 	 *			by using the FBX SDK.
@@ -33,10 +122,20 @@ namespace BansheeEngine
 		 */
 		virtual bool isMagicNumberSupported(const UINT8* magicNumPtr, UINT32 numBytes) const; 
 
+		/**
+		 * @copydoc	SpecificImporter::getVersion
+		 */
+		virtual UINT32 getVersion() const { return 6; }
+
 		/**
 		 * @copydoc	SpecificImporter::import
 		 */
 		virtual ResourcePtr import(const Path& filePath, ConstImportOptionsPtr importOptions);
+
+		/**
+		 * @copydoc SpecificImporter::createImportOptions
+		 */
+		virtual ImportOptionsPtr createImportOptions() const;
 	private:
 		/**
 		 * @brief	Starts up FBX SDK. Must be called before any other operations.
@@ -61,14 +160,37 @@ namespace BansheeEngine
 		 *			containing all vertices, indexes and other mesh information. Also outputs
 		 *			a sub-mesh array that allows you locate specific sub-meshes within the returned
 		 *			mesh data object.
+		 *
+		 * @note	Data is first extracted from the SDK serially, after which all meshes are converted 
+		 *			in parallel and written into the output mesh data object.
 		 */
 		MeshDataPtr parseScene(FbxManager* manager, FbxScene* scene, Vector<SubMesh>& subMeshes);
 
 		/**
-		 * @brief	Parses an FBX mesh. Converts it from FBX SDK format into a mesh data object containing
-		 *			one or multiple sub-meshes.
+		 * @brief	Copies raw data of an FBX mesh into a new import mesh object. Returns null if the
+		 *			mesh doesn't contain any polygons.
+		 */
+		FBXImportMesh* extractMesh(FbxMesh* mesh);
+
+		/**
+		 * @brief	Copies the contents of an FBX geometry element into the provided import element.
+		 */
+		template<class T>
+		void extractElement(const FbxLayerElementTemplate<T>* element, FrameAlloc* arena, FBXImportElement& output);
+
+		/**
+		 * @brief	Converts raw data of an import mesh into a list of unique vertices and indices grouped
+		 *			per material. Triangulates the polygons and generates tangents if they are missing.
+		 *
+		 * @note	Doesn't access the FBX SDK and may be called from any thread.
+		 */
+		void processMesh(FBXImportMesh& mesh, bool createTangentsIfMissing = true);
+
+		/**
+		 * @brief	Creates a mesh data object large enough to hold all of the provided processed meshes,
+		 *			and writes their vertices and indices into it. Outputs a combined list of sub-meshes.
 		 */
-		MeshDataPtr parseMesh(FbxMesh* mesh, Vector<SubMesh>& subMeshes, bool createTangentsIfMissing = true);
+		MeshDataPtr combineMeshes(const Vector<FBXImportMesh*>& meshes, Vector<SubMesh>& subMeshes);
 
 		/**
 		 * @brief	Computes world transform matrix for the specified FBX node.
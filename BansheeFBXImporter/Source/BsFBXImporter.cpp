@@ -13,6 +13,13 @@
 #include "BsVector3.h"
 #include "BsVector4.h"
 #include "BsVertexDataDesc.h"
+#include "BsColor.h"
+#include "BsFrameAlloc.h"
+#include "BsTaskScheduler.h"
+#include "BsMeshImportOptions.h"
+#include "BsMeshOptimizer.h"
+#include "BsMeshSimplifier.h"
+#include "BsMeshQuantizer.h"
 
 namespace BansheeEngine
 {
@@ -40,8 +47,15 @@ namespace BansheeEngine
 		return true; // FBX files can be plain-text so I don't even check for magic number
 	}
 
+	ImportOptionsPtr FBXImporter::createImportOptions() const
+	{
+		return bs_shared_ptr<MeshImportOptions, ScratchAlloc>();
+	}
+
 	ResourcePtr FBXImporter::import(const Path& filePath, ConstImportOptionsPtr importOptions)
 	{
+		const MeshImportOptions* meshImportOptions = static_cast<const MeshImportOptions*>(importOptions.get());
+
 		FbxManager* fbxManager = nullptr;
 		FbxScene* fbxScene = nullptr;
 
@@ -53,7 +67,29 @@ namespace BansheeEngine
 
 		shutDownSdk(fbxManager);
 
+		Vector<SubMesh> lodSubMeshes;
+		Vector<float> lodScreenSizes;
+		meshData = MeshSimplifier::generateLODs(meshData, subMeshes, meshImportOptions->getNumLODs(), lodSubMeshes, lodScreenSizes);
+
+		if(meshData != nullptr && meshImportOptions->getOptimizeMesh())
+		{
+			// Optimize all levels together so their vertices end up ordered by first use across the levels
+			Vector<SubMesh> allSubMeshes = subMeshes;
+			allSubMeshes.insert(allSubMeshes.end(), lodSubMeshes.begin(), lodSubMeshes.end());
+
+			MeshOptimizer::optimize(*meshData, allSubMeshes);
+		}
+
+		// Directions are left unquantized as built-in shaders don't decode octahedral normals
+		if(meshData != nullptr)
+		{
+			meshData = MeshQuantizer::quantize(meshData, meshImportOptions->getQuantizePositions(), 
+				false, meshImportOptions->getQuantizeTexCoords());
+		}
+
 		MeshPtr mesh = Mesh::_createPtr(meshData, subMeshes);
+		if(!lodScreenSizes.empty())
+			mesh->_setLODs(lodSubMeshes, lodScreenSizes);
 
 		WString fileName = filePath.getWFilename(false);
 		mesh->setName(toString(fileName));
@@ -122,484 +158,835 @@ namespace BansheeEngine
 		importer->Destroy();
 	}
 
-	MeshDataPtr FBXImporter::parseScene(FbxManager* manager, FbxScene* scene, Vector<SubMesh>& subMeshes)
+	/**
+	 * @brief	Number of bytes initially reserved in a mesh arena per polygon vertex. Arenas 
+	 *			allocate more memory if this isn't enough.
+	 */
+	static const UINT32 ARENA_BYTES_PER_POLYGON_VERTEX = 256;
+
+	/**
+	 * @brief	Minimum number of bytes initially reserved in a mesh arena.
+	 */
+	static const UINT32 MIN_ARENA_SIZE = 16 * 1024;
+
+	/**
+	 * @brief	Allocates an array of elements of the specified type from the arena. Returned memory is 
+	 *			aligned to 16 bytes and uninitialized.
+	 */
+	template<class T>
+	static T* arenaAlloc(FrameAlloc* arena, UINT32 count)
 	{
-		Stack<FbxNode*> todo;
-		todo.push(scene->GetRootNode());
-
-		Vector<MeshDataPtr> allMeshes;
-		Vector<Vector<SubMesh>> allSubMeshes;
+		UINT8* data = arena->alloc(count * sizeof(T) + 15);
+		return (T*)(((size_t)data + 15) & ~(size_t)15);
+	}
 
-		while(!todo.empty())
+	/**
+	 * @brief	Calls the provided function once for every mesh in the list. Meshes are split between 
+	 *			multiple tasks if the task scheduler is running.
+	 */
+	static void forEachMesh(const Vector<FBXImportMesh*>& meshes, const std::function<void(UINT32)>& func)
+	{
+		UINT32 numMeshes = (UINT32)meshes.size();
+		if(!TaskScheduler::isStarted() || numMeshes <= 1)
 		{
-			FbxNode* curNode = todo.top();
-			todo.pop();
+			for(UINT32 i = 0; i < numMeshes; i++)
+				func(i);
 
-			const char* name = curNode->GetName();
+			return;
+		}
 
-			FbxNodeAttribute* attrib = curNode->GetNodeAttribute();
-			if(attrib != nullptr)
+		Vector<TaskPtr> tasks;
+		for(UINT32 i = 0; i < numMeshes; i++)
+		{
+			TaskPtr task = Task::create("FBXImport", [&func, i]()
 			{
-				FbxNodeAttribute::EType attribType = attrib->GetAttributeType();
+				func(i);
+			});
 
-				switch(attribType)
-				{
-				case FbxNodeAttribute::eMesh:
-					{
-						FbxMesh* mesh = static_cast<FbxMesh*>(attrib);
-						mesh->RemoveBadPolygons();
-
-						if(!mesh->IsTriangleMesh())
-						{
-							FbxGeometryConverter geomConverter(manager);
-							geomConverter.Triangulate(mesh, true);
-							attrib = curNode->GetNodeAttribute();
-							mesh = static_cast<FbxMesh*>(attrib);
-						}
+			TaskScheduler::instance().addTask(task);
+			tasks.push_back(task);
+		}
 
-						allSubMeshes.push_back(Vector<SubMesh>());
+		for(auto& task : tasks)
+			task->wait();
+	}
 
-						MeshDataPtr meshData = parseMesh(mesh, allSubMeshes.back()); 
-						allMeshes.push_back(meshData);
+	static Vector4 toVector4(const FbxVector4& value)
+	{
+		return Vector4((float)value[0], (float)value[1], (float)value[2], (float)value[3]);
+	}
 
-						// TODO - Transform meshes based on node transform
-					}
-					break;
-				case FbxNodeAttribute::eSkeleton:
-					break; // TODO - I should probably implement skeleton parsing
+	static Vector4 toVector4(const FbxVector2& value)
+	{
+		return Vector4((float)value[0], (float)value[1], 0.0f, 0.0f);
+	}
 
-				}
-			}
+	static Vector4 toVector4(const FbxColor& value)
+	{
+		return Vector4((float)value[0], (float)value[1], (float)value[2], (float)value[3]);
+	}
 
-			for(int i = 0; i < curNode->GetChildCount(); i++)
-				todo.push(curNode->GetChild(i));
+	/**
+	 * @brief	Converts an FBX matrix into a matrix that transforms column vectors in the same way
+	 *			as the FBX matrix transforms row vectors.
+	 */
+	static Matrix4 toMatrix4(const FbxAMatrix& value)
+	{
+		Matrix4 output;
+		for(UINT32 row = 0; row < 4; row++)
+		{
+			for(UINT32 col = 0; col < 4; col++)
+				output[row][col] = (float)value.Get(col, row);
 		}
 
-		if(allMeshes.size() == 0)
-			return nullptr;
-		else if(allMeshes.size() == 1)
-		{
-			subMeshes = allSubMeshes[0];
+		return output;
+	}
 
-			return allMeshes[0];
-		}
-		else
-		{
-			MeshDataPtr combinedMeshData = MeshData::combine(allMeshes, allSubMeshes, subMeshes);
+	/**
+	 * @brief	Transforms a direction (e.g. a normal) using the provided matrix, and normalizes it.
+	 */
+	static Vector3 transformDirection(const Matrix4& transform, const Vector4& direction)
+	{
+		Vector4 transformed = transform.multiply3x4(Vector4(direction.x, direction.y, direction.z, 0.0f));
 
-			return combinedMeshData;
-		}
+		Vector3 output(transformed.x, transformed.y, transformed.z);
+		output.normalize();
+
+		return output;
 	}
 
-	MeshDataPtr FBXImporter::parseMesh(FbxMesh* mesh, Vector<SubMesh>& subMeshes, bool createTangentsIfMissing)
+	/**
+	 * @brief	Finds the value of a geometry element for the specified polygon vertex. Returns false if 
+	 *			the element has no valid value for it.
+	 */
+	static bool resolveElement(const FBXImportElement& element, UINT32 polygonIdx, UINT32 polygonVertexIdx, 
+		INT32 controlPointIdx, Vector4& output)
 	{
-		if (!mesh->GetNode())
+		INT32 idx = 0;
+		switch(element.mappingMode)
 		{
-			VertexDataDescPtr tmpVertDesc = bs_shared_ptr<VertexDataDesc>();
-			return bs_shared_ptr<MeshData, ScratchAlloc>(0, 0, tmpVertDesc);
+		case FbxGeometryElement::eByControlPoint:
+			idx = controlPointIdx;
+			break;
+		case FbxGeometryElement::eByPolygonVertex:
+			idx = (INT32)polygonVertexIdx;
+			break;
+		case FbxGeometryElement::eByPolygon:
+			idx = (INT32)polygonIdx;
+			break;
+		case FbxGeometryElement::eAllSame:
+			idx = 0;
+			break;
+		default:
+			return false;
 		}
 
-		// Find out which vertex attributes exist
-		bool hasColor = mesh->GetElementVertexColorCount() > 0;
-		const FbxGeometryElementVertexColor* colorElement = nullptr;
-		FbxGeometryElement::EMappingMode colorMappingMode = FbxGeometryElement::eNone;
-		FbxGeometryElement::EReferenceMode colorRefMode = FbxGeometryElement::eDirect;
-
-		if(hasColor)
+		if(element.referenceMode != FbxGeometryElement::eDirect)
 		{
-			colorElement = mesh->GetElementVertexColor(0);
-			colorMappingMode = colorElement->GetMappingMode();
-			colorRefMode = colorElement->GetReferenceMode();
+			if(idx < 0 || (UINT32)idx >= element.numIndices)
+				return false;
 
-			if (colorMappingMode == FbxGeometryElement::eNone)
-				hasColor = false;
+			idx = element.indices[idx];
 		}
 
-		bool hasNormal = mesh->GetElementNormalCount() > 0;
-		const FbxGeometryElementNormal* normalElement = nullptr;
-		FbxGeometryElement::EMappingMode normalMappingMode = FbxGeometryElement::eNone;
-		FbxGeometryElement::EReferenceMode normalRefMode = FbxGeometryElement::eDirect;
+		if(idx < 0 || (UINT32)idx >= element.numData)
+			return false;
+
+		output = element.data[idx];
+		return true;
+	}
+
+	/**
+	 * @brief	Returns twice the signed area of the triangle, positive if the triangle is counter-clockwise.
+	 */
+	static float orientation(const Vector2& a, const Vector2& b, const Vector2& c)
+	{
+		return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+	}
+
+	/**
+	 * @brief	Checks can the vertex "cur" of a counter-clockwise polygon be clipped off as a triangle
+	 *			formed with its neighbors, without the triangle containing any other remaining vertex.
+	 */
+	static bool isEar(const Vector2* points, const UINT32* remaining, UINT32 numRemaining, UINT32 prev, UINT32 cur, UINT32 next)
+	{
+		const Vector2& a = points[prev];
+		const Vector2& b = points[cur];
+		const Vector2& c = points[next];
+
+		if(orientation(a, b, c) <= 0.0f)
+			return false;
 
-		if (hasNormal)
+		for(UINT32 i = 0; i < numRemaining; i++)
 		{
-			normalElement = mesh->GetElementNormal(0);
-			normalMappingMode = normalElement->GetMappingMode();
-			normalRefMode = normalElement->GetReferenceMode();
+			UINT32 idx = remaining[i];
+			if(idx == prev || idx == cur || idx == next)
+				continue;
 
-			if (normalMappingMode == FbxGeometryElement::eNone)
-				hasNormal = false;
+			const Vector2& p = points[idx];
+			if(orientation(a, b, p) >= 0.0f && orientation(b, c, p) >= 0.0f && orientation(c, a, p) >= 0.0f)
+				return false;
 		}
 
-		bool hasTangent = mesh->GetElementTangentCount() > 0;
-		const FbxGeometryElementTangent* tangentElement = nullptr;
-		FbxGeometryElement::EMappingMode tangentMappingMode = FbxGeometryElement::eNone;
-		FbxGeometryElement::EReferenceMode tangentRefMode = FbxGeometryElement::eDirect;
+		return true;
+	}
 
-		if (hasTangent)
+	/**
+	 * @brief	Splits a polygon into triangles using ear clipping.
+	 *
+	 * @param	positions	Positions of the polygon vertices.
+	 * @param	numVertices	Number of vertices in the polygon, at least three.
+	 * @param	remaining	Buffer of at least "numVertices" entries used for intermediate data.
+	 * @param	points		Buffer of at least "numVertices" entries used for intermediate data.
+	 * @param	output		Buffer of at least "(numVertices - 2) * 3" entries that receives indices of the polygon
+	 *						vertices forming the triangles, relative to the polygon start. Triangles have the same 
+	 *						winding as the polygon.
+	 */
+	static void triangulatePolygon(const Vector3* positions, UINT32 numVertices, UINT32* remaining, Vector2* points, UINT32* output)
+	{
+		// Find the polygon normal using Newell's method, and project the polygon onto the axis-aligned
+		// plane it's most parallel to, flipped so the polygon is always counter-clockwise
+		Vector3 normal = Vector3::ZERO;
+		for(UINT32 i = 0; i < numVertices; i++)
 		{
-			tangentElement = mesh->GetElementTangent(0);
-			tangentMappingMode = tangentElement->GetMappingMode();
-			tangentRefMode = tangentElement->GetReferenceMode();
+			const Vector3& cur = positions[i];
+			const Vector3& next = positions[(i + 1) % numVertices];
 
-			if (tangentMappingMode == FbxGeometryElement::eNone)
-				hasTangent = false;
+			normal.x += (cur.y - next.y) * (cur.z + next.z);
+			normal.y += (cur.z - next.z) * (cur.x + next.x);
+			normal.z += (cur.x - next.x) * (cur.y + next.y);
 		}
 
-		bool hasBitangent = mesh->GetElementBinormalCount() > 0;
-		const FbxGeometryElementBinormal* bitangentElement = nullptr;
-		FbxGeometryElement::EMappingMode bitangentMappingMode = FbxGeometryElement::eNone;
-		FbxGeometryElement::EReferenceMode bitangentRefMode = FbxGeometryElement::eDirect;
+		UINT32 axisU = 0;
+		UINT32 axisV = 1;
+		float area = normal.z;
 
-		if (hasBitangent)
+		if(Math::abs(normal.x) >= Math::abs(normal.y) && Math::abs(normal.x) >= Math::abs(normal.z))
+		{
+			axisU = 1;
+			axisV = 2;
+			area = normal.x;
+		}
+		else if(Math::abs(normal.y) >= Math::abs(normal.z))
 		{
-			bitangentElement = mesh->GetElementBinormal(0);
-			bitangentMappingMode = bitangentElement->GetMappingMode();
-			bitangentRefMode = bitangentElement->GetReferenceMode();
+			axisU = 2;
+			axisV = 0;
+			area = normal.y;
+		}
 
-			if (bitangentMappingMode == FbxGeometryElement::eNone)
-				hasBitangent = false;
+		float flip = area < 0.0f ? -1.0f : 1.0f;
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			points[i] = Vector2(positions[i][axisU], positions[i][axisV] * flip);
+			remaining[i] = i;
 		}
 
-		bool hasUV0 = mesh->GetElementUVCount() > 0;
-		const FbxGeometryElementUV* UVElement0 = nullptr;
-		FbxGeometryElement::EMappingMode UVMappingMode0 = FbxGeometryElement::eNone;
-		FbxGeometryElement::EReferenceMode UVRefMode0 = FbxGeometryElement::eDirect;
+		UINT32 numRemaining = numVertices;
+		UINT32 numOutput = 0;
+		UINT32 cur = 0;
+		UINT32 numRejected = 0;
 
-		if (hasUV0)
+		while(numRemaining > 3)
 		{
-			UVElement0 = mesh->GetElementUV(0);
-			UVMappingMode0 = UVElement0->GetMappingMode();
-			UVRefMode0 = UVElement0->GetReferenceMode();
+			UINT32 prevIdx = remaining[(cur + numRemaining - 1) % numRemaining];
+			UINT32 curIdx = remaining[cur];
+			UINT32 nextIdx = remaining[(cur + 1) % numRemaining];
+
+			if(isEar(points, remaining, numRemaining, prevIdx, curIdx, nextIdx))
+			{
+				output[numOutput++] = prevIdx;
+				output[numOutput++] = curIdx;
+				output[numOutput++] = nextIdx;
+
+				for(UINT32 i = cur; i < numRemaining - 1; i++)
+					remaining[i] = remaining[i + 1];
+
+				numRemaining--;
+				if(cur >= numRemaining)
+					cur = 0;
+
+				numRejected = 0;
+			}
+			else
+			{
+				cur = (cur + 1) % numRemaining;
+				numRejected++;
+
+				// Degenerate or self-intersecting polygon, fall back to a fan for the remaining vertices
+				if(numRejected >= numRemaining)
+					break;
+			}
+		}
 
-			if (UVMappingMode0 == FbxGeometryElement::eNone)
-				hasUV0 = false;
+		for(UINT32 i = 1; i < numRemaining - 1; i++)
+		{
+			output[numOutput++] = remaining[0];
+			output[numOutput++] = remaining[i];
+			output[numOutput++] = remaining[i + 1];
 		}
+	}
 
-		bool hasUV1 = mesh->GetElementUVCount() > 1;
-		const FbxGeometryElementUV* UVElement1 = nullptr;
-		FbxGeometryElement::EMappingMode UVMappingMode1 = FbxGeometryElement::eNone;
-		FbxGeometryElement::EReferenceMode UVRefMode1 = FbxGeometryElement::eDirect;
+	/**
+	 * @brief	Calculates a hash of all the vertex attributes.
+	 */
+	static UINT32 hashVertex(const FBXImportVertex& vertex)
+	{
+		const UINT8* data = (const UINT8*)&vertex;
 
-		if (hasUV1)
+		UINT32 hash = 2166136261U;
+		for(UINT32 i = 0; i < sizeof(FBXImportVertex); i++)
+			hash = (hash ^ data[i]) * 16777619U;
+
+		return hash;
+	}
+
+	/**
+	 * @brief	Generates tangents and bitangents for the provided vertices from their positions, normals 
+	 *			and first set of texture coordinates. Vertices must have normals and texture coordinates.
+	 */
+	static void generateTangents(FBXImportVertex* vertices, UINT32 numVertices, const UINT32* indices, UINT32 numIndices, FrameAlloc* arena)
+	{
+		Vector3* tangents = arenaAlloc<Vector3>(arena, numVertices);
+		Vector3* bitangents = arenaAlloc<Vector3>(arena, numVertices);
+
+		memset(tangents, 0, numVertices * sizeof(Vector3));
+		memset(bitangents, 0, numVertices * sizeof(Vector3));
+
+		for(UINT32 i = 0; i < numIndices; i += 3)
 		{
-			UVElement1 = mesh->GetElementUV(1);
-			UVMappingMode1 = UVElement1->GetMappingMode();
-			UVRefMode1 = UVElement1->GetReferenceMode();
+			const FBXImportVertex& v0 = vertices[indices[i + 0]];
+			const FBXImportVertex& v1 = vertices[indices[i + 1]];
+			const FBXImportVertex& v2 = vertices[indices[i + 2]];
 
-			if (UVMappingMode1 == FbxGeometryElement::eNone)
-				hasUV1 = false;
-		}
+			Vector3 edge1 = v1.position - v0.position;
+			Vector3 edge2 = v2.position - v0.position;
+			Vector2 uvEdge1 = v1.uv0 - v0.uv0;
+			Vector2 uvEdge2 = v2.uv0 - v0.uv0;
 
-		// Create tangents if needed
-		if(createTangentsIfMissing && mesh->GetElementUVCount() > 0)
-			mesh->GenerateTangentsData(0, false);
+			float det = uvEdge1.x * uvEdge2.y - uvEdge2.x * uvEdge1.y;
+			if(Math::abs(det) < 1e-12f)
+				continue;
 
-		// Calculate number of vertices and indexes
-		int polygonCount = mesh->GetPolygonCount();
-		UINT32 vertexCount = 0;
+			float invDet = 1.0f / det;
+			Vector3 tangent = (edge1 * uvEdge2.y - edge2 * uvEdge1.y) * invDet;
+			Vector3 bitangent = (edge2 * uvEdge1.x - edge1 * uvEdge2.x) * invDet;
 
-		VertexDataDescPtr vertexDesc = bs_shared_ptr<VertexDataDesc>();
+			for(UINT32 j = 0; j < 3; j++)
+			{
+				tangents[indices[i + j]] += tangent;
+				bitangents[indices[i + j]] += bitangent;
+			}
+		}
 
-		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			const Vector3& normal = vertices[i].normal;
 
-		if(hasColor)
-			vertexDesc->addVertElem(VET_COLOR, VES_COLOR);
+			// Orthogonalize the tangent with the normal, and use the accumulated bitangent only for handedness
+			Vector3 tangent = tangents[i] - normal * normal.dot(tangents[i]);
+			if(tangent.squaredLength() < 1e-12f)
+				tangent = normal.perpendicular();
+			else
+				tangent.normalize();
 
-		if(hasNormal)
-			vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+			Vector3 bitangent = normal.cross(tangent);
+			if(bitangent.dot(bitangents[i]) < 0.0f)
+				bitangent = -bitangent;
 
-		if(hasTangent)
-			vertexDesc->addVertElem(VET_FLOAT3, VES_TANGENT);
+			vertices[i].tangent = tangent;
+			vertices[i].bitangent = bitangent;
+		}
+	}
 
-		if(hasBitangent)
-			vertexDesc->addVertElem(VET_FLOAT3, VES_BITANGENT);
+	FBXImportElement::FBXImportElement()
+		:data(nullptr), numData(0), indices(nullptr), numIndices(0), 
+		mappingMode(FbxGeometryElement::eNone), referenceMode(FbxGeometryElement::eDirect)
+	{ }
 
-		if (hasUV0)
-			vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD, 0);
+	FBXImportMesh::FBXImportMesh(UINT32 arenaSize)
+		:controlPoints(nullptr), numControlPoints(0), polygonVertices(nullptr), numPolygonVertices(0), 
+		polygonStarts(nullptr), numPolygons(0), materials(nullptr), numMaterialIndices(0), numMaterials(0),
+		vertices(nullptr), numVertices(0), indices(nullptr), numIndices(0), hasColor(false), hasNormal(false),
+		hasTangent(false), hasBitangent(false), hasUV0(false), hasUV1(false)
+	{
+		arena = bs_new<FrameAlloc>(arenaSize);
+	}
 
-		if (hasUV1)
-			vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD, 1);
+	FBXImportMesh::~FBXImportMesh()
+	{
+		bs_delete(arena);
+	}
 
-		// Count the polygon count of each material
-		FbxLayerElementArrayTemplate<int>* materialElementArray = NULL;
-		FbxGeometryElement::EMappingMode materialMappingMode = FbxGeometryElement::eNone;
+	MeshDataPtr FBXImporter::parseScene(FbxManager* manager, FbxScene* scene, Vector<SubMesh>& subMeshes)
+	{
+		Stack<FbxNode*> todo;
+		todo.push(scene->GetRootNode());
 
-		Set<UINT32> uniqueIndices;
-		UINT32 numIndices = 0;
-		if (mesh->GetElementMaterial())
+		// Extract raw data of all meshes first, as the FBX SDK may only be accessed from this thread
+		Vector<FBXImportMesh*> meshes;
+
+		while(!todo.empty())
 		{
-			materialElementArray = &mesh->GetElementMaterial()->GetIndexArray();
-			materialMappingMode = mesh->GetElementMaterial()->GetMappingMode();
-			if (materialElementArray && materialMappingMode == FbxGeometryElement::eByPolygon)
+			FbxNode* curNode = todo.top();
+			todo.pop();
+
+			FbxNodeAttribute* attrib = curNode->GetNodeAttribute();
+			if(attrib != nullptr)
 			{
-				FBX_ASSERT(materialElementArray->GetCount() == polygonCount);
-				if (materialElementArray->GetCount() == polygonCount)
+				FbxNodeAttribute::EType attribType = attrib->GetAttributeType();
+
+				switch(attribType)
 				{
-					// Count the faces of each material
-					for (int polygonIndex = 0; polygonIndex < polygonCount; ++polygonIndex)
+				case FbxNodeAttribute::eMesh:
 					{
-						const UINT32 materialIndex = (UINT32)materialElementArray->GetAt(polygonIndex);
-						if (subMeshes.size() < materialIndex + 1)
-						{
-							subMeshes.resize(materialIndex + 1);
-						}
+						FbxMesh* mesh = static_cast<FbxMesh*>(attrib);
 
-						subMeshes[materialIndex].indexCount += 3;
+						FBXImportMesh* importMesh = extractMesh(mesh);
+						if(importMesh != nullptr)
+							meshes.push_back(importMesh);
 					}
+					break;
+				case FbxNodeAttribute::eSkeleton:
+					break; // TODO - I should probably implement skeleton parsing
 
-					// Record the offsets and allocate index arrays
-					UINT32 materialCount = (UINT32)subMeshes.size();
-					int offset = 0;
-					for (UINT32 i = 0; i < materialCount; ++i)
-					{
-						subMeshes[i].indexOffset = offset;
-						offset += subMeshes[i].indexCount;
-
-						numIndices += subMeshes[i].indexCount;
-					}
-					FBX_ASSERT(offset == polygonCount * 3);
 				}
 			}
+
+			for(int i = 0; i < curNode->GetChildCount(); i++)
+				todo.push(curNode->GetChild(i));
 		}
 
-		if (subMeshes.size() == 0)
+		if(meshes.size() == 0)
+			return nullptr;
+
+		forEachMesh(meshes, [&](UINT32 idx)
 		{
-			numIndices = polygonCount * 3;
+			processMesh(*meshes[idx]);
+		});
+
+		MeshDataPtr meshData = combineMeshes(meshes, subMeshes);
+
+		for(auto& mesh : meshes)
+			bs_delete(mesh);
 
-			subMeshes.resize(1);
-			subMeshes[0].indexCount = polygonCount * 3;
+		return meshData;
+	}
+
+	FBXImportMesh* FBXImporter::extractMesh(FbxMesh* mesh)
+	{
+		if(mesh->GetNode() == nullptr)
+			return nullptr;
+
+		mesh->RemoveBadPolygons();
+
+		INT32 numControlPoints = mesh->GetControlPointsCount();
+		INT32 numPolygons = mesh->GetPolygonCount();
+		INT32 numPolygonVertices = mesh->GetPolygonVertexCount();
+
+		if(numControlPoints <= 0 || numPolygons <= 0 || numPolygonVertices <= 0)
+			return nullptr;
+
+		UINT32 arenaSize = std::max(MIN_ARENA_SIZE, (UINT32)numPolygonVertices * ARENA_BYTES_PER_POLYGON_VERTEX);
+		FBXImportMesh* output = bs_new<FBXImportMesh>(arenaSize);
+		FrameAlloc* arena = output->arena;
+
+		const FbxVector4* controlPoints = mesh->GetControlPoints();
+		output->numControlPoints = (UINT32)numControlPoints;
+		output->controlPoints = arenaAlloc<Vector3>(arena, output->numControlPoints);
+
+		for(INT32 i = 0; i < numControlPoints; i++)
+		{
+			const FbxVector4& controlPoint = controlPoints[i];
+			output->controlPoints[i] = Vector3((float)controlPoint[0], (float)controlPoint[1], (float)controlPoint[2]);
 		}
 
-		// Count number of unique vertices
-		for (int polygonIndex = 0; polygonIndex < polygonCount; ++polygonIndex)
+		const int* polygonVertices = mesh->GetPolygonVertices();
+		output->numPolygonVertices = (UINT32)numPolygonVertices;
+		output->polygonVertices = arenaAlloc<INT32>(arena, output->numPolygonVertices);
+
+		for(INT32 i = 0; i < numPolygonVertices; i++)
 		{
-			for (int vertexIndex = 0; vertexIndex < 3; ++vertexIndex)
+			INT32 controlPointIdx = polygonVertices[i];
+			output->polygonVertices[i] = (controlPointIdx >= 0 && controlPointIdx < numControlPoints) ? controlPointIdx : 0;
+		}
+
+		output->numPolygons = (UINT32)numPolygons;
+		output->polygonStarts = arenaAlloc<UINT32>(arena, output->numPolygons + 1);
+
+		for(INT32 i = 0; i < numPolygons; i++)
+			output->polygonStarts[i] = (UINT32)mesh->GetPolygonVertexIndex(i);
+
+		output->polygonStarts[numPolygons] = (UINT32)numPolygonVertices;
+
+		FbxGeometryElementMaterial* materialElement = mesh->GetElementMaterial();
+		if(materialElement != nullptr && materialElement->GetMappingMode() == FbxGeometryElement::eByPolygon)
+		{
+			const FbxLayerElementArrayTemplate<int>& materialIndices = materialElement->GetIndexArray();
+			if(materialIndices.GetCount() == numPolygons)
 			{
-				const int controlPointIndex = mesh->GetPolygonVertex(polygonIndex, vertexIndex);
-				if (uniqueIndices.find(controlPointIndex) == uniqueIndices.end())
+				output->numMaterialIndices = (UINT32)numPolygons;
+				output->materials = arenaAlloc<INT32>(arena, output->numMaterialIndices);
+
+				for(INT32 i = 0; i < numPolygons; i++)
 				{
-					uniqueIndices.insert(controlPointIndex);
-					vertexCount++;
+					INT32 materialIdx = std::max(materialIndices.GetAt(i), 0);
+
+					output->materials[i] = materialIdx;
+					output->numMaterials = std::max(output->numMaterials, (UINT32)materialIdx + 1);
 				}
 			}
 		}
 
-		// Allocate the array memory for all vertices and indices
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(vertexCount, numIndices, vertexDesc);
+		if(mesh->GetElementVertexColorCount() > 0)
+			extractElement(mesh->GetElementVertexColor(0), arena, output->colors);
 
-		VertexElemIter<Vector3> positions = meshData->getVec3DataIter(VES_POSITION);
+		if(mesh->GetElementNormalCount() > 0)
+			extractElement(mesh->GetElementNormal(0), arena, output->normals);
 
-		VertexElemIter<UINT32> colors;
-		if(hasColor)
-			colors = meshData->getDWORDDataIter(VES_COLOR);
+		if(mesh->GetElementTangentCount() > 0)
+			extractElement(mesh->GetElementTangent(0), arena, output->tangents);
 
-		VertexElemIter<Vector3> normals;
-		if (hasNormal)
-			normals = meshData->getVec3DataIter(VES_NORMAL);
+		if(mesh->GetElementBinormalCount() > 0)
+			extractElement(mesh->GetElementBinormal(0), arena, output->bitangents);
 
-		VertexElemIter<Vector3> tangents;
-		if (hasTangent)
-			tangents = meshData->getVec3DataIter(VES_TANGENT);
+		if(mesh->GetElementUVCount() > 0)
+			extractElement(mesh->GetElementUV(0), arena, output->UV0);
 
-		VertexElemIter<Vector3> bitangents;
-		if (hasBitangent)
-			bitangents = meshData->getVec3DataIter(VES_BITANGENT);
+		if(mesh->GetElementUVCount() > 1)
+			extractElement(mesh->GetElementUV(1), arena, output->UV1);
 
-		VertexElemIter<Vector2> uv0;
-		if (hasUV0)
-			uv0 = meshData->getVec2DataIter(VES_TEXCOORD, 0);
+		FbxAMatrix worldTransform = computeWorldTransform(mesh->GetNode());
+		FbxAMatrix worldTransformIT = worldTransform.Inverse();
+		worldTransformIT = worldTransformIT.Transpose();
 
-		VertexElemIter<Vector2> uv1;
-		if (hasUV1)
-			uv1 = meshData->getVec2DataIter(VES_TEXCOORD, 1);
+		output->transform = toMatrix4(worldTransform);
+		output->transformIT = toMatrix4(worldTransformIT);
 
-		// Get node transform
-		FbxAMatrix worldTransform;
-		FbxAMatrix worldTransformIT;
-		worldTransform = computeWorldTransform(mesh->GetNode());
-		worldTransformIT = worldTransform.Inverse();
-		worldTransformIT = worldTransformIT.Transpose();
+		return output;
+	}
 
-		// Populate the mesh data with vertex attributes and indices
-		const FbxVector4* controlPoints = mesh->GetControlPoints();
+	template<class T>
+	void FBXImporter::extractElement(const FbxLayerElementTemplate<T>* element, FrameAlloc* arena, FBXImportElement& output)
+	{
+		FbxGeometryElement::EMappingMode mappingMode = element->GetMappingMode();
+		if(mappingMode == FbxGeometryElement::eNone || mappingMode == FbxGeometryElement::eByEdge)
+			return;
 
-		Vector<UINT32> indexOffsetPerSubmesh;
-		indexOffsetPerSubmesh.resize(subMeshes.size(), 0);
+		const FbxLayerElementArrayTemplate<T>& directArray = element->GetDirectArray();
+		INT32 numData = directArray.GetCount();
+		if(numData <= 0)
+			return;
 
-		Vector<UINT32*> indices;
-		indices.resize(subMeshes.size());
+		output.mappingMode = mappingMode;
+		output.referenceMode = element->GetReferenceMode();
+		output.numData = (UINT32)numData;
+		output.data = arenaAlloc<Vector4>(arena, output.numData);
 
-		for(UINT32 i = 0; i < (UINT32)indices.size(); i++)
+		for(INT32 i = 0; i < numData; i++)
+			output.data[i] = toVector4(directArray.GetAt(i));
+
+		if(output.referenceMode != FbxGeometryElement::eDirect)
 		{
-			indices[i] = meshData->getIndices32() + subMeshes[i].indexOffset;
+			const FbxLayerElementArrayTemplate<int>& indexArray = element->GetIndexArray();
+			INT32 numIndices = std::max(indexArray.GetCount(), 0);
+
+			output.numIndices = (UINT32)numIndices;
+			output.indices = arenaAlloc<INT32>(arena, output.numIndices);
+
+			for(INT32 i = 0; i < numIndices; i++)
+				output.indices[i] = indexArray.GetAt(i);
+		}
+	}
+
+	void FBXImporter::processMesh(FBXImportMesh& mesh, bool createTangentsIfMissing)
+	{
+		FrameAlloc* arena = mesh.arena;
+
+		mesh.hasColor = mesh.colors.isPresent();
+		mesh.hasNormal = mesh.normals.isPresent();
+		mesh.hasTangent = mesh.tangents.isPresent();
+		mesh.hasBitangent = mesh.bitangents.isPresent();
+		mesh.hasUV0 = mesh.UV0.isPresent();
+		mesh.hasUV1 = mesh.UV1.isPresent();
+
+		// Triangulate the polygons. Output is a list of polygon vertex indices, three per triangle.
+		UINT32 numTriangles = 0;
+		UINT32 maxPolygonSize = 3;
+		for(UINT32 i = 0; i < mesh.numPolygons; i++)
+		{
+			UINT32 polygonSize = mesh.polygonStarts[i + 1] - mesh.polygonStarts[i];
+			if(polygonSize < 3)
+				continue;
+
+			numTriangles += polygonSize - 2;
+			maxPolygonSize = std::max(maxPolygonSize, polygonSize);
 		}
 
-		Map<UINT32, UINT32> indexMap;
+		UINT32 numCorners = numTriangles * 3;
+		UINT32* corners = arenaAlloc<UINT32>(arena, numCorners);
+		UINT32* trianglePolygons = arenaAlloc<UINT32>(arena, numTriangles);
+
+		UINT32* remaining = arenaAlloc<UINT32>(arena, maxPolygonSize);
+		Vector2* points = arenaAlloc<Vector2>(arena, maxPolygonSize);
+		Vector3* positions = arenaAlloc<Vector3>(arena, maxPolygonSize);
+		UINT32* polygonTriangles = arenaAlloc<UINT32>(arena, (maxPolygonSize - 2) * 3);
 
-		UINT32 curVertexCount = 0;
-		for (int polygonIndex = 0; polygonIndex < polygonCount; ++polygonIndex)
+		UINT32 triangleIdx = 0;
+		for(UINT32 i = 0; i < mesh.numPolygons; i++)
 		{
-			// The material for current face.
-			int lMaterialIndex = 0;
-			if (materialElementArray && materialMappingMode == FbxGeometryElement::eByPolygon)
+			UINT32 polygonStart = mesh.polygonStarts[i];
+			UINT32 polygonSize = mesh.polygonStarts[i + 1] - polygonStart;
+			if(polygonSize < 3)
+				continue;
+
+			if(polygonSize == 3)
 			{
-				lMaterialIndex = materialElementArray->GetAt(polygonIndex);
+				corners[triangleIdx * 3 + 0] = polygonStart + 0;
+				corners[triangleIdx * 3 + 1] = polygonStart + 1;
+				corners[triangleIdx * 3 + 2] = polygonStart + 2;
+				trianglePolygons[triangleIdx++] = i;
+
+				continue;
 			}
 
-			// Where should I save the vertex attribute index, according to the material
-			int indexOffset = subMeshes[lMaterialIndex].indexOffset + indexOffsetPerSubmesh[lMaterialIndex];
-			for (int vertexIndex = 0; vertexIndex < 3; ++vertexIndex)
+			for(UINT32 j = 0; j < polygonSize; j++)
+				positions[j] = mesh.controlPoints[mesh.polygonVertices[polygonStart + j]];
+
+			triangulatePolygon(positions, polygonSize, remaining, points, polygonTriangles);
+
+			for(UINT32 j = 0; j < polygonSize - 2; j++)
 			{
-				int controlPointIndex = mesh->GetPolygonVertex(polygonIndex, vertexIndex);
-				int triangleIndex = indexOffset + (2 - vertexIndex);
+				corners[triangleIdx * 3 + 0] = polygonStart + polygonTriangles[j * 3 + 0];
+				corners[triangleIdx * 3 + 1] = polygonStart + polygonTriangles[j * 3 + 1];
+				corners[triangleIdx * 3 + 2] = polygonStart + polygonTriangles[j * 3 + 2];
+				trianglePolygons[triangleIdx++] = i;
+			}
+		}
 
-				auto findIter = indexMap.find(controlPointIndex);
-				if (findIter != indexMap.end())
-				{
-					indices[lMaterialIndex][triangleIndex] = static_cast<unsigned int>(findIter->second);
-				}
-				else
-				{
-					indices[lMaterialIndex][triangleIndex] = static_cast<unsigned int>(curVertexCount);
-					FbxVector4 currentVertex = controlPoints[controlPointIndex];
-					currentVertex = worldTransform.MultT(currentVertex);
+		// Resolve attributes of every triangle corner
+		FBXImportVertex* vertices = arenaAlloc<FBXImportVertex>(arena, numCorners);
+		memset(vertices, 0, numCorners * sizeof(FBXImportVertex));
 
-					Vector3 curPosValue;
-					curPosValue[0] = static_cast<float>(currentVertex[0]);
-					curPosValue[1] = static_cast<float>(currentVertex[1]);
-					curPosValue[2] = static_cast<float>(currentVertex[2]);
+		for(UINT32 i = 0; i < numCorners; i++)
+		{
+			UINT32 polygonIdx = trianglePolygons[i / 3];
+			UINT32 polygonVertexIdx = corners[i];
+			INT32 controlPointIdx = mesh.polygonVertices[polygonVertexIdx];
 
-					positions.addValue(curPosValue);
-					indexMap[controlPointIndex] = curVertexCount;
-					++curVertexCount;
+			FBXImportVertex& vertex = vertices[i];
+			vertex.position = mesh.transform.multiply3x4(mesh.controlPoints[controlPointIdx]);
 
-					if (hasColor)
-					{
-						int colorIdx = indexOffset + vertexIndex;
+			Vector4 value;
+			if(mesh.hasColor && resolveElement(mesh.colors, polygonIdx, polygonVertexIdx, controlPointIdx, value))
+				vertex.color = Color(value.x, value.y, value.z, value.w).getAsRGBA();
 
-						if (colorMappingMode == FbxLayerElement::eByControlPoint)
-							colorIdx = controlPointIndex;
+			if(mesh.hasNormal && resolveElement(mesh.normals, polygonIdx, polygonVertexIdx, controlPointIdx, value))
+				vertex.normal = transformDirection(mesh.transformIT, value);
 
-						if (colorRefMode == FbxLayerElement::eIndexToDirect)
-							colorIdx = colorElement->GetIndexArray().GetAt(colorIdx);
+			if(mesh.hasTangent && resolveElement(mesh.tangents, polygonIdx, polygonVertexIdx, controlPointIdx, value))
+				vertex.tangent = transformDirection(mesh.transformIT, value);
 
-						FbxColor lCurrentColor = colorElement->GetDirectArray().GetAt(colorIdx);
+			if(mesh.hasBitangent && resolveElement(mesh.bitangents, polygonIdx, polygonVertexIdx, controlPointIdx, value))
+				vertex.bitangent = transformDirection(mesh.transformIT, value);
 
-						Color curColorValue;
-						curColorValue[0] = static_cast<float>(lCurrentColor[0]);
-						curColorValue[1] = static_cast<float>(lCurrentColor[1]);
-						curColorValue[2] = static_cast<float>(lCurrentColor[2]);
-						curColorValue[3] = static_cast<float>(lCurrentColor[3]);
+			if(mesh.hasUV0 && resolveElement(mesh.UV0, polygonIdx, polygonVertexIdx, controlPointIdx, value))
+				vertex.uv0 = Vector2(value.x, 1.0f - value.y);
 
-						UINT32 color32 = curColorValue.getAsRGBA();
-						colors.addValue(color32);
-					}
+			if(mesh.hasUV1 && resolveElement(mesh.UV1, polygonIdx, polygonVertexIdx, controlPointIdx, value))
+				vertex.uv1 = Vector2(value.x, 1.0f - value.y);
+		}
 
-					if (hasNormal)
-					{
-						int normalIdx = indexOffset + vertexIndex;
+		// Weld corners with identical attributes into unique vertices, using an open addressing hash table. 
+		// Unique vertices are compacted at the start of the corner array.
+		UINT32 tableSize = 1;
+		while(tableSize < numCorners * 2)
+			tableSize <<= 1;
 
-						if (normalMappingMode == FbxLayerElement::eByControlPoint)
-							normalIdx = controlPointIndex;
+		UINT32 tableMask = tableSize - 1;
+		UINT32* table = arenaAlloc<UINT32>(arena, tableSize);
+		memset(table, 0xFF, tableSize * sizeof(UINT32));
 
-						if (normalRefMode == FbxLayerElement::eIndexToDirect)
-							normalIdx = normalElement->GetIndexArray().GetAt(normalIdx);
+		UINT32* vertexIndices = arenaAlloc<UINT32>(arena, numCorners);
+		UINT32 numVertices = 0;
 
-						FbxVector4 currentNormal = normalElement->GetDirectArray().GetAt(normalIdx);
-						currentNormal = worldTransformIT.MultT(currentNormal);
+		for(UINT32 i = 0; i < numCorners; i++)
+		{
+			UINT32 slot = hashVertex(vertices[i]) & tableMask;
+			while(true)
+			{
+				UINT32 entry = table[slot];
+				if(entry == 0xFFFFFFFF)
+				{
+					if(numVertices != i)
+						vertices[numVertices] = vertices[i];
 
-						Vector3 curNormalValue;
-						curNormalValue[0] = static_cast<float>(currentNormal[0]);
-						curNormalValue[1] = static_cast<float>(currentNormal[1]);
-						curNormalValue[2] = static_cast<float>(currentNormal[2]);
+					table[slot] = numVertices;
+					vertexIndices[i] = numVertices++;
+					break;
+				}
 
-						normals.addValue(curNormalValue);
-					}
+				if(memcmp(&vertices[entry], &vertices[i], sizeof(FBXImportVertex)) == 0)
+				{
+					vertexIndices[i] = entry;
+					break;
+				}
 
-					if (hasTangent)
-					{
-						int tangentIdx = indexOffset + vertexIndex;
+				slot = (slot + 1) & tableMask;
+			}
+		}
 
-						if (tangentMappingMode == FbxLayerElement::eByControlPoint)
-							tangentIdx = controlPointIndex;
+		if(createTangentsIfMissing && !mesh.hasTangent && mesh.hasNormal && mesh.hasUV0)
+		{
+			generateTangents(vertices, numVertices, vertexIndices, numCorners, arena);
 
-						if (tangentRefMode == FbxLayerElement::eIndexToDirect)
-							tangentIdx = tangentElement->GetIndexArray().GetAt(tangentIdx);
+			mesh.hasTangent = true;
+			mesh.hasBitangent = true;
+		}
 
-						FbxVector4 currentTangent = tangentElement->GetDirectArray().GetAt(tangentIdx);
-						currentTangent = worldTransformIT.MultT(currentTangent);
+		// Group triangles per material, with winding order flipped
+		UINT32 numMaterials = std::max(mesh.numMaterials, 1U);
+		mesh.subMeshes.resize(numMaterials);
 
-						Vector3 curTangentValue;
-						curTangentValue[0] = static_cast<float>(currentTangent[0]);
-						curTangentValue[1] = static_cast<float>(currentTangent[1]);
-						curTangentValue[2] = static_cast<float>(currentTangent[2]);
+		for(UINT32 i = 0; i < numTriangles; i++)
+		{
+			UINT32 materialIdx = mesh.materials != nullptr ? mesh.materials[trianglePolygons[i]] : 0;
+			mesh.subMeshes[materialIdx].indexCount += 3;
+		}
 
-						tangents.addValue(curTangentValue);
-					}
+		UINT32* writeOffsets = arenaAlloc<UINT32>(arena, numMaterials);
+		UINT32 indexOffset = 0;
+		for(UINT32 i = 0; i < numMaterials; i++)
+		{
+			mesh.subMeshes[i].indexOffset = indexOffset;
+			writeOffsets[i] = indexOffset;
 
-					if (hasBitangent)
-					{
-						int bitangentIdx = indexOffset + vertexIndex;
+			indexOffset += mesh.subMeshes[i].indexCount;
+		}
 
-						if (bitangentMappingMode == FbxLayerElement::eByControlPoint)
-							bitangentIdx = controlPointIndex;
+		mesh.indices = arenaAlloc<UINT32>(arena, numCorners);
+		for(UINT32 i = 0; i < numTriangles; i++)
+		{
+			UINT32 materialIdx = mesh.materials != nullptr ? mesh.materials[trianglePolygons[i]] : 0;
+			UINT32* dst = mesh.indices + writeOffsets[materialIdx];
 
-						if (bitangentRefMode == FbxLayerElement::eIndexToDirect)
-							bitangentIdx = bitangentElement->GetIndexArray().GetAt(bitangentIdx);
+			dst[0] = vertexIndices[i * 3 + 2];
+			dst[1] = vertexIndices[i * 3 + 1];
+			dst[2] = vertexIndices[i * 3 + 0];
 
-						FbxVector4 currentBitangent = bitangentElement->GetDirectArray().GetAt(bitangentIdx);
-						currentBitangent = worldTransformIT.MultT(currentBitangent);
+			writeOffsets[materialIdx] += 3;
+		}
 
-						Vector3 curBitangentValue;
-						curBitangentValue[0] = static_cast<float>(currentBitangent[0]);
-						curBitangentValue[1] = static_cast<float>(currentBitangent[1]);
-						curBitangentValue[2] = static_cast<float>(currentBitangent[2]);
+		mesh.vertices = vertices;
+		mesh.numVertices = numVertices;
+		mesh.numIndices = numCorners;
+	}
 
-						bitangents.addValue(curBitangentValue);
-					}
+	MeshDataPtr FBXImporter::combineMeshes(const Vector<FBXImportMesh*>& meshes, Vector<SubMesh>& subMeshes)
+	{
+		bool hasColor = false;
+		bool hasNormal = false;
+		bool hasTangent = false;
+		bool hasBitangent = false;
+		bool hasUV0 = false;
+		bool hasUV1 = false;
 
-					if (hasUV0)
-					{
-						int uv0Idx = indexOffset + vertexIndex;
+		Vector<UINT32> vertexOffsets(meshes.size());
+		Vector<UINT32> indexOffsets(meshes.size());
 
-						if (UVMappingMode0 == FbxLayerElement::eByControlPoint)
-							uv0Idx = controlPointIndex;
+		UINT32 numVertices = 0;
+		UINT32 numIndices = 0;
+		for(UINT32 i = 0; i < (UINT32)meshes.size(); i++)
+		{
+			const FBXImportMesh& mesh = *meshes[i];
 
-						if (UVRefMode0 == FbxLayerElement::eIndexToDirect)
-							uv0Idx = UVElement0->GetIndexArray().GetAt(uv0Idx);
+			hasColor |= mesh.hasColor;
+			hasNormal |= mesh.hasNormal;
+			hasTangent |= mesh.hasTangent;
+			hasBitangent |= mesh.hasBitangent;
+			hasUV0 |= mesh.hasUV0;
+			hasUV1 |= mesh.hasUV1;
 
-						FbxVector4 currentUV = UVElement0->GetDirectArray().GetAt(uv0Idx);
+			for(auto& subMesh : mesh.subMeshes)
+				subMeshes.push_back(SubMesh(subMesh.indexOffset + numIndices, subMesh.indexCount, subMesh.drawOp));
 
-						Vector2 curUV0Value;
-						curUV0Value[0] = static_cast<float>(currentUV[0]);
-						curUV0Value[1] = 1.0f - static_cast<float>(currentUV[1]);
+			vertexOffsets[i] = numVertices;
+			indexOffsets[i] = numIndices;
 
-						uv0.addValue(curUV0Value);
-					}
+			numVertices += mesh.numVertices;
+			numIndices += mesh.numIndices;
+		}
 
-					if (hasUV1)
-					{
-						int uv1Idx = indexOffset + vertexIndex;
+		VertexDataDescPtr vertexDesc = bs_shared_ptr<VertexDataDesc>();
 
-						if (UVMappingMode1 == FbxLayerElement::eByControlPoint)
-							uv1Idx = controlPointIndex;
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
 
-						if (UVRefMode1 == FbxLayerElement::eIndexToDirect)
-							uv1Idx = UVElement1->GetIndexArray().GetAt(uv1Idx);
+		if(hasColor)
+			vertexDesc->addVertElem(VET_COLOR, VES_COLOR);
 
-						FbxVector4 currentUV = UVElement1->GetDirectArray().GetAt(uv1Idx);
+		if(hasNormal)
+			vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
 
-						Vector2 curUV1Value;
-						curUV1Value[0] = static_cast<float>(currentUV[0]);
-						curUV1Value[1] = 1.0f - static_cast<float>(currentUV[1]);
+		if(hasTangent)
+			vertexDesc->addVertElem(VET_FLOAT3, VES_TANGENT);
 
-						uv1.addValue(curUV1Value);
-					}
-				}
+		if(hasBitangent)
+			vertexDesc->addVertElem(VET_FLOAT3, VES_BITANGENT);
+
+		if (hasUV0)
+			vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD, 0);
+
+		if (hasUV1)
+			vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD, 1);
+
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(numVertices, numIndices, vertexDesc);
+
+		UINT32 vertexStride = vertexDesc->getVertexStride(0);
+		UINT8* positionData = meshData->getElementData(VES_POSITION);
+		UINT8* colorData = hasColor ? meshData->getElementData(VES_COLOR) : nullptr;
+		UINT8* normalData = hasNormal ? meshData->getElementData(VES_NORMAL) : nullptr;
+		UINT8* tangentData = hasTangent ? meshData->getElementData(VES_TANGENT) : nullptr;
+		UINT8* bitangentData = hasBitangent ? meshData->getElementData(VES_BITANGENT) : nullptr;
+		UINT8* uv0Data = hasUV0 ? meshData->getElementData(VES_TEXCOORD, 0) : nullptr;
+		UINT8* uv1Data = hasUV1 ? meshData->getElementData(VES_TEXCOORD, 1) : nullptr;
+		UINT32* indexData = meshData->getIndices32();
+
+		// Every mesh writes into its own range of the output buffers. Attributes a mesh doesn't have are
+		// zero in its vertices.
+		forEachMesh(meshes, [&](UINT32 idx)
+		{
+			const FBXImportMesh& mesh = *meshes[idx];
+			UINT32 vertexOffset = vertexOffsets[idx];
+
+			for(UINT32 i = 0; i < mesh.numVertices; i++)
+			{
+				const FBXImportVertex& vertex = mesh.vertices[i];
+				UINT32 dataOffset = (vertexOffset + i) * vertexStride;
+
+				memcpy(positionData + dataOffset, &vertex.position, sizeof(Vector3));
+
+				if(colorData != nullptr)
+					memcpy(colorData + dataOffset, &vertex.color, sizeof(UINT32));
+
+				if(normalData != nullptr)
+					memcpy(normalData + dataOffset, &vertex.normal, sizeof(Vector3));
+
+				if(tangentData != nullptr)
+					memcpy(tangentData + dataOffset, &vertex.tangent, sizeof(Vector3));
+
+				if(bitangentData != nullptr)
+					memcpy(bitangentData + dataOffset, &vertex.bitangent, sizeof(Vector3));
+
+				if(uv0Data != nullptr)
+					memcpy(uv0Data + dataOffset, &vertex.uv0, sizeof(Vector2));
+
+				if(uv1Data != nullptr)
+					memcpy(uv1Data + dataOffset, &vertex.uv1, sizeof(Vector2));
 			}
 
-			indexOffsetPerSubmesh[lMaterialIndex] += 3;
-		}
+			UINT32* dstIndices = indexData + indexOffsets[idx];
+			for(UINT32 i = 0; i < mesh.numIndices; i++)
+				dstIndices[i] = mesh.indices[i] + vertexOffset;
+		});
 
 		return meshData;
 	}
@@ -29,6 +29,11 @@ namespace BansheeEngine
 		 */
 		virtual bool isMagicNumberSupported(const UINT8* magicNumPtr, UINT32 numBytes) const; 
 
+		/**
+		 * @copydoc	SpecificImporter::getVersion
+		 */
+		virtual UINT32 getVersion() const { return 2; }
+
 		/**
 		 * @copydoc	SpecificImporter::import
 		 */
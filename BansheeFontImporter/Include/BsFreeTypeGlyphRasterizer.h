@@ -0,0 +1,66 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsFontPrerequisites.h"
+#include "BsGlyphRasterizer.h"
+
+struct FT_LibraryRec_;
+struct FT_FaceRec_;
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Glyph rasterizer that renders glyphs using the FreeType library. Keeps the
+	 *			font face loaded so glyphs can be rendered whenever they are requested.
+	 */
+	class BS_FONT_EXPORT FreeTypeGlyphRasterizer : public GlyphRasterizer
+	{
+	public:
+		/**
+		 * @brief	Constructs a new rasterizer. Use ::create instead.
+		 */
+		FreeTypeGlyphRasterizer(FT_LibraryRec_* library, FT_FaceRec_* face, bool antialiasing);
+		~FreeTypeGlyphRasterizer();
+
+		/**
+		 * @copydoc	GlyphRasterizer::getFontDesc
+		 */
+		virtual void getFontDesc(FONT_DESC& fontDesc);
+
+		/**
+		 * @copydoc	GlyphRasterizer::rasterizeGlyph
+		 */
+		virtual bool rasterizeGlyph(UINT32 charId, CHAR_DESC& charDesc, Vector<UINT8>& pixels);
+
+		/**
+		 * @copydoc	GlyphRasterizer::rasterizeMissingGlyph
+		 */
+		virtual void rasterizeMissingGlyph(CHAR_DESC& charDesc, Vector<UINT8>& pixels);
+
+		/**
+		 * @copydoc	GlyphRasterizer::getKerning
+		 */
+		virtual INT32 getKerning(UINT32 charId, UINT32 nextCharId);
+
+		/**
+		 * @brief	Creates a rasterizer for the font face stored in memory. Returns null if the face
+		 *			cannot be loaded.
+		 *
+		 * @note	Font file data is not copied and must remain valid for as long as the rasterizer is used.
+		 *			Signature matches FontManager::GlyphRasterizerFactory.
+		 */
+		static GlyphRasterizerPtr create(const UINT8* fontFileData, UINT32 fontFileSize, UINT32 fontSize, UINT32 dpi, bool antialiasing);
+
+	private:
+		/**
+		 * @brief	Renders the glyph with the provided FreeType glyph index. Returns false on failure.
+		 */
+		bool rasterizeGlyphIndex(UINT32 glyphIdx, UINT32 charId, CHAR_DESC& charDesc, Vector<UINT8>& pixels);
+
+		FT_LibraryRec_* mLibrary;
+		FT_FaceRec_* mFace;
+		INT32 mLoadFlags;
+	};
+}
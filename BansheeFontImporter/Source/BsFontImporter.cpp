@@ -12,6 +12,8 @@
 #include "BsCoreApplication.h"
 #include "BsCoreThread.h"
 #include "BsCoreThreadAccessor.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
 
 #include <ft2build.h>
 #include <freetype/freetype.h>
@@ -56,6 +58,26 @@ namespace BansheeEngine
 	{
 		const FontImportOptions* fontImportOptions = static_cast<const FontImportOptions*>(importOptions.get());
 
+		// Dynamic fonts keep the font file and render glyphs on demand, so no textures are generated here
+		if(fontImportOptions->getDynamic())
+		{
+			DataStreamPtr stream = FileSystem::openFile(filePath);
+
+			Vector<UINT8> fontFileData(stream->size());
+			if(!fontFileData.empty())
+				stream->read(fontFileData.data(), fontFileData.size());
+
+			stream->close();
+
+			FontPtr newFont = Font::_createDynamicPtr(fontFileData, fontImportOptions->getFontSizes(), 
+				fontImportOptions->getDPI(), fontImportOptions->getAntialiasing());
+
+			WString fileName = filePath.getWFilename(false);
+			newFont->setName(toString(fileName));
+
+			return newFont;
+		}
+
 		FT_Library library;
 
 		FT_Error error = FT_Init_FreeType(&library);
@@ -4,6 +4,8 @@
 #include "BsFontPrerequisites.h"
 #include "BsImporter.h"
 #include "BsFontImporter.h"
+#include "BsFreeTypeGlyphRasterizer.h"
+#include "BsFontManager.h"
 
 namespace BansheeEngine
 {
@@ -24,6 +26,8 @@ namespace BansheeEngine
 		FontImporter* importer = bs_new<FontImporter>();
 		Importer::instance()._registerAssetImporter(importer);
 
+		FontManager::instance()._setGlyphRasterizerFactory(&FreeTypeGlyphRasterizer::create);
+
 		return nullptr;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,168 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsFreeTypeGlyphRasterizer.h"
+#include "BsDebug.h"
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+#include FT_FREETYPE_H
+
+namespace BansheeEngine
+{
+	FreeTypeGlyphRasterizer::FreeTypeGlyphRasterizer(FT_LibraryRec_* library, FT_FaceRec_* face, bool antialiasing)
+		:mLibrary(library), mFace(face), mLoadFlags(FT_LOAD_RENDER)
+	{
+		if(!antialiasing)
+			mLoadFlags |= FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
+	}
+
+	FreeTypeGlyphRasterizer::~FreeTypeGlyphRasterizer()
+	{
+		FT_Done_Face(mFace);
+		FT_Done_FreeType(mLibrary);
+	}
+
+	void FreeTypeGlyphRasterizer::getFontDesc(FONT_DESC& fontDesc)
+	{
+		const FT_Size_Metrics& metrics = mFace->size->metrics;
+
+		fontDesc.baselineOffset = (INT32)(metrics.ascender >> 6);
+		fontDesc.lineHeight = (UINT32)(metrics.height >> 6);
+		fontDesc.spaceWidth = 0;
+
+		if(FT_Load_Char(mFace, 32, mLoadFlags) == 0)
+			fontDesc.spaceWidth = (UINT32)(mFace->glyph->advance.x >> 6);
+	}
+
+	bool FreeTypeGlyphRasterizer::rasterizeGlyph(UINT32 charId, CHAR_DESC& charDesc, Vector<UINT8>& pixels)
+	{
+		FT_UInt glyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)charId);
+		if(glyphIdx == 0)
+			return false;
+
+		return rasterizeGlyphIndex(glyphIdx, charId, charDesc, pixels);
+	}
+
+	void FreeTypeGlyphRasterizer::rasterizeMissingGlyph(CHAR_DESC& charDesc, Vector<UINT8>& pixels)
+	{
+		if(!rasterizeGlyphIndex(0, 0, charDesc, pixels))
+		{
+			LOGWRN("Failed to render the missing glyph.");
+
+			charDesc.charId = 0;
+			charDesc.width = charDesc.height = 0;
+			charDesc.xOffset = charDesc.yOffset = 0;
+			charDesc.xAdvance = charDesc.yAdvance = 0;
+			pixels.clear();
+		}
+	}
+
+	INT32 FreeTypeGlyphRasterizer::getKerning(UINT32 charId, UINT32 nextCharId)
+	{
+		if(!FT_HAS_KERNING(mFace))
+			return 0;
+
+		FT_UInt glyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)charId);
+		FT_UInt nextGlyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)nextCharId);
+
+		FT_Vector kerning;
+		if(FT_Get_Kerning(mFace, glyphIdx, nextGlyphIdx, FT_KERNING_DEFAULT, &kerning))
+			return 0;
+
+		return (INT32)(kerning.x >> 6); // Y kerning is ignored because it is so rare
+	}
+
+	bool FreeTypeGlyphRasterizer::rasterizeGlyphIndex(UINT32 glyphIdx, UINT32 charId, CHAR_DESC& charDesc, Vector<UINT8>& pixels)
+	{
+		if(FT_Load_Glyph(mFace, (FT_UInt)glyphIdx, mLoadFlags))
+			return false;
+
+		FT_GlyphSlot slot = mFace->glyph;
+
+		if(slot->bitmap.buffer == nullptr && slot->bitmap.rows > 0 && slot->bitmap.width > 0)
+			return false;
+
+		UINT32 width = (UINT32)slot->bitmap.width;
+		UINT32 height = (UINT32)slot->bitmap.rows;
+
+		pixels.resize(width * height);
+
+		const UINT8* sourceBuffer = slot->bitmap.buffer;
+		UINT8* dstBuffer = pixels.data();
+
+		if(slot->bitmap.pixel_mode == ft_pixel_mode_grays)
+		{
+			for(UINT32 bitmapRow = 0; bitmapRow < height; bitmapRow++)
+			{
+				memcpy(dstBuffer, sourceBuffer, width);
+
+				dstBuffer += width;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else if(slot->bitmap.pixel_mode == ft_pixel_mode_mono)
+		{
+			// 8 pixels are packed into a byte, so do some unpacking
+			for(UINT32 bitmapRow = 0; bitmapRow < height; bitmapRow++)
+			{
+				for(UINT32 bitmapColumn = 0; bitmapColumn < width; bitmapColumn++)
+				{
+					UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
+					dstBuffer[bitmapColumn] = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
+				}
+
+				dstBuffer += width;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else if(width > 0 && height > 0)
+		{
+			LOGWRN("Unsupported pixel mode for a FreeType bitmap.");
+			return false;
+		}
+
+		charDesc.charId = charId;
+		charDesc.width = width;
+		charDesc.height = height;
+		charDesc.xOffset = slot->bitmap_left;
+		charDesc.yOffset = slot->bitmap_top;
+		charDesc.xAdvance = slot->advance.x >> 6;
+		charDesc.yAdvance = slot->advance.y >> 6;
+		charDesc.kerningPairs.clear();
+
+		return true;
+	}
+
+	GlyphRasterizerPtr FreeTypeGlyphRasterizer::create(const UINT8* fontFileData, UINT32 fontFileSize, UINT32 fontSize, UINT32 dpi, bool antialiasing)
+	{
+		// Each rasterizer gets its own library instance, as FreeType libraries aren't thread safe
+		FT_Library library;
+		if(FT_Init_FreeType(&library))
+		{
+			LOGWRN("Error occurred during FreeType library initialization.");
+			return nullptr;
+		}
+
+		FT_Face face;
+		if(FT_New_Memory_Face(library, (const FT_Byte*)fontFileData, (FT_Long)fontFileSize, 0, &face))
+		{
+			LOGWRN("Failed to load font face from memory.");
+
+			FT_Done_FreeType(library);
+			return nullptr;
+		}
+
+		FT_F26Dot6 ftSize = (FT_F26Dot6)(fontSize * (1 << 6));
+		if(FT_Set_Char_Size(face, ftSize, 0, dpi, dpi))
+		{
+			LOGWRN("Could not set character size: " + toString(fontSize));
+
+			FT_Done_Face(face);
+			FT_Done_FreeType(library);
+			return nullptr;
+		}
+
+		return bs_shared_ptr<FreeTypeGlyphRasterizer>(library, face, antialiasing);
+	}
+}
@@ -31,6 +31,16 @@ namespace BansheeEngine
 		 */
 		virtual bool isMagicNumberSupported(const UINT8* magicNumPtr, UINT32 numBytes) const; 
 
+		/**
+		 * @copydoc	SpecificImporter::getVersion
+		 */
+		virtual UINT32 getVersion() const { return 3; }
+
+		/**
+		 * @copydoc	SpecificImporter::isThreadSafe
+		 */
+		virtual bool isThreadSafe() const { return true; }
+
 		/**
 		 * @copydoc	SpecificImporter::import
 		 */
@@ -155,13 +155,22 @@ namespace BansheeEngine
 		TexturePtr newTexture = Texture::_createPtr(TEX_TYPE_2D, 
 			imgData->getWidth(), imgData->getHeight(), numMips, textureImportOptions->getFormat());
 
+		// Texture size and format are known as soon as it is created, so there is no need to wait for the core
+		// thread to initialize it as writes below are queued after initialization. Mip levels are generated
+		// directly in texture format so copying them below doesn't require conversion.
 		Vector<PixelDataPtr> mipLevels;
 		if (numMips > 0)
-			mipLevels = PixelUtil::genMipmaps(*imgData, MipMapGenOptions());
+		{
+			MipMapGenOptions mipOptions;
+			mipOptions.isSRGB = textureImportOptions->getSRGB();
+			mipOptions.preserveAlphaCoverage = textureImportOptions->getPreserveAlphaCoverage();
+			mipOptions.alphaCoverageCutoff = textureImportOptions->getAlphaCutoff();
+
+			mipLevels = PixelUtil::genMipmaps(*imgData, mipOptions, newTexture->getFormat());
+		}
 		else
 			mipLevels.insert(mipLevels.begin(), imgData);
 
-		newTexture->synchronize(); // TODO - Required due to a bug in allocateSubresourceBuffer
 		for (UINT32 mip = 0; mip < (UINT32)mipLevels.size(); ++mip)
 		{
 			UINT32 subresourceIdx = newTexture->mapToSubresourceIdx(0, mip);
@@ -21,6 +21,11 @@ namespace BansheeEngine
 		 */
 		void writeData(const UINT8* data);
 
+		/**
+		 * @copydoc	GpuParamBlockBuffer::writeDataDiscard
+		 */
+		void writeDataDiscard(const UINT8* data, UINT32 offset, UINT32 length);
+
 		/**
 		 * @copydoc GpuParamBlockBuffer::readAll.
 		 */
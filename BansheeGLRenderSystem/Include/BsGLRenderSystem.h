@@ -126,6 +126,11 @@ namespace BansheeEngine
 		 */
 		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount);
 
+		/**
+		 * @copydoc RenderSystem::drawIndexedInstanced()
+		 */
+		void drawIndexedInstanced(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount);
+
 		/**
 		 * @copydoc RenderSystem::clearRenderTarget()
 		 */
@@ -46,6 +46,19 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
 	}
 
+	void GLGpuParamBlockBuffer::writeDataDiscard(const UINT8* data, UINT32 offset, UINT32 length)
+	{
+		GLenum usage = mUsage == GPBU_STATIC ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW;
+
+		// Orphan the old storage so we don't have to wait on the GPU
+		glBindBuffer(GL_UNIFORM_BUFFER, mGLHandle);
+		glBufferData(GL_UNIFORM_BUFFER, mSize, nullptr, usage);
+		glBufferSubData(GL_UNIFORM_BUFFER, offset, length, data);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
+	}
+
 	void GLGpuParamBlockBuffer::readData(UINT8* data) const
 	{
 		glBindBuffer(GL_UNIFORM_BUFFER, mGLHandle);
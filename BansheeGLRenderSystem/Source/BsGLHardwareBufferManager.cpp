@@ -60,7 +60,12 @@ namespace BansheeEngine
             case VET_SHORT2:
             case VET_SHORT3:
             case VET_SHORT4:
+			case VET_SHORT2_NORM:
                 return GL_SHORT;
+			case VET_USHORT4_NORM:
+				return GL_UNSIGNED_SHORT;
+			case VET_HALF2:
+				return GL_HALF_FLOAT;
             case VET_COLOR:
 			case VET_COLOR_ABGR:
 			case VET_COLOR_ARGB:
@@ -301,9 +301,17 @@ namespace BansheeEngine
 
 			const GLGpuParamBlockBuffer* glParamBlockBuffer = static_cast<const GLGpuParamBlockBuffer*>(paramBlockBuffer.get());
 
+			// Buffers bound at an offset are shared between multiple objects, so only bind the range for this one
+			UINT32 offset = bindableParams->getParamBlockOffset(iter->second.slot);
+			UINT32 size = glParamBlockBuffer->getSize() - offset;
+
+			UINT32 blockSize = iter->second.blockSize * sizeof(UINT32);
+			if (blockSize > 0)
+				size = std::min(size, blockSize);
+
 			UINT32 globalBlockBinding = getGLUniformBlockBinding(gptype, blockBinding);
 			glUniformBlockBinding(glProgram, iter->second.slot - 1, globalBlockBinding);
-			glBindBufferRange(GL_UNIFORM_BUFFER, globalBlockBinding, glParamBlockBuffer->getGLHandle(), 0, glParamBlockBuffer->getSize());
+			glBindBufferRange(GL_UNIFORM_BUFFER, globalBlockBinding, glParamBlockBuffer->getGLHandle(), offset, size);
 
 			blockBinding++;
 
@@ -656,6 +664,7 @@ namespace BansheeEngine
 		UINT32 primCount = vertexCountToPrimCount(mCurrentDrawOperation, vertexCount);
 
 		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumInstances, 1);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
@@ -683,12 +692,44 @@ namespace BansheeEngine
 		UINT32 primCount = vertexCountToPrimCount(mCurrentDrawOperation, vertexCount);
 
 		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumInstances, 1);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 
 		BS_INC_RENDER_STAT(NumIndexBufferBinds);
 	}
 
+	void GLRenderSystem::drawIndexedInstanced(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
+	{
+		if(mBoundIndexBuffer == nullptr)
+		{
+			LOGWRN("Cannot draw indexed because index buffer is not set.");
+			return;
+		}
+
+		// Find the correct type to render
+		GLint primType = getGLDrawMode();
+		beginDraw();
+
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 
+			static_cast<GLIndexBuffer*>(mBoundIndexBuffer.get())->getGLBufferId());
+
+		GLenum indexType = (mBoundIndexBuffer->getType() == IndexBuffer::IT_16BIT) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+		glDrawElementsInstancedBaseVertex(primType, indexCount, indexType, 
+			(GLvoid*)(mBoundIndexBuffer->getIndexSize() * startIndex), instanceCount, vertexOffset);
+
+		endDraw();
+
+		UINT32 primCount = vertexCountToPrimCount(mCurrentDrawOperation, vertexCount);
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumInstances, instanceCount);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount * instanceCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, primCount * instanceCount);
+
+		BS_INC_RENDER_STAT(NumIndexBufferBinds);
+	}
+
 	void GLRenderSystem::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
 	{
 		THROW_IF_NOT_CORE_THREAD;
@@ -1875,6 +1916,12 @@ namespace BansheeEngine
 		// UBYTE4 always supported
 		rsc->setCapability(RSC_VERTEX_FORMAT_UBYTE4);
 
+		// Instanced arrays are core since 3.3
+		if (GLEW_VERSION_3_3 || getGLSupport()->checkExtension("GL_ARB_instanced_arrays"))
+		{
+			rsc->setCapability(RSC_INSTANCING);
+		}
+
 		// Infinite far plane always supported
 		rsc->setCapability(RSC_INFINITE_FAR_PLANE);
 
@@ -1940,6 +1987,13 @@ namespace BansheeEngine
 		glGetIntegerv(GL_MAX_FRAGMENT_UNIFORM_BLOCKS, &numUniformBlocks);
 		rsc->setNumGpuParamBlockBuffers(GPT_FRAGMENT_PROGRAM, numUniformBlocks);
 
+		// Uniform buffer ranges can always be bound at an offset
+		GLint uniformBufferOffsetAlignment;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformBufferOffsetAlignment);
+
+		rsc->setCapability(RSC_PARAM_BLOCK_OFFSETS);
+		rsc->setParamBlockOffsetAlignment(std::max((UINT32)uniformBufferOffsetAlignment, 1U));
+
 		if (mGLSupport->checkExtension("GL_ARB_geometry_shader4"))
 		{
 			GLint geomUnits;
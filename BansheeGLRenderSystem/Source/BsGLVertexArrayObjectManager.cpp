@@ -155,6 +155,8 @@ namespace BansheeEngine
 			case VET_COLOR:
 			case VET_COLOR_ABGR:
 			case VET_COLOR_ARGB:
+			case VET_USHORT4_NORM:
+			case VET_SHORT2_NORM:
 				normalized = GL_TRUE;
 				break;
 			default:
@@ -166,6 +168,7 @@ namespace BansheeEngine
 			GLsizei vertexSize = static_cast<GLsizei>(vertexBuffer->getVertexSize());
 			glVertexAttribPointer(attribLocation, typeCount, glType, normalized,
 				vertexSize, bufferData);
+			glVertexAttribDivisor(attribLocation, vertexDecl->getInstanceStepRate(streamIdx));
 
 			glEnableVertexAttribArray(attribLocation);
 		}
@@ -0,0 +1,108 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsCorePrerequisites.h"
+#include "BsResourceManifest.h"
+#include "BsResourcePackage.h"
+#include "BsFileSystem.h"
+#include "BsPath.h"
+#include "BsException.h"
+
+#include <iostream>
+
+using namespace BansheeEngine;
+
+/**
+ * Prints command line usage of the tool.
+ */
+void printUsage()
+{
+	std::cout << "Builds a resource package from a resource manifest." << std::endl << std::endl;
+	std::cout << "Usage: BansheePacker <manifest> <package> [-root <folder>] [-nocompress]" << std::endl << std::endl;
+	std::cout << "  manifest     Resource manifest file listing the resources to package." << std::endl;
+	std::cout << "  package      Package file to create. Existing file is overwritten." << std::endl;
+	std::cout << "  -root        Folder the paths in the manifest are relative to. Defaults to" << std::endl;
+	std::cout << "               the folder containing the manifest." << std::endl;
+	std::cout << "  -nocompress  Store all resources uncompressed." << std::endl;
+	std::cout << std::endl << "The manifest is saved back pointing to the package, so Resources loads its" << std::endl;
+	std::cout << "resources from the package once the manifest is registered." << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	Vector<String> positionalArgs;
+	String rootFolder;
+	bool compress = true;
+
+	for (int i = 1; i < argc; i++)
+	{
+		String arg = argv[i];
+
+		if (arg == "-nocompress")
+			compress = false;
+		else if (arg == "-root" && (i + 1) < argc)
+			rootFolder = argv[++i];
+		else if (arg.size() > 0 && arg[0] == '-')
+		{
+			printUsage();
+			return 1;
+		}
+		else
+			positionalArgs.push_back(arg);
+	}
+
+	if (positionalArgs.size() != 2)
+	{
+		printUsage();
+		return 1;
+	}
+
+	Path workingFolder = FileSystem::getWorkingDirectoryPath();
+	Path manifestPath = Path(positionalArgs[0]).getAbsolute(workingFolder);
+	Path packagePath = Path(positionalArgs[1]).getAbsolute(workingFolder);
+
+	Path relativePath;
+	if (rootFolder.empty())
+		relativePath = manifestPath.getDirectory();
+	else
+	{
+		// Make sure the last entry is parsed as a folder and not a file name
+		char lastChar = rootFolder.back();
+		if (lastChar != '/' && lastChar != '\\')
+			rootFolder += '/';
+
+		relativePath = Path(rootFolder).getAbsolute(workingFolder);
+	}
+
+	if (!FileSystem::isFile(manifestPath))
+	{
+		std::cout << "Manifest file \"" << manifestPath.toString() << "\" doesn't exist." << std::endl;
+		return 1;
+	}
+
+	try
+	{
+		ResourceManifestPtr manifest = ResourceManifest::load(manifestPath, relativePath);
+		ResourcePackage::build(manifest, packagePath, compress);
+		ResourceManifest::save(manifest, manifestPath, relativePath);
+
+		ResourcePackagePtr package = ResourcePackage::open(packagePath);
+
+		UINT32 numCompressed = 0;
+		for (auto& entry : package->getEntries())
+		{
+			if ((entry.flags & ResourcePackage::EF_Compressed) != 0)
+				numCompressed++;
+		}
+
+		std::cout << "Packaged " << package->getEntries().size() << " resources (" << numCompressed << " compressed) into \""
+			<< packagePath.toString() << "\", " << FileSystem::getFileSize(packagePath) << " bytes." << std::endl;
+	}
+	catch (const Exception& e)
+	{
+		std::cout << "Packaging failed: " << e.getFullDescription() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
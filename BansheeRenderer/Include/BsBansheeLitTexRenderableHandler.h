@@ -16,6 +16,11 @@ namespace BansheeEngine
 	 *			and rendering of renderable objects with a single texture
 	 *			and a single light.
 	 *
+	 *			Per object data of all rendered elements is sub-allocated from a single buffer
+	 *			and uploaded once, if the render system supports binding buffers at an offset.
+	 *			Otherwise a single shared per object buffer is rewritten before each element is
+	 *			rendered.
+	 *
 	 * @note	This class is DEBUG ONLY. Until a better renderer is complete.
 	 */
 	class BS_BSRND_EXPORT LitTexRenderableHandler : public RenderableHandler
@@ -26,15 +31,17 @@ namespace BansheeEngine
 		 */
 		struct PerObjectData
 		{
-			GpuParamBlockBufferPtr perObjectParamBuffer;
-
 			bool hasWVPParam = false;
-			GpuParamMat4 wvpParam;
+			Matrix4 wvpMatrix;
+
+			UINT32 bufferOffset = 0;
+			UINT32 lastUpdateIdx = (UINT32)-1;
 
 			Vector<MaterialProxy::BufferBindInfo> perObjectBuffers;
 		};
 
 		LitTexRenderableHandler();
+		~LitTexRenderableHandler();
 
 		/**
 		 * @copydoc	RenderableHandler::initializeRenderElem
@@ -43,6 +50,9 @@ namespace BansheeEngine
 
 		/**
 		 * @copydoc	RenderableHandler::bindPerObjectBuffers
+		 *
+		 * @note	Must be called right before rendering the element, as all elements share
+		 *			the same per object buffer.
 		 */
 		void bindPerObjectBuffers(const RenderableElement* element);
 
@@ -53,11 +63,24 @@ namespace BansheeEngine
 		void updateGlobalBuffers(float time);
 
 		/**
-		 * @brief	Updates object specific parameter buffers with new values.
-		 *			To be called whenever object specific values change.
+		 * @brief	Prepares for a new set of per object buffer updates. All elements rendered
+		 *			after this call must have their per object buffers updated again.
+		 *
+		 * @param	maxNumElements	Maximum number of elements that will be updated.
+		 */
+		void beginPerObjectUpdates(UINT32 maxNumElements);
+
+		/**
+		 * @brief	Updates object specific parameter buffers with new values. Must be called
+		 *			between ::beginPerObjectUpdates and ::endPerObjectUpdates.
 		 */
 		void updatePerObjectBuffers(RenderableElement* element, const Matrix4& wvpMatrix);
 
+		/**
+		 * @brief	Uploads all per object data provided since ::beginPerObjectUpdates to the GPU.
+		 */
+		void endPerObjectUpdates();
+
 	protected:
 		/**
 		 * @brief	Creates a new default shader used for lit textured renderables.
@@ -78,11 +101,17 @@ namespace BansheeEngine
 
 		GpuParamBlockBufferPtr staticParamBuffer;
 		GpuParamBlockBufferPtr perFrameParamBuffer;
+		GpuParamBlockBufferPtr perObjectParamBuffer;
 
 		GpuParamsPtr staticParams;
 		GpuParamsPtr perFrameParams;
+		GpuParamsPtr perObjectParams;
 
 		GpuParamVec4 lightDirParam;
 		GpuParamFloat timeParam;
+		GpuParamMat4 wvpParam;
+
+		GpuParamBlockAllocator* perObjectAllocator;
+		UINT32 updateIdx;
 	};
 }
\ No newline at end of file
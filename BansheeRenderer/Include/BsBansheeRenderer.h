@@ -24,6 +24,13 @@ namespace BansheeEngine
 	 * @brief	Default renderer for Banshee. Performs frustum culling, sorting and 
 	 *			renders objects in custom ways determine by renderable handlers.
 	 *
+	 *			Objects using shaders that allow instancing are drawn in batches with a single draw call.
+	 *			Their vertex programs receive rows of the world view projection matrix as per-instance
+	 *			VES_TEXCOORD inputs, with semantic indices starting at INSTANCE_SEMANTIC_IDX.
+	 *
+	 *			Static renderables are merged into per-material batches by a StaticBatcher, and are
+	 *			rendered through the proxies of their batches instead of their own.
+	 *
 	 * @note	Sim thread unless otherwise noted.
 	 */
 	class BS_BSRND_EXPORT BansheeRenderer : public Renderer
@@ -37,6 +44,20 @@ namespace BansheeEngine
 			Vector<CameraProxyPtr> cameras;
 		};
 
+		/**
+		 * @brief	Mesh vertex declaration extended with per-instance elements.
+		 */
+		struct InstancedDeclaration
+		{
+			std::weak_ptr<VertexDeclaration> meshDeclaration;
+			VertexDeclarationPtr declaration;
+		};
+
+	public:
+		static const UINT32 INSTANCE_SEMANTIC_IDX;
+		static const UINT32 INSTANCE_STREAM_IDX;
+		static const UINT32 MAX_INSTANCES_PER_BATCH;
+
 	public:
 		BansheeRenderer();
 		~BansheeRenderer();
@@ -155,6 +176,20 @@ namespace BansheeEngine
 		 */
 		virtual void render(const CameraProxy& cameraProxy, const RenderQueuePtr& renderQueue);
 
+		/**
+		 * @brief	Selects which level of detail of a renderable element to render, depending on how 
+		 *			large its bounds appear on the screen.
+		 *
+		 * @param	cameraProxy		Camera the element is being rendered for.
+		 * @param	element			Element to select the level of detail for.
+		 * @param	worldBounds		World space bounds of the element.
+		 *
+		 * @return	Mesh proxy of the selected level of detail.
+		 *
+		 * @note	Core thread only.
+		 */
+		virtual MeshProxyPtr selectLOD(const CameraProxy& cameraProxy, const RenderableElement& element, const Bounds& worldBounds) const;
+
 		/**
 		 * @brief	Activates the specified pass on the pipeline.
 		 *
@@ -172,6 +207,34 @@ namespace BansheeEngine
 		 */
 		void draw(const MeshProxy& mesh);
 
+		/**
+		 * @brief	Draws the specified mesh proxy once for each of the provided renderable elements, using 
+		 *			instanced draw calls with last set pass.
+		 *
+		 * @param	mesh			Mesh shared by all the elements.
+		 * @param	instances		Elements to draw.
+		 * @param	numInstances	Number of elements in the "instances" array.
+		 * @param	viewProjMatrix	View projection matrix of the camera the elements are drawn for.
+		 *
+		 * @note	Core thread only.
+		 */
+		void drawInstanced(const MeshProxy& mesh, RenderableElement* const* instances, UINT32 numInstances, const Matrix4& viewProjMatrix);
+
+		/**
+		 * @brief	Binds vertex buffers of the provided vertex data to the pipeline.
+		 *
+		 * @note	Core thread only.
+		 */
+		void setVertexBuffers(const std::shared_ptr<VertexData>& vertexData);
+
+		/**
+		 * @brief	Returns a vertex declaration containing all elements of the provided mesh declaration,
+		 *			followed by per-instance elements.
+		 *
+		 * @note	Core thread only.
+		 */
+		VertexDeclarationPtr getInstancedDeclaration(const VertexDeclarationPtr& meshDeclaration);
+
 		/**
 		 * @brief	Called by the scene manager whenever a Renderable component has been
 		 *			removed from the scene.
@@ -195,6 +258,11 @@ namespace BansheeEngine
 		Vector<Bounds> mWorldBounds;
 
 		LitTexRenderableHandler* mLitTexHandler;
+		StaticBatcher* mStaticBatcher;
+
+		VertexBufferPtr mInstanceBuffer;
+		Vector<Matrix4> mInstanceData;
+		UnorderedMap<const VertexDeclaration*, InstancedDeclaration> mInstancedDeclarations;
 
 		HEvent mRenderableRemovedConn;
 		HEvent mCameraRemovedConn;
@@ -9,6 +9,9 @@
 #include "BsBansheeRenderer.h"
 #include "BsHardwareBufferManager.h"
 #include "BsGpuParamBlockBuffer.h"
+#include "BsGpuParamBlock.h"
+#include "BsGpuParamBlockAllocator.h"
+#include "BsRenderSystemCapabilities.h"
 #include "BsTechnique.h"
 #include "BsPass.h"
 #include "BsRenderSystem.h"
@@ -16,6 +19,7 @@
 namespace BansheeEngine
 {
 	LitTexRenderableHandler::LitTexRenderableHandler()
+		:perObjectAllocator(nullptr), updateIdx(0)
 	{
 		defaultShader = createDefaultShader();
 
@@ -113,17 +117,31 @@ namespace BansheeEngine
 		// Create global GPU param buffers and get parameter handles
 		staticParams = bs_shared_ptr<GpuParams>(staticParamsDesc, matrixTranspose);
 		perFrameParams = bs_shared_ptr<GpuParams>(perFrameParamsDesc, matrixTranspose);
+		perObjectParams = bs_shared_ptr<GpuParams>(perObjectParamsDesc, matrixTranspose);
 
 		staticParamBuffer = HardwareBufferManager::instance().createGpuParamBlockBuffer(staticParamBlockDesc.blockSize * sizeof(UINT32));
 		perFrameParamBuffer = HardwareBufferManager::instance().createGpuParamBlockBuffer(perFrameParamBlockDesc.blockSize * sizeof(UINT32));
+		perObjectParamBuffer = HardwareBufferManager::instance().createGpuParamBlockBuffer(perObjectParamBlockDesc.blockSize * sizeof(UINT32));
 
 		staticParams->setParamBlockBuffer(staticParamBlockDesc.slot, staticParamBuffer);
 		perFrameParams->setParamBlockBuffer(perFrameParamBlockDesc.slot, perFrameParamBuffer);
+		perObjectParams->setParamBlockBuffer(perObjectParamBlockDesc.slot, perObjectParamBuffer);
 
 		staticParams->getParam(lightDirParamDesc.name, lightDirParam);
 		perFrameParams->getParam(timeParamDesc.name, timeParam);
+		perObjectParams->getParam(wvpParamDesc.name, wvpParam);
 
 		lightDirParam.set(Vector4(0.707f, 0.707f, 0.707f, 0.0f));
+
+		// Per object buffer is then only used as a CPU side template for the data of each object
+		if (RenderSystem::instance().getCapabilities()->hasCapability(RSC_PARAM_BLOCK_OFFSETS))
+			perObjectAllocator = bs_new<GpuParamBlockAllocator>();
+	}
+
+	LitTexRenderableHandler::~LitTexRenderableHandler()
+	{
+		if (perObjectAllocator != nullptr)
+			bs_delete(perObjectAllocator);
 	}
 
 	void LitTexRenderableHandler::initializeRenderElem(RenderableElement* element)
@@ -209,10 +227,7 @@ namespace BansheeEngine
 				{
 					if (findIter->second.blockSize == perObjectParamBlockDesc.blockSize)
 					{
-						if (rendererData->perObjectParamBuffer == nullptr)
-							rendererData->perObjectParamBuffer = HardwareBufferManager::instance().createGpuParamBlockBuffer(perObjectParamBlockDesc.blockSize * sizeof(UINT32));
-
-						rendererData->perObjectBuffers.push_back(MaterialProxy::BufferBindInfo(idx, findIter->second.slot, rendererData->perObjectParamBuffer));
+						rendererData->perObjectBuffers.push_back(MaterialProxy::BufferBindInfo(idx, findIter->second.slot, perObjectParamBuffer));
 
 						if (!rendererData->hasWVPParam && wvpParamName != "")
 						{
@@ -220,10 +235,7 @@ namespace BansheeEngine
 							if (findIter2 != paramsDesc.params.end())
 							{
 								if (paramsMatch(findIter2->second, wvpParamDesc))
-								{
-									gpuParams->getParam(wvpParamName, rendererData->wvpParam);
 									rendererData->hasWVPParam = true;
-								}
 							}
 						}
 					}
@@ -239,11 +251,32 @@ namespace BansheeEngine
 	void LitTexRenderableHandler::bindPerObjectBuffers(const RenderableElement* element)
 	{
 		const PerObjectData* rendererData = any_cast_unsafe<PerObjectData>(&element->rendererData);
-		for (auto& perObjectBuffer : rendererData->perObjectBuffers)
+		if (rendererData->perObjectBuffers.size() == 0)
+			return;
+
+		if (perObjectAllocator != nullptr)
 		{
-			GpuParamsPtr params = element->material->params[perObjectBuffer.paramsIdx];
+			for (auto& perObjectBuffer : rendererData->perObjectBuffers)
+			{
+				GpuParamsPtr params = element->material->params[perObjectBuffer.paramsIdx];
+
+				params->setParamBlockBuffer(perObjectBuffer.slotIdx, perObjectAllocator->getBuffer());
+				params->setParamBlockOffset(perObjectBuffer.slotIdx, rendererData->bufferOffset);
+			}
+		}
+		else
+		{
+			for (auto& perObjectBuffer : rendererData->perObjectBuffers)
+			{
+				GpuParamsPtr params = element->material->params[perObjectBuffer.paramsIdx];
+
+				params->setParamBlockBuffer(perObjectBuffer.slotIdx, perObjectParamBuffer);
+			}
+
+			wvpParam.set(rendererData->hasWVPParam ? rendererData->wvpMatrix : Matrix4::ZERO);
 
-			params->setParamBlockBuffer(perObjectBuffer.slotIdx, rendererData->perObjectParamBuffer);
+			GpuParamBlockPtr paramBlock = perObjectParamBuffer->getParamBlock();
+			paramBlock->uploadToBuffer(perObjectParamBuffer);
 		}
 	}
 
@@ -255,21 +288,44 @@ namespace BansheeEngine
 		perFrameParams->updateHardwareBuffers();
 	}
 
+	void LitTexRenderableHandler::beginPerObjectUpdates(UINT32 maxNumElements)
+	{
+		updateIdx++;
+
+		if (perObjectAllocator != nullptr)
+		{
+			UINT32 elementSize = perObjectAllocator->getAllocationSize(perObjectParamBuffer->getSize());
+			perObjectAllocator->beginFrame(maxNumElements * elementSize);
+		}
+	}
+
 	void LitTexRenderableHandler::updatePerObjectBuffers(RenderableElement* element, const Matrix4& wvpMatrix)
 	{
 		PerObjectData* rendererData = any_cast_unsafe<PerObjectData>(&element->rendererData);
 
-		if (rendererData->hasWVPParam)
-			rendererData->wvpParam.set(wvpMatrix);
+		// Elements rendered with multiple passes only need a single update
+		if (rendererData->perObjectBuffers.size() == 0 || rendererData->lastUpdateIdx == updateIdx)
+			return;
+
+		rendererData->wvpMatrix = wvpMatrix;
+		rendererData->lastUpdateIdx = updateIdx;
 
-		if (rendererData->perObjectParamBuffer != nullptr)
+		if (perObjectAllocator != nullptr)
 		{
-			GpuParamBlockPtr paramBlock = rendererData->perObjectParamBuffer->getParamBlock();
-			if (paramBlock->isDirty())
-				paramBlock->uploadToBuffer(rendererData->perObjectParamBuffer);
+			wvpParam.set(rendererData->hasWVPParam ? wvpMatrix : Matrix4::ZERO);
+
+			GpuParamBlockPtr paramBlock = perObjectParamBuffer->getParamBlock();
+			rendererData->bufferOffset = perObjectAllocator->allocate(paramBlock->getData(), perObjectParamBuffer->getSize());
+			paramBlock->setDirty(false);
 		}
 	}
 
+	void LitTexRenderableHandler::endPerObjectUpdates()
+	{
+		if (perObjectAllocator != nullptr)
+			perObjectAllocator->endFrame();
+	}
+
 	ShaderPtr LitTexRenderableHandler::createDefaultShader()
 	{
 		String rsName = RenderSystem::instance().getName();
@@ -32,13 +32,23 @@
 #include "BsShaderProxy.h"
 #include "BsBansheeLitTexRenderableHandler.h"
 #include "BsTime.h"
+#include "BsVertexDeclaration.h"
+#include "BsRenderSystemCapabilities.h"
+#include "BsStaticBatcher.h"
+#include "BsDebug.h"
 
 using namespace std::placeholders;
 
 namespace BansheeEngine
 {
+	const UINT32 BansheeRenderer::INSTANCE_SEMANTIC_IDX = 4;
+	const UINT32 BansheeRenderer::INSTANCE_STREAM_IDX = 8;
+	const UINT32 BansheeRenderer::MAX_INSTANCES_PER_BATCH = 1024;
+
 	BansheeRenderer::BansheeRenderer()
 	{
+		mStaticBatcher = bs_new<StaticBatcher>();
+
 		mRenderableRemovedConn = gBsSceneManager().onRenderableRemoved.connect(std::bind(&BansheeRenderer::renderableRemoved, this, _1));
 		mCameraRemovedConn = gBsSceneManager().onCameraRemoved.connect(std::bind(&BansheeRenderer::cameraRemoved, this, _1));
 	}
@@ -47,6 +57,8 @@ namespace BansheeEngine
 	{
 		mRenderableRemovedConn.disconnect();
 		mCameraRemovedConn.disconnect();
+
+		bs_delete(mStaticBatcher);
 	}
 
 	const String& BansheeRenderer::getName() const
@@ -68,6 +80,9 @@ namespace BansheeEngine
 
 		if (mLitTexHandler != nullptr)
 			bs_delete(mLitTexHandler);
+
+		mInstanceBuffer = nullptr;
+		mInstancedDeclarations.clear();
 	}
 
 	void BansheeRenderer::addRenderableProxy(RenderableProxyPtr proxy)
@@ -75,7 +90,7 @@ namespace BansheeEngine
 		for (auto& element : proxy->renderableElements)
 		{
 			mRenderableElements.push_back(element);
-			mWorldTransforms.push_back(element->worldTransform);
+			mWorldTransforms.push_back(element->worldTransform * element->mesh->positionDecode);
 			mWorldBounds.push_back(element->calculateWorldBounds());
 
 			element->renderableType = proxy->renderableType;
@@ -97,15 +112,21 @@ namespace BansheeEngine
 		{
 			assert(mRenderableElements.size() > element->id && element->id >= 0);
 
-			if (mRenderableElements.size() == 0)
-				mRenderableElements.erase(mRenderableElements.begin());
-			else
+			// Move the last element in place of the removed one, keeping per-element data arrays in step
+			UINT32 id = element->id;
+			UINT32 lastId = (UINT32)(mRenderableElements.size() - 1);
+			if (id != lastId)
 			{
-				std::swap(mRenderableElements[element->id], mRenderableElements.back());
-				mRenderableElements.erase(mRenderableElements.end() - 1);
+				mRenderableElements[id] = mRenderableElements[lastId];
+				mWorldTransforms[id] = mWorldTransforms[lastId];
+				mWorldBounds[id] = mWorldBounds[lastId];
 
-				mRenderableElements[element->id]->id = element->id;
+				mRenderableElements[id]->id = id;
 			}
+
+			mRenderableElements.pop_back();
+			mWorldTransforms.pop_back();
+			mWorldBounds.pop_back();
 		}
 	}
 
@@ -115,7 +136,7 @@ namespace BansheeEngine
 		{
 			element->worldTransform = localToWorld;
 
-			mWorldTransforms[element->id] = localToWorld;
+			mWorldTransforms[element->id] = localToWorld * element->mesh->positionDecode;
 			mWorldBounds[element->id] = element->calculateWorldBounds();
 		}
 	}
@@ -185,6 +206,8 @@ namespace BansheeEngine
 
 	void BansheeRenderer::renderableRemoved(const HRenderable& renderable)
 	{
+		mStaticBatcher->removeRenderable(renderable);
+
 		if (renderable->_getActiveProxy() != nullptr)
 		{
 			mDeletedRenderableProxies.push_back(renderable->_getActiveProxy());
@@ -211,16 +234,44 @@ namespace BansheeEngine
 		}
 
 		// Add or update Renderable proxies
-		const Vector<HRenderable>& allRenderables = gBsSceneManager().getAllRenderables();
 		Vector<HSceneObject> dirtySceneObjects;
 		Vector<HRenderable> dirtyRenderables;
 
-		for (auto& renderable : allRenderables)
+		gBsSceneManager().forEachComponent<Renderable>([&](Renderable& component)
 		{
+			HRenderable renderable = component._getHandle();
+
 			bool addedNewProxy = false;
+			bool needsNewProxy = false;
 			RenderableProxyPtr proxy = renderable->_getActiveProxy();
 
-			if (renderable->_isCoreDirty())
+			if (renderable->getIsStatic())
+			{
+				if (renderable->_isCoreDirty() || renderable->SO()->_isCoreDirty())
+				{
+					if (mStaticBatcher->addRenderable(renderable))
+					{
+						if (proxy != nullptr)
+						{
+							gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::removeRenderableProxy, this, proxy));
+							renderable->_setActiveProxy(nullptr);
+						}
+
+						dirtyRenderables.push_back(renderable);
+						dirtySceneObjects.push_back(renderable->SO());
+						return;
+					}
+
+					// Can't be batched (yet), render it on its own
+					needsNewProxy = true;
+				}
+				else if (proxy == nullptr)
+					return; // Rendered as part of a batch
+			}
+			else if (renderable->_isCoreDirty())
+				mStaticBatcher->removeRenderable(renderable);
+
+			if (needsNewProxy || renderable->_isCoreDirty())
 			{
 				if (proxy != nullptr)
 					gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::removeRenderableProxy, this, proxy));
@@ -255,6 +306,29 @@ namespace BansheeEngine
 					}
 				}
 			}
+		});
+
+		// Rebuild batches of static renderables that changed
+		Vector<RenderableProxyPtr> addedBatchProxies;
+		Vector<RenderableProxyPtr> removedBatchProxies;
+		mStaticBatcher->update(addedBatchProxies, removedBatchProxies);
+
+		for (auto& proxy : removedBatchProxies)
+			gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::removeRenderableProxy, this, proxy));
+
+		for (auto& proxy : addedBatchProxies)
+			gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::addRenderableProxy, this, proxy));
+
+		for (auto& entry : mStaticBatcher->getBatches())
+		{
+			const StaticBatcher::Batch* batch = entry.second;
+
+			HMaterial mat = batch->material;
+			if (mat.isLoaded() && mat->_isCoreDirty(MaterialDirtyFlag::Params))
+			{
+				gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::updateMaterialProxy, this, batch->proxy->renderableElements[0]->material, mat->_getDirtyProxyParams()));
+				mat->_markCoreClean(MaterialDirtyFlag::Params);
+			}
 		}
 
 		// Mark all renderables as clean (needs to be done after all proxies are updated as
@@ -273,9 +347,10 @@ namespace BansheeEngine
 		}
 
 		// Add or update Camera proxies
-		const Vector<HCamera>& allCameras = gBsSceneManager().getAllCameras();
-		for (auto& camera : allCameras)
+		gBsSceneManager().forEachComponent<Camera>([&](Camera& component)
 		{
+			HCamera camera = component._getHandle();
+
 			if (camera->_isCoreDirty())
 			{
 				CameraProxyPtr proxy = camera->_getActiveProxy();
@@ -301,7 +376,7 @@ namespace BansheeEngine
 
 				dirtySceneObjects.push_back(camera->SO());
 			}
-		}
+		});
 
 		// Mark scene objects clean
 		for (auto& dirtySO : dirtySceneObjects)
@@ -310,8 +385,10 @@ namespace BansheeEngine
 		}
 
 		// Populate direct draw lists
-		for (auto& camera : allCameras)
+		gBsSceneManager().forEachComponent<Camera>([&](Camera& component)
 		{
+			HCamera camera = component._getHandle();
+
 			DrawListPtr drawList = bs_shared_ptr<DrawList>();
 
 			// Get GUI render operations
@@ -355,7 +432,7 @@ namespace BansheeEngine
 			}
 
 			gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::addToRenderQueue, this, camera->_getActiveProxy(), renderQueue));
-		}
+		});
 
 		gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::renderAllCore, this, gTime().getTime()));
 	}
@@ -429,23 +506,9 @@ namespace BansheeEngine
 
 		if (!cameraProxy.ignoreSceneRenderables)
 		{
-			// Update per-object param buffers and queue render elements
+			// Queue visible render elements
 			for (auto& renderElem : mRenderableElements)
 			{
-				if (renderElem->handler != nullptr)
-					renderElem->handler->bindPerObjectBuffers(renderElem);
-
-				if (renderElem->renderableType == RenType_LitTextured)
-				{
-					Matrix4 worldViewProjMatrix = viewProjMatrix * mWorldTransforms[renderElem->id];;
-					mLitTexHandler->updatePerObjectBuffers(renderElem, worldViewProjMatrix);
-				}
-
-				for (auto& param : renderElem->material->params)
-				{
-					param->updateHardwareBuffers();
-				}
-
 				// Do frustum culling
 				// TODO - This is bound to be a bottleneck at some point. When it is ensure that intersect
 				// methods use vector operations, as it is trivial to update them.
@@ -458,8 +521,9 @@ namespace BansheeEngine
 					if (cameraProxy.worldFrustum.intersects(boundingBox))
 					{
 						float distanceToCamera = (cameraProxy.worldPosition - boundingBox.getCenter()).length();
+						MeshProxyPtr mesh = selectLOD(cameraProxy, *renderElem, mWorldBounds[renderElem->id]);
 
-						renderQueue->add(renderElem, distanceToCamera);
+						renderQueue->add(renderElem, mesh, distanceToCamera);
 					}
 				}
 			}
@@ -467,18 +531,86 @@ namespace BansheeEngine
 
 		renderQueue->sort();
 		const Vector<RenderQueueElement>& sortedRenderElements = renderQueue->getSortedElements();
+		const Vector<RenderableElement*>& sortedInstances = renderQueue->getSortedInstances();
 
+		// Update per-object data of visible elements, all at once. Instanced elements receive their
+		// transforms through the instance buffer instead.
+		mLitTexHandler->beginPerObjectUpdates((UINT32)sortedRenderElements.size());
+		for (auto& sortedElement : sortedRenderElements)
+		{
+			RenderableElement* renderElem = sortedElement.renderElem;
+			if (renderElem == nullptr || sortedElement.numInstances > 0)
+				continue;
+
+			if (renderElem->renderableType == RenType_LitTextured)
+			{
+				Matrix4 worldViewProjMatrix = viewProjMatrix * mWorldTransforms[renderElem->id];
+				mLitTexHandler->updatePerObjectBuffers(renderElem, worldViewProjMatrix);
+			}
+		}
+		mLitTexHandler->endPerObjectUpdates();
+
+		bool instancingSupported = rs.getCapabilities()->hasCapability(RSC_INSTANCING);
 		for(auto iter = sortedRenderElements.begin(); iter != sortedRenderElements.end(); ++iter)
 		{
 			MaterialProxyPtr materialProxy = iter->material;
 
-			setPass(materialProxy, iter->passIdx);
-			draw(*iter->mesh);
+			if (iter->numInstances > 0)
+			{
+				if (!instancingSupported)
+				{
+					LOGWRN("Cannot render objects with an instanced shader because the render system doesn't support instancing.");
+					continue;
+				}
+
+				setPass(materialProxy, iter->passIdx);
+				drawInstanced(*iter->mesh, &sortedInstances[iter->instanceOffset], iter->numInstances, viewProjMatrix);
+			}
+			else
+			{
+				// Per-object buffers are shared between elements, so they must be bound right before drawing
+				if (iter->renderElem != nullptr && iter->renderElem->handler != nullptr)
+					iter->renderElem->handler->bindPerObjectBuffers(iter->renderElem);
+
+				setPass(materialProxy, iter->passIdx);
+				draw(*iter->mesh);
+			}
 		}
 
 		renderQueue->clear();
 	}
 
+	MeshProxyPtr BansheeRenderer::selectLOD(const CameraProxy& cameraProxy, const RenderableElement& element, const Bounds& worldBounds) const
+	{
+		if (element.lodMeshes.empty())
+			return element.mesh;
+
+		// Screen size is the portion of the viewport half-height covered by the bounding sphere radius
+		const Sphere& boundingSphere = worldBounds.getSphere();
+		float screenSize = boundingSphere.getRadius() * cameraProxy.projMatrix[1][1];
+
+		bool isPerspective = cameraProxy.projMatrix[3][3] == 0.0f;
+		if (isPerspective)
+		{
+			float distance = (cameraProxy.worldPosition - boundingSphere.getCenter()).length();
+			if (distance <= boundingSphere.getRadius())
+				return element.mesh;
+
+			screenSize /= distance;
+		}
+
+		MeshProxyPtr mesh = element.mesh;
+		for (UINT32 i = 0; i < (UINT32)element.lodScreenSizes.size(); i++)
+		{
+			if (screenSize >= element.lodScreenSizes[i])
+				break;
+
+			mesh = element.lodMeshes[i];
+		}
+
+		return mesh;
+	}
+
 	void BansheeRenderer::setPass(const MaterialProxyPtr& material, UINT32 passIdx)
 	{
 		THROW_IF_NOT_CORE_THREAD;
@@ -568,6 +700,79 @@ namespace BansheeEngine
 		std::shared_ptr<VertexData> vertexData = mesh->_getVertexData();
 
 		rs.setVertexDeclaration(vertexData->vertexDeclaration);
+		setVertexBuffers(vertexData);
+
+		SubMesh subMesh = meshProxy.subMesh;
+		rs.setDrawOperation(subMesh.drawOp);
+
+		IndexBufferPtr indexBuffer = mesh->_getIndexBuffer();
+
+		UINT32 indexCount = subMesh.indexCount;
+		if (indexCount == 0)
+			indexCount = indexBuffer->getNumIndices();
+
+		rs.setIndexBuffer(indexBuffer);
+		rs.drawIndexed(subMesh.indexOffset + mesh->_getIndexOffset(), indexCount, mesh->_getVertexOffset(), vertexData->vertexCount);
+
+		mesh->_notifyUsedOnGPU();
+	}
+
+	void BansheeRenderer::drawInstanced(const MeshProxy& meshProxy, RenderableElement* const* instances, UINT32 numInstances, const Matrix4& viewProjMatrix)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		RenderSystem& rs = RenderSystem::instance();
+		MeshBasePtr mesh;
+
+		if (!meshProxy.mesh.expired())
+			mesh = meshProxy.mesh.lock(); 
+		else
+			return;
+
+		if (mInstanceBuffer == nullptr)
+		{
+			mInstanceBuffer = HardwareBufferManager::instance().createVertexBuffer(sizeof(Matrix4), MAX_INSTANCES_PER_BATCH, GBU_DYNAMIC);
+			mInstanceData.resize(MAX_INSTANCES_PER_BATCH);
+		}
+
+		std::shared_ptr<VertexData> vertexData = mesh->_getVertexData();
+
+		rs.setVertexDeclaration(getInstancedDeclaration(vertexData->vertexDeclaration));
+		setVertexBuffers(vertexData);
+		rs.setVertexBuffers(INSTANCE_STREAM_IDX, &mInstanceBuffer, 1);
+
+		SubMesh subMesh = meshProxy.subMesh;
+		rs.setDrawOperation(subMesh.drawOp);
+
+		IndexBufferPtr indexBuffer = mesh->_getIndexBuffer();
+
+		UINT32 indexCount = subMesh.indexCount;
+		if (indexCount == 0)
+			indexCount = indexBuffer->getNumIndices();
+
+		rs.setIndexBuffer(indexBuffer);
+
+		for (UINT32 batchStart = 0; batchStart < numInstances; batchStart += MAX_INSTANCES_PER_BATCH)
+		{
+			UINT32 batchSize = std::min(numInstances - batchStart, MAX_INSTANCES_PER_BATCH);
+
+			for (UINT32 i = 0; i < batchSize; i++)
+				mInstanceData[i] = viewProjMatrix * mWorldTransforms[instances[batchStart + i]->id];
+
+			mInstanceBuffer->writeData(0, batchSize * sizeof(Matrix4), &mInstanceData[0], BufferWriteType::Discard);
+
+			rs.drawIndexedInstanced(subMesh.indexOffset + mesh->_getIndexOffset(), indexCount, mesh->_getVertexOffset(), 
+				vertexData->vertexCount, batchSize);
+		}
+
+		mesh->_notifyUsedOnGPU();
+	}
+
+	void BansheeRenderer::setVertexBuffers(const std::shared_ptr<VertexData>& vertexData)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		RenderSystem& rs = RenderSystem::instance();
 		auto vertexBuffers = vertexData->getBuffers();
 
 		if (vertexBuffers.size() > 0)
@@ -592,19 +797,40 @@ namespace BansheeEngine
 
 			rs.setVertexBuffers(startSlot, buffers, endSlot - startSlot + 1);
 		}
+	}
 
-		SubMesh subMesh = meshProxy.subMesh;
-		rs.setDrawOperation(subMesh.drawOp);
+	VertexDeclarationPtr BansheeRenderer::getInstancedDeclaration(const VertexDeclarationPtr& meshDeclaration)
+	{
+		THROW_IF_NOT_CORE_THREAD;
 
-		IndexBufferPtr indexBuffer = mesh->_getIndexBuffer();
+		// Entries are keyed by address, so make sure the entry doesn't belong to an older declaration at the same address
+		auto iterFind = mInstancedDeclarations.find(meshDeclaration.get());
+		if (iterFind != mInstancedDeclarations.end() && iterFind->second.meshDeclaration.lock() == meshDeclaration)
+			return iterFind->second.declaration;
 
-		UINT32 indexCount = subMesh.indexCount;
-		if (indexCount == 0)
-			indexCount = indexBuffer->getNumIndices();
+		VertexDeclaration::VertexElementList elements = meshDeclaration->getElements();
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			elements.push_back(VertexElement((UINT16)INSTANCE_STREAM_IDX, i * sizeof(Vector4), VET_FLOAT4, VES_TEXCOORD, 
+				(UINT16)(INSTANCE_SEMANTIC_IDX + i)));
+		}
 
-		rs.setIndexBuffer(indexBuffer);
-		rs.drawIndexed(subMesh.indexOffset + mesh->_getIndexOffset(), indexCount, mesh->_getVertexOffset(), vertexData->vertexCount);
+		VertexDeclaration::InstanceStepRateMap instanceStepRates;
+		instanceStepRates[(UINT16)INSTANCE_STREAM_IDX] = 1;
 
-		mesh->_notifyUsedOnGPU();
+		// Remove entries of declarations that were destroyed, so the map only grows with the number of live declarations
+		for (auto iter = mInstancedDeclarations.begin(); iter != mInstancedDeclarations.end();)
+		{
+			if (iter->second.meshDeclaration.expired())
+				iter = mInstancedDeclarations.erase(iter);
+			else
+				++iter;
+		}
+
+		InstancedDeclaration& instancedDecl = mInstancedDeclarations[meshDeclaration.get()];
+		instancedDecl.meshDeclaration = meshDeclaration;
+		instancedDecl.declaration = HardwareBufferManager::instance().createVertexDeclaration(elements, instanceStepRates);
+
+		return instancedDecl.declaration;
 	}
 }
\ No newline at end of file
@@ -20,16 +20,6 @@ namespace BansheeEngine
 		BansheeSceneManager() {}
 		~BansheeSceneManager() {}
 
-		/**
-		 * @copydoc	SceneManager::getAllCameras
-		 */
-		const Vector<HCamera>& getAllCameras() const { return mCachedCameras; }
-
-		/**
-		 * @copydoc	SceneManager::getAllRenderables
-		 */
-		const Vector<HRenderable>& getAllRenderables() const { return mRenderables; }
-
 		/**
 		 * @copydoc	SceneManager
 		 */
@@ -45,8 +35,5 @@ namespace BansheeEngine
 		 * @brief	Called by scene objects whenever a new component is destroyed.
 		 */
 		void notifyComponentRemoved(const HComponent& component);
-
-		Vector<HCamera> mCachedCameras;
-		Vector<HRenderable> mRenderables;
 	};
 }
\ No newline at end of file
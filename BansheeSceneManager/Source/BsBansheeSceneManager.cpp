@@ -18,58 +18,29 @@ namespace BansheeEngine
 		//     but putting them in a slow, normal array. Once the number of dynamic elements
 		//	   goes over some number the hierarchy is re-optimized.
 
-		for(auto& iter : mRenderables)
+		forEachComponent<Renderable>([](Renderable& renderable)
 		{
-			iter->SO()->updateTransformsIfDirty();
-		}
+			renderable.SO()->updateTransformsIfDirty();
+		});
 	}
 
 	void BansheeSceneManager::notifyComponentAdded(const HComponent& component)
 	{
-		if(component->getTypeId() == TID_Camera)
-		{
-			HCamera camera = static_object_cast<Camera>(component);
-			auto findIter = std::find(mCachedCameras.begin(), mCachedCameras.end(), camera);
-
-			if(findIter != mCachedCameras.end())
-			{
-				BS_EXCEPT(InternalErrorException, "Trying to add an already existing camera!");
-			}
-
-			mCachedCameras.push_back(camera);
-		}
-		else if(component->getTypeId() == TID_Renderable)
-		{
-			HRenderable renderable = static_object_cast<Renderable>(component);
-			mRenderables.push_back(renderable);
-		}
+		SceneManager::notifyComponentAdded(component);
 	}
 
 	void BansheeSceneManager::notifyComponentRemoved(const HComponent& component)
 	{
+		SceneManager::notifyComponentRemoved(component);
+
 		if(component->getTypeId() == TID_Camera)
 		{
 			HCamera camera = static_object_cast<Camera>(component);
-			auto findIter = std::find(mCachedCameras.begin(), mCachedCameras.end(), camera);
-
-			if(findIter == mCachedCameras.end())
-			{
-				BS_EXCEPT(InternalErrorException, "Cannot find specified camera!");
-			}
-
-			mCachedCameras.erase(findIter);
-
 			onCameraRemoved(camera);
 		}
 		else if(component->getTypeId() == TID_Renderable)
 		{
 			HRenderable renderable = static_object_cast<Renderable>(component);
-
-			// TODO - I should probably use some for of a hash set because searching through possibly thousands of renderables will be slow
-			auto findIter = std::find(mRenderables.begin(), mRenderables.end(), renderable);
-			if(findIter != mRenderables.end())
-				mRenderables.erase(findIter);
-
 			onRenderableRemoved(renderable);
 		}
 	}
@@ -0,0 +1,68 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+/**
+ * @brief	Checks the provided condition and reports a failure, including the
+ *			expression and its location, if it doesn't hold. Execution of the
+ *			test continues regardless.
+ */
+#define BS_TEST_ASSERT(expr) BansheeEngine::TestRunner::check((expr), #expr, __FILE__, __LINE__)
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Runs test functions and keeps track of failed checks.
+	 *
+	 * @note	Not thread safe. Checks must only be performed from the main thread.
+	 */
+	class TestRunner
+	{
+	public:
+		typedef void(*TestFunc)();
+
+		/**
+		 * @brief	Runs the provided test and reports whether all of its checks passed.
+		 */
+		static void run(const char* name, TestFunc test);
+
+		/**
+		 * @brief	Records the result of a single check. Normally called through BS_TEST_ASSERT.
+		 */
+		static void check(bool passed, const char* expr, const char* file, int line);
+
+		/**
+		 * @brief	Returns the number of tests that had at least one failed check.
+		 */
+		static UINT32 getNumFailedTests() { return mNumFailedTests; }
+
+		/**
+		 * @brief	Returns the total number of tests that were ran.
+		 */
+		static UINT32 getNumTests() { return mNumTests; }
+
+	private:
+		static UINT32 mNumTests;
+		static UINT32 mNumFailedTests;
+		static UINT32 mNumFailedChecks;
+	};
+
+	void runGuidTests();
+	void runCompressionTests();
+	void runFontTests();
+	void runTexAtlasTests();
+	void runGameObjectTests();
+	void runComponentTests();
+	void runPixelConversionTests();
+	void runBlockCompressionTests();
+	void runResamplerTests();
+	void runImporterTests();
+	void runFrameAllocTests();
+	void runMeshDataTests();
+	void runMeshOptimizerTests();
+	void runMeshSimplifierTests();
+	void runMeshQuantizerTests();
+}
@@ -0,0 +1,197 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsBlockCompression.h"
+#include "BsPixelUtil.h"
+#include "BsPixelData.h"
+#include "BsMath.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Creates an R8G8B8A8 image with smooth gradients in all channels, and optionally some noise.
+	 */
+	PixelDataPtr createBlockTestImage(UINT32 width, UINT32 height, UINT32 noise)
+	{
+		PixelDataPtr image = bs_shared_ptr<PixelData>(width, height, 1, PF_R8G8B8A8);
+		image->allocateInternalBuffer();
+
+		UINT32 seed = 7;
+		for (UINT32 y = 0; y < height; y++)
+		{
+			for (UINT32 x = 0; x < width; x++)
+			{
+				seed = seed * 1103515245 + 12345;
+				INT32 offset = noise > 0 ? (INT32)((seed >> 16) % (noise * 2 + 1)) - (INT32)noise : 0;
+
+				INT32 r = x * 255 / (width - 1) + offset;
+				INT32 g = y * 255 / (height - 1) - offset;
+				INT32 b = (x + y) * 4 + 64;
+				INT32 a = 255 - x * 255 / (width - 1);
+
+				PixelUtil::packColor((UINT8)Math::clamp(r, 0, 255), (UINT8)Math::clamp(g, 0, 255), (UINT8)Math::clamp(b, 0, 255), (UINT8)a,
+					PF_R8G8B8A8, image->getData() + (y * width + x) * 4);
+			}
+		}
+
+		return image;
+	}
+
+	/**
+	 * @brief	Compresses the image to the specified format and decompresses it back, returning the
+	 *			root mean square error of each channel.
+	 */
+	void blockCompressRoundTrip(const PixelData& image, PixelFormat format, bool highQuality, float error[4])
+	{
+		UINT32 width = image.getWidth();
+		UINT32 height = image.getHeight();
+
+		PixelData compressed(width, height, 1, format);
+		compressed.allocateInternalBuffer();
+
+		CompressionOptions options;
+		options.format = format;
+		options.backend = CompressionBackend::Builtin;
+		options.quality = highQuality ? CompressionQuality::Highest : CompressionQuality::Fastest;
+		PixelUtil::compress(image, compressed, options);
+
+		PixelData decompressed(width, height, 1, PF_R8G8B8A8);
+		decompressed.allocateInternalBuffer();
+		PixelUtil::bulkPixelConversion(compressed, decompressed);
+
+		double sumSquared[4] = { 0.0, 0.0, 0.0, 0.0 };
+		for (UINT32 i = 0; i < width * height; i++)
+		{
+			UINT8 original[4];
+			PixelUtil::unpackColor(&original[0], &original[1], &original[2], &original[3], PF_R8G8B8A8, image.getData() + i * 4);
+
+			UINT8 decoded[4];
+			PixelUtil::unpackColor(&decoded[0], &decoded[1], &decoded[2], &decoded[3], PF_R8G8B8A8, decompressed.getData() + i * 4);
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				double diff = (double)original[j] - (double)decoded[j];
+				sumSquared[j] += diff * diff;
+			}
+		}
+
+		for (UINT32 j = 0; j < 4; j++)
+			error[j] = (float)sqrt(sumSquared[j] / (width * height));
+	}
+
+	void testBlockCompressionRoundTrip()
+	{
+		// Second image size isn't a multiple of the block size
+		PixelDataPtr images[] = { createBlockTestImage(32, 32, 0), createBlockTestImage(37, 29, 0) };
+
+		for (auto& image : images)
+		{
+			for (UINT32 i = 0; i < 2; i++)
+			{
+				bool highQuality = i == 1;
+				float error[4];
+
+				blockCompressRoundTrip(*image, PF_BC1, highQuality, error);
+				BS_TEST_ASSERT(error[0] < 10.0f && error[1] < 10.0f && error[2] < 10.0f);
+
+				blockCompressRoundTrip(*image, PF_BC2, highQuality, error);
+				BS_TEST_ASSERT(error[0] < 10.0f && error[1] < 10.0f && error[2] < 10.0f);
+				BS_TEST_ASSERT(error[3] <= 8.5f); // Four bits of explicit alpha
+
+				blockCompressRoundTrip(*image, PF_BC3, highQuality, error);
+				BS_TEST_ASSERT(error[0] < 10.0f && error[1] < 10.0f && error[2] < 10.0f);
+				BS_TEST_ASSERT(error[3] < 3.0f);
+
+				blockCompressRoundTrip(*image, PF_BC4, highQuality, error);
+				BS_TEST_ASSERT(error[0] < 3.0f);
+
+				blockCompressRoundTrip(*image, PF_BC5, highQuality, error);
+				BS_TEST_ASSERT(error[0] < 3.0f && error[1] < 3.0f);
+			}
+		}
+	}
+
+	void testBlockCompressionSolidColor()
+	{
+		// Color exactly representable in 5:6:5, which must survive compression unchanged
+		PixelData image(8, 8, 1, PF_R8G8B8A8);
+		image.allocateInternalBuffer();
+
+		for (UINT32 i = 0; i < 64; i++)
+			PixelUtil::packColor((UINT8)255, (UINT8)130, (UINT8)66, (UINT8)200, PF_R8G8B8A8, image.getData() + i * 4);
+
+		PixelFormat formats[] = { PF_BC1, PF_BC3, PF_BC4, PF_BC5 };
+		for (auto& format : formats)
+		{
+			float error[4];
+			blockCompressRoundTrip(image, format, false, error);
+
+			BS_TEST_ASSERT(error[0] == 0.0f);
+
+			if (format != PF_BC4)
+				BS_TEST_ASSERT(error[1] == 0.0f);
+
+			if (format == PF_BC1 || format == PF_BC3)
+				BS_TEST_ASSERT(error[2] == 0.0f);
+
+			if (format == PF_BC3)
+				BS_TEST_ASSERT(error[3] == 0.0f);
+		}
+	}
+
+	void testBlockCompressionQuality()
+	{
+		PixelDataPtr image = createBlockTestImage(64, 64, 40);
+
+		float fastError[4];
+		float highQualityError[4];
+		blockCompressRoundTrip(*image, PF_BC1, false, fastError);
+		blockCompressRoundTrip(*image, PF_BC1, true, highQualityError);
+
+		float fastTotal = fastError[0] + fastError[1] + fastError[2];
+		float highQualityTotal = highQualityError[0] + highQualityError[1] + highQualityError[2];
+
+		BS_TEST_ASSERT(highQualityTotal <= fastTotal);
+	}
+
+	void testBlockCompressionAlphaCutout()
+	{
+		// BC1a stores fully transparent pixels in a reserved palette entry
+		PixelData image(4, 4, 1, PF_R8G8B8A8);
+		image.allocateInternalBuffer();
+
+		for (UINT32 i = 0; i < 16; i++)
+		{
+			UINT8 alpha = (i % 3) == 0 ? 0 : 255;
+			PixelUtil::packColor((UINT8)(i * 16), (UINT8)64, (UINT8)(255 - i * 16), alpha, PF_R8G8B8A8, image.getData() + i * 4);
+		}
+
+		PixelData compressed(4, 4, 1, PF_BC1a);
+		compressed.allocateInternalBuffer();
+		BlockCompression::compress(image, compressed, true);
+
+		PixelData decompressed(4, 4, 1, PF_R8G8B8A8);
+		decompressed.allocateInternalBuffer();
+		BlockCompression::decompress(compressed, decompressed);
+
+		bool alphaMatches = true;
+		for (UINT32 i = 0; i < 16; i++)
+		{
+			UINT8 r, g, b, a;
+			PixelUtil::unpackColor(&r, &g, &b, &a, PF_R8G8B8A8, decompressed.getData() + i * 4);
+
+			alphaMatches &= a == ((i % 3) == 0 ? 0 : 255);
+		}
+
+		BS_TEST_ASSERT(alphaMatches);
+	}
+
+	void runBlockCompressionTests()
+	{
+		TestRunner::run("Block compression round trip", &testBlockCompressionRoundTrip);
+		TestRunner::run("Block compression solid color", &testBlockCompressionSolidColor);
+		TestRunner::run("Block compression quality", &testBlockCompressionQuality);
+		TestRunner::run("Block compression alpha cutout", &testBlockCompressionAlphaCutout);
+	}
+}
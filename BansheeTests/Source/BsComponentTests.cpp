@@ -0,0 +1,181 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsCoreSceneManager.h"
+#include "BsGameObjectManager.h"
+#include "BsSceneObject.h"
+#include "BsComponent.h"
+#include "BsThreadPool.h"
+#include "BsTaskScheduler.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Component holding a single value. It doesn't override RTTI so it is listed under the Component type.
+	 */
+	class TestComponent : public Component
+	{
+	public:
+		TestComponent(const HSceneObject& parent, UINT32 value)
+			:Component(parent), value(value), numUpdates(0)
+		{ }
+
+		virtual void update() { numUpdates++; }
+
+		UINT32 value;
+		UINT32 numUpdates;
+	};
+
+	typedef GameObjectHandle<TestComponent> HTestComponent;
+
+	/**
+	 * @brief	Returns a bit mask with a bit set for the value of every visited test component.
+	 */
+	UINT64 getVisitedComponents()
+	{
+		UINT64 visited = 0;
+		gSceneManager().forEachComponent<TestComponent>([&](TestComponent& component)
+		{
+			visited |= 1ULL << component.value;
+		});
+
+		return visited;
+	}
+
+	void testComponentIteration()
+	{
+		GameObjectManager::startUp();
+		CoreSceneManager::startUp();
+
+		HSceneObject sceneObject = SceneObject::create("Test");
+
+		Vector<HTestComponent> components;
+		for (UINT32 i = 0; i < 10; i++)
+			components.push_back(sceneObject->addComponent<TestComponent>(i));
+
+		BS_TEST_ASSERT(gSceneManager().getNumComponents<TestComponent>() == 10);
+		BS_TEST_ASSERT(getVisitedComponents() == 0x3FF);
+
+		// Components reached through iteration can find their own handles
+		bool handlesMatch = true;
+		gSceneManager().forEachComponent<TestComponent>([&](TestComponent& component)
+		{
+			handlesMatch &= component._getHandle().get() == components[component.value].get();
+		});
+
+		BS_TEST_ASSERT(handlesMatch);
+
+		// Removal outside of iteration
+		sceneObject->destroyComponent(components[3]);
+		BS_TEST_ASSERT(components[3].isDestroyed());
+		BS_TEST_ASSERT(gSceneManager().getNumComponents<TestComponent>() == 9);
+		BS_TEST_ASSERT(getVisitedComponents() == (0x3FF & ~(1ULL << 3)));
+
+		// Per frame update reaches all components
+		gSceneManager()._update();
+
+		bool allUpdated = true;
+		gSceneManager().forEachComponent<TestComponent>([&](TestComponent& component)
+		{
+			allUpdated &= component.numUpdates == 1;
+		});
+
+		BS_TEST_ASSERT(allUpdated);
+
+		sceneObject->destroy();
+		BS_TEST_ASSERT(gSceneManager().getNumComponents<TestComponent>() == 0);
+		BS_TEST_ASSERT(getVisitedComponents() == 0);
+
+		CoreSceneManager::shutDown();
+		GameObjectManager::shutDown();
+	}
+
+	void testComponentModificationDuringIteration()
+	{
+		GameObjectManager::startUp();
+		CoreSceneManager::startUp();
+
+		HSceneObject sceneObject = SceneObject::create("Test");
+
+		Vector<HTestComponent> components;
+		for (UINT32 i = 0; i < 10; i++)
+			components.push_back(sceneObject->addComponent<TestComponent>(i));
+
+		// Destroy components that weren't visited yet and the component being visited, and add new ones
+		UINT32 numVisited = 0;
+		UINT64 visited = 0;
+		gSceneManager().forEachComponent<TestComponent>([&](TestComponent& component)
+		{
+			numVisited++;
+			UINT32 value = component.value;
+			visited |= 1ULL << value;
+
+			if (value == 0)
+			{
+				for (UINT32 i = 5; i < 10; i++)
+					sceneObject->destroyComponent(components[i]);
+
+				components.push_back(sceneObject->addComponent<TestComponent>(10));
+			}
+			else if (value == 2)
+				sceneObject->destroyComponent(components[2]);
+		});
+
+		BS_TEST_ASSERT(numVisited == 6);
+		BS_TEST_ASSERT(visited == (0x1F | (1ULL << 10)));
+
+		// Holes left by components destroyed during iteration are compacted afterwards
+		BS_TEST_ASSERT(gSceneManager().getNumComponents<TestComponent>() == 5);
+		BS_TEST_ASSERT(getVisitedComponents() == (0x1B | (1ULL << 10)));
+
+		sceneObject->destroyComponent(components[0]);
+		BS_TEST_ASSERT(getVisitedComponents() == (0x1A | (1ULL << 10)));
+
+		sceneObject->destroy();
+
+		CoreSceneManager::shutDown();
+		GameObjectManager::shutDown();
+	}
+
+	void testComponentParallelIteration()
+	{
+		GameObjectManager::startUp();
+		CoreSceneManager::startUp();
+		ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>(4);
+		TaskScheduler::startUp();
+
+		HSceneObject sceneObject = SceneObject::create("Test");
+
+		const UINT32 numComponents = 5000;
+		for (UINT32 i = 0; i < numComponents; i++)
+			sceneObject->addComponent<TestComponent>(i);
+
+		gSceneManager().forEachComponentParallel<TestComponent>([&](TestComponent& component)
+		{
+			component.numUpdates += component.value;
+		}, 128);
+
+		bool allVisitedOnce = true;
+		gSceneManager().forEachComponent<TestComponent>([&](TestComponent& component)
+		{
+			allVisitedOnce &= component.numUpdates == component.value;
+		});
+
+		BS_TEST_ASSERT(allVisitedOnce);
+
+		sceneObject->destroy();
+
+		TaskScheduler::shutDown();
+		ThreadPool::shutDown();
+		CoreSceneManager::shutDown();
+		GameObjectManager::shutDown();
+	}
+
+	void runComponentTests()
+	{
+		TestRunner::run("Component iteration", &testComponentIteration);
+		TestRunner::run("Component modification during iteration", &testComponentModificationDuringIteration);
+		TestRunner::run("Component parallel iteration", &testComponentParallelIteration);
+	}
+}
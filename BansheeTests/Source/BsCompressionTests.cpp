@@ -0,0 +1,123 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsCompression.h"
+#include "BsMappedFile.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsPath.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Compresses and decompresses the provided buffer and checks the output matches the input.
+	 *
+	 * @return	Size of the compressed data, in bytes.
+	 */
+	UINT32 compressRoundTrip(const Vector<UINT8>& input)
+	{
+		UINT32 srcSize = (UINT32)input.size();
+		const UINT8* src = srcSize > 0 ? &input[0] : nullptr;
+
+		Vector<UINT8> compressed(Compression::getMaxCompressedSize(srcSize));
+		UINT32 compressedSize = Compression::compress(src, srcSize, &compressed[0]);
+		BS_TEST_ASSERT(compressedSize <= compressed.size());
+
+		Vector<UINT8> output(srcSize + 1, 0xCD);
+		BS_TEST_ASSERT(Compression::decompress(&compressed[0], compressedSize, &output[0], srcSize));
+		BS_TEST_ASSERT(srcSize == 0 || memcmp(src, &output[0], srcSize) == 0);
+		BS_TEST_ASSERT(output[srcSize] == 0xCD); // Nothing written past the end
+
+		return compressedSize;
+	}
+
+	void testCompressionRoundTrip()
+	{
+		compressRoundTrip(Vector<UINT8>());
+		compressRoundTrip(Vector<UINT8>(1, 42));
+		compressRoundTrip(Vector<UINT8>(7, 42));
+
+		// Repetitive data must compress well
+		Vector<UINT8> repetitive(64 * 1024);
+		for (UINT32 i = 0; i < (UINT32)repetitive.size(); i++)
+			repetitive[i] = (UINT8)(i % 37);
+
+		UINT32 repetitiveSize = compressRoundTrip(repetitive);
+		BS_TEST_ASSERT(repetitiveSize < repetitive.size() / 10);
+
+		// Long runs use multiple length bytes
+		compressRoundTrip(Vector<UINT8>(100000, 0));
+
+		// Incompressible data must not grow past the reported maximum
+		Vector<UINT8> noise(70000);
+		UINT32 seed = 12345;
+		for (auto& entry : noise)
+		{
+			seed = seed * 1103515245 + 12345;
+			entry = (UINT8)(seed >> 16);
+		}
+
+		compressRoundTrip(noise);
+
+		// Matches further away than the maximum offset
+		Vector<UINT8> distant(noise);
+		distant.insert(distant.end(), noise.begin(), noise.begin() + 1000);
+		compressRoundTrip(distant);
+	}
+
+	void testCompressionCorruptData()
+	{
+		Vector<UINT8> input(4096);
+		for (UINT32 i = 0; i < (UINT32)input.size(); i++)
+			input[i] = (UINT8)(i % 13);
+
+		Vector<UINT8> compressed(Compression::getMaxCompressedSize((UINT32)input.size()));
+		UINT32 compressedSize = Compression::compress(&input[0], (UINT32)input.size(), &compressed[0]);
+
+		Vector<UINT8> output(input.size());
+
+		// Truncated input
+		BS_TEST_ASSERT(!Compression::decompress(&compressed[0], compressedSize / 2, &output[0], (UINT32)output.size()));
+
+		// Wrong expected size
+		BS_TEST_ASSERT(!Compression::decompress(&compressed[0], compressedSize, &output[0], (UINT32)output.size() - 1));
+
+		// Offset pointing before the start of the output
+		UINT8 badOffset[] = { 0x10, 'a', 0xFF, 0x00 };
+		BS_TEST_ASSERT(!Compression::decompress(badOffset, sizeof(badOffset), &output[0], 5));
+	}
+
+	void testMappedFile()
+	{
+		Path path = Path("BsMappedFileTest.bin").getAbsolute(FileSystem::getWorkingDirectoryPath());
+
+		Vector<UINT8> contents(100000);
+		for (UINT32 i = 0; i < (UINT32)contents.size(); i++)
+			contents[i] = (UINT8)(i * 7);
+
+		{
+			DataStreamPtr stream = FileSystem::createAndOpenFile(path);
+			stream->write(&contents[0], contents.size());
+			stream->close();
+		}
+
+		{
+			MappedFile file(path);
+			BS_TEST_ASSERT(file.getSize() == contents.size());
+			BS_TEST_ASSERT(file.getData() != nullptr);
+
+			if (file.getData() != nullptr)
+				BS_TEST_ASSERT(memcmp(file.getData(), &contents[0], contents.size()) == 0);
+		}
+
+		FileSystem::remove(path);
+	}
+
+	void runCompressionTests()
+	{
+		TestRunner::run("Compression round trip", &testCompressionRoundTrip);
+		TestRunner::run("Compression corrupt data", &testCompressionCorruptData);
+		TestRunner::run("Mapped file", &testMappedFile);
+	}
+}
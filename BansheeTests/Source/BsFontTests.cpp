@@ -0,0 +1,117 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsFont.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Adds a character with the provided ID and advance to the font description.
+	 */
+	CHAR_DESC& addTestChar(FONT_DESC& fontDesc, UINT32 charId, INT32 xAdvance)
+	{
+		CHAR_DESC& charDesc = fontDesc.characters[charId];
+		charDesc.charId = charId;
+		charDesc.page = 0;
+		charDesc.uvX = charDesc.uvY = 0.0f;
+		charDesc.uvWidth = charDesc.uvHeight = 0.0f;
+		charDesc.width = charDesc.height = 0;
+		charDesc.xOffset = charDesc.yOffset = 0;
+		charDesc.xAdvance = xAdvance;
+		charDesc.yAdvance = 0;
+
+		return charDesc;
+	}
+
+	/**
+	 * @brief	Creates font data containing ASCII, BMP and supplementary plane characters, with a few kerning pairs.
+	 */
+	FontData createTestFontData()
+	{
+		FontData fontData;
+		fontData.size = 12;
+		fontData.fontDesc.baselineOffset = 10;
+		fontData.fontDesc.lineHeight = 14;
+		fontData.fontDesc.spaceWidth = 4;
+		fontData.fontDesc.missingGlyph.charId = 0;
+		fontData.fontDesc.missingGlyph.xAdvance = 99;
+
+		KerningPair pair;
+		CHAR_DESC& charA = addTestChar(fontData.fontDesc, 'A', 8);
+		pair.otherCharId = 'V';
+		pair.amount = -2;
+		charA.kerningPairs.push_back(pair);
+
+		// Duplicate pair, the first one is expected to win
+		pair.amount = -5;
+		charA.kerningPairs.push_back(pair);
+
+		CHAR_DESC& charV = addTestChar(fontData.fontDesc, 'V', 7);
+		pair.otherCharId = 0x1F600;
+		pair.amount = 3;
+		charV.kerningPairs.push_back(pair);
+
+		addTestChar(fontData.fontDesc, 0x4E2D, 12);
+		addTestChar(fontData.fontDesc, 0xFFFF, 5);
+		addTestChar(fontData.fontDesc, 0x1F600, 16);
+
+		fontData.buildLookupTables();
+		return fontData;
+	}
+
+	void testFontCharLookup()
+	{
+		FontData fontData = createTestFontData();
+
+		BS_TEST_ASSERT(fontData.getCharDesc('A').xAdvance == 8);
+		BS_TEST_ASSERT(fontData.getCharDesc('V').xAdvance == 7);
+		BS_TEST_ASSERT(fontData.getCharDesc(0x4E2D).xAdvance == 12);
+		BS_TEST_ASSERT(fontData.getCharDesc(0xFFFF).xAdvance == 5);
+		BS_TEST_ASSERT(fontData.getCharDesc(0x1F600).xAdvance == 16);
+
+		// Missing characters below, inside and above the direct lookup range
+		BS_TEST_ASSERT(fontData.getCharDesc('B').xAdvance == 99);
+		BS_TEST_ASSERT(fontData.getCharDesc(0x5000).xAdvance == 99);
+		BS_TEST_ASSERT(fontData.getCharDesc(0x10000).xAdvance == 99);
+	}
+
+	void testFontKerning()
+	{
+		FontData fontData = createTestFontData();
+
+		BS_TEST_ASSERT(fontData.getKerning('A', 'V') == -2);
+		BS_TEST_ASSERT(fontData.getKerning('V', 'A') == 0);
+		BS_TEST_ASSERT(fontData.getKerning('V', 0x1F600) == 3);
+		BS_TEST_ASSERT(fontData.getKerning('A', 'A') == 0);
+		BS_TEST_ASSERT(fontData.getKerning('B', 'V') == 0);
+	}
+
+	void testFontDataCopy()
+	{
+		FontData copy;
+
+		{
+			FontData original = createTestFontData();
+			copy = original;
+
+			// Lookups must point into the copy's own descriptor, not the original's
+			BS_TEST_ASSERT(&copy.getCharDesc('A') == &copy.fontDesc.characters['A']);
+			BS_TEST_ASSERT(&copy.getCharDesc(0x1F600) == &copy.fontDesc.characters[0x1F600]);
+
+			FontData copyConstructed(original);
+			BS_TEST_ASSERT(&copyConstructed.getCharDesc('V') == &copyConstructed.fontDesc.characters['V']);
+		}
+
+		// Original is destroyed at this point
+		BS_TEST_ASSERT(copy.getCharDesc('A').xAdvance == 8);
+		BS_TEST_ASSERT(copy.getKerning('A', 'V') == -2);
+	}
+
+	void runFontTests()
+	{
+		TestRunner::run("Font character lookup", &testFontCharLookup);
+		TestRunner::run("Font kerning", &testFontKerning);
+		TestRunner::run("Font data copy", &testFontDataCopy);
+	}
+}
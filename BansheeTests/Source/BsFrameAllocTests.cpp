@@ -0,0 +1,94 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsFrameAlloc.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Allocation made during a frame allocator test, along with the value it was filled with.
+	 */
+	struct FrameAllocation
+	{
+		UINT8* data;
+		UINT32 size;
+		UINT8 value;
+	};
+
+	/**
+	 * @brief	Checks that none of the allocations were overwritten by any other.
+	 */
+	bool areFrameAllocationsIntact(const Vector<FrameAllocation>& allocations)
+	{
+		bool intact = true;
+		for (auto& allocation : allocations)
+		{
+			for (UINT32 i = 0; i < allocation.size; i++)
+				intact &= allocation.data[i] == allocation.value;
+		}
+
+		return intact;
+	}
+
+	void testFrameAllocOverlap()
+	{
+		// Small block size so most allocations don't fit in the current block, and many are larger than 255 bytes
+		FrameAlloc frameAlloc(256);
+
+		for (UINT32 frame = 0; frame < 3; frame++)
+		{
+			Vector<FrameAllocation> allocations;
+			for (UINT32 i = 0; i < 200; i++)
+			{
+				FrameAllocation allocation;
+				allocation.size = 1 + (i * 97 + frame * 13) % 1500;
+				allocation.value = (UINT8)(i + frame);
+				allocation.data = frameAlloc.alloc(allocation.size);
+
+				memset(allocation.data, allocation.value, allocation.size);
+				allocations.push_back(allocation);
+			}
+
+			BS_TEST_ASSERT(areFrameAllocationsIntact(allocations));
+
+			for (auto& allocation : allocations)
+				frameAlloc.dealloc(allocation.data);
+
+			// Blocks are merged into one after clear, and the next frame must fit in it
+			frameAlloc.clear();
+		}
+	}
+
+	void testFrameAllocLargeAllocation()
+	{
+		FrameAlloc frameAlloc(1024);
+
+		// Larger than the block size, followed by allocations that fit in the default block again
+		Vector<FrameAllocation> allocations;
+		UINT32 sizes[] = { 100, 70000, 300, 1024, 5, 256, 257 };
+		for (UINT32 i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+		{
+			FrameAllocation allocation;
+			allocation.size = sizes[i];
+			allocation.value = (UINT8)(0xA0 + i);
+			allocation.data = frameAlloc.alloc(allocation.size);
+
+			memset(allocation.data, allocation.value, allocation.size);
+			allocations.push_back(allocation);
+		}
+
+		BS_TEST_ASSERT(areFrameAllocationsIntact(allocations));
+
+		for (auto& allocation : allocations)
+			frameAlloc.dealloc(allocation.data);
+
+		frameAlloc.clear();
+	}
+
+	void runFrameAllocTests()
+	{
+		TestRunner::run("Frame allocator overlap", &testFrameAllocOverlap);
+		TestRunner::run("Frame allocator large allocation", &testFrameAllocLargeAllocation);
+	}
+}
@@ -0,0 +1,134 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsGameObject.h"
+#include "BsGameObjectManager.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Minimal GameObject that can be registered with the GameObjectManager directly.
+	 */
+	class TestGameObject : public GameObject
+	{
+	public:
+		TestGameObject(UINT32 value)
+			:value(value)
+		{ }
+
+		UINT32 value;
+	};
+
+	/**
+	 * @brief	Handle that exposes destruction, which is normally only performed by SceneObject.
+	 */
+	class TestGameObjectHandle : public GameObjectHandleBase
+	{
+	public:
+		TestGameObjectHandle(const GameObjectHandleBase& other)
+			:GameObjectHandleBase(other)
+		{ }
+
+		void destroy()
+		{
+			if (isDestroyed())
+				return;
+
+			GameObjectManager::instance().unregisterObject(*this);
+			GameObjectHandleBase::destroy();
+		}
+
+		UINT32 getValue() const { return static_cast<TestGameObject*>(get())->value; }
+	};
+
+	void testGameObjectHandles()
+	{
+		GameObjectManager::startUp();
+
+		std::weak_ptr<GameObject> weakA;
+		TestGameObjectHandle handleA = GameObjectManager::instance().registerObject(bs_shared_ptr<TestGameObject>(1));
+		TestGameObjectHandle handleB = GameObjectManager::instance().registerObject(bs_shared_ptr<TestGameObject>(2));
+		weakA = handleA.getInternalPtr();
+
+		UINT64 idA = handleA.getInstanceId();
+		UINT64 idB = handleB.getInstanceId();
+
+		BS_TEST_ASSERT(!handleA.isDestroyed() && !handleB.isDestroyed());
+		BS_TEST_ASSERT(idA != idB && idA != 0 && idB != 0);
+		BS_TEST_ASSERT(handleA.getValue() == 1 && handleB.getValue() == 2);
+		BS_TEST_ASSERT(GameObjectManager::instance().objectExists(idA));
+		BS_TEST_ASSERT(GameObjectManager::instance().getObject(idB).get() == handleB.get());
+
+		TestGameObjectHandle copyA = handleA;
+		handleA.destroy();
+
+		BS_TEST_ASSERT(handleA.isDestroyed() && copyA.isDestroyed());
+		BS_TEST_ASSERT(copyA.getInstanceId() == idA);
+		BS_TEST_ASSERT(weakA.expired());
+		BS_TEST_ASSERT(!GameObjectManager::instance().objectExists(idA));
+		BS_TEST_ASSERT(!handleB.isDestroyed());
+
+		// The freed slot gets reused, but old handles must stay invalid
+		TestGameObjectHandle handleC = GameObjectManager::instance().registerObject(bs_shared_ptr<TestGameObject>(3));
+		BS_TEST_ASSERT(!handleC.isDestroyed());
+		BS_TEST_ASSERT(handleC.getValue() == 3);
+		BS_TEST_ASSERT(handleC.getInstanceId() != idA);
+		BS_TEST_ASSERT(handleA.isDestroyed() && copyA.isDestroyed());
+
+		handleC.destroy();
+		handleB.destroy();
+
+		GameObjectManager::shutDown();
+	}
+
+	void testGameObjectSlotGrowth()
+	{
+		GameObjectManager::startUp();
+
+		// Slot array gets reallocated many times, handles must keep resolving to their objects
+		Vector<TestGameObjectHandle> handles;
+		for (UINT32 i = 0; i < 1000; i++)
+			handles.push_back(GameObjectManager::instance().registerObject(bs_shared_ptr<TestGameObject>(i)));
+
+		bool allValid = true;
+		for (UINT32 i = 0; i < (UINT32)handles.size(); i++)
+			allValid &= !handles[i].isDestroyed() && handles[i].getValue() == i;
+
+		BS_TEST_ASSERT(allValid);
+
+		// Destroy every other object and refill the slots
+		for (UINT32 i = 0; i < (UINT32)handles.size(); i += 2)
+			handles[i].destroy();
+
+		Vector<TestGameObjectHandle> newHandles;
+		for (UINT32 i = 0; i < 500; i++)
+			newHandles.push_back(GameObjectManager::instance().registerObject(bs_shared_ptr<TestGameObject>(1000 + i)));
+
+		allValid = true;
+		for (UINT32 i = 0; i < (UINT32)handles.size(); i++)
+		{
+			if ((i % 2) == 0)
+				allValid &= handles[i].isDestroyed();
+			else
+				allValid &= !handles[i].isDestroyed() && handles[i].getValue() == i;
+		}
+
+		for (UINT32 i = 0; i < (UINT32)newHandles.size(); i++)
+			allValid &= !newHandles[i].isDestroyed() && newHandles[i].getValue() == 1000 + i;
+
+		BS_TEST_ASSERT(allValid);
+
+		GameObjectManager::shutDown();
+
+		// Shutting down the manager releases all objects
+		BS_TEST_ASSERT(handles[1].isDestroyed());
+		BS_TEST_ASSERT(newHandles[0].isDestroyed());
+	}
+
+	void runGameObjectTests()
+	{
+		TestRunner::run("GameObject handles", &testGameObjectHandles);
+		TestRunner::run("GameObject slot growth", &testGameObjectSlotGrowth);
+	}
+}
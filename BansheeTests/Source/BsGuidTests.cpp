@@ -0,0 +1,70 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsUUID.h"
+
+namespace BansheeEngine
+{
+	void testGuidStringRoundTrip()
+	{
+		String text = "0123abcd-4567-89ef-fedc-ba9876543210";
+		Guid guid(text);
+
+		BS_TEST_ASSERT(!guid.empty());
+		BS_TEST_ASSERT(guid == Guid(0x0123abcd, 0x456789ef, 0xfedcba98, 0x76543210));
+		BS_TEST_ASSERT(guid.toString() == text);
+
+		// Parsing is case insensitive, but output is always lower case
+		BS_TEST_ASSERT(Guid("0123ABCD-4567-89EF-FEDC-BA9876543210") == guid);
+		BS_TEST_ASSERT(Guid().toString() == "00000000-0000-0000-0000-000000000000");
+	}
+
+	void testGuidInvalidString()
+	{
+		BS_TEST_ASSERT(Guid(String("")).empty());
+		BS_TEST_ASSERT(Guid("0123abcd-4567-89ef-fedc-ba987654321").empty());
+		BS_TEST_ASSERT(Guid("0123abcd-4567-89ef-fedc-ba98765432100").empty());
+		BS_TEST_ASSERT(Guid("0123abcd-4567-89ef-fedc-ba987654321g").empty());
+	}
+
+	void testGuidComparison()
+	{
+		Guid a(1, 2, 3, 4);
+		Guid b(1, 2, 3, 5);
+		Guid c(2, 0, 0, 0);
+
+		BS_TEST_ASSERT(a != b);
+		BS_TEST_ASSERT(a < b && b < c && a < c);
+		BS_TEST_ASSERT(!(a < a));
+		BS_TEST_ASSERT(std::hash<Guid>()(a) == std::hash<Guid>()(Guid(1, 2, 3, 4)));
+		BS_TEST_ASSERT(Guid::EMPTY.empty());
+	}
+
+	void testGuidGenerator()
+	{
+		UUIDGenerator::startUp();
+
+		for (UINT32 i = 0; i < 100; i++)
+		{
+			Guid guid = UUIDGenerator::instance().generateRandom();
+			BS_TEST_ASSERT(!guid.empty());
+			BS_TEST_ASSERT(Guid(guid.toString()) == guid);
+
+			// Time based version, and the variant bit of the clock sequence
+			String text = guid.toString();
+			BS_TEST_ASSERT(text[14] == '1');
+			BS_TEST_ASSERT(text[19] >= '8' && text[19] <= 'b');
+		}
+
+		UUIDGenerator::shutDown();
+	}
+
+	void runGuidTests()
+	{
+		TestRunner::run("Guid string round trip", &testGuidStringRoundTrip);
+		TestRunner::run("Guid invalid string", &testGuidInvalidString);
+		TestRunner::run("Guid comparison", &testGuidComparison);
+		TestRunner::run("Guid generator", &testGuidGenerator);
+	}
+}
@@ -0,0 +1,210 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsImporter.h"
+#include "BsSpecificImporter.h"
+#include "BsGpuProgInclude.h"
+#include "BsResources.h"
+#include "BsCoreObjectManager.h"
+#include "BsUUID.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsException.h"
+#include "BsThreadPool.h"
+#include "BsTaskScheduler.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Thread safe importer for ".bstest" files that creates an include resource from the file
+	 *			contents, or fails if the contents start with "fail". Keeps track of how many imports ran
+	 *			at the same time.
+	 */
+	class TestBatchImporter : public SpecificImporter
+	{
+	public:
+		virtual bool isExtensionSupported(const WString& ext) const { return ext == L"bstest"; }
+		virtual bool isMagicNumberSupported(const UINT8* magicNumPtr, UINT32 numBytes) const { return true; }
+		virtual bool isThreadSafe() const { return true; }
+
+		virtual ResourcePtr import(const Path& filePath, ConstImportOptionsPtr importOptions)
+		{
+			UINT32 numActive = ++NumActiveImports;
+
+			UINT32 maxActive = MaxActiveImports;
+			while (numActive > maxActive && !MaxActiveImports.compare_exchange_weak(maxActive, numActive))
+			{ }
+
+			DataStreamPtr stream = FileSystem::openFile(filePath);
+			String contents = stream->getAsString();
+			stream->close();
+
+			// Give other imports a chance to overlap with this one
+			BS_THREAD_SLEEP(1);
+			NumActiveImports--;
+
+			if (contents.compare(0, 4, "fail") == 0)
+				BS_EXCEPT(InternalErrorException, "Requested import failure.");
+
+			return GpuProgInclude::_createPtr(contents);
+		}
+
+		static std::atomic<UINT32> NumActiveImports;
+		static std::atomic<UINT32> MaxActiveImports;
+	};
+
+	std::atomic<UINT32> TestBatchImporter::NumActiveImports;
+	std::atomic<UINT32> TestBatchImporter::MaxActiveImports;
+
+	/**
+	 * @brief	Creates a file with the provided contents in the working directory and returns its path.
+	 */
+	Path createImportTestFile(const String& name, const String& contents)
+	{
+		Path path = Path(name).getAbsolute(FileSystem::getWorkingDirectoryPath());
+
+		DataStreamPtr stream = FileSystem::createAndOpenFile(path);
+		stream->write(contents.data(), contents.size());
+		stream->close();
+
+		return path;
+	}
+
+	/**
+	 * @brief	Checks that the handle points to an include resource with the provided contents.
+	 */
+	bool isImportedInclude(const HResource& resource, const String& contents)
+	{
+		if (!resource)
+			return false;
+
+		HGpuProgInclude include = static_resource_cast<GpuProgInclude>(resource);
+		return include->getString() == contents;
+	}
+
+	void startUpImporterTest()
+	{
+		CoreObjectManager::startUp();
+		UUIDGenerator::startUp();
+		Resources::startUp();
+		Importer::startUp();
+
+		Importer::instance()._registerAssetImporter(bs_new<TestBatchImporter>());
+		TestBatchImporter::NumActiveImports = 0;
+		TestBatchImporter::MaxActiveImports = 0;
+	}
+
+	void shutDownImporterTest()
+	{
+		Importer::shutDown();
+		Resources::shutDown();
+		UUIDGenerator::shutDown();
+		CoreObjectManager::shutDown();
+	}
+
+	void testImportBatchFailures()
+	{
+		startUpImporterTest();
+
+		// Built-in include importer isn't thread safe, so the batch mixes serial and parallel imports
+		Vector<Path> paths;
+		paths.push_back(createImportTestFile("BsImportTest0.bstest", "first"));
+		paths.push_back(Path("BsImportTestMissing.bstest").getAbsolute(FileSystem::getWorkingDirectoryPath()));
+		paths.push_back(createImportTestFile("BsImportTest2.bsunknown", "unsupported"));
+		paths.push_back(createImportTestFile("BsImportTest3.bstest", "fail"));
+		paths.push_back(createImportTestFile("BsImportTest4.gpuproginc", "fifth"));
+		paths.push_back(createImportTestFile("BsImportTest5.bstest", "sixth"));
+
+		// Once without the task scheduler, and once with it
+		for (UINT32 i = 0; i < 2; i++)
+		{
+			if (i == 1)
+			{
+				ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>(4);
+				TaskScheduler::startUp();
+			}
+
+			Vector<HResource> resources = Importer::instance().importBatch(paths);
+
+			BS_TEST_ASSERT(resources.size() == paths.size());
+			if (resources.size() != paths.size())
+				continue;
+
+			BS_TEST_ASSERT(isImportedInclude(resources[0], "first"));
+			BS_TEST_ASSERT(!resources[1]); // Missing file
+			BS_TEST_ASSERT(!resources[2]); // No importer for the extension
+			BS_TEST_ASSERT(!resources[3]); // Importer threw
+			BS_TEST_ASSERT(isImportedInclude(resources[4], "fifth"));
+			BS_TEST_ASSERT(isImportedInclude(resources[5], "sixth"));
+		}
+
+		TaskScheduler::shutDown();
+		ThreadPool::shutDown();
+
+		for (auto& path : paths)
+		{
+			if (FileSystem::isFile(path))
+				FileSystem::remove(path);
+		}
+
+		shutDownImporterTest();
+	}
+
+	void testImportBatchParallel()
+	{
+		startUpImporterTest();
+		ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>(4);
+		TaskScheduler::startUp();
+
+		// Every fifth file fails, and every seventh goes through the serial include importer
+		const UINT32 numFiles = 50;
+		Vector<Path> paths;
+		Vector<String> contents;
+		for (UINT32 i = 0; i < numFiles; i++)
+		{
+			String fileContents = (i % 5) == 4 ? "fail" + toString(i) : "file" + toString(i);
+			String extension = (i % 7) == 6 ? ".gpuproginc" : ".bstest";
+
+			paths.push_back(createImportTestFile("BsImportTest" + toString(i) + extension, fileContents));
+			contents.push_back(fileContents);
+		}
+
+		const UINT32 maxInFlight = 3;
+		Vector<HResource> resources = Importer::instance().importBatch(paths, Vector<ConstImportOptionsPtr>(), maxInFlight);
+
+		BS_TEST_ASSERT(resources.size() == numFiles);
+		if (resources.size() == numFiles)
+		{
+			bool allMatch = true;
+			for (UINT32 i = 0; i < numFiles; i++)
+			{
+				bool shouldFail = (i % 5) == 4 && (i % 7) != 6;
+
+				if (shouldFail)
+					allMatch &= !resources[i];
+				else
+					allMatch &= isImportedInclude(resources[i], contents[i]);
+			}
+
+			BS_TEST_ASSERT(allMatch);
+		}
+
+		// Parallel imports are throttled to the requested number in flight
+		BS_TEST_ASSERT(TestBatchImporter::MaxActiveImports >= 1);
+		BS_TEST_ASSERT(TestBatchImporter::MaxActiveImports <= maxInFlight);
+
+		for (auto& path : paths)
+			FileSystem::remove(path);
+
+		TaskScheduler::shutDown();
+		ThreadPool::shutDown();
+		shutDownImporterTest();
+	}
+
+	void runImporterTests()
+	{
+		TestRunner::run("Import batch failures", &testImportBatchFailures);
+		TestRunner::run("Import batch parallel", &testImportBatchParallel);
+	}
+}
@@ -0,0 +1,103 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsSubMesh.h"
+#include "BsVector2.h"
+#include "BsVector3.h"
+
+namespace BansheeEngine
+{
+	void testMeshDataCombine()
+	{
+		// First mesh has positions and texture coordinates, second one only positions, so its vertex
+		// stride differs from the stride of the combined mesh
+		VertexDataDescPtr firstDesc = bs_shared_ptr<VertexDataDesc>();
+		firstDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		firstDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		VertexDataDescPtr secondDesc = bs_shared_ptr<VertexDataDesc>();
+		secondDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+
+		Vector3 firstPositions[] = { Vector3(0.0f, 1.0f, 2.0f), Vector3(3.0f, 4.0f, 5.0f), Vector3(6.0f, 7.0f, 8.0f) };
+		Vector2 firstUVs[] = { Vector2(0.1f, 0.2f), Vector2(0.3f, 0.4f), Vector2(0.5f, 0.6f) };
+		Vector3 secondPositions[] = { Vector3(10.0f, 11.0f, 12.0f), Vector3(13.0f, 14.0f, 15.0f),
+			Vector3(16.0f, 17.0f, 18.0f), Vector3(19.0f, 20.0f, 21.0f) };
+
+		MeshDataPtr firstMesh = bs_shared_ptr<MeshData>(3, 3, firstDesc);
+		firstMesh->setVertexData(VES_POSITION, (UINT8*)firstPositions, sizeof(firstPositions));
+		firstMesh->setVertexData(VES_TEXCOORD, (UINT8*)firstUVs, sizeof(firstUVs));
+
+		UINT32* firstIndices = firstMesh->getIndices32();
+		firstIndices[0] = 0; firstIndices[1] = 1; firstIndices[2] = 2;
+
+		MeshDataPtr secondMesh = bs_shared_ptr<MeshData>(4, 6, secondDesc);
+		secondMesh->setVertexData(VES_POSITION, (UINT8*)secondPositions, sizeof(secondPositions));
+
+		UINT32* secondIndices = secondMesh->getIndices32();
+		secondIndices[0] = 0; secondIndices[1] = 1; secondIndices[2] = 2;
+		secondIndices[3] = 2; secondIndices[4] = 3; secondIndices[5] = 0;
+
+		Vector<MeshDataPtr> meshes = { firstMesh, secondMesh };
+
+		Vector<Vector<SubMesh>> allSubMeshes(2);
+		allSubMeshes[0].push_back(SubMesh(0, 3, DOT_TRIANGLE_LIST));
+		allSubMeshes[1].push_back(SubMesh(0, 3, DOT_TRIANGLE_LIST));
+		allSubMeshes[1].push_back(SubMesh(3, 3, DOT_TRIANGLE_LIST));
+
+		Vector<SubMesh> subMeshes;
+		MeshDataPtr combined = MeshData::combine(meshes, allSubMeshes, subMeshes);
+
+		BS_TEST_ASSERT(combined->getNumVertices() == 7);
+		BS_TEST_ASSERT(combined->getNumIndices() == 9);
+
+		// Indices of later meshes are offset by the vertices of earlier ones
+		UINT32 expectedIndices[] = { 0, 1, 2, 3, 4, 5, 5, 6, 3 };
+		BS_TEST_ASSERT(memcmp(combined->getIndices32(), expectedIndices, sizeof(expectedIndices)) == 0);
+
+		BS_TEST_ASSERT(subMeshes.size() == 3);
+		if (subMeshes.size() == 3)
+		{
+			BS_TEST_ASSERT(subMeshes[0].indexOffset == 0 && subMeshes[0].indexCount == 3);
+			BS_TEST_ASSERT(subMeshes[1].indexOffset == 3 && subMeshes[1].indexCount == 3);
+			BS_TEST_ASSERT(subMeshes[2].indexOffset == 6 && subMeshes[2].indexCount == 3);
+		}
+
+		// Vertices are read with the stride of their own mesh, and missing elements are zeroed
+		UINT32 stride = combined->getVertexDesc()->getVertexStride(0);
+		UINT8* positionData = combined->getElementData(VES_POSITION);
+		UINT8* uvData = combined->getElementData(VES_TEXCOORD);
+
+		bool positionsMatch = true;
+		bool uvsMatch = true;
+		for (UINT32 i = 0; i < 7; i++)
+		{
+			Vector3 position;
+			memcpy(&position, positionData + i * stride, sizeof(position));
+
+			Vector2 uv;
+			memcpy(&uv, uvData + i * stride, sizeof(uv));
+
+			if (i < 3)
+			{
+				positionsMatch &= position == firstPositions[i];
+				uvsMatch &= uv == firstUVs[i];
+			}
+			else
+			{
+				positionsMatch &= position == secondPositions[i - 3];
+				uvsMatch &= uv == Vector2::ZERO;
+			}
+		}
+
+		BS_TEST_ASSERT(positionsMatch);
+		BS_TEST_ASSERT(uvsMatch);
+	}
+
+	void runMeshDataTests()
+	{
+		TestRunner::run("Mesh data combine", &testMeshDataCombine);
+	}
+}
@@ -0,0 +1,222 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsMeshOptimizer.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsVector2.h"
+#include "BsVector3.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Creates a flat grid of quads with vertices in pseudo-random order. Triangles of the bottom and top
+	 *			half of the grid are shuffled separately, so each half can be used as a sub-mesh. Positions are
+	 *			stored in the first vertex stream, and texture coordinates equal to the position in the second.
+	 */
+	MeshDataPtr createOptimizerTestGrid(UINT32 numQuads, IndexBuffer::IndexType indexType)
+	{
+		UINT32 numSideVertices = numQuads + 1;
+		UINT32 numVertices = numSideVertices * numSideVertices;
+		UINT32 numTriangles = numQuads * numQuads * 2;
+
+		UINT32 seed = 3;
+		auto random = [&](UINT32 max)
+		{
+			seed = seed * 1103515245 + 12345;
+			return (seed >> 16) % max;
+		};
+
+		// Shuffled mapping from grid vertices to vertex buffer locations
+		Vector<UINT32> vertexOrder(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			vertexOrder[i] = i;
+
+		for (UINT32 i = numVertices - 1; i > 0; i--)
+			std::swap(vertexOrder[i], vertexOrder[random(i + 1)]);
+
+		Vector<UINT32> triangles;
+		for (UINT32 y = 0; y < numQuads; y++)
+		{
+			for (UINT32 x = 0; x < numQuads; x++)
+			{
+				UINT32 v0 = vertexOrder[y * numSideVertices + x];
+				UINT32 v1 = vertexOrder[y * numSideVertices + x + 1];
+				UINT32 v2 = vertexOrder[(y + 1) * numSideVertices + x];
+				UINT32 v3 = vertexOrder[(y + 1) * numSideVertices + x + 1];
+
+				UINT32 quad[] = { v0, v2, v1, v1, v2, v3 };
+				triangles.insert(triangles.end(), quad, quad + 6);
+			}
+		}
+
+		UINT32 halfTriangles = numTriangles / 2;
+		for (UINT32 half = 0; half < 2; half++)
+		{
+			UINT32 first = half * halfTriangles;
+			UINT32 count = half == 0 ? halfTriangles : numTriangles - halfTriangles;
+
+			for (UINT32 i = count - 1; i > 0; i--)
+			{
+				UINT32 j = random(i + 1);
+				for (UINT32 k = 0; k < 3; k++)
+					std::swap(triangles[(first + i) * 3 + k], triangles[(first + j) * 3 + k]);
+			}
+		}
+
+		VertexDataDescPtr vertexDesc = bs_shared_ptr<VertexDataDesc>();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION, 0, 0);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD, 0, 1);
+
+		MeshDataPtr meshData = bs_shared_ptr<MeshData>(numVertices, numTriangles * 3, vertexDesc, indexType);
+
+		Vector<Vector3> positions(numVertices);
+		Vector<Vector2> uvs(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			float x = (float)(i % numSideVertices);
+			float y = (float)(i / numSideVertices);
+
+			positions[vertexOrder[i]] = Vector3(x, y, 0.0f);
+			uvs[vertexOrder[i]] = Vector2(x, y);
+		}
+
+		meshData->setVertexData(VES_POSITION, (UINT8*)&positions[0], numVertices * sizeof(Vector3), 0, 0);
+		meshData->setVertexData(VES_TEXCOORD, (UINT8*)&uvs[0], numVertices * sizeof(Vector2), 0, 1);
+
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+		{
+			if (indexType == IndexBuffer::IT_32BIT)
+				meshData->getIndices32()[i] = triangles[i];
+			else
+				meshData->getIndices16()[i] = (UINT16)triangles[i];
+		}
+
+		return meshData;
+	}
+
+	/**
+	 * @brief	Returns the index at the specified location, regardless of the index type.
+	 */
+	UINT32 getOptimizerTestIndex(const MeshData& meshData, UINT32 idx)
+	{
+		if (meshData.getIndexType() == IndexBuffer::IT_32BIT)
+			return meshData.getIndices32()[idx];
+
+		return meshData.getIndices16()[idx];
+	}
+
+	/**
+	 * @brief	Returns the triangles of the sub-mesh identified by the positions of their vertices, sorted. Each
+	 *			triangle is rotated so its first vertex is the smallest, which keeps the winding order intact.
+	 */
+	Vector<UINT64> getOptimizerTestTriangles(const MeshData& meshData, const SubMesh& subMesh, UINT32 numSideVertices)
+	{
+		const UINT8* positionData = meshData.getElementData(VES_POSITION, 0, 0);
+		UINT32 stride = meshData.getVertexDesc()->getVertexStride(0);
+
+		Vector<UINT64> triangles;
+		for (UINT32 i = 0; i < subMesh.indexCount; i += 3)
+		{
+			UINT64 ids[3];
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				Vector3 position;
+				memcpy(&position, positionData + getOptimizerTestIndex(meshData, subMesh.indexOffset + i + j) * stride, sizeof(position));
+
+				ids[j] = (UINT64)position.y * numSideVertices + (UINT64)position.x;
+			}
+
+			UINT32 first = 0;
+			if (ids[1] < ids[first]) first = 1;
+			if (ids[2] < ids[first]) first = 2;
+
+			triangles.push_back((ids[first] << 42) | (ids[(first + 1) % 3] << 21) | ids[(first + 2) % 3]);
+		}
+
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+
+	void testMeshOptimizer()
+	{
+		const UINT32 numQuads = 40;
+		const UINT32 numSideVertices = numQuads + 1;
+
+		IndexBuffer::IndexType indexTypes[] = { IndexBuffer::IT_32BIT, IndexBuffer::IT_16BIT };
+		for (auto& indexType : indexTypes)
+		{
+			MeshDataPtr meshData = createOptimizerTestGrid(numQuads, indexType);
+			UINT32 numIndices = meshData->getNumIndices();
+			UINT32 numVertices = meshData->getNumVertices();
+
+			// Bottom and top half of the grid as separate sub-meshes, triangles must not move between them
+			Vector<SubMesh> subMeshes;
+			subMeshes.push_back(SubMesh(0, numIndices / 2, DOT_TRIANGLE_LIST));
+			subMeshes.push_back(SubMesh(numIndices / 2, numIndices - numIndices / 2, DOT_TRIANGLE_LIST));
+
+			Vector<Vector<UINT64>> originalTriangles;
+			Vector<float> originalACMR;
+			for (auto& subMesh : subMeshes)
+			{
+				originalTriangles.push_back(getOptimizerTestTriangles(*meshData, subMesh, numSideVertices));
+				originalACMR.push_back(MeshOptimizer::calculateACMR(*meshData, subMesh));
+			}
+
+			MeshOptimizer::optimize(*meshData, subMeshes);
+
+			BS_TEST_ASSERT(meshData->getNumIndices() == numIndices);
+			BS_TEST_ASSERT(meshData->getNumVertices() == numVertices);
+
+			for (UINT32 i = 0; i < (UINT32)subMeshes.size(); i++)
+			{
+				BS_TEST_ASSERT(getOptimizerTestTriangles(*meshData, subMeshes[i], numSideVertices) == originalTriangles[i]);
+
+				// Shuffled grid is close to the worst case, optimized grid should be close to the ideal 0.5
+				float optimizedACMR = MeshOptimizer::calculateACMR(*meshData, subMeshes[i]);
+				BS_TEST_ASSERT(originalACMR[i] > 2.0f);
+				BS_TEST_ASSERT(optimizedACMR < 0.8f);
+				BS_TEST_ASSERT(MeshOptimizer::calculateATVR(*meshData, subMeshes[i]) < 1.5f);
+			}
+
+			// Vertices are numbered in the order they are first referenced
+			bool fetchOrdered = true;
+			UINT32 nextVertex = 0;
+			for (UINT32 i = 0; i < numIndices; i++)
+			{
+				UINT32 index = getOptimizerTestIndex(*meshData, i);
+				fetchOrdered &= index <= nextVertex;
+
+				if (index == nextVertex)
+					nextVertex++;
+			}
+
+			BS_TEST_ASSERT(fetchOrdered);
+			BS_TEST_ASSERT(nextVertex == numVertices);
+
+			// Vertices from both streams were moved together
+			const UINT8* positionData = meshData->getElementData(VES_POSITION, 0, 0);
+			const UINT8* uvData = meshData->getElementData(VES_TEXCOORD, 0, 1);
+
+			bool attributesMatch = true;
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				Vector3 position;
+				memcpy(&position, positionData + i * sizeof(Vector3), sizeof(position));
+
+				Vector2 uv;
+				memcpy(&uv, uvData + i * sizeof(Vector2), sizeof(uv));
+
+				attributesMatch &= position.x == uv.x && position.y == uv.y;
+			}
+
+			BS_TEST_ASSERT(attributesMatch);
+		}
+	}
+
+	void runMeshOptimizerTests()
+	{
+		TestRunner::run("Mesh optimizer", &testMeshOptimizer);
+	}
+}
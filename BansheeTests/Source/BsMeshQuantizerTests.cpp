@@ -0,0 +1,211 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsMeshQuantizer.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsVector2.h"
+#include "BsVector3.h"
+#include "BsVector4.h"
+#include "BsMath.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Returns unit length directions distributed over the sphere, including the axes and the
+	 *			directions along the octahedron edges, where the encoding folds.
+	 */
+	Vector<Vector3> getQuantizerTestDirections()
+	{
+		Vector<Vector3> directions;
+
+		const UINT32 numRings = 64;
+		const UINT32 numSegments = 128;
+		for (UINT32 i = 0; i <= numRings; i++)
+		{
+			float theta = Math::PI * i / numRings;
+			for (UINT32 j = 0; j < numSegments; j++)
+			{
+				float phi = Math::TWO_PI * j / numSegments;
+				directions.push_back(Vector3(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta)));
+			}
+		}
+
+		for (INT32 x = -1; x <= 1; x++)
+		{
+			for (INT32 y = -1; y <= 1; y++)
+			{
+				for (INT32 z = -1; z <= 1; z++)
+				{
+					Vector3 direction((float)x, (float)y, (float)z);
+					if (direction.length() > 0.0f)
+						directions.push_back(Vector3::normalize(direction));
+				}
+			}
+		}
+
+		return directions;
+	}
+
+	/**
+	 * @brief	Returns the angle between two directions in degrees. Accurate for small angles, unlike the dot product.
+	 */
+	float getQuantizerTestAngle(const Vector3& a, const Vector3& b)
+	{
+		return atan2(a.cross(b).length(), a.dot(b)) * 180.0f / Math::PI;
+	}
+
+	void testOctahedralEncoding()
+	{
+		// Error of a 16-bit octahedral encoding stays well below 0.01 degrees
+		const float maxQuantizedAngle = 0.01f;
+
+		bool inRange = true;
+		bool exact = true;
+		bool quantizedAccurate = true;
+		for (auto& direction : getQuantizerTestDirections())
+		{
+			Vector2 encoded = MeshQuantizer::encodeOctahedral(direction);
+			inRange &= fabs(encoded.x) <= 1.0f && fabs(encoded.y) <= 1.0f;
+
+			Vector3 decoded = MeshQuantizer::decodeOctahedral(encoded);
+			exact &= (decoded - direction).length() < 0.0001f;
+
+			// Same rounding as VET_SHORT2_NORM
+			Vector2 quantized(floor(encoded.x * 32767.0f + 0.5f) / 32767.0f, floor(encoded.y * 32767.0f + 0.5f) / 32767.0f);
+			Vector3 quantizedDecoded = MeshQuantizer::decodeOctahedral(quantized);
+
+			quantizedAccurate &= fabs(quantizedDecoded.length() - 1.0f) < 0.0001f;
+			quantizedAccurate &= getQuantizerTestAngle(quantizedDecoded, direction) <= maxQuantizedAngle;
+		}
+
+		BS_TEST_ASSERT(inRange);
+		BS_TEST_ASSERT(exact);
+		BS_TEST_ASSERT(quantizedAccurate);
+	}
+
+	void testMeshQuantize()
+	{
+		// Wrapped sphere with positions offset from the origin and texture coordinates outside of [0, 1]
+		Vector<Vector3> directions = getQuantizerTestDirections();
+		UINT32 numVertices = (UINT32)directions.size();
+		UINT32 numIndices = (numVertices - 2) * 3;
+
+		const Vector3 center(10.0f, -4.0f, 2.5f);
+		const float radius = 3.0f;
+
+		Vector<Vector3> positions(numVertices);
+		Vector<Vector2> uvs(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			positions[i] = center + directions[i] * radius;
+			uvs[i] = Vector2(directions[i].x * 4.0f, 2.0f + directions[i].y);
+		}
+
+		VertexDataDescPtr vertexDesc = bs_shared_ptr<VertexDataDesc>();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+		vertexDesc->addVertElem(VET_COLOR, VES_COLOR);
+
+		MeshDataPtr meshData = bs_shared_ptr<MeshData>(numVertices, numIndices, vertexDesc, IndexBuffer::IT_16BIT);
+		meshData->setVertexData(VES_POSITION, (UINT8*)&positions[0], numVertices * sizeof(Vector3));
+		meshData->setVertexData(VES_NORMAL, (UINT8*)&directions[0], numVertices * sizeof(Vector3));
+		meshData->setVertexData(VES_TEXCOORD, (UINT8*)&uvs[0], numVertices * sizeof(Vector2));
+
+		Vector<UINT32> colors(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			colors[i] = i * 2654435761U;
+
+		meshData->setVertexData(VES_COLOR, (UINT8*)&colors[0], numVertices * sizeof(UINT32));
+
+		UINT16* indices = meshData->getIndices16();
+		for (UINT32 i = 0; i < numIndices; i += 3)
+		{
+			indices[i + 0] = (UINT16)(i / 3);
+			indices[i + 1] = (UINT16)(i / 3 + 1);
+			indices[i + 2] = (UINT16)(i / 3 + 2);
+		}
+
+		// Nothing to quantize returns the original
+		BS_TEST_ASSERT(MeshQuantizer::quantize(meshData, false, false, false) == meshData);
+
+		MeshDataPtr quantized = MeshQuantizer::quantize(meshData, true, true, true);
+		BS_TEST_ASSERT(quantized != meshData);
+		BS_TEST_ASSERT(quantized->getNumVertices() == numVertices);
+		BS_TEST_ASSERT(quantized->getNumIndices() == numIndices);
+		BS_TEST_ASSERT(quantized->getIndexType() == IndexBuffer::IT_16BIT);
+		BS_TEST_ASSERT(memcmp(quantized->getIndices16(), indices, numIndices * sizeof(UINT16)) == 0);
+
+		const VertexDataDescPtr& quantizedDesc = quantized->getVertexDesc();
+		BS_TEST_ASSERT(quantizedDesc->getNumElements() == 4);
+		if (quantizedDesc->getNumElements() != 4)
+			return;
+
+		BS_TEST_ASSERT(quantizedDesc->getElement(0).getType() == VET_USHORT4_NORM);
+		BS_TEST_ASSERT(quantizedDesc->getElement(1).getType() == VET_SHORT2_NORM);
+		BS_TEST_ASSERT(quantizedDesc->getElement(2).getType() == VET_HALF2);
+		BS_TEST_ASSERT(quantizedDesc->getElement(3).getType() == VET_COLOR);
+		BS_TEST_ASSERT(quantizedDesc->getVertexStride(0) == 20);
+
+		// Positions use the largest extent of the bounds as the scale on all axes
+		BS_TEST_ASSERT((quantized->getPositionDecodeOffset() - (center - Vector3(radius, radius, radius))).length() < 0.0001f);
+		BS_TEST_ASSERT(fabs(quantized->getPositionDecodeScale() - radius * 2.0f) < 0.0001f);
+
+		const float maxPositionError = radius * 2.0f / 65535.0f + 0.0001f;
+		const float maxDirectionAngle = 0.01f;
+
+		VertexElemDecodeIter positionIter = quantized->getDecodedDataIter(VES_POSITION);
+		VertexElemDecodeIter normalIter = quantized->getDecodedDataIter(VES_NORMAL);
+		VertexElemDecodeIter uvIter = quantized->getDecodedDataIter(VES_TEXCOORD);
+
+		bool positionsMatch = true;
+		bool normalsMatch = true;
+		bool uvsMatch = true;
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			Vector4 position = positionIter.getValue();
+			positionsMatch &= fabs(position.x - positions[i].x) <= maxPositionError;
+			positionsMatch &= fabs(position.y - positions[i].y) <= maxPositionError;
+			positionsMatch &= fabs(position.z - positions[i].z) <= maxPositionError;
+
+			Vector4 normal = normalIter.getValue();
+			normalsMatch &= getQuantizerTestAngle(Vector3(normal.x, normal.y, normal.z), directions[i]) <= maxDirectionAngle;
+
+			// Half precision keeps 11 significant bits
+			Vector4 uv = uvIter.getValue();
+			uvsMatch &= fabs(uv.x - uvs[i].x) <= std::max(Math::abs(uvs[i].x), 0.001f) / 2048.0f;
+			uvsMatch &= fabs(uv.y - uvs[i].y) <= std::max(Math::abs(uvs[i].y), 0.001f) / 2048.0f;
+
+			positionIter.moveNext();
+			normalIter.moveNext();
+			uvIter.moveNext();
+		}
+
+		BS_TEST_ASSERT(positionsMatch);
+		BS_TEST_ASSERT(normalsMatch);
+		BS_TEST_ASSERT(uvsMatch);
+
+		// Elements that weren't quantized are copied as is
+		UINT8* colorData = quantized->getElementData(VES_COLOR);
+		UINT32 stride = quantizedDesc->getVertexStride(0);
+
+		bool colorsMatch = true;
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			UINT32 color;
+			memcpy(&color, colorData + i * stride, sizeof(color));
+
+			colorsMatch &= color == colors[i];
+		}
+
+		BS_TEST_ASSERT(colorsMatch);
+	}
+
+	void runMeshQuantizerTests()
+	{
+		TestRunner::run("Octahedral encoding", &testOctahedralEncoding);
+		TestRunner::run("Mesh quantize", &testMeshQuantize);
+	}
+}
@@ -0,0 +1,302 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsMeshSimplifier.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsVector2.h"
+#include "BsVector3.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Creates a grid of quads in the XY plane. Height of each vertex is
+	 *			amplitude * sin(0.7 * x) * cos(0.5 * y). If a seam is requested, vertices in the middle column are
+	 *			duplicated and the right half of the grid uses the duplicates, with texture coordinates offset by 100.
+	 */
+	MeshDataPtr createSimplifierTestGrid(UINT32 numQuads, float amplitude, bool seam)
+	{
+		UINT32 numSideVertices = numQuads + 1;
+		UINT32 seamColumn = numQuads / 2;
+
+		Vector<Vector3> positions;
+		Vector<Vector2> uvs;
+		Vector<UINT32> gridVertices(numSideVertices * numSideVertices);
+		Vector<UINT32> seamVertices(numSideVertices);
+
+		for (UINT32 y = 0; y < numSideVertices; y++)
+		{
+			for (UINT32 x = 0; x < numSideVertices; x++)
+			{
+				Vector3 position((float)x, (float)y, amplitude * sin(x * 0.7f) * cos(y * 0.5f));
+				float uvOffset = (seam && x > seamColumn) ? 100.0f : 0.0f;
+
+				gridVertices[y * numSideVertices + x] = (UINT32)positions.size();
+				positions.push_back(position);
+				uvs.push_back(Vector2(x + uvOffset, (float)y));
+
+				if (seam && x == seamColumn)
+				{
+					seamVertices[y] = (UINT32)positions.size();
+					positions.push_back(position);
+					uvs.push_back(Vector2(x + 100.0f, (float)y));
+				}
+			}
+		}
+
+		auto getVertex = [&](UINT32 x, UINT32 y, bool right)
+		{
+			if (seam && right && x == seamColumn)
+				return seamVertices[y];
+
+			return gridVertices[y * numSideVertices + x];
+		};
+
+		Vector<UINT32> indices;
+		for (UINT32 y = 0; y < numQuads; y++)
+		{
+			for (UINT32 x = 0; x < numQuads; x++)
+			{
+				bool right = x >= seamColumn;
+
+				UINT32 v0 = getVertex(x, y, right);
+				UINT32 v1 = getVertex(x + 1, y, right);
+				UINT32 v2 = getVertex(x, y + 1, right);
+				UINT32 v3 = getVertex(x + 1, y + 1, right);
+
+				UINT32 quad[] = { v0, v1, v2, v1, v3, v2 };
+				indices.insert(indices.end(), quad, quad + 6);
+			}
+		}
+
+		VertexDataDescPtr vertexDesc = bs_shared_ptr<VertexDataDesc>();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		UINT32 numVertices = (UINT32)positions.size();
+		MeshDataPtr meshData = bs_shared_ptr<MeshData>(numVertices, (UINT32)indices.size(), vertexDesc);
+		meshData->setVertexData(VES_POSITION, (UINT8*)&positions[0], numVertices * sizeof(Vector3));
+		meshData->setVertexData(VES_TEXCOORD, (UINT8*)&uvs[0], numVertices * sizeof(Vector2));
+		memcpy(meshData->getIndices32(), &indices[0], indices.size() * sizeof(UINT32));
+
+		return meshData;
+	}
+
+	/**
+	 * @brief	Reads the vertex element of the specified type at the provided vertex index.
+	 */
+	template<class T>
+	T getSimplifierTestElement(const MeshData& meshData, VertexElementSemantic semantic, UINT32 vertexIdx)
+	{
+		UINT32 stride = meshData.getVertexDesc()->getVertexStride(0);
+
+		T value;
+		memcpy(&value, meshData.getElementData(semantic) + vertexIdx * stride, sizeof(value));
+
+		return value;
+	}
+
+	/**
+	 * @brief	Information about a triangle list used for validating simplified triangles.
+	 */
+	struct SimplifiedTriangles
+	{
+		UINT32 numDegenerate; /**< Triangles referencing the same vertex twice, or with no area. */
+		UINT32 numFlipped; /**< Triangles facing away from the +Z axis. */
+		UINT32 numMixedSeam; /**< Triangles referencing vertices from both sides of the seam. */
+		float area; /**< Projected area in the XY plane. */
+		float seamLeftArea; /**< Projected area of triangles left of the seam. */
+	};
+
+	/**
+	 * @brief	Validates the provided triangles referencing the vertices of the provided mesh data.
+	 */
+	SimplifiedTriangles checkSimplifiedTriangles(const MeshData& meshData, const UINT32* indices, UINT32 numIndices)
+	{
+		SimplifiedTriangles output = { 0, 0, 0, 0.0f, 0.0f };
+
+		for (UINT32 i = 0; i < numIndices; i += 3)
+		{
+			UINT32 triangle[3] = { indices[i], indices[i + 1], indices[i + 2] };
+
+			Vector3 positions[3];
+			UINT32 numRightSide = 0;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				positions[j] = getSimplifierTestElement<Vector3>(meshData, VES_POSITION, triangle[j]);
+
+				if (getSimplifierTestElement<Vector2>(meshData, VES_TEXCOORD, triangle[j]).x >= 100.0f)
+					numRightSide++;
+			}
+
+			Vector3 edge0 = positions[1] - positions[0];
+			Vector3 edge1 = positions[2] - positions[0];
+			float projectedArea = (edge0.x * edge1.y - edge0.y * edge1.x) * 0.5f;
+
+			if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2] ||
+				edge0.cross(edge1).length() < 0.0001f)
+				output.numDegenerate++;
+
+			if (projectedArea < 0.0f)
+				output.numFlipped++;
+
+			if (numRightSide != 0 && numRightSide != 3)
+				output.numMixedSeam++;
+
+			output.area += projectedArea;
+			if (numRightSide == 0)
+				output.seamLeftArea += projectedArea;
+		}
+
+		return output;
+	}
+
+	void testMeshSimplifierPlane()
+	{
+		// Interior of a plane can be collapsed with no error, while the border keeps its shape
+		const UINT32 numQuads = 32;
+		MeshDataPtr meshData = createSimplifierTestGrid(numQuads, 0.0f, false);
+
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32 targetIndexCount = numIndices / 4;
+
+		// Output is appended to existing contents
+		Vector<UINT32> output = { 7 };
+		UINT32 numOutputIndices = MeshSimplifier::simplify(*meshData, SubMesh(0, numIndices, DOT_TRIANGLE_LIST),
+			targetIndexCount, 0.0f, output);
+
+		BS_TEST_ASSERT(output[0] == 7);
+		BS_TEST_ASSERT(numOutputIndices == output.size() - 1);
+		BS_TEST_ASSERT((numOutputIndices % 3) == 0);
+		BS_TEST_ASSERT(numOutputIndices > 0 && numOutputIndices <= targetIndexCount);
+
+		bool indicesValid = true;
+		for (UINT32 i = 1; i < (UINT32)output.size(); i++)
+			indicesValid &= output[i] < meshData->getNumVertices();
+
+		BS_TEST_ASSERT(indicesValid);
+		if (!indicesValid || numOutputIndices == 0)
+			return;
+
+		SimplifiedTriangles triangles = checkSimplifiedTriangles(*meshData, &output[1], numOutputIndices);
+		BS_TEST_ASSERT(triangles.numDegenerate == 0);
+		BS_TEST_ASSERT(triangles.numFlipped == 0);
+		BS_TEST_ASSERT(fabs(triangles.area - numQuads * numQuads) < 0.01f);
+	}
+
+	void testMeshSimplifierMaxError()
+	{
+		const UINT32 numQuads = 32;
+		MeshDataPtr meshData = createSimplifierTestGrid(numQuads, 2.0f, false);
+
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32 targetIndexCount = numIndices / 8;
+		SubMesh subMesh(0, numIndices, DOT_TRIANGLE_LIST);
+
+		// Curved surface can't be reduced much without error
+		Vector<UINT32> preciseOutput;
+		UINT32 numPreciseIndices = MeshSimplifier::simplify(*meshData, subMesh, targetIndexCount, 0.001f, preciseOutput);
+
+		Vector<UINT32> coarseOutput;
+		UINT32 numCoarseIndices = MeshSimplifier::simplify(*meshData, subMesh, targetIndexCount, 1.0f, coarseOutput);
+
+		BS_TEST_ASSERT(numPreciseIndices > numIndices / 2);
+		BS_TEST_ASSERT(numCoarseIndices <= targetIndexCount);
+
+		SimplifiedTriangles preciseTriangles = checkSimplifiedTriangles(*meshData, &preciseOutput[0], numPreciseIndices);
+		BS_TEST_ASSERT(preciseTriangles.numDegenerate == 0);
+		BS_TEST_ASSERT(preciseTriangles.numFlipped == 0);
+		BS_TEST_ASSERT(fabs(preciseTriangles.area - numQuads * numQuads) < 0.01f);
+
+		if (numCoarseIndices > 0)
+		{
+			SimplifiedTriangles coarseTriangles = checkSimplifiedTriangles(*meshData, &coarseOutput[0], numCoarseIndices);
+			BS_TEST_ASSERT(coarseTriangles.numDegenerate == 0);
+		}
+	}
+
+	void testMeshSimplifierSeam()
+	{
+		// Texture coordinate seam down the middle of a plane must stay in place
+		const UINT32 numQuads = 32;
+		MeshDataPtr meshData = createSimplifierTestGrid(numQuads, 0.0f, true);
+
+		UINT32 numIndices = meshData->getNumIndices();
+
+		Vector<UINT32> output;
+		UINT32 numOutputIndices = MeshSimplifier::simplify(*meshData, SubMesh(0, numIndices, DOT_TRIANGLE_LIST),
+			numIndices / 4, 0.0f, output);
+
+		BS_TEST_ASSERT(numOutputIndices > 0 && numOutputIndices <= numIndices / 4);
+		if (numOutputIndices == 0)
+			return;
+
+		SimplifiedTriangles triangles = checkSimplifiedTriangles(*meshData, &output[0], numOutputIndices);
+		BS_TEST_ASSERT(triangles.numDegenerate == 0);
+		BS_TEST_ASSERT(triangles.numFlipped == 0);
+		BS_TEST_ASSERT(triangles.numMixedSeam == 0);
+		BS_TEST_ASSERT(fabs(triangles.area - numQuads * numQuads) < 0.01f);
+		BS_TEST_ASSERT(fabs(triangles.seamLeftArea - numQuads * numQuads * 0.5f) < 0.01f);
+	}
+
+	void testMeshSimplifierLODs()
+	{
+		const UINT32 numQuads = 32;
+		MeshDataPtr meshData = createSimplifierTestGrid(numQuads, 2.0f, false);
+
+		// Two sub-meshes, bottom and top half of the grid
+		UINT32 numIndices = meshData->getNumIndices();
+		Vector<SubMesh> subMeshes;
+		subMeshes.push_back(SubMesh(0, numIndices / 2, DOT_TRIANGLE_LIST));
+		subMeshes.push_back(SubMesh(numIndices / 2, numIndices / 2, DOT_TRIANGLE_LIST));
+
+		Vector<SubMesh> lodSubMeshes;
+		Vector<float> lodScreenSizes;
+		MeshDataPtr lodMeshData = MeshSimplifier::generateLODs(meshData, subMeshes, 4, lodSubMeshes, lodScreenSizes);
+
+		BS_TEST_ASSERT(lodScreenSizes.size() > 0 && lodScreenSizes.size() <= 3);
+		BS_TEST_ASSERT(lodSubMeshes.size() == lodScreenSizes.size() * subMeshes.size());
+		BS_TEST_ASSERT(lodMeshData->getNumVertices() == meshData->getNumVertices());
+
+		// Original indices come first, unchanged
+		BS_TEST_ASSERT(memcmp(lodMeshData->getIndices32(), meshData->getIndices32(), numIndices * sizeof(UINT32)) == 0);
+
+		UINT32 prevIndexCount = numIndices;
+		float prevScreenSize = std::numeric_limits<float>::max();
+		for (UINT32 i = 0; i < (UINT32)lodScreenSizes.size(); i++)
+		{
+			UINT32 lodIndexCount = 0;
+			for (UINT32 j = 0; j < (UINT32)subMeshes.size(); j++)
+			{
+				const SubMesh& subMesh = lodSubMeshes[i * subMeshes.size() + j];
+
+				BS_TEST_ASSERT(subMesh.indexOffset >= numIndices);
+				BS_TEST_ASSERT(subMesh.indexOffset + subMesh.indexCount <= lodMeshData->getNumIndices());
+
+				SimplifiedTriangles triangles = checkSimplifiedTriangles(*lodMeshData,
+					lodMeshData->getIndices32() + subMesh.indexOffset, subMesh.indexCount);
+				BS_TEST_ASSERT(triangles.numDegenerate == 0);
+
+				// Vertices shared between the sub-meshes stay in place, so each half keeps its area
+				BS_TEST_ASSERT(fabs(triangles.area - numQuads * numQuads * 0.5f) < 0.01f);
+
+				lodIndexCount += subMesh.indexCount;
+			}
+
+			BS_TEST_ASSERT(lodIndexCount < prevIndexCount);
+			BS_TEST_ASSERT(lodScreenSizes[i] < prevScreenSize);
+
+			prevIndexCount = lodIndexCount;
+			prevScreenSize = lodScreenSizes[i];
+		}
+	}
+
+	void runMeshSimplifierTests()
+	{
+		TestRunner::run("Mesh simplifier plane", &testMeshSimplifierPlane);
+		TestRunner::run("Mesh simplifier max error", &testMeshSimplifierMaxError);
+		TestRunner::run("Mesh simplifier seam", &testMeshSimplifierSeam);
+		TestRunner::run("Mesh simplifier levels of detail", &testMeshSimplifierLODs);
+	}
+}
@@ -0,0 +1,164 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsPixelUtil.h"
+#include "BsPixelData.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Fills the pixel data with a pattern that exercises all byte values of every channel.
+	 */
+	void fillTestPixels(PixelData& pixelData)
+	{
+		UINT32 pixelSize = PixelUtil::getNumElemBytes(pixelData.getFormat());
+		UINT8* data = pixelData.getData();
+
+		for (UINT32 i = 0; i < pixelData.getWidth() * pixelData.getHeight(); i++)
+		{
+			UINT8 r = (UINT8)(i * 1);
+			UINT8 g = (UINT8)(i * 7 + 3);
+			UINT8 b = (UINT8)(i * 13 + 100);
+			UINT8 a = (UINT8)(255 - i);
+
+			PixelUtil::packColor(r, g, b, a, pixelData.getFormat(), data + i * pixelSize);
+		}
+	}
+
+	void testPixelConversionMatchesGeneric()
+	{
+		// All pairs of these go through either a specialized kernel or the generic path. The reference
+		// is always computed one pixel at a time through floats, same as the generic path.
+		PixelFormat formats[] = { PF_R8G8B8, PF_B8G8R8, PF_A8R8G8B8, PF_A8B8G8R8, PF_B8G8R8A8, PF_R8G8B8A8,
+			PF_FLOAT32_RGBA, PF_FLOAT32_RGB, PF_FLOAT16_RGBA, PF_FLOAT16_RGB, PF_FLOAT32_R, PF_FLOAT16_R };
+
+		// Odd width so vectorized kernels also need to handle the remainder
+		const UINT32 width = 37;
+		const UINT32 height = 9;
+
+		UINT32 numFormats = sizeof(formats) / sizeof(formats[0]);
+		for (UINT32 i = 0; i < numFormats; i++)
+		{
+			PixelData src(width, height, 1, formats[i]);
+			src.allocateInternalBuffer();
+			fillTestPixels(src);
+
+			UINT32 srcPixelSize = PixelUtil::getNumElemBytes(src.getFormat());
+			for (UINT32 j = 0; j < numFormats; j++)
+			{
+				PixelData dst(width, height, 1, formats[j]);
+				dst.allocateInternalBuffer();
+				PixelUtil::bulkPixelConversion(src, dst);
+
+				UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dst.getFormat());
+				bool isFloatDst = PixelUtil::isFloatingPoint(dst.getFormat());
+
+				bool matches = true;
+				for (UINT32 k = 0; k < width * height; k++)
+				{
+					float r, g, b, a;
+					PixelUtil::unpackColor(&r, &g, &b, &a, src.getFormat(), src.getData() + k * srcPixelSize);
+
+					UINT8 expected[16];
+					PixelUtil::packColor(r, g, b, a, dst.getFormat(), expected);
+
+					if (!isFloatDst)
+					{
+						matches &= memcmp(expected, dst.getData() + k * dstPixelSize, dstPixelSize) == 0;
+						continue;
+					}
+
+					// Hardware and software half conversion may round differently
+					float expectedColor[4];
+					float actualColor[4];
+					PixelUtil::unpackColor(&expectedColor[0], &expectedColor[1], &expectedColor[2], &expectedColor[3],
+						dst.getFormat(), expected);
+					PixelUtil::unpackColor(&actualColor[0], &actualColor[1], &actualColor[2], &actualColor[3],
+						dst.getFormat(), dst.getData() + k * dstPixelSize);
+
+					for (UINT32 l = 0; l < 4; l++)
+						matches &= fabs(expectedColor[l] - actualColor[l]) <= 0.001f;
+				}
+
+				if (!matches)
+				{
+					String conversion = PixelUtil::getFormatName(src.getFormat()) + " to " + PixelUtil::getFormatName(dst.getFormat());
+					TestRunner::check(false, conversion.c_str(), __FILE__, __LINE__);
+				}
+			}
+		}
+	}
+
+	void testPixelConversionSubVolume()
+	{
+		// Convert into the middle of a larger image stored in an X format, to make sure the box and pitch
+		// of the destination are respected when it gets aliased to its alpha counterpart
+		const UINT32 size = 8;
+		const UINT8 untouched = 0xAB;
+
+		PixelData src(4, 4, 1, PF_R8G8B8A8);
+		src.allocateInternalBuffer();
+		fillTestPixels(src);
+
+		Vector<UINT8> dstBuffer(size * size * 4, untouched);
+		PixelData dst(PixelVolume(2, 3, 0, 6, 7, 1), PF_X8R8G8B8);
+		dst.setRowPitch(size);
+		dst.setSlicePitch(size * size);
+		dst.setExternalBuffer(&dstBuffer[0]);
+
+		PixelUtil::bulkPixelConversion(src, dst);
+
+		bool matches = true;
+		for (UINT32 y = 0; y < size; y++)
+		{
+			for (UINT32 x = 0; x < size; x++)
+			{
+				const UINT8* dstPixel = &dstBuffer[(y * size + x) * 4];
+				bool inside = x >= 2 && x < 6 && y >= 3 && y < 7;
+
+				if (!inside)
+				{
+					matches &= dstPixel[0] == untouched && dstPixel[1] == untouched &&
+						dstPixel[2] == untouched && dstPixel[3] == untouched;
+					continue;
+				}
+
+				UINT8 srcR, srcG, srcB, srcA;
+				PixelUtil::unpackColor(&srcR, &srcG, &srcB, &srcA, PF_R8G8B8A8, src.getData() + ((y - 3) * 4 + (x - 2)) * 4);
+
+				UINT8 dstR, dstG, dstB, dstA;
+				PixelUtil::unpackColor(&dstR, &dstG, &dstB, &dstA, PF_X8R8G8B8, dstPixel);
+
+				matches &= srcR == dstR && srcG == dstG && srcB == dstB;
+			}
+		}
+
+		BS_TEST_ASSERT(matches);
+
+		// And back out of the sub-volume, with an X source format
+		PixelData roundTrip(4, 4, 1, PF_R8G8B8);
+		roundTrip.allocateInternalBuffer();
+		PixelUtil::bulkPixelConversion(dst, roundTrip);
+
+		matches = true;
+		for (UINT32 i = 0; i < 16; i++)
+		{
+			UINT8 srcR, srcG, srcB, srcA;
+			PixelUtil::unpackColor(&srcR, &srcG, &srcB, &srcA, PF_R8G8B8A8, src.getData() + i * 4);
+
+			UINT8 dstR, dstG, dstB, dstA;
+			PixelUtil::unpackColor(&dstR, &dstG, &dstB, &dstA, PF_R8G8B8, roundTrip.getData() + i * 3);
+
+			matches &= srcR == dstR && srcG == dstG && srcB == dstB;
+		}
+
+		BS_TEST_ASSERT(matches);
+	}
+
+	void runPixelConversionTests()
+	{
+		TestRunner::run("Pixel conversion matches generic path", &testPixelConversionMatchesGeneric);
+		TestRunner::run("Pixel conversion sub-volume", &testPixelConversionSubVolume);
+	}
+}
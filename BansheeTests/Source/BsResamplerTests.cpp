@@ -0,0 +1,295 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsPixelUtil.h"
+#include "BsPixelData.h"
+#include "BsColor.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Fills the pixel data with a pattern that varies in both directions.
+	 */
+	void fillResamplerTestPixels(PixelData& pixelData)
+	{
+		UINT32 pixelSize = PixelUtil::getNumElemBytes(pixelData.getFormat());
+		UINT32 width = pixelData.getWidth();
+		UINT32 height = pixelData.getHeight();
+
+		for (UINT32 y = 0; y < height; y++)
+		{
+			for (UINT32 x = 0; x < width; x++)
+			{
+				UINT8 r = (UINT8)(x * 255 / width);
+				UINT8 g = (UINT8)(y * 255 / height);
+				UINT8 b = (UINT8)((x * 37 + y * 91) % 256);
+				UINT8 a = (UINT8)(255 - (x + y) * 3);
+
+				PixelUtil::packColor(r, g, b, a, pixelData.getFormat(), pixelData.getData() + (y * width + x) * pixelSize);
+			}
+		}
+	}
+
+	/**
+	 * @brief	Checks that all the pixels in the pixel data have the specified color, within the provided tolerance.
+	 */
+	bool hasResamplerColor(const PixelData& pixelData, const Color& color, float tolerance)
+	{
+		UINT32 pixelSize = PixelUtil::getNumElemBytes(pixelData.getFormat());
+		bool hasAlpha = PixelUtil::hasAlpha(pixelData.getFormat());
+
+		bool matches = true;
+		for (UINT32 i = 0; i < pixelData.getWidth() * pixelData.getHeight(); i++)
+		{
+			float r, g, b, a;
+			PixelUtil::unpackColor(&r, &g, &b, &a, pixelData.getFormat(), pixelData.getData() + i * pixelSize);
+
+			matches &= fabs(r - color.r) <= tolerance && fabs(g - color.g) <= tolerance && fabs(b - color.b) <= tolerance;
+
+			if (hasAlpha)
+				matches &= fabs(a - color.a) <= tolerance;
+		}
+
+		return matches;
+	}
+
+	void testResamplerConstantColor()
+	{
+		// Weights are normalized, so no filter may change the color of a uniform image, including near the edges
+		// where some of the taps fall outside of the image
+		PixelFormat formats[] = { PF_R8G8B8A8, PF_R8G8B8, PF_FLOAT32_RGBA, PF_FLOAT16_RGBA };
+		PixelUtil::Filter filters[] = { PixelUtil::FILTER_BICUBIC, PixelUtil::FILTER_MITCHELL,
+			PixelUtil::FILTER_LANCZOS3, PixelUtil::FILTER_AREA };
+
+		UINT32 dstSizes[][2] = { { 64, 40 }, { 7, 5 }, { 23, 3 } };
+
+		Color color(0.2f, 0.6f, 0.8f, 0.4f);
+		for (auto& format : formats)
+		{
+			PixelData src(23, 17, 1, format);
+			src.allocateInternalBuffer();
+
+			UINT32 pixelSize = PixelUtil::getNumElemBytes(format);
+			for (UINT32 i = 0; i < src.getWidth() * src.getHeight(); i++)
+				PixelUtil::packColor(color, format, src.getData() + i * pixelSize);
+
+			// Read back the stored color, as byte formats can't represent it exactly
+			Color storedColor;
+			PixelUtil::unpackColor(&storedColor, format, src.getData());
+
+			for (auto& filter : filters)
+			{
+				for (auto& dstSize : dstSizes)
+				{
+					PixelData dst(dstSize[0], dstSize[1], 1, format);
+					dst.allocateInternalBuffer();
+					PixelUtil::scale(src, dst, filter);
+
+					if (!hasResamplerColor(dst, storedColor, 0.001f))
+					{
+						String test = PixelUtil::getFormatName(format) + " filter " + toString((UINT32)filter) +
+							" to " + toString(dstSize[0]) + "x" + toString(dstSize[1]);
+						TestRunner::check(false, test.c_str(), __FILE__, __LINE__);
+					}
+				}
+			}
+		}
+	}
+
+	void testResamplerIdentity()
+	{
+		// Interpolating filters evaluate to one at the pixel center and zero at its neighbors, so scaling to
+		// the same size must not change the image
+		PixelUtil::Filter filters[] = { PixelUtil::FILTER_BICUBIC, PixelUtil::FILTER_LANCZOS3, PixelUtil::FILTER_AREA };
+
+		PixelData src(19, 11, 1, PF_R8G8B8A8);
+		src.allocateInternalBuffer();
+		fillResamplerTestPixels(src);
+
+		for (auto& filter : filters)
+		{
+			PixelData dst(19, 11, 1, PF_R8G8B8A8);
+			dst.allocateInternalBuffer();
+			PixelUtil::scale(src, dst, filter);
+
+			BS_TEST_ASSERT(memcmp(src.getData(), dst.getData(), src.getConsecutiveSize()) == 0);
+		}
+	}
+
+	void testResamplerAreaDownscale()
+	{
+		// Halving the size with the area filter averages each 2x2 block of source pixels
+		const UINT32 width = 16;
+		const UINT32 height = 12;
+
+		PixelFormat formats[] = { PF_R8G8B8A8, PF_FLOAT32_RGBA };
+		for (auto& format : formats)
+		{
+			PixelData src(width, height, 1, format);
+			src.allocateInternalBuffer();
+			fillResamplerTestPixels(src);
+
+			PixelData dst(width / 2, height / 2, 1, format);
+			dst.allocateInternalBuffer();
+			PixelUtil::scale(src, dst, PixelUtil::FILTER_AREA);
+
+			// Bytes are rounded after each pass
+			float tolerance = PixelUtil::isFloatingPoint(format) ? 0.0001f : 1.0f / 255.0f + 0.0001f;
+			UINT32 pixelSize = PixelUtil::getNumElemBytes(format);
+
+			bool matches = true;
+			for (UINT32 y = 0; y < height / 2; y++)
+			{
+				for (UINT32 x = 0; x < width / 2; x++)
+				{
+					Color expected(0.0f, 0.0f, 0.0f, 0.0f);
+					for (UINT32 i = 0; i < 4; i++)
+					{
+						UINT32 srcX = x * 2 + (i % 2);
+						UINT32 srcY = y * 2 + (i / 2);
+
+						Color srcColor;
+						PixelUtil::unpackColor(&srcColor, format, src.getData() + (srcY * width + srcX) * pixelSize);
+						expected += srcColor * 0.25f;
+					}
+
+					Color actual;
+					PixelUtil::unpackColor(&actual, format, dst.getData() + (y * (width / 2) + x) * pixelSize);
+
+					matches &= fabs(expected.r - actual.r) <= tolerance && fabs(expected.g - actual.g) <= tolerance &&
+						fabs(expected.b - actual.b) <= tolerance && fabs(expected.a - actual.a) <= tolerance;
+				}
+			}
+
+			BS_TEST_ASSERT(matches);
+		}
+	}
+
+	void testResamplerLinearGradient()
+	{
+		// Both cubic filters reproduce linear functions exactly, away from the image edges
+		const UINT32 srcWidth = 16;
+		const UINT32 dstWidth = 64;
+		const UINT32 height = 4;
+
+		PixelData src(srcWidth, height, 1, PF_FLOAT32_RGBA);
+		src.allocateInternalBuffer();
+
+		float* srcData = (float*)src.getData();
+		for (UINT32 y = 0; y < height; y++)
+		{
+			for (UINT32 x = 0; x < srcWidth; x++)
+			{
+				float* pixel = srcData + (y * srcWidth + x) * 4;
+				pixel[0] = x / (float)(srcWidth - 1);
+				pixel[1] = 1.0f - pixel[0];
+				pixel[2] = 0.5f;
+				pixel[3] = 1.0f;
+			}
+		}
+
+		PixelUtil::Filter filters[] = { PixelUtil::FILTER_BICUBIC, PixelUtil::FILTER_MITCHELL };
+		for (auto& filter : filters)
+		{
+			PixelData dst(dstWidth, height, 1, PF_FLOAT32_RGBA);
+			dst.allocateInternalBuffer();
+			PixelUtil::scale(src, dst, filter);
+
+			float scale = srcWidth / (float)dstWidth;
+			const float* dstData = (const float*)dst.getData();
+
+			bool matches = true;
+			for (UINT32 y = 0; y < height; y++)
+			{
+				// Skip destination pixels whose filter reaches past the source edges
+				for (UINT32 x = 12; x < dstWidth - 12; x++)
+				{
+					float srcX = (x + 0.5f) * scale - 0.5f;
+					float expected = srcX / (float)(srcWidth - 1);
+
+					const float* pixel = dstData + (y * dstWidth + x) * 4;
+					matches &= fabs(pixel[0] - expected) < 0.001f && fabs(pixel[1] - (1.0f - expected)) < 0.001f;
+					matches &= fabs(pixel[2] - 0.5f) < 0.001f && fabs(pixel[3] - 1.0f) < 0.001f;
+				}
+			}
+
+			BS_TEST_ASSERT(matches);
+		}
+	}
+
+	void testResamplerSubVolume()
+	{
+		// Scale from the middle of one buffer into the middle of another. Pixels outside of the source box
+		// have a different color and must not bleed in, and pixels outside of the destination box must stay intact.
+		const UINT32 srcSize = 12;
+		const UINT32 dstSize = 16;
+		const UINT8 untouched = 0xAB;
+
+		Vector<UINT8> srcBuffer(srcSize * srcSize * 4);
+		for (UINT32 y = 0; y < srcSize; y++)
+		{
+			for (UINT32 x = 0; x < srcSize; x++)
+			{
+				bool inside = x >= 2 && x < 10 && y >= 2 && y < 10;
+				UINT8* pixel = &srcBuffer[(y * srcSize + x) * 4];
+
+				if (inside)
+					PixelUtil::packColor((UINT8)40, (UINT8)120, (UINT8)200, (UINT8)255, PF_R8G8B8A8, pixel);
+				else
+					PixelUtil::packColor((UINT8)255, (UINT8)0, (UINT8)0, (UINT8)0, PF_R8G8B8A8, pixel);
+			}
+		}
+
+		PixelData src(PixelVolume(2, 2, 0, 10, 10, 1), PF_R8G8B8A8);
+		src.setRowPitch(srcSize);
+		src.setSlicePitch(srcSize * srcSize);
+		src.setExternalBuffer(&srcBuffer[0]);
+
+		// Same format is resampled in place, different format through a temporary buffer
+		PixelFormat dstFormats[] = { PF_R8G8B8A8, PF_B8G8R8A8 };
+		for (auto& dstFormat : dstFormats)
+		{
+			Vector<UINT8> dstBuffer(dstSize * dstSize * 4, untouched);
+			PixelData dst(PixelVolume(3, 4, 0, 13, 12, 1), dstFormat);
+			dst.setRowPitch(dstSize);
+			dst.setSlicePitch(dstSize * dstSize);
+			dst.setExternalBuffer(&dstBuffer[0]);
+
+			PixelUtil::scale(src, dst, PixelUtil::FILTER_LANCZOS3);
+
+			bool matches = true;
+			for (UINT32 y = 0; y < dstSize; y++)
+			{
+				for (UINT32 x = 0; x < dstSize; x++)
+				{
+					const UINT8* dstPixel = &dstBuffer[(y * dstSize + x) * 4];
+					bool inside = x >= 3 && x < 13 && y >= 4 && y < 12;
+
+					if (!inside)
+					{
+						matches &= dstPixel[0] == untouched && dstPixel[1] == untouched &&
+							dstPixel[2] == untouched && dstPixel[3] == untouched;
+						continue;
+					}
+
+					UINT8 r, g, b, a;
+					PixelUtil::unpackColor(&r, &g, &b, &a, dstFormat, dstPixel);
+
+					matches &= r == 40 && g == 120 && b == 200 && a == 255;
+				}
+			}
+
+			BS_TEST_ASSERT(matches);
+		}
+	}
+
+	void runResamplerTests()
+	{
+		TestRunner::run("Resampler constant color", &testResamplerConstantColor);
+		TestRunner::run("Resampler identity", &testResamplerIdentity);
+		TestRunner::run("Resampler area downscale", &testResamplerAreaDownscale);
+		TestRunner::run("Resampler linear gradient", &testResamplerLinearGradient);
+		TestRunner::run("Resampler sub-volume", &testResamplerSubVolume);
+	}
+}
@@ -0,0 +1,37 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+
+#include <iostream>
+
+namespace BansheeEngine
+{
+	UINT32 TestRunner::mNumTests = 0;
+	UINT32 TestRunner::mNumFailedTests = 0;
+	UINT32 TestRunner::mNumFailedChecks = 0;
+
+	void TestRunner::run(const char* name, TestFunc test)
+	{
+		mNumFailedChecks = 0;
+		test();
+
+		mNumTests++;
+		if (mNumFailedChecks > 0)
+		{
+			mNumFailedTests++;
+			std::cout << "[FAILED] " << name << std::endl;
+		}
+		else
+			std::cout << "[OK]     " << name << std::endl;
+	}
+
+	void TestRunner::check(bool passed, const char* expr, const char* file, int line)
+	{
+		if (passed)
+			return;
+
+		mNumFailedChecks++;
+		std::cout << "  " << file << "(" << line << "): check failed: " << expr << std::endl;
+	}
+}
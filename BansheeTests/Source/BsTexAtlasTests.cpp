@@ -0,0 +1,206 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsTexAtlasPacker.h"
+#include "BsTexAtlasGenerator.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Keeps track of which pixels of an atlas are in use, in order to detect overlapping rectangles.
+	 */
+	class AtlasCoverage
+	{
+	public:
+		AtlasCoverage(UINT32 width, UINT32 height)
+			:mWidth(width), mHeight(height), mPixels(width * height, 0)
+		{ }
+
+		/**
+		 * @brief	Marks the rectangle as used. Returns false if it is out of bounds or overlaps a used area.
+		 */
+		bool add(UINT32 x, UINT32 y, UINT32 width, UINT32 height)
+		{
+			if ((x + width) > mWidth || (y + height) > mHeight)
+				return false;
+
+			bool overlaps = false;
+			for (UINT32 row = y; row < y + height; row++)
+			{
+				for (UINT32 column = x; column < x + width; column++)
+				{
+					UINT8& pixel = mPixels[row * mWidth + column];
+					overlaps |= pixel != 0;
+					pixel = 1;
+				}
+			}
+
+			return !overlaps;
+		}
+
+		/**
+		 * @brief	Marks the rectangle as unused.
+		 */
+		void remove(UINT32 x, UINT32 y, UINT32 width, UINT32 height)
+		{
+			for (UINT32 row = y; row < y + height; row++)
+				memset(&mPixels[row * mWidth + x], 0, width);
+		}
+
+	private:
+		UINT32 mWidth;
+		UINT32 mHeight;
+		Vector<UINT8> mPixels;
+	};
+
+	/**
+	 * @brief	Rectangle placed by a packer during a test.
+	 */
+	struct PackedRect
+	{
+		UINT32 x, y, width, height;
+	};
+
+	/**
+	 * @brief	Inserts pseudo-random rectangles until the packer fills up, removes every other one and fills
+	 *			the freed space again, validating placement and occupancy along the way.
+	 *
+	 * @return	Occupancy after the initial fill.
+	 */
+	float testPacker(TexAtlasPacker& packer)
+	{
+		UINT32 width = packer.getWidth();
+		UINT32 height = packer.getHeight();
+
+		AtlasCoverage coverage(width, height);
+		Vector<PackedRect> rects;
+		UINT64 usedArea = 0;
+
+		UINT32 seed = 1;
+		auto random = [&](UINT32 min, UINT32 max)
+		{
+			seed = seed * 1103515245 + 12345;
+			return min + (seed >> 16) % (max - min + 1);
+		};
+
+		UINT32 numFailed = 0;
+		while (numFailed < 20)
+		{
+			PackedRect rect;
+			rect.width = random(2, 24);
+			rect.height = random(2, 24);
+
+			if (!packer.insert(rect.width, rect.height, rect.x, rect.y))
+			{
+				numFailed++;
+				continue;
+			}
+
+			BS_TEST_ASSERT(coverage.add(rect.x, rect.y, rect.width, rect.height));
+
+			rects.push_back(rect);
+			usedArea += rect.width * rect.height;
+		}
+
+		float occupancy = packer.getOccupancy();
+		BS_TEST_ASSERT(fabs(occupancy - usedArea / (float)(width * height)) < 0.0001f);
+
+		for (UINT32 i = 0; i < (UINT32)rects.size(); i += 2)
+		{
+			const PackedRect& rect = rects[i];
+
+			packer.remove(rect.x, rect.y, rect.width, rect.height);
+			coverage.remove(rect.x, rect.y, rect.width, rect.height);
+			usedArea -= rect.width * rect.height;
+		}
+
+		BS_TEST_ASSERT(fabs(packer.getOccupancy() - usedArea / (float)(width * height)) < 0.0001f);
+
+		// Freed space must be usable by rectangles of the same size
+		UINT32 numReinserted = 0;
+		for (UINT32 i = 0; i < (UINT32)rects.size(); i += 2)
+		{
+			PackedRect rect = rects[i];
+			if (!packer.insert(rect.width, rect.height, rect.x, rect.y))
+				continue;
+
+			BS_TEST_ASSERT(coverage.add(rect.x, rect.y, rect.width, rect.height));
+			numReinserted++;
+		}
+
+		BS_TEST_ASSERT(numReinserted > 0);
+
+		// Doesn't fit
+		UINT32 x, y;
+		BS_TEST_ASSERT(!packer.insert(width + 1, 1, x, y));
+		BS_TEST_ASSERT(!packer.insert(1, height + 1, x, y));
+
+		// Clear and fill the whole area with a single rectangle
+		packer.clear(width, height);
+		BS_TEST_ASSERT(packer.getOccupancy() == 0.0f);
+		BS_TEST_ASSERT(packer.insert(width, height, x, y));
+		BS_TEST_ASSERT(x == 0 && y == 0);
+		BS_TEST_ASSERT(packer.getOccupancy() == 1.0f);
+		BS_TEST_ASSERT(!packer.insert(1, 1, x, y));
+
+		return occupancy;
+	}
+
+	void testSkylinePacker()
+	{
+		TexAtlasSkylinePacker packer(256, 256);
+		float occupancy = testPacker(packer);
+
+		BS_TEST_ASSERT(occupancy > 0.8f);
+	}
+
+	void testMaxRectsPacker()
+	{
+		TexAtlasMaxRectsPacker packer(256, 256);
+		float occupancy = testPacker(packer);
+
+		BS_TEST_ASSERT(occupancy > 0.9f);
+	}
+
+	void testAtlasGenerator()
+	{
+		Vector<TexAtlasElementDesc> elements;
+		for (UINT32 i = 0; i < 300; i++)
+		{
+			TexAtlasElementDesc element;
+			element.input.width = 8 + (i * 7) % 57;
+			element.input.height = 8 + (i * 13) % 41;
+
+			elements.push_back(element);
+		}
+
+		TexAtlasGenerator generator(false, 512, 512);
+		Vector<TexAtlasPageDesc> pages = generator.createAtlasLayout(elements);
+		BS_TEST_ASSERT(pages.size() > 0);
+
+		Vector<AtlasCoverage> coverage;
+		for (auto& page : pages)
+		{
+			BS_TEST_ASSERT(page.width <= 512 && page.height <= 512);
+			coverage.push_back(AtlasCoverage(page.width, page.height));
+		}
+
+		for (auto& element : elements)
+		{
+			BS_TEST_ASSERT(element.output.page >= 0 && element.output.page < (INT32)pages.size());
+			if (element.output.page < 0 || element.output.page >= (INT32)pages.size())
+				continue;
+
+			BS_TEST_ASSERT(coverage[element.output.page].add(element.output.x, element.output.y,
+				element.input.width, element.input.height));
+		}
+	}
+
+	void runTexAtlasTests()
+	{
+		TestRunner::run("Skyline atlas packer", &testSkylinePacker);
+		TestRunner::run("MaxRects atlas packer", &testMaxRectsPacker);
+		TestRunner::run("Atlas generator", &testAtlasGenerator);
+	}
+}
@@ -0,0 +1,37 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTestPrerequisites.h"
+#include "BsMemStack.h"
+
+#include <iostream>
+
+using namespace BansheeEngine;
+
+int main(int argc, char* argv[])
+{
+	MemStack::beginThread();
+
+	runGuidTests();
+	runCompressionTests();
+	runFontTests();
+	runTexAtlasTests();
+	runGameObjectTests();
+	runComponentTests();
+	runPixelConversionTests();
+	runBlockCompressionTests();
+	runResamplerTests();
+	runImporterTests();
+	runFrameAllocTests();
+	runMeshDataTests();
+	runMeshOptimizerTests();
+	runMeshSimplifierTests();
+	runMeshQuantizerTests();
+
+	MemStack::endThread();
+
+	std::cout << std::endl << TestRunner::getNumTests() - TestRunner::getNumFailedTests() << "/"
+		<< TestRunner::getNumTests() << " tests passed." << std::endl;
+
+	return TestRunner::getNumFailedTests() > 0 ? 1 : 0;
+}
@@ -0,0 +1,49 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Lossless compression of raw memory buffers using a fast LZ77 style codec.
+	 *			Favors decompression speed over compression ratio.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT Compression
+	{
+	public:
+		/**
+		 * @brief	Returns the maximum number of bytes compressing a buffer of the
+		 *			provided size may output.
+		 */
+		static UINT32 getMaxCompressedSize(UINT32 srcSize);
+
+		/**
+		 * @brief	Compresses the source buffer into the destination buffer.
+		 *
+		 * @param	src			Data to compress.
+		 * @param	srcSize		Size of the data to compress, in bytes.
+		 * @param	dst			Buffer to write the compressed data to. Must be at least
+		 *						::getMaxCompressedSize bytes large.
+		 *
+		 * @return	Number of bytes written to the destination buffer.
+		 */
+		static UINT32 compress(const UINT8* src, UINT32 srcSize, UINT8* dst);
+
+		/**
+		 * @brief	Decompresses data previously compressed with ::compress.
+		 *
+		 * @param	src			Compressed data.
+		 * @param	srcSize		Size of the compressed data, in bytes.
+		 * @param	dst			Buffer to write the decompressed data to.
+		 * @param	dstSize		Exact size of the decompressed data, in bytes.
+		 *
+		 * @return	True if decompression succeeded, false if the compressed data is corrupt.
+		 */
+		static bool decompress(const UINT8* src, UINT32 srcSize, UINT8* dst, UINT32 dstSize);
+	};
+}
@@ -16,6 +16,8 @@ namespace BansheeEngine
 	class BS_UTILITY_EXPORT Debug
 	{
 	public:
+		Debug();
+
 		/**
 		 * @brief	Adds a log entry in the "Debug" channel.
 		 */
@@ -32,7 +34,8 @@ namespace BansheeEngine
 		void logWarning(const String& msg);
 
 		/**
-		 * @brief	Adds a log entry in the "Error" channel.
+		 * @brief	Adds a log entry in the "Error" channel. The entry is output to all log sinks before
+		 *			the method returns.
 		 */
 		void logError(const String& msg);
 
@@ -44,6 +44,8 @@ namespace BansheeEngine
 	class DataStream;
 	class MemoryDataStream;
 	class FileDataStream;
+	class MappedFile;
+	class LogSink;
 	class MeshData;
 	class FileSystem;
 	class Timer;
@@ -65,6 +67,8 @@ namespace BansheeEngine
 	typedef std::shared_ptr<DataStream> DataStreamPtr;
 	typedef std::shared_ptr<MemoryDataStream> MemoryDataStreamPtr;
 	typedef std::shared_ptr<FileDataStream> FileDataStreamPtr;
+	typedef std::shared_ptr<MappedFile> MappedFilePtr;
+	typedef std::shared_ptr<LogSink> LogSinkPtr;
 	typedef std::shared_ptr<MeshData> MeshDataPtr;
 	typedef std::shared_ptr<PixelData> PixelDataPtr;
 	typedef std::shared_ptr<GpuResourceData> GpuResourceDataPtr;
@@ -16,6 +16,9 @@ namespace BansheeEngine
 	 *			doesn't exist then the identifier is used as is.
 	 *			
 	 *			Use {0}, {1}, etc. in the string value for values that might change dynamically.
+	 *
+	 *			String value is retrieved from the string table lazily, and retrieved again only if the string
+	 *			table version changed in the meantime (see StringTable::getVersion).
 	 */
 	class BS_UTILITY_EXPORT HString
 	{
@@ -31,15 +34,22 @@ namespace BansheeEngine
 		private:
 			friend class HString;
 
-			LocalizedStringData* mStringData;
+			UINT32 mStringId;
 			WString* mParameters;
-			HEvent mUpdateConn;
+			UINT32 mNumParameters;
+
+			mutable LocalizedStringData* mStringData;
+			mutable UINT32 mVersion;
 
 			mutable bool mIsDirty;
 			mutable WString mCachedString;
 			mutable WString* mStringPtr;
 
-			void updateString();
+			/**
+			 * @brief	Retrieves the string data from the string table again if the table was modified since the
+			 *			data was last retrieved.
+			 */
+			void updateStringData() const;
 		};
 
 		/**
@@ -55,6 +65,12 @@ namespace BansheeEngine
 		*/
 		explicit HString(const WString& identifierString, const WString& englishString);
 
+		/**
+		 * @brief	Creates a new localized string from a string ID previously returned by StringTable::getStringId.
+		 *			Faster than creating the string from the identifier as no identifier lookup is required.
+		 */
+		explicit HString(UINT32 stringId);
+
 		HString();
 		HString(const HString& copy);
 		~HString();
@@ -62,17 +78,44 @@ namespace BansheeEngine
 		operator const WString& () const;
 		const WString& getValue() const;
 
+		/**
+		 * @brief	Writes the string value with all parameters applied into the provided buffer. Unlike
+		 *			getValue this doesn't build or cache a copy of the string, which makes it preferable for
+		 *			strings whose parameters change every frame. Output is not null terminated.
+		 *
+		 * @param	buffer			Buffer to write the characters to. 
+		 * @param	bufferLength	Maximum number of characters to write. Use getLength to find out how many
+		 *							characters are needed. Output is truncated if the buffer is too small.
+		 *
+		 * @return	Number of characters written.
+		 */
+		UINT32 getValue(wchar_t* buffer, UINT32 bufferLength) const;
+
+		/**
+		 * @brief	Returns the number of characters in the string value, with all parameters applied.
+		 */
+		UINT32 getLength() const;
+
+		/**
+		 * @brief	Returns the ID of the string in the string table.
+		 */
+		UINT32 getStringId() const { return mData->mStringId; }
+
 		/**
 		 * @brief	Sets a value of a string parameter. Parameters are specified as bracketed values
 		 * 			within the string itself (e.g. {0}, {1}) etc.
 		 *
 		 * @note	Useful for strings that have dynamically changing values, like numbers, embedded in them.
+		 *			Setting a parameter to the value it already has doesn't modify the string.
 		 */
 		void setParameter(UINT32 idx, const WString& value);
 		
 		/**
-		 * @brief	Registers a callback that gets triggered whenever string value changes. This may happen
-		 * 			when the string table is modified, or when the active language is changed.
+		 * @brief	Registers a callback that gets triggered whenever string value changes due to a 
+		 *			parameter change.
+		 *
+		 * @note	Changes to the string table (e.g. active language change) don't trigger the callback.
+		 *			Check StringTable::getVersion to detect those instead.
 		 */
 		HEvent addOnStringModifiedCallback(std::function<void()> callback) const;
 
@@ -81,6 +124,11 @@ namespace BansheeEngine
 		 */
 		static const HString& dummy();
 	private:
+		/**
+		 * @brief	Initializes string data for the string with the specified ID.
+		 */
+		void initialize(UINT32 stringId);
+
 		std::shared_ptr<StringData> mData;
 	};
 }
\ No newline at end of file
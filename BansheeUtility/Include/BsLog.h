@@ -15,24 +15,79 @@ namespace BansheeEngine
 	class BS_UTILITY_EXPORT LogEntry
 	{
 	public:
+		LogEntry() {}
 		LogEntry(const String& msg, const String& channel);
 
-		const String& getChannel(void) { return mChannel; }
-		const String& getMessage(void) { return mMsg; }
+		const String& getChannel(void) const { return mChannel; }
+		const String& getMessage(void) const { return mMsg; }
 
 	private:
 		String mMsg;
 		String mChannel;
 	};
 
+	/**
+	 * @brief	Receives processed log entries and outputs them somewhere (e.g. a file or a console).
+	 *
+	 * @note	Calls to a single sink are never concurrent, but they might happen on the log worker thread.
+	 */
+	class BS_UTILITY_EXPORT LogSink
+	{
+	public:
+		virtual ~LogSink() {}
+
+		/**
+		 * @brief	Outputs a single log entry.
+		 */
+		virtual void write(const LogEntry& entry) = 0;
+
+		/**
+		 * @brief	Called after a batch of entries was written.
+		 */
+		virtual void flush() { }
+	};
+
+	/**
+	 * @brief	Log sink that appends all entries to a text file.
+	 */
+	class BS_UTILITY_EXPORT FileLogSink : public LogSink
+	{
+	public:
+		/**
+		 * @brief	Creates the sink and opens the file. Any existing file at the path is overwritten.
+		 */
+		FileLogSink(const Path& path);
+		~FileLogSink();
+
+		/**
+		 * @copydoc	LogSink::write
+		 */
+		virtual void write(const LogEntry& entry);
+
+	private:
+		DataStreamPtr mStream;
+	};
+
 	/**
 	 * @brief	Used for logging messages. Can categorize messages according to channels, save the log to a file
 	 * 			and send out callbacks when a new message is added.
+	 *
+	 *			Logging only records the message in a buffer local to the calling thread, without taking any locks.
+	 *			Entries are processed (forwarded to sinks, stored in history and reported through ::onEntryAdded)
+	 *			on a separate worker thread, if one was started. Otherwise they are processed immediately
+	 *			on the logging thread. Messages are never dropped: if the buffer of the calling thread is full,
+	 *			or the message is logged with immediate processing requested, it is processed on the logging
+	 *			thread instead, together with all messages logged before it.
+	 *
+	 *			Consecutive identical messages are collapsed into a single entry followed by a repeat count, and
+	 *			only a limited number of most recent entries is retained.
 	 * 			
 	 * @note	Thread safe.
 	 */
 	class BS_UTILITY_EXPORT Log
 	{
+		struct ThreadBuffer;
+
 	public:
 		Log();
 		~Log();
@@ -40,10 +95,18 @@ namespace BansheeEngine
 		/**
 		 * @brief	Logs a new message. 
 		 *
-		 * @param	message	The message describing the log entry.
-		 * @param	channel Channel in which to store the log entry.
+		 * @param	message		The message describing the log entry.
+		 * @param	channel		Channel in which to store the log entry.
+		 * @param	immediate	If true the message, and all messages logged before it, are processed and all sinks
+		 *						flushed before the method returns. Use for messages that must reach the sinks even
+		 *						if the application terminates right after, like errors.
 		 */
-		void logMsg(const String& message, const String& channel);
+		void logMsg(const String& message, const String& channel, bool immediate = false);
+
+		/**
+		 * @brief	Processes all messages logged so far and flushes all sinks. Blocks until done.
+		 */
+		void flush();
 
 		/**
 		 * @brief	Removes all log entries. 
@@ -51,19 +114,134 @@ namespace BansheeEngine
 		void clear();
 
 		/**
-		 * @brief	Saves the log file to disk.
+		 * @brief	Saves the retained log entries to a text file on disk.
 		 */
 		void saveToFile(const WString& path);
 
+		/**
+		 * @brief	Returns a copy of all retained log entries, from oldest to newest.
+		 */
+		Vector<LogEntry> getEntries() const;
+
+		/**
+		 * @brief	Sets the maximum number of entries retained in history. Oldest entries are
+		 *			discarded when the limit is reached.
+		 */
+		void setMaxEntries(UINT32 maxEntries);
+
+		/**
+		 * @brief	Returns the maximum number of entries retained in history.
+		 */
+		UINT32 getMaxEntries() const;
+
+		/**
+		 * @brief	Registers a sink that will receive all processed log entries.
+		 */
+		void addSink(const LogSinkPtr& sink);
+
+		/**
+		 * @brief	Unregisters a sink previously registered with ::addSink.
+		 */
+		void removeSink(const LogSinkPtr& sink);
+
+		/**
+		 * @brief	Starts the worker thread that processes logged messages. Until it is started
+		 *			messages are processed on the thread that logs them.
+		 *
+		 * @note	Internal method.
+		 */
+		void _startWorker();
+
+		/**
+		 * @brief	Processes any outstanding messages and stops the worker thread.
+		 *
+		 * @note	Internal method.
+		 */
+		void _stopWorker();
+
+		/**
+		 * @brief	Releases the message buffer of the calling thread. Any messages still in it are processed
+		 *			and the buffer is freed the next time messages are processed. Must be called before a
+		 *			thread that logged messages exits, otherwise its buffer is only freed when the log is destroyed.
+		 *
+		 * @note	Internal method.
+		 */
+		static void _endThread();
+
 	private:
-		Vector<LogEntry*> mEntries;
-		BS_RECURSIVE_MUTEX(mMutex);
+		/**
+		 * @brief	Returns the message buffer of the calling thread, creating it if needed.
+		 */
+		ThreadBuffer* getThreadBuffer();
+
+		/**
+		 * @brief	Marks a thread buffer as no longer used by its thread, so it may be freed once emptied.
+		 */
+		void releaseThreadBuffer(ThreadBuffer* buffer);
+
+		/**
+		 * @brief	Moves all messages from thread buffers, and processes them in the order they were logged.
+		 *			Frees buffers of threads that ended.
+		 *
+		 * @note	Caller must hold ::mProcessMutex.
+		 */
+		void processPending();
+
+		/**
+		 * @brief	Processes a single entry, collapsing it if it's a repeat of the previous one.
+		 *
+		 * @note	Caller must hold ::mProcessMutex.
+		 */
+		void processEntry(const LogEntry& entry);
+
+		/**
+		 * @brief	Outputs the repeat count of the last entry, if it was repeated.
+		 *
+		 * @note	Caller must hold ::mProcessMutex.
+		 */
+		void flushRepeats();
+
+		/**
+		 * @brief	Stores the entry in history and sends it to all sinks and listeners.
+		 *
+		 * @note	Caller must hold ::mProcessMutex.
+		 */
+		void outputEntry(const LogEntry& entry);
+
+		/**
+		 * @brief	Main function of the worker thread.
+		 */
+		void workerMain();
 
 		/**
 		 * @brief	Called whenever a new entry is added.
 		 */
 		void doOnEntryAdded(const LogEntry& entry);
 
+		static const UINT32 WORKER_INTERVAL_MS;
+
+		static BS_THREADLOCAL ThreadBuffer* CurrentThreadBuffer;
+		static BS_THREADLOCAL Log* CurrentThreadBufferOwner;
+
+		Vector<ThreadBuffer*> mThreadBuffers;
+		BS_MUTEX(mThreadBuffersMutex);
+
+		std::atomic<UINT64> mNextSequence;
+
+		Deque<LogEntry> mEntries;
+		UINT32 mMaxEntries;
+		Vector<LogSinkPtr> mSinks;
+		BS_RECURSIVE_MUTEX(mProcessMutex);
+
+		LogEntry mLastEntry;
+		UINT32 mNumRepeats;
+		bool mHasLastEntry;
+
+		BS_THREAD_TYPE* mWorkerThread;
+		std::atomic<bool> mWorkerRunning;
+		BS_MUTEX(mWorkerMutex);
+		BS_THREAD_SYNCHRONISER(mWorkerSignal);
+
 		/************************************************************************/
 		/* 								SIGNALS		                     		*/
 		/************************************************************************/
@@ -71,7 +249,7 @@ namespace BansheeEngine
 		/**
 		 * @brief	Triggered when a new entry in the log is added.
 		 * 			
-		 * @note	
+		 * @note	Triggered on the log worker thread if it is running.
 		 */
 		Event<void(const LogEntry&)> onEntryAdded;
 	};
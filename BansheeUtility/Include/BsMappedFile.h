@@ -0,0 +1,57 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Read-only view of a file mapped into the process address space. Contents
+	 *			are paged in by the OS on first access, so opening a file is cheap regardless
+	 *			of its size.
+	 *
+	 *			If the file cannot be mapped, for example when a 32-bit process runs out of address space,
+	 *			its contents are read into memory instead and the class behaves the same otherwise.
+	 *
+	 * @note	Thread safe. Mapped memory may be read from any number of threads at once.
+	 *			Only implemented for Windows (Source/Win32), like the rest of the platform specific code.
+	 */
+	class BS_UTILITY_EXPORT MappedFile
+	{
+	public:
+		/**
+		 * @brief	Maps the file at the specified path. Throws an exception if the file
+		 *			cannot be opened.
+		 */
+		MappedFile(const Path& fullPath);
+		~MappedFile();
+
+		/**
+		 * @brief	Returns a pointer to the start of the mapped file contents. Null if the file is empty.
+		 */
+		const UINT8* getData() const { return mData; }
+
+		/**
+		 * @brief	Returns the size of the mapped file, in bytes.
+		 */
+		UINT64 getSize() const { return mSize; }
+
+		/**
+		 * @brief	Returns true if the file is mapped, or false if its contents were read into memory
+		 *			because mapping failed.
+		 */
+		bool isMapped() const { return mIsMapped; }
+
+	private:
+		MappedFile(const MappedFile& other);
+		MappedFile& operator=(const MappedFile& other);
+
+		void* mFileHandle;
+		void* mMappingHandle;
+		const UINT8* mData;
+		UINT64 mSize;
+		bool mIsMapped;
+	};
+}
@@ -208,12 +208,6 @@ namespace BansheeEngine
 	 */
 	struct LocalizedStringData
 	{
-		struct Common
-		{
-			WString identifier;
-			Event<void()> onStringDataModified;
-		};
-
 		struct ParamOffset
 		{
 			ParamOffset()
@@ -235,9 +229,22 @@ namespace BansheeEngine
 		UINT32 numParameters;
 		ParamOffset* parameterOffsets; 
 
-		Common* commonData;
+		UINT32 id;
+
+		/**
+		 * @brief	Returns the number of characters in the string after the provided parameters are inserted.
+		 */
+		UINT32 getLength(const WString* parameters, UINT32 numParameterValues) const;
 
-		void concatenateString(WString& outputString, WString* parameters, UINT32 numParameterValues) const;
+		/**
+		 * @brief	Inserts the provided parameters into the string and writes the result into a caller provided 
+		 *			buffer. Output is truncated if the buffer is too small, and is not null terminated.
+		 *
+		 * @return	Number of characters written to the buffer.
+		 */
+		UINT32 concatenateString(wchar_t* output, UINT32 outputLength, const WString* parameters, UINT32 numParameterValues) const;
+
+		void concatenateString(WString& outputString, const WString* parameters, UINT32 numParameterValues) const;
 		void updateString(const WString& string);
 	};
 
@@ -251,9 +258,14 @@ namespace BansheeEngine
 
 		struct LanguageData
 		{
-			UnorderedMap<WString, LocalizedStringData*> strings;
+			Vector<LocalizedStringData*> strings; // Indexed by string ID, null if not translated
 		};
 	public:
+		/**
+		 * @brief	ID of the empty string identifier, always present in the table.
+		 */
+		static const UINT32 EMPTY_STRING_ID;
+
 		StringTable();
 		~StringTable();
 
@@ -270,6 +282,11 @@ namespace BansheeEngine
 
 		/**
 		 * @brief	Adds or modifies string translation for the specified language.
+		 *
+		 * @note	Modifying a string in the active or the default language increments the table version
+		 *			(see getVersion), regardless of which string was modified. GUIManager responds to a version
+		 *			change by marking every element in every widget dirty, so avoid modifying strings every frame.
+		 *			Use string parameters for dynamically changing values instead.
 		 */
 		void setString(const WString& identifier, Language language, const WString& string);
 
@@ -278,6 +295,25 @@ namespace BansheeEngine
 		 */
 		void removeString(const WString& identifier);
 
+		/**
+		 * @brief	Returns a unique integer ID for the provided string identifier, registering it if it wasn't
+		 *			used before. IDs are never unregistered, so the returned value can be stored and used for
+		 *			retrieving string data without hashing the identifier again.
+		 */
+		UINT32 getStringId(const WString& identifier);
+
+		/**
+		 * @brief	Returns the string identifier a string ID was created from.
+		 */
+		const WString& getIdentifier(UINT32 id) const { return mIdentifiers[id]; }
+
+		/**
+		 * @brief	Returns a value that is incremented whenever a change to the table might modify the value of
+		 *			previously retrieved strings (e.g. active language is changed or a translation is modified).
+		 *			Compare with a previously stored version to find out if strings need to be retrieved again.
+		 */
+		UINT32 getVersion() const { return mVersion; }
+
 		/**
 		 * @brief	Gets a string data for the specified string identifier and currently active language.
 		 *
@@ -303,6 +339,31 @@ namespace BansheeEngine
 		 */
 		LocalizedStringData& getStringData(const WString& identifier, Language language, bool insertIfNonExisting = true);
 
+		/**
+		 * @brief	Gets a string data for the specified string ID and currently active language.
+		 *
+		 * @param	id					String ID returned by getStringId.
+		 * @param	insertIfNonExisting	If true, a new string data for the specified ID will be added to the table
+		 *								if data doesn't already exist. The data will use the identifier as
+		 * 								the translation string.
+		 *
+		 * @return	The string data. Don't store reference to this data as it may get deleted.
+		 */
+		LocalizedStringData& getStringData(UINT32 id, bool insertIfNonExisting = true);
+
+		/**
+		 * @brief	Gets a string data for the specified string ID and language.
+		 *
+		 * @param	id					String ID returned by getStringId.
+		 * @param	language		   	Language.
+		 * @param	insertIfNonExisting	If true, a new string data for the specified ID will be added to the table
+		 *								if data doesn't already exist. The data will use the identifier as
+		 * 								the translation string.
+		 *
+		 * @return	The string data. Don't store reference to this data as it may get deleted.
+		 */
+		LocalizedStringData& getStringData(UINT32 id, Language language, bool insertIfNonExisting = true);
+
 	private:
 		friend class HString;
 
@@ -314,8 +375,21 @@ namespace BansheeEngine
 
 		LanguageData* mAllLanguages;
 
-		UnorderedMap<WString, LocalizedStringData::Common*> mCommonData;
+		UnorderedMap<WString, UINT32> mStringIds;
+		Vector<WString> mIdentifiers;
+		UINT32 mVersion;
 
-		void notifyAllStringsChanged();
+		/**
+		 * @brief	Returns existing string data for the specified ID and language, or null if the string
+		 *			isn't translated to that language.
+		 */
+		LocalizedStringData* findStringData(UINT32 id, Language language) const;
+
+		/**
+		 * @brief	Creates new string data for the specified ID and language, unless it already exists.
+		 *
+		 * @return	Existing or newly created string data.
+		 */
+		LocalizedStringData* createStringData(UINT32 id, Language language, bool& created);
 	};
 }
\ No newline at end of file
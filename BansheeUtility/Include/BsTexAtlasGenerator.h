@@ -39,10 +39,11 @@ namespace BansheeEngine
 		UINT32 width, height;
 	};
 
-	class TexAtlasNode;
-
 	/**
 	 * @brief	Organizes a set of textures into a single larger texture (an atlas) by minimizing empty space.
+	 *
+	 * @note	Elements are packed using TexAtlasMaxRectsPacker. Use the packers directly if you need
+	 *			to add or remove elements incrementally.
 	 */
 	class BS_UTILITY_EXPORT TexAtlasGenerator
 	{
@@ -89,27 +90,8 @@ namespace BansheeEngine
 		 * 			
 		 *			Using "startPage" parameter you may add an offset to the generated page indexes.
 		 *
-		 * @return	Number of pages generated.
+		 * @return	Number of pages generated, or -1 if some element is larger than a page.
 		 */
 		int generatePagesForSize(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage = 0) const;
-
-		/**
-		 * @brief	Finds the largest element without a page that fits within the provided node.
-		 *
-		 * @return	Array index of the found page, or -1 if all textures have a page.
-		 */
-		int addLargestTextureWithoutPageThatFits(Vector<TexAtlasElementDesc>& elements, TexAtlasNode& node) const;
-
-		/**
-		 * @brief	Scan all of the provided elements and find the largest one that still doesn't have a page assigned.
-		 * 			
-		 * @return	Array index of the found page, or -1 if all textures have a page.
-		 */
-		int findLargestTextureWithoutPage(const Vector<TexAtlasElementDesc>& elements) const;
-
-		/**
-		 * @brief	Sorts all the texture elements so that larget elements come first.
-		 */
-		void sortBySize(Vector<TexAtlasElementDesc>& elements) const;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,164 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Incrementally packs rectangles into a single fixed size area. Rectangles
+	 *			can be inserted and removed at any time.
+	 */
+	class BS_UTILITY_EXPORT TexAtlasPacker
+	{
+	public:
+		TexAtlasPacker(UINT32 width, UINT32 height);
+		virtual ~TexAtlasPacker() {}
+
+		/**
+		 * @brief	Attempts to find room for a rectangle of the specified size.
+		 *
+		 * @param	width	Width of the rectangle to insert.
+		 * @param	height	Height of the rectangle to insert.
+		 * @param	x		Output horizontal position of the inserted rectangle.
+		 * @param	y		Output vertical position of the inserted rectangle.
+		 *
+		 * @return	False if there is no room for the rectangle.
+		 */
+		virtual bool insert(UINT32 width, UINT32 height, UINT32& x, UINT32& y) = 0;
+
+		/**
+		 * @brief	Frees the area of a rectangle previously returned from ::insert.
+		 */
+		virtual void remove(UINT32 x, UINT32 y, UINT32 width, UINT32 height) = 0;
+
+		/**
+		 * @brief	Removes all rectangles and changes the size of the packed area.
+		 */
+		virtual void clear(UINT32 width, UINT32 height) = 0;
+
+		/**
+		 * @brief	Returns the width of the packed area.
+		 */
+		UINT32 getWidth() const { return mWidth; }
+
+		/**
+		 * @brief	Returns the height of the packed area.
+		 */
+		UINT32 getHeight() const { return mHeight; }
+
+		/**
+		 * @brief	Returns the ratio of area covered by inserted rectangles, in [0, 1] range.
+		 */
+		float getOccupancy() const;
+
+	protected:
+		UINT32 mWidth;
+		UINT32 mHeight;
+		UINT64 mUsedArea;
+	};
+
+	/**
+	 * @brief	Packs rectangles by keeping track of the top edge ("skyline") of the placed rectangles
+	 *			and placing each new rectangle as low as possible on it. Very fast but wastes space
+	 *			below the skyline.
+	 *
+	 * @note	Removed rectangles are reclaimed only if nothing was placed on top of them.
+	 */
+	class BS_UTILITY_EXPORT TexAtlasSkylinePacker : public TexAtlasPacker
+	{
+		/**
+		 * @brief	Horizontal segment of the skyline.
+		 */
+		struct Segment
+		{
+			UINT32 x, y, width;
+		};
+
+	public:
+		TexAtlasSkylinePacker(UINT32 width, UINT32 height);
+
+		/**
+		 * @copydoc	TexAtlasPacker::insert
+		 */
+		virtual bool insert(UINT32 width, UINT32 height, UINT32& x, UINT32& y);
+
+		/**
+		 * @copydoc	TexAtlasPacker::remove
+		 */
+		virtual void remove(UINT32 x, UINT32 y, UINT32 width, UINT32 height);
+
+		/**
+		 * @copydoc	TexAtlasPacker::clear
+		 */
+		virtual void clear(UINT32 width, UINT32 height);
+
+	private:
+		/**
+		 * @brief	Splits the skyline so a segment starts at the provided position, if it doesn't already.
+		 */
+		void splitAt(UINT32 x);
+
+		/**
+		 * @brief	Merges neighboring segments of the same height.
+		 */
+		void merge();
+
+		Vector<Segment> mSkyline; /**< Sorted by position, covers the entire width. */
+	};
+
+	/**
+	 * @brief	Packs rectangles by keeping a list of maximal free rectangles, and placing each
+	 *			new rectangle in the free rectangle where it leaves the shortest leftover side
+	 *			("best short side fit"). Slower than a skyline but reaches much higher occupancy.
+	 */
+	class BS_UTILITY_EXPORT TexAtlasMaxRectsPacker : public TexAtlasPacker
+	{
+		/**
+		 * @brief	Axis aligned rectangle.
+		 */
+		struct Rect
+		{
+			UINT32 x, y, width, height;
+		};
+
+	public:
+		TexAtlasMaxRectsPacker(UINT32 width, UINT32 height);
+
+		/**
+		 * @copydoc	TexAtlasPacker::insert
+		 */
+		virtual bool insert(UINT32 width, UINT32 height, UINT32& x, UINT32& y);
+
+		/**
+		 * @copydoc	TexAtlasPacker::remove
+		 */
+		virtual void remove(UINT32 x, UINT32 y, UINT32 width, UINT32 height);
+
+		/**
+		 * @copydoc	TexAtlasPacker::clear
+		 */
+		virtual void clear(UINT32 width, UINT32 height);
+
+	private:
+		/**
+		 * @brief	Splits all free rectangles that overlap the provided used rectangle.
+		 */
+		void splitFreeRects(const Rect& usedRect);
+
+		/**
+		 * @brief	Merges free rectangles sharing a whole edge, and removes free rectangles fully
+		 *			contained in other free rectangles.
+		 */
+		void pruneFreeRects();
+
+		/**
+		 * @brief	Checks is rectangle "a" fully contained within rectangle "b".
+		 */
+		static bool isContainedIn(const Rect& a, const Rect& b);
+
+		Vector<Rect> mFreeRects;
+	};
+}
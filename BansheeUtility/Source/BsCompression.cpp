@@ -0,0 +1,174 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsCompression.h"
+
+namespace BansheeEngine
+{
+	// Compressed data is a list of sequences. Each sequence starts with a token byte containing
+	// literal length in the high and match length in the low four bits. A length of 15 means
+	// additional length bytes follow, each adding up to 255. Literals follow the token, and then
+	// a two byte match offset. The last sequence contains only literals.
+	static const UINT32 MIN_MATCH = 4;
+	static const UINT32 MAX_OFFSET = 65535;
+	static const UINT32 HASH_BITS = 12;
+	static const UINT32 HASH_SIZE = 1 << HASH_BITS;
+
+	static UINT32 compression_hash(const UINT8* data)
+	{
+		UINT32 value;
+		memcpy(&value, data, sizeof(value));
+
+		return (value * 2654435761U) >> (32 - HASH_BITS);
+	}
+
+	static UINT8* compression_writeLength(UINT8* dst, UINT32 length)
+	{
+		while (length >= 255)
+		{
+			*dst++ = 255;
+			length -= 255;
+		}
+
+		*dst++ = (UINT8)length;
+		return dst;
+	}
+
+	static bool compression_readLength(const UINT8*& src, const UINT8* srcEnd, UINT32& length)
+	{
+		UINT8 value;
+		do
+		{
+			if (src >= srcEnd)
+				return false;
+
+			value = *src++;
+			length += value;
+		} while (value == 255);
+
+		return true;
+	}
+
+	UINT32 Compression::getMaxCompressedSize(UINT32 srcSize)
+	{
+		return srcSize + srcSize / 255 + 16;
+	}
+
+	UINT32 Compression::compress(const UINT8* src, UINT32 srcSize, UINT8* dst)
+	{
+		UINT32 hashTable[HASH_SIZE]; // Stores position + 1 so zero means empty
+		memset(hashTable, 0, sizeof(hashTable));
+
+		UINT8* output = dst;
+		UINT32 anchor = 0;
+		UINT32 pos = 0;
+
+		while (pos + MIN_MATCH <= srcSize)
+		{
+			UINT32 hash = compression_hash(src + pos);
+			UINT32 candidate = hashTable[hash];
+			hashTable[hash] = pos + 1;
+
+			if (candidate == 0 || (pos - (candidate - 1)) > MAX_OFFSET || memcmp(src + candidate - 1, src + pos, MIN_MATCH) != 0)
+			{
+				pos++;
+				continue;
+			}
+
+			UINT32 matchPos = candidate - 1;
+			UINT32 matchLength = MIN_MATCH;
+			while (pos + matchLength < srcSize && src[matchPos + matchLength] == src[pos + matchLength])
+				matchLength++;
+
+			UINT32 literalLength = pos - anchor;
+			UINT32 encodedMatchLength = matchLength - MIN_MATCH;
+
+			*output++ = (UINT8)((std::min(literalLength, 15U) << 4) | std::min(encodedMatchLength, 15U));
+
+			if (literalLength >= 15)
+				output = compression_writeLength(output, literalLength - 15);
+
+			memcpy(output, src + anchor, literalLength);
+			output += literalLength;
+
+			UINT32 offset = pos - matchPos;
+			*output++ = (UINT8)(offset & 0xFF);
+			*output++ = (UINT8)((offset >> 8) & 0xFF);
+
+			if (encodedMatchLength >= 15)
+				output = compression_writeLength(output, encodedMatchLength - 15);
+
+			pos += matchLength;
+			anchor = pos;
+		}
+
+		UINT32 literalLength = srcSize - anchor;
+		*output++ = (UINT8)(std::min(literalLength, 15U) << 4);
+
+		if (literalLength >= 15)
+			output = compression_writeLength(output, literalLength - 15);
+
+		memcpy(output, src + anchor, literalLength);
+		output += literalLength;
+
+		return (UINT32)(output - dst);
+	}
+
+	bool Compression::decompress(const UINT8* src, UINT32 srcSize, UINT8* dst, UINT32 dstSize)
+	{
+		const UINT8* input = src;
+		const UINT8* inputEnd = src + srcSize;
+		UINT8* output = dst;
+		UINT8* outputEnd = dst + dstSize;
+
+		while (input < inputEnd)
+		{
+			UINT8 token = *input++;
+
+			UINT32 literalLength = token >> 4;
+			if (literalLength == 15)
+			{
+				if (!compression_readLength(input, inputEnd, literalLength))
+					return false;
+			}
+
+			if ((UINT32)(inputEnd - input) < literalLength || (UINT32)(outputEnd - output) < literalLength)
+				return false;
+
+			memcpy(output, input, literalLength);
+			input += literalLength;
+			output += literalLength;
+
+			// Last sequence has no match
+			if (input == inputEnd)
+				break;
+
+			if ((inputEnd - input) < 2)
+				return false;
+
+			UINT32 offset = input[0] | (input[1] << 8);
+			input += 2;
+
+			UINT32 matchLength = token & 0x0F;
+			if (matchLength == 15)
+			{
+				if (!compression_readLength(input, inputEnd, matchLength))
+					return false;
+			}
+
+			matchLength += MIN_MATCH;
+
+			if (offset == 0 || offset > (UINT32)(output - dst) || (UINT32)(outputEnd - output) < matchLength)
+				return false;
+
+			// Source and destination may overlap, so copy byte by byte
+			const UINT8* match = output - offset;
+			for (UINT32 i = 0; i < matchLength; i++)
+				output[i] = match[i];
+
+			output += matchLength;
+		}
+
+		return output == outputEnd;
+	}
+}
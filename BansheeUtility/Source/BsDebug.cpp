@@ -11,49 +11,57 @@
 
 #if BS_PLATFORM == BS_PLATFORM_WIN32 && BS_COMPILER == BS_COMPILER_MSVC
 #include <windows.h>
-
-void logToIDEConsole(const BansheeEngine::String& message)
-{
-	OutputDebugString(message.c_str());
-	OutputDebugString("\n");
-}
-#else
-void logToIDEConsole(const BansheeEngine::String& message)
-{
-	// Do nothing
-}
 #endif
 
 namespace BansheeEngine
 {
+	/**
+	 * @brief	Log sink that outputs entries to the IDE output window, if available.
+	 */
+	class IDEConsoleLogSink : public LogSink
+	{
+	public:
+		/**
+		 * @copydoc	LogSink::write
+		 */
+		virtual void write(const LogEntry& entry)
+		{
+#if BS_PLATFORM == BS_PLATFORM_WIN32 && BS_COMPILER == BS_COMPILER_MSVC
+			OutputDebugString(entry.getMessage().c_str());
+			OutputDebugString("\n");
+#endif
+		}
+	};
+
+	Debug::Debug()
+	{
+		mLog.addSink(bs_shared_ptr<IDEConsoleLogSink>());
+	}
+
 	void Debug::logDebug(const String& msg)
 	{
 		mLog.logMsg(msg, "GlobalDebug");
-		logToIDEConsole(msg);
 	}
 
 	void Debug::logInfo(const String& msg)
 	{
 		mLog.logMsg(msg, "GlobalInfo");
-		logToIDEConsole(msg);
 	}
 
 	void Debug::logWarning(const String& msg)
 	{
 		mLog.logMsg(msg, "GlobalWarning");
-		logToIDEConsole(msg);
 	}
 
 	void Debug::logError(const String& msg)
 	{
-		mLog.logMsg(msg, "GlobalError");
-		logToIDEConsole(msg);
+		// Errors often precede a crash, so make sure they reach the sinks right away
+		mLog.logMsg(msg, "GlobalError", true);
 	}
 
 	void Debug::log(const String& msg, const String& channel)
 	{
 		mLog.logMsg(msg, channel);
-		logToIDEConsole(msg);
 	}
 
 	void Debug::writeAsBMP(UINT8* rawPixels, UINT32 bytesPerPixel, UINT32 width, UINT32 height, const Path& filePath, bool overwrite) const
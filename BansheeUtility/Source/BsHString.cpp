@@ -8,70 +8,64 @@
 namespace BansheeEngine
 {
 	HString::StringData::StringData()
-		:mParameters(nullptr), mIsDirty(true), mStringPtr(nullptr)
+		:mStringId(0), mParameters(nullptr), mNumParameters(0), mStringData(nullptr), mVersion(0), 
+		mIsDirty(true), mStringPtr(nullptr)
 	{ }
 
 	HString::StringData::~StringData()
 	{
-		mUpdateConn.disconnect();
-
 		if(mParameters != nullptr)
-			bs_deleteN(mParameters, mStringData->numParameters);
+			bs_deleteN(mParameters, mNumParameters);
 	}
 
-	void HString::StringData::updateString()
+	void HString::StringData::updateStringData() const
 	{
-		LocalizedStringData* stringData = &StringTable::instance().getStringData(mStringData->commonData->identifier);
+		StringTable& stringTable = StringTable::instance();
 
-		// If common data changed re-apply the connections
-		if(stringData->commonData != mStringData->commonData)
-		{
-			mUpdateConn.disconnect();
-			mUpdateConn = stringData->commonData->onStringDataModified.connect(std::bind(&HString::StringData::updateString, this));
-		}
+		UINT32 version = stringTable.getVersion();
+		if(mVersion == version)
+			return;
 
-		mStringData = stringData;
+		mStringData = &stringTable.getStringData(mStringId);
+		mVersion = version;
 		mIsDirty = true;
-
-		onStringModified();
 	}
 
 	HString::HString()
 	{
-		mData = bs_shared_ptr<StringData>();
-
-		mData->mStringData = &StringTable::instance().getStringData(L"");
-
-		if(mData->mStringData->numParameters > 0)
-			mData->mParameters = bs_newN<WString>(mData->mStringData->numParameters);
-
-		mData->mUpdateConn = mData->mStringData->commonData->onStringDataModified.connect(std::bind(&HString::StringData::updateString, mData.get()));
+		initialize(StringTable::EMPTY_STRING_ID);
 	}
 
 	HString::HString(const WString& identifierString)
 	{
-		mData = bs_shared_ptr<StringData>();
-
-		mData->mStringData = &StringTable::instance().getStringData(identifierString);
+		initialize(StringTable::instance().getStringId(identifierString));
+	}
 
-		if(mData->mStringData->numParameters > 0)
-			mData->mParameters = bs_newN<WString>(mData->mStringData->numParameters);
+	HString::HString(const WString& identifierString, const WString& defaultString)
+	{
+		StringTable::instance().setString(identifierString, StringTable::DEFAULT_LANGUAGE, defaultString);
 
-		mData->mUpdateConn = mData->mStringData->commonData->onStringDataModified.connect(std::bind(&HString::StringData::updateString, mData.get()));
+		initialize(StringTable::instance().getStringId(identifierString));
 	}
 
-	HString::HString(const WString& identifierString, const WString& defaultString)
+	HString::HString(UINT32 stringId)
 	{
-		mData = bs_shared_ptr<StringData>();
+		initialize(stringId);
+	}
 
-		StringTable::instance().setString(identifierString, StringTable::DEFAULT_LANGUAGE, defaultString);
+	void HString::initialize(UINT32 stringId)
+	{
+		StringTable& stringTable = StringTable::instance();
 
-		mData->mStringData = &StringTable::instance().getStringData(identifierString);
+		mData = bs_shared_ptr<StringData>();
 
-		if (mData->mStringData->numParameters > 0)
-			mData->mParameters = bs_newN<WString>(mData->mStringData->numParameters);
+		mData->mStringId = stringId;
+		mData->mStringData = &stringTable.getStringData(stringId);
+		mData->mVersion = stringTable.getVersion();
 
-		mData->mUpdateConn = mData->mStringData->commonData->onStringDataModified.connect(std::bind(&HString::StringData::updateString, mData.get()));
+		mData->mNumParameters = mData->mStringData->numParameters;
+		if(mData->mNumParameters > 0)
+			mData->mParameters = bs_newN<WString>(mData->mNumParameters);
 	}
 
 	HString::HString(const HString& copy)
@@ -91,11 +85,13 @@ namespace BansheeEngine
 
 	const WString& HString::getValue() const
 	{
+		mData->updateStringData();
+
 		if(mData->mIsDirty)
 		{
 			if(mData->mParameters != nullptr)
 			{
-				mData->mStringData->concatenateString(mData->mCachedString, mData->mParameters, mData->mStringData->numParameters);
+				mData->mStringData->concatenateString(mData->mCachedString, mData->mParameters, mData->mNumParameters);
 				mData->mStringPtr = &mData->mCachedString;
 			}
 			else
@@ -109,8 +105,25 @@ namespace BansheeEngine
 		return *mData->mStringPtr; 
 	}
 
+	UINT32 HString::getValue(wchar_t* buffer, UINT32 bufferLength) const
+	{
+		mData->updateStringData();
+
+		return mData->mStringData->concatenateString(buffer, bufferLength, mData->mParameters, mData->mNumParameters);
+	}
+
+	UINT32 HString::getLength() const
+	{
+		mData->updateStringData();
+
+		return mData->mStringData->getLength(mData->mParameters, mData->mNumParameters);
+	}
+
 	void HString::setParameter(UINT32 idx, const WString& value)
 	{
+		if(mData->mParameters[idx] == value)
+			return;
+
 		mData->mParameters[idx] = value;
 
 		mData->mIsDirty = true;
@@ -3,49 +3,363 @@
 //________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
 #include "BsLog.h"
 #include "BsException.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsPath.h"
 
 namespace BansheeEngine
 {
+	/**
+	 * @brief	Single producer, single consumer ring of messages logged by a single thread.
+	 */
+	struct Log::ThreadBuffer
+	{
+		static const UINT32 SIZE = 256; // Must be a power of two
+
+		struct Slot
+		{
+			String message;
+			String channel;
+			UINT64 sequence;
+		};
+
+		ThreadBuffer()
+			:readPos(0), writePos(0), isReleased(false)
+		{ }
+
+		Slot slots[SIZE];
+		std::atomic<UINT32> readPos; // Only written by the consumer
+		std::atomic<UINT32> writePos; // Only written by the owning thread
+		bool isReleased; // Protected by Log::mThreadBuffersMutex
+	};
+
+	const UINT32 Log::WORKER_INTERVAL_MS = 10;
+
+	BS_THREADLOCAL Log::ThreadBuffer* Log::CurrentThreadBuffer = nullptr;
+	BS_THREADLOCAL Log* Log::CurrentThreadBufferOwner = nullptr;
+
 	LogEntry::LogEntry(const String& msg, const String& level)
 		:mMsg(msg), mChannel(level)
 	{ }
 
+	FileLogSink::FileLogSink(const Path& path)
+	{
+		mStream = FileSystem::createAndOpenFile(path);
+	}
+
+	FileLogSink::~FileLogSink()
+	{
+		if(mStream != nullptr)
+			mStream->close();
+	}
+
+	void FileLogSink::write(const LogEntry& entry)
+	{
+		if(mStream == nullptr)
+			return;
+
+		String line = "[" + entry.getChannel() + "] " + entry.getMessage() + "\n";
+		mStream->write(line.data(), line.size());
+	}
+
 	Log::Log()
+		:mNextSequence(0), mMaxEntries(4096), mNumRepeats(0), mHasLastEntry(false), 
+		mWorkerThread(nullptr), mWorkerRunning(false)
 	{
 	}
 
 	Log::~Log()
 	{
-		BS_LOCK_RECURSIVE_MUTEX(mMutex);
+		_stopWorker();
+
+		BS_LOCK_MUTEX(mThreadBuffersMutex);
 
-		for(auto iter = mEntries.begin(); iter != mEntries.end(); ++iter)
-			bs_delete<PoolAlloc>(*iter);
+		for(auto& buffer : mThreadBuffers)
+			bs_delete(buffer);
 	}
 
-	void Log::logMsg(const String& message, const String& level)
+	void Log::logMsg(const String& message, const String& level, bool immediate)
 	{
-		BS_LOCK_RECURSIVE_MUTEX(mMutex);
+		if(!immediate && mWorkerRunning.load(std::memory_order_acquire))
+		{
+			ThreadBuffer* buffer = getThreadBuffer();
+
+			UINT32 writePos = buffer->writePos.load(std::memory_order_relaxed);
+			if((writePos - buffer->readPos.load(std::memory_order_acquire)) < ThreadBuffer::SIZE)
+			{
+				ThreadBuffer::Slot& slot = buffer->slots[writePos & (ThreadBuffer::SIZE - 1)];
+				slot.message = message;
+				slot.channel = level;
+				slot.sequence = mNextSequence.fetch_add(1, std::memory_order_relaxed);
+
+				buffer->writePos.store(writePos + 1, std::memory_order_release);
+				return;
+			}
+
+			// Buffer is full, process the message on this thread rather than dropping it
+		}
 
-		LogEntry* newEntry = bs_new<LogEntry, PoolAlloc>(message, level);
-		mEntries.push_back(newEntry);
+		BS_LOCK_RECURSIVE_MUTEX(mProcessMutex);
 
-		doOnEntryAdded(*newEntry);
+		// Messages already in the buffers were logged first
+		processPending();
+		processEntry(LogEntry(message, level));
+
+		if(immediate)
+		{
+			flushRepeats();
+
+			for(auto& sink : mSinks)
+				sink->flush();
+		}
 	}
 
-	void Log::clear()
+	void Log::flush()
 	{
-		BS_LOCK_RECURSIVE_MUTEX(mMutex);
+		BS_LOCK_RECURSIVE_MUTEX(mProcessMutex);
+
+		processPending();
+		flushRepeats();
 
-		for(auto iter = mEntries.begin(); iter != mEntries.end(); ++iter)
-			bs_delete<PoolAlloc>(*iter);
+		for(auto& sink : mSinks)
+			sink->flush();
+	}
+
+	void Log::clear()
+	{
+		BS_LOCK_RECURSIVE_MUTEX(mProcessMutex);
 
 		mEntries.clear();
 	}
 
 	void Log::saveToFile(const WString& path)
 	{
-		// TODO - Save the log as HTML
-		BS_EXCEPT(NotImplementedException, "Log save to file not yet implemented.");
+		Vector<LogEntry> entries = getEntries();
+
+		Path filePath(path);
+		FileLogSink sink(filePath);
+		for(auto& entry : entries)
+			sink.write(entry);
+	}
+
+	Vector<LogEntry> Log::getEntries() const
+	{
+		BS_LOCK_RECURSIVE_MUTEX(mProcessMutex);
+
+		return Vector<LogEntry>(mEntries.begin(), mEntries.end());
+	}
+
+	void Log::setMaxEntries(UINT32 maxEntries)
+	{
+		BS_LOCK_RECURSIVE_MUTEX(mProcessMutex);
+
+		mMaxEntries = maxEntries;
+		while((UINT32)mEntries.size() > mMaxEntries)
+			mEntries.pop_front();
+	}
+
+	UINT32 Log::getMaxEntries() const
+	{
+		BS_LOCK_RECURSIVE_MUTEX(mProcessMutex);
+
+		return mMaxEntries;
+	}
+
+	void Log::addSink(const LogSinkPtr& sink)
+	{
+		BS_LOCK_RECURSIVE_MUTEX(mProcessMutex);
+
+		mSinks.push_back(sink);
+	}
+
+	void Log::removeSink(const LogSinkPtr& sink)
+	{
+		BS_LOCK_RECURSIVE_MUTEX(mProcessMutex);
+
+		auto iterFind = std::find(mSinks.begin(), mSinks.end(), sink);
+		if(iterFind != mSinks.end())
+			mSinks.erase(iterFind);
+	}
+
+	void Log::_startWorker()
+	{
+		BS_LOCK_MUTEX(mWorkerMutex);
+
+		if(mWorkerThread != nullptr)
+			return;
+
+		mWorkerRunning = true;
+
+		BS_THREAD_CREATE(t, (std::bind(&Log::workerMain, this)));
+		mWorkerThread = t;
+	}
+
+	void Log::_stopWorker()
+	{
+		{
+			BS_LOCK_MUTEX(mWorkerMutex);
+
+			if(mWorkerThread == nullptr)
+				return;
+
+			mWorkerRunning = false;
+			BS_THREAD_NOTIFY_ALL(mWorkerSignal);
+		}
+
+		mWorkerThread->join();
+		BS_THREAD_DESTROY(mWorkerThread);
+		mWorkerThread = nullptr;
+
+		flush();
+	}
+
+	Log::ThreadBuffer* Log::getThreadBuffer()
+	{
+		if(CurrentThreadBufferOwner == this)
+			return CurrentThreadBuffer;
+
+		ThreadBuffer* buffer = bs_new<ThreadBuffer>();
+		{
+			BS_LOCK_MUTEX(mThreadBuffersMutex);
+			mThreadBuffers.push_back(buffer);
+		}
+
+		CurrentThreadBuffer = buffer;
+		CurrentThreadBufferOwner = this;
+
+		return buffer;
+	}
+
+	void Log::_endThread()
+	{
+		if(CurrentThreadBufferOwner != nullptr)
+			CurrentThreadBufferOwner->releaseThreadBuffer(CurrentThreadBuffer);
+
+		CurrentThreadBuffer = nullptr;
+		CurrentThreadBufferOwner = nullptr;
+	}
+
+	void Log::releaseThreadBuffer(ThreadBuffer* buffer)
+	{
+		BS_LOCK_MUTEX(mThreadBuffersMutex);
+		buffer->isReleased = true;
+	}
+
+	void Log::processPending()
+	{
+		struct PendingEntry
+		{
+			LogEntry entry;
+			UINT64 sequence;
+		};
+
+		Vector<PendingEntry> pending;
+		{
+			BS_LOCK_MUTEX(mThreadBuffersMutex);
+
+			for(auto iter = mThreadBuffers.begin(); iter != mThreadBuffers.end();)
+			{
+				ThreadBuffer* buffer = *iter;
+
+				UINT32 readPos = buffer->readPos.load(std::memory_order_relaxed);
+				UINT32 writePos = buffer->writePos.load(std::memory_order_acquire);
+
+				for(; readPos != writePos; readPos++)
+				{
+					ThreadBuffer::Slot& slot = buffer->slots[readPos & (ThreadBuffer::SIZE - 1)];
+
+					PendingEntry pendingEntry;
+					pendingEntry.entry = LogEntry(slot.message, slot.channel);
+					pendingEntry.sequence = slot.sequence;
+					pending.push_back(pendingEntry);
+				}
+
+				buffer->readPos.store(writePos, std::memory_order_release);
+
+				// Owning thread ended, so nothing can be written to the buffer anymore
+				if(buffer->isReleased)
+				{
+					bs_delete(buffer);
+					iter = mThreadBuffers.erase(iter);
+				}
+				else
+					++iter;
+			}
+		}
+
+		if(pending.size() > 1)
+		{
+			std::sort(pending.begin(), pending.end(), 
+				[](const PendingEntry& a, const PendingEntry& b) { return a.sequence < b.sequence; });
+		}
+
+		for(auto& pendingEntry : pending)
+			processEntry(pendingEntry.entry);
+	}
+
+	void Log::processEntry(const LogEntry& entry)
+	{
+		if(mHasLastEntry && entry.getMessage() == mLastEntry.getMessage() && entry.getChannel() == mLastEntry.getChannel())
+		{
+			mNumRepeats++;
+			return;
+		}
+
+		flushRepeats();
+
+		mLastEntry = entry;
+		mHasLastEntry = true;
+
+		outputEntry(entry);
+	}
+
+	void Log::flushRepeats()
+	{
+		if(mNumRepeats == 0)
+			return;
+
+		UINT32 numRepeats = mNumRepeats;
+		mNumRepeats = 0;
+
+		outputEntry(LogEntry("Previous message repeated " + toString(numRepeats) + " more time(s).", mLastEntry.getChannel()));
+	}
+
+	void Log::outputEntry(const LogEntry& entry)
+	{
+		if(mMaxEntries > 0)
+		{
+			if((UINT32)mEntries.size() >= mMaxEntries)
+				mEntries.pop_front();
+
+			mEntries.push_back(entry);
+		}
+
+		for(auto& sink : mSinks)
+			sink->write(entry);
+
+		doOnEntryAdded(entry);
+	}
+
+	void Log::workerMain()
+	{
+		while(true)
+		{
+			{
+				BS_LOCK_MUTEX_NAMED(mWorkerMutex, lock);
+
+				if(!mWorkerRunning)
+					break;
+
+				mWorkerSignal.wait_for(lock, std::chrono::milliseconds(WORKER_INTERVAL_MS));
+			}
+
+			BS_LOCK_RECURSIVE_MUTEX(mProcessMutex);
+			processPending();
+			flushRepeats();
+
+			for(auto& sink : mSinks)
+				sink->flush();
+		}
 	}
 
 	void Log::doOnEntryAdded(const LogEntry& entry)
@@ -7,9 +7,10 @@
 namespace BansheeEngine
 {
 	const Language StringTable::DEFAULT_LANGUAGE = Language::EnglishUS;
+	const UINT32 StringTable::EMPTY_STRING_ID = 0;
 
 	LocalizedStringData::LocalizedStringData()
-		:commonData(nullptr), parameterOffsets(nullptr), numParameters(0)
+		:parameterOffsets(nullptr), numParameters(0), id(0)
 	{
 
 	}
@@ -20,50 +21,69 @@ namespace BansheeEngine
 			bs_deleteN(parameterOffsets, numParameters);
 	}
 
-	void LocalizedStringData::concatenateString(WString& outputString, WString* parameters, UINT32 numParameterValues) const
+	UINT32 LocalizedStringData::getLength(const WString* parameters, UINT32 numParameterValues) const
 	{
+		if(parameters == nullptr)
+			return (UINT32)string.size();
+
 		// A safeguard in case translated strings have different number of parameters
 		UINT32 actualNumParameters = std::min(numParameterValues, numParameters);
-		
-		if(parameters != nullptr)
+
+		UINT32 totalNumChars = 0;
+		UINT32 prevIdx = 0;
+		for(UINT32 i = 0; i < actualNumParameters; i++)
 		{
-			UINT32 totalNumChars = 0;
-			UINT32 prevIdx = 0;
-			for(UINT32 i = 0; i < actualNumParameters; i++)
-			{
-				totalNumChars += (parameterOffsets[i].location - prevIdx) + (UINT32)parameters[parameterOffsets[i].paramIdx].size();;
+			totalNumChars += (parameterOffsets[i].location - prevIdx) + (UINT32)parameters[parameterOffsets[i].paramIdx].size();
 
-				prevIdx = parameterOffsets[i].location;
-			}
+			prevIdx = parameterOffsets[i].location;
+		}
+
+		totalNumChars += (UINT32)string.size() - prevIdx;
 
-			totalNumChars += (UINT32)string.size() - prevIdx;
+		return totalNumChars;
+	}
 
-			outputString.resize(totalNumChars);
-			wchar_t* strData = &outputString[0]; // String contiguity required by C++11, but this should work elsewhere as well
+	UINT32 LocalizedStringData::concatenateString(wchar_t* output, UINT32 outputLength, const WString* parameters, 
+		UINT32 numParameterValues) const
+	{
+		UINT32 numWritten = 0;
+		auto write = [&] (const wchar_t* src, UINT32 numChars)
+		{
+			numChars = std::min(numChars, outputLength - numWritten);
+			if(numChars > 0)
+				memcpy(output + numWritten, src, numChars * sizeof(wchar_t));
 
-			prevIdx = 0;
+			numWritten += numChars;
+		};
+
+		UINT32 prevIdx = 0;
+		if(parameters != nullptr)
+		{
+			UINT32 actualNumParameters = std::min(numParameterValues, numParameters);
 			for(UINT32 i = 0; i < actualNumParameters; i++)
 			{
-				UINT32 strSize = parameterOffsets[i].location - prevIdx;
-				memcpy(strData, &string[prevIdx], strSize * sizeof(wchar_t));
-				strData += strSize;
+				write(string.data() + prevIdx, parameterOffsets[i].location - prevIdx);
 
-				WString& param = parameters[parameterOffsets[i].paramIdx];
-				memcpy(strData, &param[0], param.size() * sizeof(wchar_t));
-				strData += param.size();
+				const WString& param = parameters[parameterOffsets[i].paramIdx];
+				write(param.data(), (UINT32)param.size());
 
 				prevIdx = parameterOffsets[i].location;
 			}
-
-			memcpy(strData, &string[prevIdx], (string.size() - prevIdx) * sizeof(wchar_t));
 		}
-		else
-		{
-			outputString.resize(string.size());
-			wchar_t* strData = &outputString[0]; // String contiguity required by C++11, but this should work elsewhere as well
 
-			memcpy(strData, &string[0], string.size() * sizeof(wchar_t));
-		}
+		write(string.data() + prevIdx, (UINT32)string.size() - prevIdx);
+
+		return numWritten;
+	}
+
+	void LocalizedStringData::concatenateString(WString& outputString, const WString* parameters, UINT32 numParameterValues) const
+	{
+		// Resizing keeps the existing capacity, so rebuilding a string of similar length doesn't allocate
+		UINT32 totalNumChars = getLength(parameters, numParameterValues);
+		outputString.resize(totalNumChars);
+
+		if(totalNumChars > 0)
+			concatenateString(&outputString[0], totalNumChars, parameters, numParameterValues);
 	}
 
 	void LocalizedStringData::updateString(const WString& _string)
@@ -163,27 +183,29 @@ namespace BansheeEngine
 	}
 
 	StringTable::StringTable()
-		:mActiveLanguageData(nullptr), mDefaultLanguageData(nullptr), mAllLanguages(nullptr)
+		:mActiveLanguageData(nullptr), mDefaultLanguageData(nullptr), mAllLanguages(nullptr), mVersion(0)
 	{
 		mAllLanguages = bs_newN<LanguageData>((UINT32)Language::Count);
 
 		mDefaultLanguageData = &(mAllLanguages[(UINT32)DEFAULT_LANGUAGE]);
 		mActiveLanguageData = mDefaultLanguageData;
 		mActiveLanguage = DEFAULT_LANGUAGE;
+
+		getStringId(L""); // Registers EMPTY_STRING_ID
 	}
 	
 	StringTable::~StringTable()
 	{
 		for(UINT32 i = 0; i < (UINT32)Language::Count; i++)
 		{
-			for(auto& iter : mAllLanguages[i].strings)
-				bs_delete(iter.second);
+			for(auto& stringData : mAllLanguages[i].strings)
+			{
+				if(stringData != nullptr)
+					bs_delete(stringData);
+			}
 		}
 
 		bs_deleteN(mAllLanguages, (UINT32)Language::Count);
-
-		for(auto& common : mCommonData)
-			bs_delete(common.second);
 	}
 
 	void StringTable::setActiveLanguage(Language language)
@@ -194,123 +216,142 @@ namespace BansheeEngine
 		mActiveLanguageData = &(mAllLanguages[(UINT32)language]);
 		mActiveLanguage = language;
 
-		notifyAllStringsChanged();
+		mVersion++;
 	}
 
-	void StringTable::setString(const WString& identifier, Language language, const WString& string)
+	UINT32 StringTable::getStringId(const WString& identifier)
 	{
-		LanguageData* curLanguage = &(mAllLanguages[(UINT32)language]);
+		auto iterFind = mStringIds.find(identifier);
+		if(iterFind != mStringIds.end())
+			return iterFind->second;
 
-		auto iterFind = curLanguage->strings.find(identifier);
+		UINT32 id = (UINT32)mIdentifiers.size();
+		mIdentifiers.push_back(identifier);
+		mStringIds[identifier] = id;
 
-		LocalizedStringData* stringData;
-		if(iterFind == curLanguage->strings.end())
-		{
-			auto iterFindCommon = mCommonData.find(identifier);
+		return id;
+	}
 
-			LocalizedStringData::Common* common = nullptr;
-			if(iterFindCommon == mCommonData.end())
-			{
-				common = bs_new<LocalizedStringData::Common>();
-				common->identifier = identifier;
-				mCommonData[identifier] = common;
-			}
-			else
-				common = iterFindCommon->second;
+	void StringTable::setString(const WString& identifier, Language language, const WString& string)
+	{
+		UINT32 id = getStringId(identifier);
 
-			stringData = bs_new<LocalizedStringData>();
-			curLanguage->strings[identifier] = stringData;
-			stringData->commonData = common;
-		}
-		else
+		bool created = false;
+		LocalizedStringData* stringData = createStringData(id, language, created);
+
+		WString oldString;
+		Vector<LocalizedStringData::ParamOffset> oldParamOffsets;
+		if(!created)
 		{
-			stringData = iterFind->second;
+			oldString = stringData->string;
+			oldParamOffsets.assign(stringData->parameterOffsets, stringData->parameterOffsets + stringData->numParameters);
 		}
 
 		stringData->updateString(string);
 
-		if(mActiveLanguage == language)
+		if(mActiveLanguage != language && DEFAULT_LANGUAGE != language)
+			return;
+
+		// Strings without a translation in the active language are resolved by inserting the default language 
+		// version, so a newly added default language string can't be referenced by any existing strings
+		bool modified;
+		if(created)
+			modified = language != DEFAULT_LANGUAGE;
+		else
 		{
-			if(!stringData->commonData->onStringDataModified.empty())
-				stringData->commonData->onStringDataModified();
+			modified = oldString != stringData->string || oldParamOffsets.size() != stringData->numParameters;
+			for(UINT32 i = 0; !modified && i < stringData->numParameters; i++)
+			{
+				modified = oldParamOffsets[i].paramIdx != stringData->parameterOffsets[i].paramIdx ||
+					oldParamOffsets[i].location != stringData->parameterOffsets[i].location;
+			}
 		}
+
+		if(modified)
+			mVersion++;
 	}
 
 	void StringTable::removeString(const WString& identifier)
 	{
-		// Order of operations is very important here, in case a string that is in use
-		// is removed. In that case we want the string to be marked as modified and it should
-		// call getStringData which will generate a new entry for the string.
-		
-		LocalizedStringData* stringData = nullptr;
+		// The ID stays registered, strings that reference it will be assigned new data the next time
+		// they are retrieved
+		auto iterFind = mStringIds.find(identifier);
+		if(iterFind == mStringIds.end())
+			return;
+
+		UINT32 id = iterFind->second;
 		for(UINT32 i = 0; i < (UINT32)Language::Count; i++)
 		{
-			auto findIter = mAllLanguages[i].strings.find(identifier);
-			if(findIter != mAllLanguages[i].strings.end())
+			Vector<LocalizedStringData*>& strings = mAllLanguages[i].strings;
+			if(id < (UINT32)strings.size() && strings[id] != nullptr)
 			{
-				if(mActiveLanguage == (Language)i)
-					stringData = findIter->second;
-				else
-					bs_delete(findIter->second);
-
-				mAllLanguages[i].strings.erase(findIter);
+				bs_delete(strings[id]);
+				strings[id] = nullptr;
 			}
 		}
 
-		auto findIterCommon = mCommonData.find(identifier);
-
-		LocalizedStringData::Common* common = nullptr;
-		if(findIterCommon != mCommonData.end())
-		{
-			common = findIterCommon->second;
-			mCommonData.erase(findIterCommon);
-
-			if(!common->onStringDataModified.empty())
-				common->onStringDataModified();
-		}
-
-		if(stringData != nullptr)
-			bs_delete(stringData);
-
-		if(common != nullptr)
-			bs_delete(common);
+		mVersion++;
 	}
 
 	LocalizedStringData& StringTable::getStringData(const WString& identifier, bool insertIfNonExisting)
 	{
-		return getStringData(identifier, mActiveLanguage, insertIfNonExisting);
+		return getStringData(getStringId(identifier), mActiveLanguage, insertIfNonExisting);
 	}
 
 	LocalizedStringData& StringTable::getStringData(const WString& identifier, Language language, bool insertIfNonExisting)
 	{
-		LanguageData* curLanguage = &(mAllLanguages[(UINT32)language]);
+		return getStringData(getStringId(identifier), language, insertIfNonExisting);
+	}
 
-		auto iterFind = curLanguage->strings.find(identifier);
-		if(iterFind != curLanguage->strings.end())
-			return *iterFind->second;
+	LocalizedStringData& StringTable::getStringData(UINT32 id, bool insertIfNonExisting)
+	{
+		return getStringData(id, mActiveLanguage, insertIfNonExisting);
+	}
 
-		auto defaultIterFind = mDefaultLanguageData->strings.find(identifier);
-		if(defaultIterFind != mDefaultLanguageData->strings.end())
-			return *defaultIterFind->second;
+	LocalizedStringData& StringTable::getStringData(UINT32 id, Language language, bool insertIfNonExisting)
+	{
+		LocalizedStringData* stringData = findStringData(id, language);
+		if(stringData != nullptr)
+			return *stringData;
 
-		if(insertIfNonExisting)
+		stringData = findStringData(id, DEFAULT_LANGUAGE);
+		if(stringData != nullptr)
+			return *stringData;
+
+		if(insertIfNonExisting && id < (UINT32)mIdentifiers.size())
 		{
-			setString(identifier, DEFAULT_LANGUAGE, identifier);
+			bool created = false;
+			stringData = createStringData(id, DEFAULT_LANGUAGE, created);
+			stringData->updateString(mIdentifiers[id]);
 
-			auto defaultIterFind = mDefaultLanguageData->strings.find(identifier);
-			if(defaultIterFind != mDefaultLanguageData->strings.end())
-				return *defaultIterFind->second;
+			return *stringData;
 		}
 
 		BS_EXCEPT(InvalidParametersException, "There is no string data for the provided identifier.");
 	}
 
-	void StringTable::notifyAllStringsChanged()
+	LocalizedStringData* StringTable::findStringData(UINT32 id, Language language) const
+	{
+		const Vector<LocalizedStringData*>& strings = mAllLanguages[(UINT32)language].strings;
+		if(id < (UINT32)strings.size())
+			return strings[id];
+
+		return nullptr;
+	}
+
+	LocalizedStringData* StringTable::createStringData(UINT32 id, Language language, bool& created)
 	{
-		for(auto& iter : mCommonData)
+		Vector<LocalizedStringData*>& strings = mAllLanguages[(UINT32)language].strings;
+		if(id >= (UINT32)strings.size())
+			strings.resize(id + 1, nullptr);
+
+		created = strings[id] == nullptr;
+		if(created)
 		{
-			if(!iter.second->onStringDataModified.empty())
-				iter.second->onStringDataModified();
+			strings[id] = bs_new<LocalizedStringData>();
+			strings[id]->id = id;
 		}
+
+		return strings[id];
 	}
 }
\ No newline at end of file
@@ -2,102 +2,11 @@
 //_____________________________________ www.banshee-project.com __________________________________________________//
 //________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
 #include "BsTexAtlasGenerator.h"
+#include "BsTexAtlasPacker.h"
 #include "BsDebug.h"
 
 namespace BansheeEngine
 {
-	class TexAtlasNode
-	{
-	public:
-		TexAtlasNode()
-			:x(0), y(0), width(0), height(0), children(nullptr), nodeFull(false)
-		{ }
-
-		TexAtlasNode(UINT32 _x, UINT32 _y, UINT32 _width, UINT32 _height)
-			:x(_x), y(_y), width(_width), height(_height), children(nullptr), nodeFull(false)
-		{ }
-
-		~TexAtlasNode()
-		{
-			if(children != nullptr)
-				bs_deleteN<ScratchAlloc>(children, 2);
-
-			int myVal = *bs_new<int, GenAlloc>();
-			float myVal2 = *bs_new<float, GenAlloc>();
-		}
-
-		UINT32 x, y, width, height;
-		TexAtlasNode* children;
-		bool nodeFull;
-
-		bool insert(TexAtlasElementDesc& element)
-		{
-			float aspect = width / (float)height;
-
-			return insert(element, aspect);
-		}
-
-		bool insert(TexAtlasElementDesc& element, float aspect)
-		{
-			if (children != nullptr)
-			{
-				if (children[0].insert(element))
-					return true;
-
-				return children[1].insert(element);
-			}
-			else
-			{
-				if(nodeFull)
-					return false;
-
-				if (element.input.width > width || element.input.height > height)
-					return false;
-
-				if (element.input.width == width && element.input.height == height)
-				{
-					element.output.x = x;
-					element.output.y = y;
-					nodeFull = true;
-
-					return true;
-				}
-
-				float dw = (float)(width - element.input.width);
-				float dh = (height - element.input.height) * aspect;
-
-				children = bs_newN<TexAtlasNode, ScratchAlloc>(2);
-
-				if (dw > dh)
-				{
-					children[0].x = x;
-					children[0].y = y;
-					children[0].width = element.input.width;
-					children[0].height = height;
-
-					children[1].x = x + element.input.width;
-					children[1].y = y;
-					children[1].width = width - element.input.width;
-					children[1].height = height;
-				}
-				else
-				{
-					children[0].x = x;
-					children[0].y = y;
-					children[0].width = width;
-					children[0].height = element.input.height;
-
-					children[1].x = x;
-					children[1].y = y + element.input.height;
-					children[1].width = width;
-					children[1].height = height - element.input.height;
-				}
-
-				return children[0].insert(element);
-			}
-		}
-	};
-
 	TexAtlasGenerator::TexAtlasGenerator(bool square, UINT32 maxTexWidth, UINT32 maxTexHeight, bool fixedSize)
 		:mSquare(square), mMaxTexWidth(maxTexWidth), mMaxTexHeight(maxTexHeight), mFixedSize(fixedSize)
 	{
@@ -116,7 +25,6 @@ namespace BansheeEngine
 		for(size_t i = 0; i < elements.size(); i++)
 			elements[i].output.page = -1;
 
-		//sortBySize(elements);
 		int numPages = generatePagesForSize(elements, mMaxTexWidth, mMaxTexHeight);
 
 		if(numPages == -1)
@@ -218,119 +126,59 @@ namespace BansheeEngine
 
 	int TexAtlasGenerator::generatePagesForSize(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage) const
 	{
-		if(elements.size() == 0)
-			return 0;
-
-		int currentPage = startPage;
-		int numPages = 0;
-		while (true)
+		// Pack largest elements first. Elements without any area don't need a page.
+		Vector<UINT32> remaining;
+		for(UINT32 i = 0; i < (UINT32)elements.size(); i++)
 		{
-			int largestTexId = findLargestTextureWithoutPage(elements); // Start with the largest available texture
-
-			if (largestTexId == -1) // No more textures, we're done
-				return numPages;
-
-			TexAtlasElementDesc& currentElem = elements[largestTexId];
+			const TexAtlasElementDesc& element = elements[i];
+			if(element.output.page != -1 || element.input.width == 0 || element.input.height == 0)
+				continue;
 
 			// If the texture is larger than the atlas size then it can never fit
-			while (width < currentElem.input.width || height < currentElem.input.height)
+			if(element.input.width > width || element.input.height > height)
 				return -1;
 
-			TexAtlasNode atlasNode(0, 0, width, height);
-			atlasNode.insert(elements[largestTexId]);
-			elements[largestTexId].output.page = currentPage;
-
-			// Now that the first (largest) texture has been added, do the same for every other texture until atlas is full
-			while (true)
-			{
-				int addedTextureId = addLargestTextureWithoutPageThatFits(elements, atlasNode); // Try to add next largest texture
-				if (addedTextureId == -1)
-					break;
-
-				elements[addedTextureId].output.page = currentPage;
-			}
-
-			currentPage++;
-			numPages++;
+			remaining.push_back(i);
 		}
-	}
 
-	int TexAtlasGenerator::addLargestTextureWithoutPageThatFits(Vector<TexAtlasElementDesc>& elements, TexAtlasNode& node) const
-	{
-		UINT32 sizeLimit = std::numeric_limits<UINT32>::max();
-		while (true)
+		std::stable_sort(remaining.begin(), remaining.end(), 
+			[&](UINT32 a, UINT32 b)
 		{
-			UINT32 largestSize = 0;
-			INT32 largestId = -1;
-
-			for (size_t i = 0; i < elements.size(); i++)
-			{
-				if (elements[i].output.page == -1) // Signifies that we haven't processed this node yet
-				{
-					UINT32 size = elements[i].input.width * elements[i].input.height;
-					if (size > largestSize && size < sizeLimit)
-					{
-						largestSize = size;
-						largestId = (INT32)i;
-					}
-				}
-			}
-
-			if (largestId == -1)
-				return -1;
+			const TexAtlasElementDesc& elemA = elements[a];
+			const TexAtlasElementDesc& elemB = elements[b];
 
-			if (node.insert(elements[largestId]))
-				return largestId;
-			else
-				sizeLimit = largestSize;
-		}
-	}
+			UINT32 areaA = elemA.input.width * elemA.input.height;
+			UINT32 areaB = elemB.input.width * elemB.input.height;
 
-	int TexAtlasGenerator::findLargestTextureWithoutPage(const Vector<TexAtlasElementDesc>& elements) const
-	{
-		INT32 largestId = -1;
-		UINT32 largestSize = 0;
+			if(areaA != areaB)
+				return areaA > areaB;
 
-		for (size_t i = 0; i < elements.size(); i++)
-		{
-			if (elements[i].output.page == -1) // Signifies that we haven't processed this node yet
-			{
-				UINT32 size = elements[i].input.width * elements[i].input.height;
-				if (size > largestSize)
-				{
-					largestSize = size;
-					largestId = (INT32)i;
-				}
-			}
-		}
+			return std::max(elemA.input.width, elemA.input.height) > std::max(elemB.input.width, elemB.input.height);
+		});
 
-		return largestId;
-	}
+		TexAtlasMaxRectsPacker packer(width, height);
 
-	void TexAtlasGenerator::sortBySize(Vector<TexAtlasElementDesc>& elements) const
-	{
-		for (size_t i = 0; i < elements.size(); i++)
+		int numPages = 0;
+		Vector<UINT32> notPlaced;
+		while(!remaining.empty())
 		{
-			INT32 largestId = -1;
-			UINT32 largestSize = 0;
+			packer.clear(width, height);
+			notPlaced.clear();
 
-			for (size_t j = i; j < elements.size(); j++)
+			for(auto& elementIdx : remaining)
 			{
-				UINT32 size = elements[j].input.width * elements[j].input.height;
+				TexAtlasElementDesc& element = elements[elementIdx];
 
-				if (size > largestSize)
-				{
-					largestSize = size;
-					largestId = (INT32)j;
-				}
+				if(packer.insert(element.input.width, element.input.height, element.output.x, element.output.y))
+					element.output.page = startPage + numPages;
+				else
+					notPlaced.push_back(elementIdx);
 			}
 
-			if(largestId != -1)
-			{
-				TexAtlasElementDesc temp = elements[i];
-				elements[i] = elements[largestId];
-				elements[largestId] = temp;
-			}
+			remaining.swap(notPlaced);
+			numPages++;
 		}
+
+		return numPages;
 	}
 }
\ No newline at end of file
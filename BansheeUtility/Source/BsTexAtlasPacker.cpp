@@ -0,0 +1,382 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsTexAtlasPacker.h"
+
+namespace BansheeEngine
+{
+	TexAtlasPacker::TexAtlasPacker(UINT32 width, UINT32 height)
+		:mWidth(width), mHeight(height), mUsedArea(0)
+	{ }
+
+	float TexAtlasPacker::getOccupancy() const
+	{
+		UINT64 totalArea = (UINT64)mWidth * mHeight;
+		if(totalArea == 0)
+			return 0.0f;
+
+		return (float)((double)mUsedArea / totalArea);
+	}
+
+	TexAtlasSkylinePacker::TexAtlasSkylinePacker(UINT32 width, UINT32 height)
+		:TexAtlasPacker(width, height)
+	{
+		clear(width, height);
+	}
+
+	bool TexAtlasSkylinePacker::insert(UINT32 width, UINT32 height, UINT32& x, UINT32& y)
+	{
+		x = 0;
+		y = 0;
+
+		if(width == 0 || height == 0)
+			return true;
+
+		if(width > mWidth || height > mHeight)
+			return false;
+
+		// Find the lowest position, preferring the leftmost one on ties
+		UINT32 bestIdx = (UINT32)-1;
+		UINT32 bestY = std::numeric_limits<UINT32>::max();
+		for(UINT32 i = 0; i < (UINT32)mSkyline.size(); i++)
+		{
+			if((mSkyline[i].x + width) > mWidth)
+				break;
+
+			// Rectangle rests on the highest segment it spans
+			UINT32 curY = 0;
+			UINT32 remainingWidth = width;
+			for(UINT32 j = i; remainingWidth > 0; j++)
+			{
+				curY = std::max(curY, mSkyline[j].y);
+
+				if(mSkyline[j].width >= remainingWidth)
+					break;
+
+				remainingWidth -= mSkyline[j].width;
+			}
+
+			if((curY + height) > mHeight)
+				continue;
+
+			if(curY < bestY)
+			{
+				bestY = curY;
+				bestIdx = i;
+			}
+		}
+
+		if(bestIdx == (UINT32)-1)
+			return false;
+
+		x = mSkyline[bestIdx].x;
+		y = bestY;
+
+		splitAt(x + width);
+
+		UINT32 lastIdx = bestIdx;
+		while((mSkyline[lastIdx].x + mSkyline[lastIdx].width) < (x + width))
+			lastIdx++;
+
+		mSkyline.erase(mSkyline.begin() + bestIdx, mSkyline.begin() + lastIdx + 1);
+
+		Segment newSegment;
+		newSegment.x = x;
+		newSegment.y = y + height;
+		newSegment.width = width;
+
+		mSkyline.insert(mSkyline.begin() + bestIdx, newSegment);
+		merge();
+
+		mUsedArea += (UINT64)width * height;
+		return true;
+	}
+
+	void TexAtlasSkylinePacker::remove(UINT32 x, UINT32 y, UINT32 width, UINT32 height)
+	{
+		if(width == 0 || height == 0)
+			return;
+
+		splitAt(x);
+		splitAt(x + width);
+
+		// Only the parts of the skyline formed by the removed rectangle's top edge can be lowered
+		for(auto& segment : mSkyline)
+		{
+			if(segment.x >= x && (segment.x + segment.width) <= (x + width) && segment.y == (y + height))
+				segment.y = y;
+		}
+
+		merge();
+
+		mUsedArea -= std::min(mUsedArea, (UINT64)width * height);
+	}
+
+	void TexAtlasSkylinePacker::clear(UINT32 width, UINT32 height)
+	{
+		mWidth = width;
+		mHeight = height;
+		mUsedArea = 0;
+
+		Segment segment;
+		segment.x = 0;
+		segment.y = 0;
+		segment.width = width;
+
+		mSkyline.clear();
+		mSkyline.push_back(segment);
+	}
+
+	void TexAtlasSkylinePacker::splitAt(UINT32 x)
+	{
+		for(UINT32 i = 0; i < (UINT32)mSkyline.size(); i++)
+		{
+			Segment& segment = mSkyline[i];
+			if(segment.x >= x)
+				return;
+
+			if((segment.x + segment.width) > x)
+			{
+				Segment right;
+				right.x = x;
+				right.y = segment.y;
+				right.width = segment.x + segment.width - x;
+
+				segment.width = x - segment.x;
+				mSkyline.insert(mSkyline.begin() + i + 1, right);
+				return;
+			}
+		}
+	}
+
+	void TexAtlasSkylinePacker::merge()
+	{
+		for(UINT32 i = 1; i < (UINT32)mSkyline.size();)
+		{
+			if(mSkyline[i - 1].y == mSkyline[i].y)
+			{
+				mSkyline[i - 1].width += mSkyline[i].width;
+				mSkyline.erase(mSkyline.begin() + i);
+			}
+			else
+				i++;
+		}
+	}
+
+	TexAtlasMaxRectsPacker::TexAtlasMaxRectsPacker(UINT32 width, UINT32 height)
+		:TexAtlasPacker(width, height)
+	{
+		clear(width, height);
+	}
+
+	bool TexAtlasMaxRectsPacker::insert(UINT32 width, UINT32 height, UINT32& x, UINT32& y)
+	{
+		x = 0;
+		y = 0;
+
+		if(width == 0 || height == 0)
+			return true;
+
+		// Best short side fit, ties broken by the long side
+		INT32 bestIdx = -1;
+		UINT32 bestShortSide = std::numeric_limits<UINT32>::max();
+		UINT32 bestLongSide = std::numeric_limits<UINT32>::max();
+		for(UINT32 i = 0; i < (UINT32)mFreeRects.size(); i++)
+		{
+			const Rect& freeRect = mFreeRects[i];
+			if(freeRect.width < width || freeRect.height < height)
+				continue;
+
+			UINT32 leftoverX = freeRect.width - width;
+			UINT32 leftoverY = freeRect.height - height;
+			UINT32 shortSide = std::min(leftoverX, leftoverY);
+			UINT32 longSide = std::max(leftoverX, leftoverY);
+
+			if(shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide))
+			{
+				bestIdx = (INT32)i;
+				bestShortSide = shortSide;
+				bestLongSide = longSide;
+			}
+		}
+
+		if(bestIdx == -1)
+			return false;
+
+		Rect usedRect;
+		usedRect.x = mFreeRects[bestIdx].x;
+		usedRect.y = mFreeRects[bestIdx].y;
+		usedRect.width = width;
+		usedRect.height = height;
+
+		splitFreeRects(usedRect);
+
+		x = usedRect.x;
+		y = usedRect.y;
+
+		mUsedArea += (UINT64)width * height;
+		return true;
+	}
+
+	void TexAtlasMaxRectsPacker::remove(UINT32 x, UINT32 y, UINT32 width, UINT32 height)
+	{
+		if(width == 0 || height == 0)
+			return;
+
+		Rect freeRect;
+		freeRect.x = x;
+		freeRect.y = y;
+		freeRect.width = width;
+		freeRect.height = height;
+
+		mFreeRects.push_back(freeRect);
+		pruneFreeRects();
+
+		mUsedArea -= std::min(mUsedArea, (UINT64)width * height);
+	}
+
+	void TexAtlasMaxRectsPacker::clear(UINT32 width, UINT32 height)
+	{
+		mWidth = width;
+		mHeight = height;
+		mUsedArea = 0;
+
+		Rect freeRect;
+		freeRect.x = 0;
+		freeRect.y = 0;
+		freeRect.width = width;
+		freeRect.height = height;
+
+		mFreeRects.clear();
+		mFreeRects.push_back(freeRect);
+	}
+
+	void TexAtlasMaxRectsPacker::splitFreeRects(const Rect& usedRect)
+	{
+		UINT32 usedRight = usedRect.x + usedRect.width;
+		UINT32 usedBottom = usedRect.y + usedRect.height;
+
+		// Untouched rectangles stay in front, rectangles created by the split are appended
+		UINT32 numOldRects = 0;
+		Vector<Rect> newRects;
+		for(UINT32 i = 0; i < (UINT32)mFreeRects.size(); i++)
+		{
+			Rect freeRect = mFreeRects[i];
+
+			UINT32 freeRight = freeRect.x + freeRect.width;
+			UINT32 freeBottom = freeRect.y + freeRect.height;
+
+			if(usedRect.x >= freeRight || usedRight <= freeRect.x || usedRect.y >= freeBottom || usedBottom <= freeRect.y)
+			{
+				mFreeRects[numOldRects++] = freeRect;
+				continue;
+			}
+
+			if(usedRect.x > freeRect.x)
+			{
+				Rect left = { freeRect.x, freeRect.y, usedRect.x - freeRect.x, freeRect.height };
+				newRects.push_back(left);
+			}
+
+			if(usedRight < freeRight)
+			{
+				Rect right = { usedRight, freeRect.y, freeRight - usedRight, freeRect.height };
+				newRects.push_back(right);
+			}
+
+			if(usedRect.y > freeRect.y)
+			{
+				Rect top = { freeRect.x, freeRect.y, freeRect.width, usedRect.y - freeRect.y };
+				newRects.push_back(top);
+			}
+
+			if(usedBottom < freeBottom)
+			{
+				Rect bottom = { freeRect.x, usedBottom, freeRect.width, freeBottom - usedBottom };
+				newRects.push_back(bottom);
+			}
+		}
+
+		mFreeRects.resize(numOldRects);
+
+		// Old rectangles were maximal before the split, so they can't contain each other and only
+		// need to be compared against the new ones
+		for(UINT32 i = 0; i < (UINT32)newRects.size(); i++)
+		{
+			bool isContained = false;
+			for(UINT32 j = 0; j < numOldRects && !isContained; j++)
+				isContained = isContainedIn(newRects[i], mFreeRects[j]);
+
+			for(UINT32 j = 0; j < (UINT32)newRects.size() && !isContained; j++)
+			{
+				if(i == j)
+					continue;
+
+				// Identical rectangles would remove each other, so keep the first one
+				if(isContainedIn(newRects[i], newRects[j]))
+					isContained = !isContainedIn(newRects[j], newRects[i]) || j < i;
+			}
+
+			if(!isContained)
+				mFreeRects.push_back(newRects[i]);
+		}
+	}
+
+	void TexAtlasMaxRectsPacker::pruneFreeRects()
+	{
+		// Merge rectangles sharing a whole edge, so freed areas can be reused for larger rectangles
+		bool merged = true;
+		while(merged)
+		{
+			merged = false;
+			for(UINT32 i = 0; i < (UINT32)mFreeRects.size() && !merged; i++)
+			{
+				for(UINT32 j = i + 1; j < (UINT32)mFreeRects.size(); j++)
+				{
+					Rect& a = mFreeRects[i];
+					const Rect& b = mFreeRects[j];
+
+					if(a.x == b.x && a.width == b.width && (a.y + a.height == b.y || b.y + b.height == a.y))
+					{
+						a.y = std::min(a.y, b.y);
+						a.height += b.height;
+						merged = true;
+					}
+					else if(a.y == b.y && a.height == b.height && (a.x + a.width == b.x || b.x + b.width == a.x))
+					{
+						a.x = std::min(a.x, b.x);
+						a.width += b.width;
+						merged = true;
+					}
+
+					if(merged)
+					{
+						mFreeRects.erase(mFreeRects.begin() + j);
+						break;
+					}
+				}
+			}
+		}
+
+		for(UINT32 i = 0; i < (UINT32)mFreeRects.size(); i++)
+		{
+			for(UINT32 j = i + 1; j < (UINT32)mFreeRects.size();)
+			{
+				if(isContainedIn(mFreeRects[j], mFreeRects[i]))
+					mFreeRects.erase(mFreeRects.begin() + j);
+				else if(isContainedIn(mFreeRects[i], mFreeRects[j]))
+				{
+					mFreeRects.erase(mFreeRects.begin() + i);
+					j = i + 1;
+				}
+				else
+					j++;
+			}
+		}
+	}
+
+	bool TexAtlasMaxRectsPacker::isContainedIn(const Rect& a, const Rect& b)
+	{
+		return a.x >= b.x && a.y >= b.y && (a.x + a.width) <= (b.x + b.width) && (a.y + a.height) <= (b.y + b.height);
+	}
+}
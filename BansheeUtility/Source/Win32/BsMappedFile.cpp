@@ -0,0 +1,103 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsMappedFile.h"
+#include "BsException.h"
+#include "BsPath.h"
+
+#if !defined(NOMINMAX) && defined(_MSC_VER)
+#	define NOMINMAX // Required to stop windows.h messing up std::min
+#endif
+
+#include <windows.h>
+
+namespace BansheeEngine
+{
+	void win32_handleError(DWORD error, const WString& path);
+
+	MappedFile::MappedFile(const Path& fullPath)
+		:mFileHandle(nullptr), mMappingHandle(nullptr), mData(nullptr), mSize(0), mIsMapped(false)
+	{
+		WString pathStr = fullPath.toWString();
+
+		HANDLE file = CreateFileW(pathStr.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+
+		if (file == INVALID_HANDLE_VALUE)
+			win32_handleError(GetLastError(), pathStr);
+
+		LARGE_INTEGER fileSize;
+		if (GetFileSizeEx(file, &fileSize) == FALSE)
+		{
+			DWORD error = GetLastError();
+			CloseHandle(file);
+			win32_handleError(error, pathStr);
+		}
+
+		mFileHandle = file;
+		mSize = (UINT64)fileSize.QuadPart;
+
+		// Empty files cannot be mapped
+		if (mSize == 0)
+			return;
+
+		HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping != NULL)
+		{
+			mData = (const UINT8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if (mData != nullptr)
+			{
+				mMappingHandle = mapping;
+				mIsMapped = true;
+				return;
+			}
+
+			CloseHandle(mapping);
+		}
+
+		// Mapping can fail if there isn't a large enough free range in the address space, read the file instead
+		if (mSize > (UINT64)std::numeric_limits<size_t>::max())
+		{
+			CloseHandle(file);
+			BS_EXCEPT(IOException, "File at path \"" + toString(pathStr) + "\" can neither be mapped nor read into memory.");
+		}
+
+		UINT8* data = (UINT8*)bs_alloc((size_t)mSize);
+
+		UINT64 offset = 0;
+		while (offset < mSize)
+		{
+			DWORD numBytesToRead = (DWORD)std::min(mSize - offset, (UINT64)0x40000000);
+			DWORD numBytesRead = 0;
+
+			if (ReadFile(file, data + offset, numBytesToRead, &numBytesRead, NULL) == FALSE || numBytesRead == 0)
+			{
+				DWORD error = GetLastError();
+				bs_free(data);
+				CloseHandle(file);
+				win32_handleError(error, pathStr);
+			}
+
+			offset += numBytesRead;
+		}
+
+		mData = data;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (mData != nullptr)
+		{
+			if (mIsMapped)
+				UnmapViewOfFile(mData);
+			else
+				bs_free((void*)mData);
+		}
+
+		if (mMappingHandle != nullptr)
+			CloseHandle((HANDLE)mMappingHandle);
+
+		if (mFileHandle != nullptr)
+			CloseHandle((HANDLE)mFileHandle);
+	}
+}